@@ -145,6 +145,12 @@ void vtkSMPToolsAPI::RefreshNumberOfThread()
   }
 }
 
+//------------------------------------------------------------------------------
+void vtkSMPToolsAPI::SetForObserver(ForObserverType observer)
+{
+  this->ForObserver = observer;
+}
+
 //------------------------------------------------------------------------------
 int vtkSMPToolsAPI::GetEstimatedNumberOfThreads()
 {
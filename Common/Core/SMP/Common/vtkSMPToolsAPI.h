@@ -20,6 +20,7 @@
 #include "vtkNew.h"
 #include "vtkObject.h"
 
+#include <atomic>
 #include <memory>
 
 #include "SMP/Common/vtkSMPToolsImpl.h"
@@ -66,10 +67,21 @@ public:
   //--------------------------------------------------------------------------------
   int GetEstimatedNumberOfThreads();
 
+  //--------------------------------------------------------------------------------
+  // Function called at the beginning (begin is true) and at the end of each
+  // For(), e.g. to profile the parallel regions.
+  using ForObserverType = void (*)(bool begin, vtkIdType first, vtkIdType last, vtkIdType grain);
+  void SetForObserver(ForObserverType observer);
+
   //--------------------------------------------------------------------------------
   template <typename FunctorInternal>
   void For(vtkIdType first, vtkIdType last, vtkIdType grain, FunctorInternal& fi)
   {
+    ForObserverType observer = this->ForObserver.load(std::memory_order_relaxed);
+    if (observer)
+    {
+      observer(true, first, last, grain);
+    }
     switch (this->ActivatedBackend)
     {
       case BackendType::Sequential:
@@ -85,6 +97,10 @@ public:
         this->OpenMPBackend->For(first, last, grain, fi);
         break;
     }
+    if (observer)
+    {
+      observer(false, first, last, grain);
+    }
   }
 
   //--------------------------------------------------------------------------------
@@ -214,6 +230,11 @@ private:
    */
   int DesiredNumberOfThread = 0;
 
+  /**
+   * Function called around each For()
+   */
+  std::atomic<ForObserverType> ForObserver{ nullptr };
+
   /**
    * Sequential backend
    */
@@ -75,6 +75,7 @@ public:
   void SetValue(vtkIdType valueIdx, ValueType value)
     VTK_EXPECTS(0 <= valueIdx && valueIdx < GetNumberOfValues())
   {
+    this->DetachBuffer();
     this->Buffer->GetBuffer()[valueIdx] = value;
   }
 
@@ -99,6 +100,7 @@ public:
     VTK_EXPECTS(0 <= tupleIdx && tupleIdx < GetNumberOfTuples())
   {
     const vtkIdType valueIdx = tupleIdx * this->NumberOfComponents;
+    this->DetachBuffer();
     std::copy(tuple, tuple + this->NumberOfComponents, this->Buffer->GetBuffer() + valueIdx);
   }
   ///@}
@@ -156,8 +158,19 @@ public:
    * Use of this method is discouraged, as newer arrays require a deep-copy of
    * the array data in order to return a suitable pointer. See vtkArrayDispatch
    * for a safer alternative for fast data access.
+   * The non-const pointers may be written through: they give the array its
+   * own memory first if it is shared (see LazyDeepCopy()). Read through the
+   * const overload to keep sharing it.
    */
-  ValueType* GetPointer(vtkIdType valueIdx);
+  ValueType* GetPointer(vtkIdType valueIdx)
+  {
+    this->DetachBuffer();
+    return this->Buffer->GetBuffer() + valueIdx;
+  }
+  const ValueType* GetPointer(vtkIdType valueIdx) const
+  {
+    return this->Buffer->GetBuffer() + valueIdx;
+  }
   void* GetVoidPointer(vtkIdType valueIdx) override;
   ///@}
 
@@ -270,6 +283,42 @@ public:
   bool HasStandardMemoryLayout() const override { return true; }
   void ShallowCopy(vtkDataArray* other) override;
 
+  /**
+   * Share the memory of @a other if it is an array of the same type, and
+   * copy it on the first modification of either array (copy-on-write). Any
+   * other array is deep copied. The arrays sharing a buffer by ShallowCopy()
+   * keep seeing each other's modifications.
+   *
+   * The methods modifying the values and the accessors returning mutable
+   * memory, GetPointer(), GetVoidPointer(), WritePointer(), Begin()/End()
+   * and the mutable iterators of the value and tuple ranges, give the array
+   * its own copy of the memory. The const GetPointer() and const ranges
+   * read the shared memory.
+   */
+  void LazyDeepCopy(vtkAbstractArray* other) override;
+
+  /**
+   * Give the array its own copy of its memory if it is shared by
+   * LazyDeepCopy(), see vtkAbstractArray::Detach().
+   */
+  void Detach() override { this->DetachBuffer(); }
+
+  /**
+   * Return true if the memory of this array is shared with another array by
+   * LazyDeepCopy(), and will be copied on the next modification.
+   */
+  bool IsMemoryShared() const { return this->Buffer->IsShared(); }
+
+  ///@{
+  /**
+   * Reimplemented to give the array its own memory when it keeps its size
+   * while sharing its memory (see LazyDeepCopy()), since the values are
+   * usually written through GetPointer() next.
+   */
+  vtkTypeBool Allocate(vtkIdType size, vtkIdType ext = 1000) override;
+  vtkTypeBool Resize(vtkIdType numTuples) override;
+  ///@}
+
   // Reimplemented for efficiency:
   void InsertTuples(
     vtkIdType dstStart, vtkIdType n, vtkIdType srcStart, vtkAbstractArray* source) override;
@@ -296,6 +345,12 @@ protected:
    */
   bool ReallocateTuples(vtkIdType numTuples);
 
+  /**
+   * Make sure the memory is not shared with another array before it is
+   * modified. This must be called by any method writing to the buffer.
+   */
+  void DetachBuffer() { this->Buffer->Detach(); }
+
   vtkBuffer<ValueType>* Buffer;
 
 private:
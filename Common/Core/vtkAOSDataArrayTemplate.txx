@@ -18,6 +18,7 @@
 #include "vtkAOSDataArrayTemplate.h"
 
 #include "vtkArrayIteratorTemplate.h"
+#include "vtkLookupTable.h"
 
 //-----------------------------------------------------------------------------
 template <class ValueTypeT>
@@ -106,6 +107,7 @@ void vtkAOSDataArrayTemplate<ValueTypeT>::SetTuple(vtkIdType tupleIdx, const flo
   // While std::copy is the obvious choice here, it kills performance on MSVC
   // debugging builds as their STL calls are poorly optimized. Just use a for
   // loop instead.
+  this->DetachBuffer();
   ValueTypeT* data = this->Buffer->GetBuffer() + tupleIdx * this->NumberOfComponents;
   for (int i = 0; i < this->NumberOfComponents; ++i)
   {
@@ -118,6 +120,7 @@ template <class ValueTypeT>
 void vtkAOSDataArrayTemplate<ValueTypeT>::SetTuple(vtkIdType tupleIdx, const double* tuple)
 {
   // See note in SetTuple about std::copy vs for loops on MSVC.
+  this->DetachBuffer();
   ValueTypeT* data = this->Buffer->GetBuffer() + tupleIdx * this->NumberOfComponents;
   for (int i = 0; i < this->NumberOfComponents; ++i)
   {
@@ -133,6 +136,7 @@ void vtkAOSDataArrayTemplate<ValueTypeT>::InsertTuple(vtkIdType tupleIdx, const
   {
     // See note in SetTuple about std::copy vs for loops on MSVC.
     const vtkIdType valueIdx = tupleIdx * this->NumberOfComponents;
+    this->DetachBuffer();
     ValueTypeT* data = this->Buffer->GetBuffer() + valueIdx;
     for (int i = 0; i < this->NumberOfComponents; ++i)
     {
@@ -150,6 +154,7 @@ void vtkAOSDataArrayTemplate<ValueTypeT>::InsertTuple(vtkIdType tupleIdx, const
   {
     // See note in SetTuple about std::copy vs for loops on MSVC.
     const vtkIdType valueIdx = tupleIdx * this->NumberOfComponents;
+    this->DetachBuffer();
     ValueTypeT* data = this->Buffer->GetBuffer() + valueIdx;
     for (int i = 0; i < this->NumberOfComponents; ++i)
     {
@@ -173,6 +178,7 @@ void vtkAOSDataArrayTemplate<ValueTypeT>::InsertComponent(
     }
   }
 
+  this->DetachBuffer();
   this->Buffer->GetBuffer()[newMaxId] = static_cast<ValueTypeT>(value);
   this->MaxId = std::max(newMaxId, this->MaxId);
 }
@@ -192,6 +198,7 @@ vtkIdType vtkAOSDataArrayTemplate<ValueTypeT>::InsertNextTuple(const float* tupl
   }
 
   // See note in SetTuple about std::copy vs for loops on MSVC.
+  this->DetachBuffer();
   ValueTypeT* data = this->Buffer->GetBuffer() + this->MaxId + 1;
   for (int i = 0; i < this->NumberOfComponents; ++i)
   {
@@ -216,6 +223,7 @@ vtkIdType vtkAOSDataArrayTemplate<ValueTypeT>::InsertNextTuple(const double* tup
   }
 
   // See note in SetTuple about std::copy vs for loops on MSVC.
+  this->DetachBuffer();
   ValueTypeT* data = this->Buffer->GetBuffer() + this->MaxId + 1;
   for (int i = 0; i < this->NumberOfComponents; ++i)
   {
@@ -286,6 +294,72 @@ void vtkAOSDataArrayTemplate<ValueTypeT>::ShallowCopy(vtkDataArray* other)
   }
 }
 
+//-----------------------------------------------------------------------------
+template <class ValueTypeT>
+void vtkAOSDataArrayTemplate<ValueTypeT>::LazyDeepCopy(vtkAbstractArray* other)
+{
+  SelfType* o = vtkArrayDownCast<SelfType>(other);
+  if (!o || o == this)
+  {
+    this->DeepCopy(other);
+    return;
+  }
+
+  // Same as vtkDataArray::DeepCopy(), except for the values.
+  this->vtkAbstractArray::DeepCopy(o);
+  this->SetNumberOfComponents(o->NumberOfComponents);
+  if (this->Buffer == o->Buffer)
+  {
+    // This array is a shallow copy of other, it needs its own buffer.
+    this->Buffer->Delete();
+    this->Buffer = vtkBuffer<ValueType>::New();
+  }
+  this->Buffer->ShareMemory(o->Buffer);
+  this->Size = o->Size;
+  this->MaxId = o->MaxId;
+
+  this->SetLookupTable(nullptr);
+  if (o->LookupTable)
+  {
+    this->LookupTable = o->LookupTable->NewInstance();
+    this->LookupTable->DeepCopy(o->LookupTable);
+  }
+  this->DataChanged();
+}
+
+//-----------------------------------------------------------------------------
+template <class ValueTypeT>
+vtkTypeBool vtkAOSDataArrayTemplate<ValueTypeT>::Allocate(vtkIdType size, vtkIdType ext)
+{
+  // The memory is kept when it is large enough, otherwise it is reallocated
+  // without copying the values.
+  if (size > 0 && size <= this->Size)
+  {
+    if (!this->Buffer->Detach())
+    {
+      return 0;
+    }
+  }
+  else if (this->Buffer->IsShared())
+  {
+    this->Buffer->SetBuffer(nullptr, 0);
+    this->Size = 0;
+  }
+  return this->Superclass::Allocate(size, ext);
+}
+
+//-----------------------------------------------------------------------------
+template <class ValueTypeT>
+vtkTypeBool vtkAOSDataArrayTemplate<ValueTypeT>::Resize(vtkIdType numTuples)
+{
+  // Any other size reallocates the memory, shared or not.
+  if (numTuples * this->GetNumberOfComponents() == this->Size && !this->Buffer->Detach())
+  {
+    return 0;
+  }
+  return this->Superclass::Resize(numTuples);
+}
+
 //-----------------------------------------------------------------------------
 template <class ValueTypeT>
 void vtkAOSDataArrayTemplate<ValueTypeT>::InsertTuples(
@@ -338,8 +412,8 @@ void vtkAOSDataArrayTemplate<ValueTypeT>::InsertTuples(
 
   this->MaxId = std::max(this->MaxId, newSize - 1);
 
-  ValueType* srcBegin = other->GetPointer(srcStart * numComps);
-  ValueType* srcEnd = srcBegin + (n * numComps);
+  const ValueType* srcBegin = other->Buffer->GetBuffer() + srcStart * numComps;
+  const ValueType* srcEnd = srcBegin + (n * numComps);
   ValueType* dstBegin = this->GetPointer(dstStart * numComps);
 
   std::copy(srcBegin, srcEnd, dstBegin);
@@ -364,6 +438,7 @@ template <class ValueTypeT>
 void vtkAOSDataArrayTemplate<ValueTypeT>::FillValue(ValueType value)
 {
   std::ptrdiff_t offset = this->MaxId + 1;
+  this->DetachBuffer();
   std::fill(this->Buffer->GetBuffer(), this->Buffer->GetBuffer() + offset, value);
 }
 
@@ -393,6 +468,7 @@ vtkAOSDataArrayTemplate<ValueTypeT>::WritePointer(vtkIdType valueIdx, vtkIdType
   this->MaxId = std::max(this->MaxId, newSize - 1);
 
   this->DataChanged();
+  this->DetachBuffer();
   return this->GetPointer(valueIdx);
 }
 
@@ -403,14 +479,6 @@ void* vtkAOSDataArrayTemplate<ValueTypeT>::WriteVoidPointer(vtkIdType valueIdx,
   return this->WritePointer(valueIdx, numValues);
 }
 
-//-----------------------------------------------------------------------------
-template <class ValueTypeT>
-typename vtkAOSDataArrayTemplate<ValueTypeT>::ValueType*
-vtkAOSDataArrayTemplate<ValueTypeT>::GetPointer(vtkIdType valueIdx)
-{
-  return this->Buffer->GetBuffer() + valueIdx;
-}
-
 //-----------------------------------------------------------------------------
 template <class ValueTypeT>
 void* vtkAOSDataArrayTemplate<ValueTypeT>::GetVoidPointer(vtkIdType valueIdx)
@@ -258,6 +258,22 @@ public:
    */
   virtual void DeepCopy(vtkAbstractArray* da);
 
+  /**
+   * Same result as DeepCopy(), but arrays supporting it (vtkAOSDataArrayTemplate
+   * subclasses) share the memory of \a da until either array is modified,
+   * which makes copies that are rarely modified almost free. Other arrays
+   * are deep copied.
+   */
+  virtual void LazyDeepCopy(vtkAbstractArray* da) { this->DeepCopy(da); }
+
+  /**
+   * Give this array its own copy of its memory if it is shared with another
+   * array by LazyDeepCopy(). The methods writing values and the non-const
+   * pointer accessors do so already; call it before handing the memory to
+   * code that caches pointers to it. Does nothing for other arrays.
+   */
+  virtual void Detach() {}
+
   /**
    * Set the tuple at dstTupleIdx in this array to the interpolated tuple value,
    * given the ptIndices in the source array and associated interpolation
@@ -29,6 +29,8 @@
 #include "vtkObjectFactory.h" // New() implementation
 
 #include <algorithm> // for std::min and std::copy
+#include <atomic>    // for SharedOwner
+#include <thread>    // for std::this_thread::yield
 
 template <class ScalarTypeT>
 class vtkBuffer : public vtkObject
@@ -87,10 +89,37 @@ public:
    */
   bool Reallocate(vtkIdType newsize);
 
+  /**
+   * Make this buffer use the memory of @a other, without copying it, until
+   * either buffer is modified. The memory is released when no buffer uses it
+   * anymore. Code writing to the memory must call Detach() first, so that it
+   * does not modify the other buffers. Buffers sharing the memory of a buffer
+   * are not affected by any later change of that buffer's memory.
+   */
+  void ShareMemory(vtkBuffer<ScalarType>* other);
+
+  /**
+   * Return true if the memory of this buffer is also used by another buffer
+   * (see ShareMemory()).
+   */
+  bool IsShared() const
+  {
+    vtkBuffer<ScalarType>* owner = this->SharedOwner.load(std::memory_order_acquire);
+    return owner && (owner == this || owner->GetReferenceCount() > 1);
+  }
+
+  /**
+   * Give this buffer its own copy of its memory if it is shared with another
+   * buffer, before it is modified. This is safe to call from several threads
+   * writing to this buffer. Returns false if the allocation fails.
+   */
+  bool Detach() { return !this->IsShared() || this->DetachSharedMemory(); }
+
 protected:
   vtkBuffer()
     : Pointer(nullptr)
     , Size(0)
+    , SharedOwner(nullptr)
   {
     this->SetMallocFunction(vtkObjectBase::GetCurrentMallocFunction());
     this->SetReallocFunction(vtkObjectBase::GetCurrentReallocFunction());
@@ -99,12 +128,21 @@ protected:
 
   ~vtkBuffer() override { this->SetBuffer(nullptr, 0); }
 
+  /**
+   * Copy the shared memory into memory owned by this buffer.
+   */
+  bool DetachSharedMemory();
+
   ScalarType* Pointer;
   vtkIdType Size;
   vtkMallocingFunction MallocFunction;
   vtkReallocingFunction ReallocFunction;
   vtkFreeingFunction DeleteFunction;
 
+  // Buffer owning the memory when it is shared by ShareMemory(), nullptr
+  // otherwise. It is set to this buffer while the memory is being detached.
+  std::atomic<vtkBuffer<ScalarType>*> SharedOwner;
+
 private:
   vtkBuffer(const vtkBuffer&) = delete;
   void operator=(const vtkBuffer&) = delete;
@@ -129,7 +167,13 @@ void vtkBuffer<ScalarT>::SetBuffer(typename vtkBuffer<ScalarT>::ScalarType* arra
 {
   if (this->Pointer != array)
   {
-    if (this->DeleteFunction)
+    vtkBuffer<ScalarT>* owner = this->SharedOwner.exchange(nullptr);
+    if (owner)
+    {
+      // The shared memory is released by its owner.
+      owner->UnRegister(nullptr);
+    }
+    else if (this->DeleteFunction)
     {
       this->DeleteFunction(this->Pointer);
     }
@@ -204,7 +248,8 @@ bool vtkBuffer<ScalarT>::Reallocate(vtkIdType newsize)
     return this->Allocate(0);
   }
 
-  if (this->Pointer && this->DeleteFunction != free)
+  // Shared memory is never reallocated in place.
+  if (this->Pointer && (this->DeleteFunction != free || this->SharedOwner.load()))
   {
     ScalarType* newArray;
     if (this->MallocFunction)
@@ -251,5 +296,101 @@ bool vtkBuffer<ScalarT>::Reallocate(vtkIdType newsize)
   return true;
 }
 
+//------------------------------------------------------------------------------
+template <typename ScalarT>
+void vtkBuffer<ScalarT>::ShareMemory(vtkBuffer<ScalarT>* other)
+{
+  if (!other || other == this || (this->Pointer && other->Pointer == this->Pointer))
+  {
+    return;
+  }
+  this->SetBuffer(nullptr, 0);
+  if (!other->Pointer)
+  {
+    return;
+  }
+
+  // The first time the memory of other is shared, its ownership moves to a
+  // new buffer referenced by all the buffers using it. other itself keeps
+  // its values, pointer and size.
+  vtkBuffer<ScalarT>* owner = other->SharedOwner.load(std::memory_order_acquire);
+  while (!owner || owner == other)
+  {
+    if (owner == other)
+    {
+      // other is being detached by another thread
+      std::this_thread::yield();
+      owner = other->SharedOwner.load(std::memory_order_acquire);
+      continue;
+    }
+    vtkBuffer<ScalarT>* newOwner = vtkBuffer<ScalarT>::New();
+    newOwner->Pointer = other->Pointer;
+    newOwner->Size = other->Size;
+    newOwner->DeleteFunction = other->DeleteFunction;
+    if (other->SharedOwner.compare_exchange_strong(owner, newOwner))
+    {
+      owner = newOwner;
+    }
+    else
+    {
+      // Shared concurrently by another buffer, use its owner.
+      newOwner->DeleteFunction = nullptr;
+      newOwner->Delete();
+    }
+  }
+  owner->Register(nullptr);
+  this->Pointer = other->Pointer;
+  this->Size = other->Size;
+  this->SharedOwner.store(owner, std::memory_order_release);
+}
+
+//------------------------------------------------------------------------------
+template <typename ScalarT>
+bool vtkBuffer<ScalarT>::DetachSharedMemory()
+{
+  // Only one of the threads writing to this buffer makes the copy, the others
+  // wait for it.
+  vtkBuffer<ScalarT>* owner = this->SharedOwner.load(std::memory_order_acquire);
+  while (true)
+  {
+    if (owner == this)
+    {
+      std::this_thread::yield();
+      owner = this->SharedOwner.load(std::memory_order_acquire);
+    }
+    else if (!owner || owner->GetReferenceCount() == 1)
+    {
+      // Detached by another thread, or the other buffers released the memory.
+      return true;
+    }
+    else if (this->SharedOwner.compare_exchange_weak(owner, this))
+    {
+      break;
+    }
+  }
+
+  ScalarType* newArray = nullptr;
+  if (this->Size > 0)
+  {
+    const size_t numBytes = this->Size * sizeof(ScalarType);
+    newArray = static_cast<ScalarType*>(
+      this->MallocFunction ? this->MallocFunction(numBytes) : malloc(numBytes));
+    if (!newArray)
+    {
+      this->SharedOwner.store(owner, std::memory_order_release);
+      return false;
+    }
+    std::copy(this->Pointer, this->Pointer + this->Size, newArray);
+    if (!this->MallocFunction)
+    {
+      this->DeleteFunction = free;
+    }
+  }
+  this->Pointer = newArray;
+  this->SharedOwner.store(nullptr, std::memory_order_release);
+  owner->UnRegister(nullptr);
+  return true;
+}
+
 #endif
 // VTK-HeaderTest-Exclude: vtkBuffer.h
@@ -53,7 +53,7 @@ namespace
 template <typename ValueType>
 struct threadedCopyFunctor
 {
-  ValueType* src;
+  const ValueType* src;
   ValueType* dst;
   int nComp;
   void operator()(vtkIdType begin, vtkIdType end) const
@@ -71,16 +71,20 @@ struct DeepCopyWorker
   void operator()(
     vtkAOSDataArrayTemplate<ValueType>* src, vtkAOSDataArrayTemplate<ValueType>* dst) const
   {
+    // Read the source through const pointers, so that it keeps sharing its
+    // memory if it was copied with LazyDeepCopy().
+    const vtkAOSDataArrayTemplate<ValueType>* constSrc = src;
     vtkIdType len = src->GetNumberOfTuples();
     if (len < 1024 * 1024)
     {
       // With less than a megabyte or so threading is likely to hurt performance. so don't
-      std::copy(src->Begin(), src->End(), dst->Begin());
+      std::copy(
+        constSrc->GetPointer(0), constSrc->GetPointer(src->GetNumberOfValues()), dst->Begin());
     }
     else
     {
       threadedCopyFunctor<ValueType> worker;
-      worker.src = src->GetPointer(0);
+      worker.src = constSrc->GetPointer(0);
       worker.dst = dst->GetPointer(0);
       worker.nComp = src->GetNumberOfComponents();
       // High granularity is likely to hurt performance too, so limit calls. 16 is about maximal.
@@ -891,8 +891,8 @@ public:
   TupleRange(ArrayType* arr, TupleIdType beginTuple, TupleIdType endTuple) noexcept
     : Array(arr)
     , NumComps(arr)
-    , BeginTuple(TupleRange::GetTuplePointer(arr, beginTuple))
-    , EndTuple(TupleRange::GetTuplePointer(arr, endTuple))
+    , BeginTuple(beginTuple)
+    , EndTuple(endTuple)
   {
     assert(this->Array);
     assert(beginTuple >= 0 && beginTuple <= endTuple);
@@ -902,10 +902,8 @@ public:
   VTK_ITER_INLINE
   TupleRange GetSubRange(TupleIdType beginTuple = 0, TupleIdType endTuple = -1) const noexcept
   {
-    const TupleIdType curBegin = this->GetTupleId(this->BeginTuple);
-    const TupleIdType realBegin = curBegin + beginTuple;
-    const TupleIdType realEnd =
-      endTuple >= 0 ? curBegin + endTuple : this->GetTupleId(this->EndTuple);
+    const TupleIdType realBegin = this->BeginTuple + beginTuple;
+    const TupleIdType realEnd = endTuple >= 0 ? this->BeginTuple + endTuple : this->EndTuple;
 
     return TupleRange{ this->Array, realBegin, realEnd };
   }
@@ -917,68 +915,85 @@ public:
   ComponentIdType GetTupleSize() const noexcept { return this->NumComps.value; }
 
   VTK_ITER_INLINE
-  TupleIdType GetBeginTupleId() const noexcept { return this->GetTupleId(this->BeginTuple); }
+  TupleIdType GetBeginTupleId() const noexcept { return this->BeginTuple; }
 
   VTK_ITER_INLINE
-  TupleIdType GetEndTupleId() const noexcept { return this->GetTupleId(this->EndTuple); }
+  TupleIdType GetEndTupleId() const noexcept { return this->EndTuple; }
 
   VTK_ITER_INLINE
   size_type size() const noexcept
   {
-    return static_cast<size_type>(this->EndTuple - this->BeginTuple) /
-      static_cast<size_type>(this->NumComps.value);
+    return static_cast<size_type>(this->EndTuple - this->BeginTuple);
   }
 
+  // The mutable accessors go through the non-const GetPointer() of the
+  // array, which gives it its own memory if it is shared by LazyDeepCopy().
+  // The pointers are therefore not cached by the range.
   VTK_ITER_INLINE
-  iterator begin() noexcept { return iterator(this->BeginTuple, this->NumComps); }
+  iterator begin() noexcept
+  {
+    return iterator(this->GetTuplePointer(this->BeginTuple), this->NumComps);
+  }
 
   VTK_ITER_INLINE
-  iterator end() noexcept { return iterator(this->EndTuple, this->NumComps); }
+  iterator end() noexcept
+  {
+    return iterator(this->GetTuplePointer(this->EndTuple), this->NumComps);
+  }
 
   VTK_ITER_INLINE
-  const_iterator begin() const noexcept { return const_iterator(this->BeginTuple, this->NumComps); }
+  const_iterator begin() const noexcept
+  {
+    return const_iterator(this->GetConstTuplePointer(this->BeginTuple), this->NumComps);
+  }
 
   VTK_ITER_INLINE
-  const_iterator end() const noexcept { return const_iterator(this->EndTuple, this->NumComps); }
+  const_iterator end() const noexcept
+  {
+    return const_iterator(this->GetConstTuplePointer(this->EndTuple), this->NumComps);
+  }
 
   VTK_ITER_INLINE
   const_iterator cbegin() const noexcept
   {
-    return const_iterator(this->BeginTuple, this->NumComps);
+    return const_iterator(this->GetConstTuplePointer(this->BeginTuple), this->NumComps);
   }
 
   VTK_ITER_INLINE
-  const_iterator cend() const noexcept { return const_iterator(this->EndTuple, this->NumComps); }
+  const_iterator cend() const noexcept
+  {
+    return const_iterator(this->GetConstTuplePointer(this->EndTuple), this->NumComps);
+  }
 
   VTK_ITER_INLINE
   reference operator[](size_type i) noexcept
   {
-    return reference{ this->BeginTuple + i * this->NumComps.value, this->NumComps };
+    return reference{ this->GetTuplePointer(this->BeginTuple + i), this->NumComps };
   }
 
   VTK_ITER_INLINE
   const_reference operator[](size_type i) const noexcept
   {
-    return const_reference{ this->BeginTuple + i * this->NumComps.value, this->NumComps };
+    return const_reference{ this->GetConstTuplePointer(this->BeginTuple + i), this->NumComps };
   }
 
 private:
   VTK_ITER_INLINE
-  ValueType* GetTuplePointer(ArrayType* array, vtkIdType tuple) const noexcept
+  ValueType* GetTuplePointer(TupleIdType tuple) noexcept
   {
-    return array->GetPointer(tuple * this->NumComps.value);
+    return this->Array->GetPointer(tuple * this->NumComps.value);
   }
 
   VTK_ITER_INLINE
-  TupleIdType GetTupleId(const ValueType* ptr) const noexcept
+  const ValueType* GetConstTuplePointer(TupleIdType tuple) const noexcept
   {
-    return static_cast<TupleIdType>((ptr - this->Array->GetPointer(0)) / this->NumComps.value);
+    return static_cast<const ArrayType*>(this->Array)->GetPointer(tuple * this->NumComps.value);
   }
 
   mutable ArrayType* Array{ nullptr };
   NumCompsType NumComps{};
-  ValueType* BeginTuple{ nullptr };
-  ValueType* EndTuple{ nullptr };
+  TupleIdType BeginTuple{ 0 };
+  TupleIdType EndTuple{ 0 };
 };
 
 // Unimplemented, only used inside decltype in SelectTupleRange:
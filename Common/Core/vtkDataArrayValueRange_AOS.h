@@ -80,8 +80,8 @@ public:
   ValueRange(ArrayType* arr, ValueIdType beginValue, ValueIdType endValue) noexcept
     : Array(arr)
     , NumComps(arr)
-    , Begin(arr->GetPointer(beginValue))
-    , End(arr->GetPointer(endValue))
+    , BeginValue(beginValue)
+    , EndValue(endValue)
   {
     assert(this->Array);
     assert(beginValue >= 0 && beginValue <= endValue);
@@ -91,11 +91,8 @@ public:
   VTK_ITER_INLINE
   ValueRange GetSubRange(ValueIdType beginValue = 0, ValueIdType endValue = -1) const noexcept
   {
-    const ValueIdType realBegin =
-      std::distance(this->Array->GetPointer(0), this->Begin) + beginValue;
-    const ValueIdType realEnd = endValue >= 0
-      ? std::distance(this->Array->GetPointer(0), this->Begin) + endValue
-      : std::distance(this->Array->GetPointer(0), this->End);
+    const ValueIdType realBegin = this->BeginValue + beginValue;
+    const ValueIdType realEnd = endValue >= 0 ? this->BeginValue + endValue : this->EndValue;
 
     return ValueRange{ this->Array, realBegin, realEnd };
   }
@@ -107,45 +104,57 @@ public:
   ComponentIdType GetTupleSize() const noexcept { return this->NumComps.value; }
 
   VTK_ITER_INLINE
-  ValueIdType GetBeginValueId() const noexcept
-  {
-    return static_cast<ValueIdType>(this->Begin - this->Array->GetPointer(0));
-  }
+  ValueIdType GetBeginValueId() const noexcept { return this->BeginValue; }
 
   VTK_ITER_INLINE
-  ValueIdType GetEndValueId() const noexcept
-  {
-    return static_cast<ValueIdType>(this->End - this->Array->GetPointer(0));
-  }
+  ValueIdType GetEndValueId() const noexcept { return this->EndValue; }
 
   VTK_ITER_INLINE
-  size_type size() const noexcept { return static_cast<size_type>(this->End - this->Begin); }
+  size_type size() const noexcept
+  {
+    return static_cast<size_type>(this->EndValue - this->BeginValue);
+  }
 
+  // The mutable accessors go through the non-const GetPointer() of the
+  // array, which gives it its own memory if it is shared by LazyDeepCopy().
+  // The pointers are therefore not cached by the range.
   VTK_ITER_INLINE
-  iterator begin() noexcept { return this->Begin; }
+  iterator begin() noexcept { return this->Array->GetPointer(this->BeginValue); }
   VTK_ITER_INLINE
-  iterator end() noexcept { return this->End; }
+  iterator end() noexcept { return this->Array->GetPointer(this->EndValue); }
 
   VTK_ITER_INLINE
-  const_iterator begin() const noexcept { return this->Begin; }
+  const_iterator begin() const noexcept { return this->GetConstPointer(this->BeginValue); }
   VTK_ITER_INLINE
-  const_iterator end() const noexcept { return this->End; }
+  const_iterator end() const noexcept { return this->GetConstPointer(this->EndValue); }
 
   VTK_ITER_INLINE
-  const_iterator cbegin() const noexcept { return this->Begin; }
+  const_iterator cbegin() const noexcept { return this->GetConstPointer(this->BeginValue); }
   VTK_ITER_INLINE
-  const_iterator cend() const noexcept { return this->End; }
+  const_iterator cend() const noexcept { return this->GetConstPointer(this->EndValue); }
 
   VTK_ITER_INLINE
-  reference operator[](size_type i) noexcept { return this->Begin[i]; }
+  reference operator[](size_type i) noexcept
+  {
+    return *this->Array->GetPointer(this->BeginValue + i);
+  }
   VTK_ITER_INLINE
-  const_reference operator[](size_type i) const noexcept { return this->Begin[i]; }
+  const_reference operator[](size_type i) const noexcept
+  {
+    return *this->GetConstPointer(this->BeginValue + i);
+  }
 
 private:
+  VTK_ITER_INLINE
+  const ValueType* GetConstPointer(ValueIdType valueId) const noexcept
+  {
+    return static_cast<const ArrayType*>(this->Array)->GetPointer(valueId);
+  }
+
   mutable ArrayType* Array{ nullptr };
   NumCompsType NumComps{};
-  ValueType* Begin{ nullptr };
-  ValueType* End{ nullptr };
+  ValueIdType BeginValue{ 0 };
+  ValueIdType EndValue{ 0 };
 };
 
 // Unimplemented, only used inside decltype in SelectValueRange:
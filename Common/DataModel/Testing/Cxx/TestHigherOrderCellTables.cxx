@@ -0,0 +1,163 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestHigherOrderCellTables.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that the linear sub-cells built from the shared vtkHigherOrderCellTables
+// match the nodes of the higher-order cells they approximate.
+
+#include "vtkBezierHexahedron.h"
+#include "vtkBezierQuadrilateral.h"
+#include "vtkDoubleArray.h"
+#include "vtkHigherOrderCellTables.h"
+#include "vtkIdList.h"
+#include "vtkLagrangeHexahedron.h"
+#include "vtkLagrangeQuadrilateral.h"
+#include "vtkLagrangeWedge.h"
+#include "vtkNew.h"
+#include "vtkPoints.h"
+
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+const vtkIdType IdOffset = 1000;
+
+// Place the nodes of the cell at slightly distorted parametric coordinates.
+void InitializeCell(vtkNonLinearCell* cell, vtkIdType npts, vtkDoubleArray* rationalWeights)
+{
+  cell->GetPoints()->SetNumberOfPoints(npts);
+  cell->GetPointIds()->SetNumberOfIds(npts);
+  if (rationalWeights)
+  {
+    rationalWeights->SetNumberOfTuples(npts);
+  }
+  const double* pcoords = cell->GetParametricCoords();
+  for (vtkIdType i = 0; i < npts; ++i)
+  {
+    const double* p = pcoords + 3 * i;
+    cell->GetPoints()->SetPoint(i, p[0] + 0.05 * std::sin(3.0 * p[1] + p[2]),
+      p[1] + 0.05 * std::cos(2.0 * p[0]), p[2] + 0.03 * std::sin(p[0] + p[1]));
+    cell->GetPointIds()->SetId(i, IdOffset + i);
+    if (rationalWeights)
+    {
+      rationalWeights->SetValue(i, 1.0 + 0.1 * (i % 3));
+    }
+  }
+}
+
+// Every point of the triangulation must be the location of the node it refers
+// to: the node itself for interpolatory cells, the projection of the control
+// point on the cell otherwise.
+bool CheckTriangulation(vtkNonLinearCell* cell, int numberOfVertices, bool projected)
+{
+  vtkNew<vtkIdList> ptIds;
+  vtkNew<vtkPoints> pts;
+  cell->Triangulate(0, ptIds, pts);
+  if (ptIds->GetNumberOfIds() == 0 || ptIds->GetNumberOfIds() != pts->GetNumberOfPoints())
+  {
+    std::cerr << cell->GetClassName() << ": empty or inconsistent triangulation." << std::endl;
+    return false;
+  }
+
+  const double* pcoords = cell->GetParametricCoords();
+  std::vector<double> weights(cell->GetNumberOfPoints());
+  for (vtkIdType i = 0; i < ptIds->GetNumberOfIds(); ++i)
+  {
+    const vtkIdType node = ptIds->GetId(i) - IdOffset;
+    if (node < 0 || node >= cell->GetNumberOfPoints())
+    {
+      std::cerr << cell->GetClassName() << ": bad point id " << ptIds->GetId(i) << std::endl;
+      return false;
+    }
+    double expected[3];
+    if (projected && node >= numberOfVertices)
+    {
+      int subId;
+      cell->EvaluateLocation(subId, pcoords + 3 * node, expected, weights.data());
+    }
+    else
+    {
+      cell->GetPoints()->GetPoint(node, expected);
+    }
+    const double* actual = pts->GetPoint(i);
+    for (int j = 0; j < 3; ++j)
+    {
+      if (std::abs(actual[j] - expected[j]) > 1e-6)
+      {
+        std::cerr << cell->GetClassName() << ": node " << node << " is at " << actual[0] << " "
+                  << actual[1] << " " << actual[2] << " instead of " << expected[0] << " "
+                  << expected[1] << " " << expected[2] << std::endl;
+        return false;
+      }
+    }
+  }
+  return true;
+}
+} // anonymous namespace
+
+int TestHigherOrderCellTables(int, char*[])
+{
+  for (int order = 1; order <= 4; ++order)
+  {
+    const vtkIdType nHex = (order + 1) * (order + 1) * (order + 1);
+    const vtkIdType nQuad = (order + 1) * (order + 1);
+
+    vtkNew<vtkLagrangeHexahedron> lagrangeHex;
+    lagrangeHex->SetOrder(order, order, order);
+    InitializeCell(lagrangeHex, nHex, nullptr);
+
+    vtkNew<vtkBezierHexahedron> bezierHex;
+    bezierHex->SetOrder(order, order, order);
+    InitializeCell(bezierHex, nHex, nullptr);
+
+    vtkNew<vtkBezierHexahedron> rationalHex;
+    rationalHex->SetOrder(order, order, order);
+    InitializeCell(rationalHex, nHex, rationalHex->GetRationalWeights());
+
+    vtkNew<vtkLagrangeQuadrilateral> lagrangeQuad;
+    lagrangeQuad->SetOrder(order, order);
+    InitializeCell(lagrangeQuad, nQuad, nullptr);
+
+    vtkNew<vtkBezierQuadrilateral> bezierQuad;
+    bezierQuad->SetOrder(order, order);
+    InitializeCell(bezierQuad, nQuad, bezierQuad->GetRationalWeights());
+
+    vtkNew<vtkLagrangeWedge> lagrangeWedge;
+    lagrangeWedge->SetOrder(order, order, order, (order + 1) * (order + 2) / 2 * (order + 1));
+    InitializeCell(lagrangeWedge, lagrangeWedge->GetOrder(3), nullptr);
+
+    if (!CheckTriangulation(lagrangeHex, 8, false) || !CheckTriangulation(bezierHex, 8, true) ||
+      !CheckTriangulation(rationalHex, 8, true) || !CheckTriangulation(lagrangeQuad, 4, false) ||
+      !CheckTriangulation(bezierQuad, 4, true) || !CheckTriangulation(lagrangeWedge, 6, false))
+    {
+      std::cerr << "Failure at order " << order << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // Cells of the same type and order share their tables.
+  const vtkIdType numberOfTables = vtkHigherOrderCellTables::GetNumberOfTables();
+  vtkNew<vtkBezierHexahedron> other;
+  other->SetOrder(3, 3, 3);
+  InitializeCell(other, 64, nullptr);
+  if (!CheckTriangulation(other, 8, true) ||
+    vtkHigherOrderCellTables::GetNumberOfTables() != numberOfTables)
+  {
+    std::cerr << "Tables are not shared between cells." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
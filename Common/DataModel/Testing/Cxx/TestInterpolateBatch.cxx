@@ -0,0 +1,193 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestInterpolateBatch.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that the batched vtkDataSetAttributes::InterpolatePoints() and
+// InterpolateEdges() match their one point at a time counterparts.
+
+#include "vtkDoubleArray.h"
+#include "vtkIdList.h"
+#include "vtkIntArray.h"
+#include "vtkMinimalStandardRandomSequence.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkSMPTools.h"
+#include "vtkSOADataArrayTemplate.h"
+#include "vtkStringArray.h"
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+const vtkIdType NumInputPoints = 100;
+const vtkIdType NumOutputPoints = 500;
+const int MaxIds = 8;
+
+void MakeInput(vtkPointData* pd)
+{
+  vtkNew<vtkDoubleArray> vectors;
+  vectors->SetName("Vectors");
+  vectors->SetNumberOfComponents(3);
+  vtkNew<vtkIntArray> scalars;
+  scalars->SetName("Scalars");
+  vtkNew<vtkIntArray> labels;
+  labels->SetName("Labels");
+  vtkNew<vtkStringArray> names;
+  names->SetName("Names");
+  // Arrays that are not dispatched by default are rounded and clamped by
+  // vtkDataArray::InterpolateTuple().
+  vtkNew<vtkSOADataArrayTemplate<unsigned char>> bytes;
+  bytes->SetName("Bytes");
+  bytes->SetNumberOfComponents(2);
+  for (vtkIdType i = 0; i < NumInputPoints; ++i)
+  {
+    vectors->InsertNextTuple3(i, 0.5 * i, -0.25 * i);
+    scalars->InsertNextValue(static_cast<int>(10 * i));
+    labels->InsertNextValue(static_cast<int>(i % 7));
+    names->InsertNextValue("point " + std::to_string(i));
+    bytes->InsertNextTuple2((37 * i) % 256, 255 - i);
+  }
+  pd->SetVectors(vectors);
+  pd->SetScalars(scalars);
+  pd->AddArray(labels);
+  pd->AddArray(names);
+  pd->AddArray(bytes);
+}
+
+bool Compare(vtkPointData* expected, vtkPointData* actual, const char* what)
+{
+  if (expected->GetNumberOfArrays() != actual->GetNumberOfArrays())
+  {
+    std::cerr << what << ": wrong number of arrays." << std::endl;
+    return false;
+  }
+  for (int a = 0; a < expected->GetNumberOfArrays(); ++a)
+  {
+    vtkAbstractArray* e = expected->GetAbstractArray(a);
+    vtkAbstractArray* r = actual->GetAbstractArray(e->GetName());
+    if (!r || r->GetNumberOfTuples() != e->GetNumberOfTuples() ||
+      r->GetNumberOfComponents() != e->GetNumberOfComponents())
+    {
+      std::cerr << what << ": array " << e->GetName() << " has the wrong size." << std::endl;
+      return false;
+    }
+    for (vtkIdType v = 0; v < e->GetNumberOfValues(); ++v)
+    {
+      if (e->GetVariantValue(v) != r->GetVariantValue(v))
+      {
+        std::cerr << what << ": array " << e->GetName() << " differs at value " << v << ": "
+                  << r->GetVariantValue(v).ToString() << " instead of "
+                  << e->GetVariantValue(v).ToString() << std::endl;
+        return false;
+      }
+    }
+  }
+  return true;
+}
+} // anonymous namespace
+
+int TestInterpolateBatch(int, char*[])
+{
+  vtkNew<vtkPointData> input;
+  MakeInput(input);
+
+  // Random stencils and edges.
+  vtkNew<vtkMinimalStandardRandomSequence> random;
+  random->SetSeed(1234);
+  auto next = [&](double rangeMin, double rangeMax) {
+    random->Next();
+    return random->GetRangeValue(rangeMin, rangeMax);
+  };
+  std::vector<vtkIdType> offsets(1, 0), ids, edges;
+  std::vector<double> weights, t;
+  for (vtkIdType i = 0; i < NumOutputPoints; ++i)
+  {
+    const int numIds = 1 + static_cast<int>(next(0, MaxIds - 1e-6));
+    double sum = 0.;
+    for (int j = 0; j < numIds; ++j)
+    {
+      ids.push_back(static_cast<vtkIdType>(next(0, NumInputPoints - 1e-6)));
+      weights.push_back(next(0.1, 1.0));
+      sum += weights.back();
+    }
+    for (int j = 0; j < numIds; ++j)
+    {
+      weights[weights.size() - numIds + j] /= sum;
+    }
+    offsets.push_back(static_cast<vtkIdType>(ids.size()));
+
+    edges.push_back(static_cast<vtkIdType>(next(0, NumInputPoints - 1e-6)));
+    edges.push_back(static_cast<vtkIdType>(next(0, NumInputPoints - 1e-6)));
+    t.push_back(next(0., 1.));
+  }
+
+  for (int nearest = 0; nearest < 2; ++nearest)
+  {
+    // The scalars use nearest neighbor interpolation in the second pass.
+    input->SetCopyAttribute(vtkDataSetAttributes::SCALARS, nearest ? 2 : 1,
+      vtkDataSetAttributes::INTERPOLATE);
+
+    // Reference, one point at a time.
+    vtkNew<vtkPointData> pointRef, edgeRef;
+    pointRef->InterpolateAllocate(input);
+    edgeRef->InterpolateAllocate(input);
+    vtkNew<vtkIdList> ptIds;
+    for (vtkIdType i = 0; i < NumOutputPoints; ++i)
+    {
+      ptIds->SetNumberOfIds(offsets[i + 1] - offsets[i]);
+      std::copy(ids.begin() + offsets[i], ids.begin() + offsets[i + 1], ptIds->GetPointer(0));
+      pointRef->InterpolatePoint(input, i, ptIds, weights.data() + offsets[i]);
+      edgeRef->InterpolateEdge(input, i, edges[2 * i], edges[2 * i + 1], t[i]);
+    }
+
+    // Batches of growing destination arrays.
+    vtkNew<vtkPointData> points, edgePoints;
+    points->InterpolateAllocate(input);
+    edgePoints->InterpolateAllocate(input);
+    const vtkIdType batch = 64;
+    for (vtkIdType start = 0; start < NumOutputPoints; start += batch)
+    {
+      const vtkIdType num = std::min(batch, NumOutputPoints - start);
+      points->InterpolatePoints(
+        input, start, num, offsets.data() + start, ids.data(), weights.data());
+      edgePoints->InterpolateEdges(input, start, num, edges.data() + 2 * start, t.data() + start);
+    }
+    if (!Compare(pointRef, points, "InterpolatePoints") ||
+      !Compare(edgeRef, edgePoints, "InterpolateEdges"))
+    {
+      return EXIT_FAILURE;
+    }
+
+    // Concurrent batches in preallocated destination arrays.
+    vtkNew<vtkPointData> smpPoints, smpEdgePoints;
+    smpPoints->InterpolateAllocate(input);
+    smpPoints->SetNumberOfTuples(NumOutputPoints);
+    smpEdgePoints->InterpolateAllocate(input);
+    smpEdgePoints->SetNumberOfTuples(NumOutputPoints);
+    vtkSMPTools::For(0, NumOutputPoints, 16, [&](vtkIdType begin, vtkIdType end) {
+      smpPoints->InterpolatePoints(
+        input, begin, end - begin, offsets.data() + begin, ids.data(), weights.data());
+      smpEdgePoints->InterpolateEdges(
+        input, begin, end - begin, edges.data() + 2 * begin, t.data() + begin);
+    });
+    if (!Compare(pointRef, smpPoints, "Concurrent InterpolatePoints") ||
+      !Compare(edgeRef, smpEdgePoints, "Concurrent InterpolateEdges"))
+    {
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,64 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestInterpolateNearestNeighbor.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that nearest neighbor interpolation picks the point with the
+// largest weight, one point at a time and in batches.
+
+#include "vtkIdList.h"
+#include "vtkIntArray.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+
+#include <algorithm>
+#include <iostream>
+
+int TestInterpolateNearestNeighbor(int, char*[])
+{
+  vtkNew<vtkIntArray> labels;
+  labels->SetName("Labels");
+  for (int i = 0; i < 4; ++i)
+  {
+    labels->InsertNextValue(10 * i);
+  }
+  vtkNew<vtkPointData> input;
+  input->SetScalars(labels);
+  input->SetCopyAttribute(vtkDataSetAttributes::SCALARS, 2, vtkDataSetAttributes::INTERPOLATE);
+
+  // The largest weight is neither the first nor the last positive one, and
+  // all the weights are below one.
+  const vtkIdType ids[] = { 0, 1, 2, 3 };
+  const double weights[] = { 0.2, 0.5, 0.25, 0.05 };
+  const vtkIdType offsets[] = { 0, 4 };
+  vtkNew<vtkIdList> ptIds;
+  ptIds->SetNumberOfIds(4);
+  std::copy(ids, ids + 4, ptIds->GetPointer(0));
+
+  vtkNew<vtkPointData> output;
+  output->InterpolateAllocate(input);
+  output->InterpolatePoint(input, 0, ptIds, const_cast<double*>(weights));
+  output->InterpolatePoints(input, 1, 1, offsets, ids, weights);
+
+  vtkDataArray* result = output->GetScalars();
+  for (vtkIdType i = 0; i < 2; ++i)
+  {
+    if (result->GetComponent(i, 0) != 10)
+    {
+      std::cerr << "Point " << i << ": expected the value of point 1 (10), got "
+                << result->GetComponent(i, 0) << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
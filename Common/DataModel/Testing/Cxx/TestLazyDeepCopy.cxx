@@ -0,0 +1,249 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestLazyDeepCopy.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that arrays copied with LazyDeepCopy() share their memory until
+// either copy is modified, and then behave like deep copies.
+
+#include "vtkDataArrayRange.h"
+#include "vtkDoubleArray.h"
+#include "vtkFieldData.h"
+#include "vtkFloatArray.h"
+#include "vtkIntArray.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkSMPTools.h"
+
+#include <algorithm>
+#include <iostream>
+#include <string>
+
+#define TEST_ASSERT(cond, msg)                                                                     \
+  do                                                                                               \
+  {                                                                                                \
+    if (!(cond))                                                                                   \
+    {                                                                                              \
+      std::cerr << "Line " << __LINE__ << ": " << msg << std::endl;                                \
+      return EXIT_FAILURE;                                                                         \
+    }                                                                                              \
+  } while (false)
+
+namespace
+{
+void FillArray(vtkDoubleArray* array, vtkIdType numTuples)
+{
+  array->SetNumberOfComponents(2);
+  array->SetNumberOfTuples(numTuples);
+  for (vtkIdType i = 0; i < numTuples; ++i)
+  {
+    array->SetTypedComponent(i, 0, i);
+    array->SetTypedComponent(i, 1, -i);
+  }
+}
+
+bool CheckArray(vtkDoubleArray* array, vtkIdType numTuples)
+{
+  if (array->GetNumberOfTuples() != numTuples || array->GetNumberOfComponents() != 2)
+  {
+    return false;
+  }
+  for (vtkIdType i = 0; i < numTuples; ++i)
+  {
+    if (array->GetTypedComponent(i, 0) != i || array->GetTypedComponent(i, 1) != -i)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+} // anonymous namespace
+
+int TestLazyDeepCopy(int, char*[])
+{
+  const vtkIdType numTuples = 1000;
+
+  // Memory is shared until the copy is modified.
+  vtkNew<vtkDoubleArray> source;
+  source->SetName("Source");
+  FillArray(source, numTuples);
+  vtkNew<vtkDoubleArray> copy;
+  copy->LazyDeepCopy(source);
+  TEST_ASSERT(copy->IsMemoryShared() && source->IsMemoryShared(), "Arrays are not shared.");
+  TEST_ASSERT(CheckArray(copy, numTuples), "Bad copied values.");
+  TEST_ASSERT(std::string(copy->GetName()) == "Source", "Name not copied.");
+  copy->SetValue(0, 42.0);
+  TEST_ASSERT(!copy->IsMemoryShared(), "Copy not detached by SetValue().");
+  TEST_ASSERT(copy->GetValue(0) == 42.0 && source->GetValue(0) == 0.0, "Shared write.");
+  TEST_ASSERT(!source->IsMemoryShared(), "Source still shared after the copy was detached.");
+  source->SetValue(1, 43.0);
+  TEST_ASSERT(copy->GetValue(1) == 0.0, "Shared write.");
+
+  // Writing to the source detaches it as well. Reading const pointers does not.
+  FillArray(source, numTuples);
+  copy->LazyDeepCopy(source);
+  const vtkDoubleArray* constSource = source;
+  const vtkDoubleArray* constCopy = copy;
+  TEST_ASSERT(constSource->GetPointer(0) == constCopy->GetPointer(0) && source->IsMemoryShared(),
+    "Const GetPointer() detached the array.");
+  double* ptr = source->WritePointer(0, 1);
+  ptr[0] = 42.0;
+  TEST_ASSERT(copy->GetValue(0) == 0.0 && CheckArray(copy, numTuples), "Shared WritePointer().");
+  TEST_ASSERT(!copy->IsMemoryShared() && source->GetValue(0) == 42.0, "Bad detached source.");
+
+  // Writing through the mutable pointers of a lazy copy leaves the source
+  // unchanged.
+  FillArray(source, numTuples);
+  copy->LazyDeepCopy(source);
+  std::fill(copy->GetPointer(0), copy->GetPointer(0) + 2 * numTuples, 7.0);
+  TEST_ASSERT(CheckArray(source, numTuples), "Source modified through GetPointer().");
+  TEST_ASSERT(copy->GetValue(1) == 7.0 && !source->IsMemoryShared(), "Bad GetPointer() copy.");
+  copy->LazyDeepCopy(source);
+  static_cast<double*>(copy->GetVoidPointer(0))[0] = 7.0;
+  TEST_ASSERT(CheckArray(source, numTuples), "Source modified through GetVoidPointer().");
+  copy->LazyDeepCopy(source);
+  *copy->Begin() = 7.0;
+  TEST_ASSERT(CheckArray(source, numTuples), "Source modified through Begin().");
+  copy->LazyDeepCopy(source);
+  copy->Detach();
+  TEST_ASSERT(!copy->IsMemoryShared() && !source->IsMemoryShared(), "Detach() kept sharing.");
+
+  // Value and tuple ranges detach on mutable access only.
+  copy->LazyDeepCopy(source);
+  {
+    const auto values = vtk::DataArrayValueRange(copy);
+    const auto tuples = vtk::DataArrayTupleRange<2>(copy);
+    TEST_ASSERT(values[3] == -1.0 && tuples[2][1] == -2.0 && copy->IsMemoryShared(),
+      "Reading a range detached the array.");
+  }
+  {
+    auto values = vtk::DataArrayValueRange(copy);
+    for (auto& value : values)
+    {
+      value = 7.0;
+    }
+    TEST_ASSERT(CheckArray(source, numTuples), "Source modified through a value range.");
+  }
+  copy->LazyDeepCopy(source);
+  {
+    auto tuples = vtk::DataArrayTupleRange<2>(copy);
+    tuples[1][0] = 7.0;
+    TEST_ASSERT(CheckArray(source, numTuples) && copy->GetTypedComponent(1, 0) == 7.0,
+      "Source modified through a tuple range.");
+  }
+
+  // Growing and shrinking keep the values and detach.
+  FillArray(source, numTuples);
+  copy->LazyDeepCopy(source);
+  copy->InsertNextTuple2(numTuples, -numTuples);
+  TEST_ASSERT(CheckArray(copy, numTuples + 1), "Bad values after insertion.");
+  TEST_ASSERT(CheckArray(source, numTuples), "Source modified by insertion.");
+  copy->LazyDeepCopy(source);
+  copy->SetNumberOfTuples(10);
+  TEST_ASSERT(CheckArray(copy, 10) && CheckArray(source, numTuples), "Bad resize.");
+  copy->LazyDeepCopy(source);
+  copy->Initialize();
+  TEST_ASSERT(copy->GetNumberOfTuples() == 0 && CheckArray(source, numTuples), "Bad reset.");
+
+  // Keeping the same size before writing through the pointer detaches.
+  copy->LazyDeepCopy(source);
+  copy->SetNumberOfValues(2 * numTuples);
+  std::fill(copy->GetPointer(0), copy->GetPointer(0) + 2 * numTuples, 7.0);
+  TEST_ASSERT(CheckArray(source, numTuples), "Source modified through SetNumberOfValues().");
+  vtkNew<vtkDoubleArray> other;
+  FillArray(other, numTuples);
+  other->SetValue(0, 42.0);
+  copy->LazyDeepCopy(source);
+  copy->DeepCopy(other);
+  TEST_ASSERT(copy->GetValue(0) == 42.0 && CheckArray(source, numTuples), "Bad DeepCopy().");
+
+  // Reading the source while inserting from it must not detach it.
+  copy->LazyDeepCopy(source);
+  other->Initialize();
+  other->SetNumberOfComponents(2);
+  other->InsertTuples(0, numTuples, 0, source);
+  TEST_ASSERT(source->IsMemoryShared() && CheckArray(other, numTuples), "Bad InsertTuples().");
+
+  // Shallow copies keep seeing each other's modifications.
+  vtkNew<vtkDoubleArray> shallow;
+  shallow->ShallowCopy(copy);
+  shallow->FillValue(7.0);
+  TEST_ASSERT(copy->GetValue(0) == 7.0 && copy->GetValue(1) == 7.0, "Shallow copy detached.");
+  TEST_ASSERT(CheckArray(source, numTuples), "Shared fill.");
+
+  // Arrays shared by shallow copies can be copied lazily too.
+  vtkNew<vtkDoubleArray> plain;
+  FillArray(plain, numTuples);
+  vtkNew<vtkDoubleArray> plainShallow;
+  plainShallow->ShallowCopy(plain);
+  copy->LazyDeepCopy(plain);
+  TEST_ASSERT(copy->IsMemoryShared() && plain->IsMemoryShared(), "Shallow copies not shared.");
+  plainShallow->SetValue(0, 42.0);
+  TEST_ASSERT(copy->GetValue(0) == 0.0 && plain->GetValue(0) == 42.0, "Bad shallow copy.");
+  plainShallow->LazyDeepCopy(plain);
+  TEST_ASSERT(plainShallow->GetValue(0) == 42.0 && plain->GetPointer(0) != copy->GetPointer(0),
+    "Bad lazy copy of a shallow copy.");
+
+  // Arrays of different types are deep copied.
+  vtkNew<vtkFloatArray> floats;
+  floats->LazyDeepCopy(source);
+  TEST_ASSERT(floats->GetNumberOfTuples() == numTuples && floats->GetValue(2) == 1.0f,
+    "Bad copy between types.");
+
+  // Concurrent writes detach the array exactly once.
+  FillArray(source, numTuples);
+  copy->LazyDeepCopy(source);
+  vtkSMPTools::For(0, numTuples, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      copy->SetTypedComponent(i, 1, 2.0 * i);
+    }
+  });
+  TEST_ASSERT(CheckArray(source, numTuples), "Source modified by concurrent writes.");
+  for (vtkIdType i = 0; i < numTuples; ++i)
+  {
+    TEST_ASSERT(copy->GetTypedComponent(i, 0) == i && copy->GetTypedComponent(i, 1) == 2.0 * i,
+      "Concurrent write lost at tuple " << i);
+  }
+
+  // Attributes copied lazily keep their attribute types, and only the
+  // modified arrays get their own memory.
+  vtkNew<vtkPointData> pd;
+  FillArray(source, numTuples);
+  pd->SetTCoords(source);
+  vtkNew<vtkIntArray> ints;
+  ints->SetName("Ints");
+  ints->SetNumberOfValues(numTuples);
+  ints->FillValue(3);
+  pd->SetScalars(ints);
+  vtkNew<vtkPointData> pdCopy;
+  pdCopy->LazyDeepCopy(pd);
+  TEST_ASSERT(pdCopy->GetNumberOfArrays() == 2 && pdCopy->GetTCoords() &&
+      pdCopy->GetScalars() && pdCopy->GetScalars() != ints,
+    "Bad attribute copy.");
+  vtkIntArray* intsCopy = vtkIntArray::SafeDownCast(pdCopy->GetScalars());
+  TEST_ASSERT(intsCopy->IsMemoryShared() && ints->IsMemoryShared(), "Attributes not shared.");
+  intsCopy->SetValue(0, 5);
+  TEST_ASSERT(ints->GetValue(0) == 3 && intsCopy->GetValue(0) == 5, "Shared attribute write.");
+  TEST_ASSERT(vtkDoubleArray::SafeDownCast(pdCopy->GetTCoords())->IsMemoryShared(),
+    "Unmodified attribute was detached.");
+
+  // Field data fall back to a field data copy.
+  vtkNew<vtkFieldData> fd;
+  fd->AddArray(ints);
+  vtkNew<vtkPointData> fdCopy;
+  fdCopy->LazyDeepCopy(fd);
+  TEST_ASSERT(fdCopy->GetNumberOfArrays() == 1 && fdCopy->GetArray("Ints")->GetComponent(1, 0) == 3,
+    "Bad field data copy.");
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,280 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestPolyhedronTopologyCache.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that polyhedra loaded from a vtkPolyhedronTopologyCache behave
+// exactly like polyhedra whose topology is generated on demand.
+
+#include "vtkCellArray.h"
+#include "vtkCellData.h"
+#include "vtkDoubleArray.h"
+#include "vtkGenericCell.h"
+#include "vtkIdList.h"
+#include "vtkMergePoints.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyhedron.h"
+#include "vtkPolyhedronTopologyCache.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+// A row of hexahedra followed by a pentagonal prism, all as polyhedra.
+void MakeGrid(vtkUnstructuredGrid* grid)
+{
+  vtkNew<vtkPoints> points;
+  for (int k = 0; k < 2; ++k)
+  {
+    for (int j = 0; j < 2; ++j)
+    {
+      for (int i = 0; i < 4; ++i)
+      {
+        points->InsertNextPoint(i, j, k);
+      }
+    }
+  }
+  grid->SetPoints(points);
+  grid->Allocate(4);
+
+  auto id = [](int i, int j, int k) -> vtkIdType { return i + 4 * j + 8 * k; };
+  for (int i = 0; i < 3; ++i)
+  {
+    vtkIdType p[8] = { id(i, 0, 0), id(i + 1, 0, 0), id(i + 1, 1, 0), id(i, 1, 0), id(i, 0, 1),
+      id(i + 1, 0, 1), id(i + 1, 1, 1), id(i, 1, 1) };
+    vtkIdType faces[] = { 4, p[0], p[3], p[2], p[1], 4, p[4], p[5], p[6], p[7], 4, p[0], p[1],
+      p[5], p[4], 4, p[1], p[2], p[6], p[5], 4, p[2], p[3], p[7], p[6], 4, p[3], p[0], p[4],
+      p[7] };
+    grid->InsertNextCell(VTK_POLYHEDRON, 8, p, 6, faces);
+  }
+
+  // Pentagonal prism, which has faces that need a polygon triangulation.
+  vtkIdType base = points->GetNumberOfPoints();
+  for (int k = 0; k < 2; ++k)
+  {
+    for (int i = 0; i < 5; ++i)
+    {
+      double angle = 2.0 * 3.14159265358979 * i / 5.0;
+      points->InsertNextPoint(5.0 + std::cos(angle), std::sin(angle), k);
+    }
+  }
+  vtkIdType p[10];
+  for (int i = 0; i < 10; ++i)
+  {
+    p[i] = base + i;
+  }
+  std::vector<vtkIdType> faces = { 5, p[4], p[3], p[2], p[1], p[0], 5, p[5], p[6], p[7], p[8],
+    p[9] };
+  for (int i = 0; i < 5; ++i)
+  {
+    int n = (i + 1) % 5;
+    faces.insert(faces.end(), { 4, p[i], p[n], p[n + 5], p[i + 5] });
+  }
+  grid->InsertNextCell(VTK_POLYHEDRON, 10, p, 7, faces.data());
+
+  vtkNew<vtkDoubleArray> scalars;
+  scalars->SetName("Scalars");
+  for (vtkIdType i = 0; i < points->GetNumberOfPoints(); ++i)
+  {
+    double x[3];
+    points->GetPoint(i, x);
+    scalars->InsertNextValue(x[0] + 0.3 * x[1] + 0.2 * x[2]);
+  }
+  grid->GetPointData()->SetScalars(scalars);
+}
+
+// Gather everything a polyhedron derives from its topology.
+std::vector<double> Summarize(vtkUnstructuredGrid* grid, vtkPolyhedron* cell, vtkIdType cellId)
+{
+  std::vector<double> values;
+  const vtkIdType* ids;
+
+  values.push_back(cell->GetNumberOfFaces());
+  for (int i = 0; i < cell->GetNumberOfFaces(); ++i)
+  {
+    vtkIdType npts = cell->GetFacePoints(i, ids);
+    values.insert(values.end(), ids, ids + npts);
+  }
+  values.push_back(cell->GetNumberOfEdges());
+  for (int i = 0; i < cell->GetNumberOfEdges(); ++i)
+  {
+    cell->GetEdgePoints(i, ids);
+    values.insert(values.end(), ids, ids + 2);
+    cell->GetEdgeToAdjacentFaces(i, ids);
+    values.insert(values.end(), ids, ids + 2);
+  }
+  vtkIdTypeArray* triangles = cell->GetFaceTriangles();
+  for (vtkIdType i = 0; i < triangles->GetNumberOfValues(); ++i)
+  {
+    values.push_back(triangles->GetValue(i));
+  }
+  vtkIdTypeArray* triOffsets = cell->GetFaceTriangleOffsets();
+  for (vtkIdType i = 0; i < triOffsets->GetNumberOfValues(); ++i)
+  {
+    values.push_back(triOffsets->GetValue(i));
+  }
+  double centroid[3];
+  cell->GetCentroid(centroid);
+  values.insert(values.end(), centroid, centroid + 3);
+  values.push_back(cell->IsConvex());
+
+  // Evaluate a point inside the cell.
+  double x[3] = { centroid[0] + 0.1, centroid[1] - 0.05, centroid[2] + 0.02 };
+  double closest[3], pcoords[3], dist2;
+  int subId;
+  std::vector<double> weights(cell->GetNumberOfPoints());
+  values.push_back(cell->EvaluatePosition(x, closest, subId, pcoords, dist2, weights.data()));
+  values.insert(values.end(), weights.begin(), weights.end());
+
+  // Contour through the middle of the cell.
+  vtkNew<vtkPoints> outPoints;
+  vtkNew<vtkMergePoints> locator;
+  double bounds[6];
+  grid->GetBounds(bounds);
+  locator->InitPointInsertion(outPoints, bounds);
+  vtkNew<vtkCellArray> verts, lines, polys;
+  vtkNew<vtkPointData> outPd;
+  outPd->InterpolateAllocate(grid->GetPointData());
+  vtkNew<vtkCellData> outCd;
+  outCd->CopyAllocate(grid->GetCellData());
+  vtkNew<vtkDoubleArray> cellScalars;
+  cellScalars->SetNumberOfTuples(cell->GetNumberOfPoints());
+  grid->GetPointData()->GetScalars()->GetTuples(cell->GetPointIds(), cellScalars);
+  double value = cellScalars->GetRange()[0] * 0.4 + cellScalars->GetRange()[1] * 0.6;
+  cell->Contour(value, cellScalars, locator, verts, lines, polys, grid->GetPointData(), outPd,
+    grid->GetCellData(), cellId, outCd);
+  values.push_back(polys->GetNumberOfCells());
+  for (vtkIdType i = 0; i < outPoints->GetNumberOfPoints(); ++i)
+  {
+    double* pt = outPoints->GetPoint(i);
+    values.insert(values.end(), pt, pt + 3);
+  }
+
+  return values;
+}
+} // anonymous namespace
+
+int TestPolyhedronTopologyCache(int, char*[])
+{
+  vtkNew<vtkUnstructuredGrid> grid;
+  MakeGrid(grid);
+  const vtkIdType numCells = grid->GetNumberOfCells();
+
+  // Reference results, without cache.
+  std::vector<std::vector<double>> expected;
+  vtkNew<vtkGenericCell> cell;
+  for (vtkIdType cellId = 0; cellId < numCells; ++cellId)
+  {
+    grid->GetCell(cellId, cell);
+    expected.push_back(
+      Summarize(grid, vtkPolyhedron::SafeDownCast(cell->GetRepresentativeCell()), cellId));
+  }
+
+  grid->BuildPolyhedronTopologyCache();
+  vtkPolyhedronTopologyCache* cache = grid->GetPolyhedronTopologyCache();
+  if (!cache || cache->GetNumberOfPolyhedra() != numCells || !cache->IsUpToDate(grid))
+  {
+    std::cerr << "Polyhedron topology cache was not built." << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (cache->GetNumberOfFaceTriangles(3) != 3 + 3 + 5 * 2)
+  {
+    std::cerr << "Unexpected number of face triangles: " << cache->GetNumberOfFaceTriangles(3)
+              << std::endl;
+    return EXIT_FAILURE;
+  }
+  const vtkIdType* triOffsets = cache->GetFaceTriangleOffsets(3);
+  const vtkIdType* faces = cache->GetFaces(3);
+  const vtkIdType* face = faces + 1;
+  for (vtkIdType i = 0; i < faces[0]; ++i, face += *face + 1)
+  {
+    if (triOffsets[i + 1] - triOffsets[i] != *face - 2)
+    {
+      std::cerr << "Unexpected number of triangles for face " << i << ": "
+                << triOffsets[i + 1] - triOffsets[i] << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+  if (triOffsets[0] != 0 || triOffsets[faces[0]] != cache->GetNumberOfFaceTriangles(3))
+  {
+    std::cerr << "Face triangle offsets do not cover the face triangles." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Results with the cache must be identical, through both GetCell() methods.
+  for (vtkIdType cellId = 0; cellId < numCells; ++cellId)
+  {
+    grid->GetCell(cellId, cell);
+    if (Summarize(grid, vtkPolyhedron::SafeDownCast(cell->GetRepresentativeCell()), cellId) !=
+      expected[cellId])
+    {
+      std::cerr << "Cached topology differs for cell " << cellId << " (generic cell)."
+                << std::endl;
+      return EXIT_FAILURE;
+    }
+    if (Summarize(grid, vtkPolyhedron::SafeDownCast(grid->GetCell(cellId)), cellId) !=
+      expected[cellId])
+    {
+      std::cerr << "Cached topology differs for cell " << cellId << "." << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // The cache is shared by shallow copies and rebuilt by deep copies.
+  vtkNew<vtkUnstructuredGrid> shallow;
+  shallow->ShallowCopy(grid);
+  vtkNew<vtkUnstructuredGrid> deep;
+  deep->DeepCopy(grid);
+  if (shallow->GetPolyhedronTopologyCache() != cache || !deep->GetPolyhedronTopologyCache() ||
+    !deep->GetPolyhedronTopologyCache()->IsUpToDate(deep))
+  {
+    std::cerr << "Cache not propagated by copies." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Replacing the points invalidates the cache.
+  vtkNew<vtkPoints> points;
+  points->DeepCopy(grid->GetPoints());
+  points->SetPoint(0, -1.0, -1.0, -1.0);
+  shallow->SetPoints(points);
+  if (cache->IsUpToDate(shallow))
+  {
+    std::cerr << "Cache should be out of date once the points are replaced." << std::endl;
+    return EXIT_FAILURE;
+  }
+  double centroid[3];
+  vtkPolyhedron::SafeDownCast(shallow->GetCell(0))->GetCentroid(centroid);
+  if (centroid[0] != 0.375 || centroid[1] != 0.375 || centroid[2] != 0.375)
+  {
+    std::cerr << "Stale centroid: " << centroid[0] << " " << centroid[1] << " " << centroid[2]
+              << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Inserting a cell invalidates the cache as well.
+  vtkIdType npts;
+  const vtkIdType* pts;
+  grid->GetCellPoints(0, npts, pts);
+  deep->InsertNextCell(VTK_HEXAHEDRON, npts, pts);
+  if (deep->GetPolyhedronTopologyCache()->IsUpToDate(deep))
+  {
+    std::cerr << "Cache should be out of date once a cell is inserted." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
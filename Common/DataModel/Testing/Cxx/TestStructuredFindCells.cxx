@@ -0,0 +1,229 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestStructuredFindCells.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that the bulk ComputeStructuredCoordinates() and FindCells() methods
+// of vtkImageData and vtkRectilinearGrid match their single point versions.
+
+#include "vtkDoubleArray.h"
+#include "vtkImageData.h"
+#include "vtkMinimalStandardRandomSequence.h"
+#include "vtkNew.h"
+#include "vtkRectilinearGrid.h"
+
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+// Random points around the bounds of the data set, plus the points of the
+// data set itself and points slightly outside of its bounds.
+std::vector<double> MakePoints(vtkDataSet* ds)
+{
+  vtkNew<vtkMinimalStandardRandomSequence> random;
+  random->SetSeed(42);
+  auto next = [&random](double min, double max) {
+    random->Next();
+    return random->GetRangeValue(min, max);
+  };
+
+  double bounds[6];
+  ds->GetBounds(bounds);
+  std::vector<double> points;
+  for (int i = 0; i < 1000; ++i)
+  {
+    for (int j = 0; j < 3; ++j)
+    {
+      const double margin = 0.2 * (bounds[2 * j + 1] - bounds[2 * j]) + 0.1;
+      points.push_back(next(bounds[2 * j] - margin, bounds[2 * j + 1] + margin));
+    }
+  }
+  for (vtkIdType i = 0; i < ds->GetNumberOfPoints(); ++i)
+  {
+    double x[3];
+    ds->GetPoint(i, x);
+    points.insert(points.end(), x, x + 3);
+    for (int j = 0; j < 3; ++j)
+    {
+      x[j] += (i % 2 ? 1e-7 : -1e-7);
+    }
+    points.insert(points.end(), x, x + 3);
+  }
+  return points;
+}
+
+bool Near(const double* a, const double* b, int n)
+{
+  for (int i = 0; i < n; ++i)
+  {
+    if (std::abs(a[i] - b[i]) > 1e-10)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <typename DataSetT, typename FindCellsT, typename FindCellT>
+bool CheckDataSet(const char* name, DataSetT* ds, FindCellsT findCells, FindCellT findCell)
+{
+  std::vector<double> points = MakePoints(ds);
+  const vtkIdType numPoints = static_cast<vtkIdType>(points.size() / 3);
+
+  // Structured coordinates
+  std::vector<int> ijk(3 * numPoints);
+  std::vector<double> pcoords(3 * numPoints);
+  std::vector<unsigned char> inside(numPoints);
+  vtkIdType numInside =
+    ds->ComputeStructuredCoordinates(numPoints, points.data(), ijk.data(), pcoords.data(),
+      inside.data());
+  vtkIdType expectedInside = 0;
+  for (vtkIdType i = 0; i < numPoints; ++i)
+  {
+    int loc[3];
+    double pc[3];
+    const int in = ds->ComputeStructuredCoordinates(points.data() + 3 * i, loc, pc);
+    expectedInside += in;
+    if (in != inside[i] ||
+      (in &&
+        (loc[0] != ijk[3 * i] || loc[1] != ijk[3 * i + 1] || loc[2] != ijk[3 * i + 2] ||
+          !Near(pc, pcoords.data() + 3 * i, 3))))
+    {
+      std::cerr << name << ": structured coordinates of point " << i << " differ." << std::endl;
+      return false;
+    }
+  }
+  if (numInside != expectedInside)
+  {
+    std::cerr << name << ": " << numInside << " points inside instead of " << expectedInside
+              << std::endl;
+    return false;
+  }
+
+  // Cells, with and without parametric coordinates
+  std::vector<vtkIdType> cellIds(numPoints);
+  std::vector<double> weights(8 * numPoints);
+  vtkIdType numFound = findCells(points.data(), numPoints, cellIds.data(), pcoords.data(),
+    weights.data());
+  std::vector<vtkIdType> cellIds2(numPoints);
+  std::vector<double> weights2(8 * numPoints);
+  if (findCells(points.data(), numPoints, cellIds2.data(), nullptr, weights2.data()) != numFound ||
+    cellIds2 != cellIds)
+  {
+    std::cerr << name << ": FindCells() depends on pcoords." << std::endl;
+    return false;
+  }
+  vtkIdType expectedFound = 0;
+  for (vtkIdType i = 0; i < numPoints; ++i)
+  {
+    double pc[3], w[8];
+    const vtkIdType cellId = findCell(points.data() + 3 * i, pc, w);
+    if (cellId != cellIds[i] ||
+      (cellId >= 0 &&
+        (!Near(pc, pcoords.data() + 3 * i, 3) || !Near(w, weights.data() + 8 * i, 8) ||
+          !Near(w, weights2.data() + 8 * i, 8))))
+    {
+      std::cerr << name << ": cell of point " << i << " is " << cellIds[i] << " instead of "
+                << cellId << " or has different weights." << std::endl;
+      return false;
+    }
+    expectedFound += (cellId >= 0);
+  }
+  if (numFound != expectedFound)
+  {
+    std::cerr << name << ": " << numFound << " points found instead of " << expectedFound
+              << std::endl;
+    return false;
+  }
+  return true;
+}
+
+bool CheckImage(const char* name, int dims[3], const double direction[9])
+{
+  vtkNew<vtkImageData> image;
+  image->SetDimensions(dims);
+  image->SetOrigin(-1.0, 0.5, 2.0);
+  image->SetSpacing(0.5, 0.25, 2.0);
+  if (direction)
+  {
+    image->SetDirectionMatrix(direction);
+  }
+  const double tol2 = 1e-6;
+  return CheckDataSet(
+    name, image.Get(),
+    [&](const double* x, vtkIdType n, vtkIdType* ids, double* pc, double* w) {
+      return image->FindCells(n, x, tol2, ids, pc, w);
+    },
+    [&](const double* x, double* pc, double* w) {
+      int subId;
+      return image->FindCell(const_cast<double*>(x), nullptr, 0, tol2, subId, pc, w);
+    });
+}
+
+bool CheckRectilinearGrid(const char* name, const std::vector<double> coords[3])
+{
+  vtkNew<vtkRectilinearGrid> grid;
+  grid->SetDimensions(static_cast<int>(coords[0].size()), static_cast<int>(coords[1].size()),
+    static_cast<int>(coords[2].size()));
+  vtkNew<vtkDoubleArray> arrays[3];
+  for (int j = 0; j < 3; ++j)
+  {
+    for (double c : coords[j])
+    {
+      arrays[j]->InsertNextValue(c);
+    }
+  }
+  grid->SetXCoordinates(arrays[0]);
+  grid->SetYCoordinates(arrays[1]);
+  grid->SetZCoordinates(arrays[2]);
+  return CheckDataSet(
+    name, grid.Get(),
+    [&](const double* x, vtkIdType n, vtkIdType* ids, double* pc, double* w) {
+      return grid->FindCells(n, x, ids, pc, w);
+    },
+    [&](const double* x, double* pc, double* w) {
+      int subId;
+      return grid->FindCell(const_cast<double*>(x), nullptr, 0, 0.0, subId, pc, w);
+    });
+}
+} // anonymous namespace
+
+int TestStructuredFindCells(int, char*[])
+{
+  const double rotation[9] = { 0.0, -1.0, 0.0, 0.6, 0.0, 0.8, -0.8, 0.0, 0.6 };
+  int volume[3] = { 7, 5, 4 };
+  int plane[3] = { 6, 1, 5 };
+  int line[3] = { 1, 1, 9 };
+  int vertex[3] = { 1, 1, 1 };
+  if (!CheckImage("Volume", volume, nullptr) || !CheckImage("Rotated volume", volume, rotation) ||
+    !CheckImage("Plane", plane, nullptr) || !CheckImage("Rotated plane", plane, rotation) ||
+    !CheckImage("Line", line, nullptr) || !CheckImage("Vertex", vertex, nullptr))
+  {
+    return EXIT_FAILURE;
+  }
+
+  const std::vector<double> increasing[3] = { { 0.0, 0.1, 0.5, 0.6, 2.0, 3.5 },
+    { -1.0, 1.0, 1.5 }, { 0.0, 0.25, 0.5, 0.75 } };
+  const std::vector<double> decreasing[3] = { { 3.0, 2.0, 1.5, 0.0 }, { 1.0, 0.5, 0.1 },
+    { 0.0, 1.0 } };
+  const std::vector<double> flat[3] = { { 0.0, 1.0, 4.0, 9.0 }, { 2.0 }, { -1.0, 0.0 } };
+  if (!CheckRectilinearGrid("Increasing grid", increasing) ||
+    !CheckRectilinearGrid("Decreasing grid", decreasing) ||
+    !CheckRectilinearGrid("Flat grid", flat))
+  {
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -143,18 +143,18 @@ vtkHexahedron* vtkBezierHexahedron::GetApproximateHex(
   {
     scalarsOut->SetNumberOfTuples(8);
   }
-  int i, j, k;
-  if (!this->SubCellCoordinatesFromId(i, j, k, subId))
+  const vtkHigherOrderCellTables::Table* tables = this->GetTables();
+  if (subId < 0 || subId >= tables->NumberOfSubCells)
   {
     vtkErrorMacro("Invalid subId " << subId);
     return nullptr;
   }
   // Get the point coordinates (and optionally scalars) for each of the 8 corners
   // in the approximating hexahedron spanned by (i, i+1) x (j, j+1) x (k, k+1):
+  const vtkIdType* corners = tables->GetSubCellPoints(subId);
   for (vtkIdType ic = 0; ic < 8; ++ic)
   {
-    const vtkIdType corner = this->PointIndexFromIJK(
-      i + ((((ic + 1) / 2) % 2) ? 1 : 0), j + (((ic / 2) % 2) ? 1 : 0), k + ((ic / 4) ? 1 : 0));
+    const vtkIdType corner = corners[ic];
     vtkVector3d cp;
     // Only the first four corners are interpolatory, we need to project the value of the other
     // nodes
@@ -164,13 +164,8 @@ vtkHexahedron* vtkBezierHexahedron::GetApproximateHex(
     }
     else
     {
-      this->SetParametricCoords();
-      double pcoords[3];
-      this->PointParametricCoordinates->GetPoint(corner, pcoords);
-      int subIdtps;
-      std::vector<double> weights(this->Points->GetNumberOfPoints());
-      this->vtkHigherOrderHexahedron::EvaluateLocation(
-        subIdtps, pcoords, cp.GetData(), weights.data());
+      vtkHigherOrderCellTables::EvaluateNodeLocation(
+        tables, corner, this->Points, this->RationalWeights, cp.GetData());
     }
     approx->Points->SetPoint(ic, cp.GetData());
     approx->PointIds->SetId(ic, doScalars ? corner : this->PointIds->GetId(corner));
@@ -240,6 +235,26 @@ vtkHigherOrderQuadrilateral* vtkBezierHexahedron::GetFaceCell()
 {
   return FaceCell;
 }
+/**\brief Add the Bezier shape functions evaluated at each node to the tables.
+ */
+void vtkBezierHexahedron::FillTables(vtkHigherOrderCellTables::Table& table)
+{
+  this->Superclass::FillTables(table);
+
+  vtkSmartPointer<vtkPoints> nodes = vtkSmartPointer<vtkPoints>::New();
+  nodes->SetDataTypeToDouble();
+  vtkHigherOrderInterpolation::AppendHexahedronCollocationPoints(nodes, table.Order);
+  const vtkIdType nPoints = table.NumberOfPoints;
+  table.NodeShapeFunctions.resize(nPoints * nPoints);
+  double pcoords[3];
+  for (vtkIdType node = 0; node < nPoints; ++node)
+  {
+    nodes->GetPoint(node, pcoords);
+    vtkBezierInterpolation::Tensor3ShapeFunctions(
+      table.Order, pcoords, table.NodeShapeFunctions.data() + node * nPoints);
+  }
+}
+
 vtkHigherOrderInterpolation* vtkBezierHexahedron::GetInterpolation()
 {
   return Interp;
@@ -73,6 +73,7 @@ public:
 protected:
   vtkHexahedron* GetApproximateHex(
     int subId, vtkDataArray* scalarsIn = nullptr, vtkDataArray* scalarsOut = nullptr) override;
+  void FillTables(vtkHigherOrderCellTables::Table& table) override;
   vtkBezierHexahedron();
   ~vtkBezierHexahedron() override;
 
@@ -106,18 +106,18 @@ vtkQuad* vtkBezierQuadrilateral::GetApproximateQuad(
   {
     scalarsOut->SetNumberOfTuples(4);
   }
-  int i, j, k;
-  if (!this->SubCellCoordinatesFromId(i, j, k, subId))
+  const vtkHigherOrderCellTables::Table* tables = this->GetTables();
+  if (subId < 0 || subId >= tables->NumberOfSubCells)
   {
     vtkErrorMacro("Invalid subId " << subId);
     return nullptr;
   }
   // Get the point ids (and optionally scalars) for each of the 4 corners
   // in the approximating quadrilateral spanned by (i, i+1) x (j, j+1):
+  const vtkIdType* corners = tables->GetSubCellPoints(subId);
   for (vtkIdType ic = 0; ic < 4; ++ic)
   {
-    const vtkIdType corner =
-      this->PointIndexFromIJK(i + ((((ic + 1) / 2) % 2) ? 1 : 0), j + (((ic / 2) % 2) ? 1 : 0), 0);
+    const vtkIdType corner = corners[ic];
     vtkVector3d cp;
 
     // Only the first four corners are interpolatory, we need to project the value of the other
@@ -128,13 +128,8 @@ vtkQuad* vtkBezierQuadrilateral::GetApproximateQuad(
     }
     else
     {
-      this->SetParametricCoords();
-      double pcoords[3];
-      this->PointParametricCoordinates->GetPoint(corner, pcoords);
-      int subIdtps;
-      std::vector<double> weights(this->Points->GetNumberOfPoints());
-      this->vtkHigherOrderQuadrilateral::EvaluateLocation(
-        subIdtps, pcoords, cp.GetData(), weights.data());
+      vtkHigherOrderCellTables::EvaluateNodeLocation(
+        tables, corner, this->Points, this->RationalWeights, cp.GetData());
     }
     approx->Points->SetPoint(ic, cp.GetData());
     approx->PointIds->SetId(ic, doScalars ? corner : this->PointIds->GetId(corner));
@@ -146,6 +141,26 @@ vtkQuad* vtkBezierQuadrilateral::GetApproximateQuad(
   return approx;
 }
 
+/**\brief Add the Bezier shape functions evaluated at each node to the tables.
+ */
+void vtkBezierQuadrilateral::FillTables(vtkHigherOrderCellTables::Table& table)
+{
+  this->Superclass::FillTables(table);
+
+  vtkSmartPointer<vtkPoints> nodes = vtkSmartPointer<vtkPoints>::New();
+  nodes->SetDataTypeToDouble();
+  vtkHigherOrderInterpolation::AppendQuadrilateralCollocationPoints(nodes, table.Order);
+  const vtkIdType nPoints = table.NumberOfPoints;
+  table.NodeShapeFunctions.resize(nPoints * nPoints);
+  double pcoords[3];
+  for (vtkIdType node = 0; node < nPoints; ++node)
+  {
+    nodes->GetPoint(node, pcoords);
+    vtkBezierInterpolation::Tensor2ShapeFunctions(
+      table.Order, pcoords, table.NodeShapeFunctions.data() + node * nPoints);
+  }
+}
+
 void vtkBezierQuadrilateral::InterpolateFunctions(const double pcoords[3], double* weights)
 {
   vtkBezierInterpolation::Tensor2ShapeFunctions(this->GetOrder(), pcoords, weights);
@@ -63,6 +63,7 @@ protected:
   // non-interpolatory
   vtkQuad* GetApproximateQuad(
     int subId, vtkDataArray* scalarsIn = nullptr, vtkDataArray* scalarsOut = nullptr) override;
+  void FillTables(vtkHigherOrderCellTables::Table& table) override;
 
   vtkBezierQuadrilateral();
   ~vtkBezierQuadrilateral() override;
@@ -20,6 +20,7 @@
 
 #include <algorithm> // for sorting
 #include <cassert>
+#include <cstring>
 #include <limits> // for IntersectWithInfiniteLine
 #include <vector> // for IntersectWithPlane
 
@@ -786,6 +787,20 @@ vtkTypeBool vtkBox::IntersectWithPlane(
   return numOutInts;
 }
 
+//------------------------------------------------------------------------------
+bool vtkBox::PrintParameterKey(ostream& os)
+{
+  if (strcmp(this->GetClassName(), "vtkBox") != 0 || !this->PrintTransformKey(os))
+  {
+    return false;
+  }
+  const double* minP = this->BBox->GetMinPoint();
+  const double* maxP = this->BBox->GetMaxPoint();
+  os << "vtkBox min " << minP[0] << " " << minP[1] << " " << minP[2] << " max " << maxP[0] << " "
+     << maxP[1] << " " << maxP[2] << "\n";
+  return true;
+}
+
 //------------------------------------------------------------------------------
 void vtkBox::PrintSelf(ostream& os, vtkIndent indent)
 {
@@ -260,6 +260,12 @@ double vtkDataSet::GetLength()
   return diff;
 }
 
+//------------------------------------------------------------------------------
+vtkMTimeType vtkDataSet::GetMeshMTime()
+{
+  return vtkDataObject::GetMTime();
+}
+
 //------------------------------------------------------------------------------
 vtkMTimeType vtkDataSet::GetMTime()
 {
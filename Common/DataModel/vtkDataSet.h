@@ -250,6 +250,17 @@ public:
    */
   vtkMTimeType GetMTime() override;
 
+  /**
+   * Return the mesh (geometry/topology) modification time. This time is
+   * different from GetMTime() which also takes into account the modification
+   * of the point and cell data: filters can compare it between executions to
+   * detect a static mesh carrying time-varying attributes. The default
+   * implementation conservatively returns the modification time of the
+   * dataset itself.
+   * THIS METHOD IS THREAD SAFE
+   */
+  virtual vtkMTimeType GetMeshMTime();
+
   /**
    * Return a pointer to this dataset's cell data.
    * THIS METHOD IS THREAD SAFE
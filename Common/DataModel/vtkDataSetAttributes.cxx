@@ -19,14 +19,17 @@
 #include "vtkAssume.h"
 #include "vtkCell.h"
 #include "vtkCharArray.h"
+#include "vtkDataArrayAccessor.h"
 #include "vtkDataArrayRange.h"
 #include "vtkDoubleArray.h"
 #include "vtkFloatArray.h"
+#include "vtkIdList.h"
 #include "vtkIdTypeArray.h"
 #include "vtkInformation.h"
 #include "vtkIntArray.h"
 #include "vtkLongArray.h"
 #include "vtkMath.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkShortArray.h"
 #include "vtkStructuredExtent.h"
@@ -34,6 +37,8 @@
 #include "vtkUnsignedIntArray.h"
 #include "vtkUnsignedLongArray.h"
 #include "vtkUnsignedShortArray.h"
+
+#include <algorithm>
 #include <vector>
 
 vtkStandardNewMacro(vtkDataSetAttributes);
@@ -141,6 +146,19 @@ void vtkDataSetAttributes::CopyAllOff(int ctype)
 // copy from input data). Note that attribute data is
 // not copied.
 void vtkDataSetAttributes::DeepCopy(vtkFieldData* fd)
+{
+  this->InternalDeepCopy(fd, false);
+}
+
+//------------------------------------------------------------------------------
+// Same as DeepCopy(), but the arrays share memory until they are modified.
+void vtkDataSetAttributes::LazyDeepCopy(vtkFieldData* fd)
+{
+  this->InternalDeepCopy(fd, true);
+}
+
+//------------------------------------------------------------------------------
+void vtkDataSetAttributes::InternalDeepCopy(vtkFieldData* fd, bool lazy)
 {
   this->Initialize(); // free up memory
 
@@ -148,21 +166,9 @@ void vtkDataSetAttributes::DeepCopy(vtkFieldData* fd)
   // If the source is a vtkDataSetAttributes
   if (dsa)
   {
-    int numArrays = fd->GetNumberOfArrays();
-    int attributeType, i;
-    vtkAbstractArray *data, *newData;
+    int attributeType;
 
-    // Allocate space for numArrays
-    this->AllocateArrays(numArrays);
-    for (i = 0; i < numArrays; i++)
-    {
-      data = fd->GetAbstractArray(i);
-      newData = data->NewInstance(); // instantiate same type of object
-      newData->DeepCopy(data);
-      newData->SetName(data->GetName());
-      this->AddArray(newData);
-      newData->Delete();
-    }
+    this->DeepCopyArrays(fd, lazy);
     // Copy the copy flags
     for (attributeType = 0; attributeType < NUM_ATTRIBUTES; attributeType++)
     {
@@ -182,7 +188,7 @@ void vtkDataSetAttributes::DeepCopy(vtkFieldData* fd)
   // If the source is field data, do a field data copy
   else
   {
-    this->vtkFieldData::DeepCopy(fd);
+    this->DeepCopyArrays(fd, lazy);
   }
 }
 
@@ -871,7 +877,7 @@ void vtkDataSetAttributes::InterpolatePoint(
     {
       vtkIdType numIds = ptIds->GetNumberOfIds();
       vtkIdType maxId = ptIds->GetId(0);
-      vtkIdType maxWeight = 0.;
+      double maxWeight = 0.;
       for (int j = 0; j < numIds; j++)
       {
         if (weights[j] > maxWeight)
@@ -922,6 +928,238 @@ void vtkDataSetAttributes::InterpolateEdge(
   }
 }
 
+//------------------------------------------------------------------------------
+namespace
+{
+// Return the id of the largest weight, for nearest neighbor interpolation.
+vtkIdType GetNearestId(const vtkIdType* ids, const double* weights, vtkIdType numIds)
+{
+  vtkIdType nearest = ids[0];
+  double maxWeight = 0.;
+  for (vtkIdType j = 0; j < numIds; ++j)
+  {
+    if (weights[j] > maxWeight)
+    {
+      maxWeight = weights[j];
+      nearest = ids[j];
+    }
+  }
+  return nearest;
+}
+
+// Make sure the destination array holds the output tuples, growing it like
+// InsertTuple() would.
+void EnsureNumberOfTuples(vtkAbstractArray* array, vtkIdType numTuples)
+{
+  if (array->GetNumberOfTuples() < numTuples)
+  {
+    const int numComps = std::max(array->GetNumberOfComponents(), 1);
+    if (array->GetSize() < numTuples * numComps)
+    {
+      array->Resize(numTuples);
+    }
+    array->SetNumberOfTuples(numTuples);
+  }
+}
+
+// Interpolation kernels used by InterpolatePoints() and InterpolateEdges().
+// Data array accessors are used rather than ranges so that reading from
+// copy-on-write source arrays does not detach them.
+struct InterpolatePointsWorker
+{
+  vtkIdType ToStart;
+  vtkIdType NumPoints;
+  const vtkIdType* Offsets;
+  const vtkIdType* Ids;
+  const double* Weights;
+  bool Nearest;
+
+  template <typename DstArrayT, typename SrcArrayT>
+  void operator()(DstArrayT* dstArray, SrcArrayT* srcArray)
+  {
+    using ValueType = typename vtkDataArrayAccessor<DstArrayT>::APIType;
+    vtkDataArrayAccessor<DstArrayT> dst(dstArray);
+    vtkDataArrayAccessor<SrcArrayT> src(srcArray);
+    const int numComps = dstArray->GetNumberOfComponents();
+    VTK_ASSUME(srcArray->GetNumberOfComponents() == numComps);
+
+    for (vtkIdType i = 0; i < this->NumPoints; ++i)
+    {
+      const vtkIdType toId = this->ToStart + i;
+      const vtkIdType* ids = this->Ids + this->Offsets[i];
+      const double* weights = this->Weights + this->Offsets[i];
+      const vtkIdType numIds = this->Offsets[i + 1] - this->Offsets[i];
+      if (this->Nearest)
+      {
+        const vtkIdType nearest = GetNearestId(ids, weights, numIds);
+        for (int c = 0; c < numComps; ++c)
+        {
+          dst.Set(toId, c, static_cast<ValueType>(src.Get(nearest, c)));
+        }
+        continue;
+      }
+      for (int c = 0; c < numComps; ++c)
+      {
+        double val = 0.;
+        for (vtkIdType j = 0; j < numIds; ++j)
+        {
+          val += weights[j] * static_cast<double>(src.Get(ids[j], c));
+        }
+        ValueType valT;
+        vtkMath::RoundDoubleToIntegralIfNecessary(val, &valT);
+        dst.Set(toId, c, valT);
+      }
+    }
+  }
+};
+
+struct InterpolateEdgesWorker
+{
+  vtkIdType ToStart;
+  vtkIdType NumPoints;
+  const vtkIdType* Edges;
+  const double* T;
+  bool Nearest;
+
+  template <typename DstArrayT, typename SrcArrayT>
+  void operator()(DstArrayT* dstArray, SrcArrayT* srcArray)
+  {
+    using ValueType = typename vtkDataArrayAccessor<DstArrayT>::APIType;
+    vtkDataArrayAccessor<DstArrayT> dst(dstArray);
+    vtkDataArrayAccessor<SrcArrayT> src(srcArray);
+    const int numComps = dstArray->GetNumberOfComponents();
+    VTK_ASSUME(srcArray->GetNumberOfComponents() == numComps);
+
+    for (vtkIdType i = 0; i < this->NumPoints; ++i)
+    {
+      const vtkIdType toId = this->ToStart + i;
+      const vtkIdType p1 = this->Edges[2 * i];
+      const vtkIdType p2 = this->Edges[2 * i + 1];
+      const double t = this->T[i];
+      if (this->Nearest)
+      {
+        const vtkIdType nearest = t < .5 ? p1 : p2;
+        for (int c = 0; c < numComps; ++c)
+        {
+          dst.Set(toId, c, static_cast<ValueType>(src.Get(nearest, c)));
+        }
+        continue;
+      }
+      for (int c = 0; c < numComps; ++c)
+      {
+        const double val = static_cast<double>(src.Get(p1, c)) * (1. - t) +
+          static_cast<double>(src.Get(p2, c)) * t;
+        ValueType valT;
+        vtkMath::RoundDoubleToIntegralIfNecessary(val, &valT);
+        dst.Set(toId, c, valT);
+      }
+    }
+  }
+};
+} // anonymous namespace
+
+//------------------------------------------------------------------------------
+void vtkDataSetAttributes::InterpolatePoints(vtkDataSetAttributes* fromPd, vtkIdType toStart,
+  vtkIdType numPoints, const vtkIdType* offsets, const vtkIdType* ids, const double* weights)
+{
+  if (numPoints <= 0)
+  {
+    return;
+  }
+
+  vtkNew<vtkIdList> ptIds;
+  for (const auto& i : this->RequiredArrays)
+  {
+    vtkAbstractArray* fromArray = fromPd->Data[i];
+    vtkAbstractArray* toArray = this->Data[this->TargetIndices[i]];
+    EnsureNumberOfTuples(toArray, toStart + numPoints);
+
+    // check if the destination array needs nearest neighbor interpolation
+    int attributeIndex = this->IsArrayAnAttribute(this->TargetIndices[i]);
+    const bool nearest =
+      attributeIndex != -1 && this->CopyAttributeFlags[INTERPOLATE][attributeIndex] == 2;
+
+    vtkDataArray* fromDA = vtkDataArray::FastDownCast(fromArray);
+    vtkDataArray* toDA = vtkDataArray::FastDownCast(toArray);
+    if (fromDA && toDA && fromDA->GetNumberOfComponents() == toDA->GetNumberOfComponents())
+    {
+      InterpolatePointsWorker worker{ toStart, numPoints, offsets, ids, weights, nearest };
+      if (vtkArrayDispatch::Dispatch2SameValueType::Execute(toDA, fromDA, worker))
+      {
+        continue;
+      }
+    }
+
+    // Other arrays (e.g. vtkBitArray, vtkStringArray) go through the
+    // vtkAbstractArray API, which rounds and clamps the values like above.
+    for (vtkIdType pt = 0; pt < numPoints; ++pt)
+    {
+      const vtkIdType numIds = offsets[pt + 1] - offsets[pt];
+      if (nearest)
+      {
+        toArray->SetTuple(toStart + pt,
+          GetNearestId(ids + offsets[pt], weights + offsets[pt], numIds), fromArray);
+      }
+      else
+      {
+        ptIds->SetNumberOfIds(numIds);
+        std::copy(ids + offsets[pt], ids + offsets[pt + 1], ptIds->GetPointer(0));
+        toArray->InterpolateTuple(
+          toStart + pt, ptIds, fromArray, const_cast<double*>(weights + offsets[pt]));
+      }
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkDataSetAttributes::InterpolateEdges(vtkDataSetAttributes* fromPd, vtkIdType toStart,
+  vtkIdType numPoints, const vtkIdType* edges, const double* t)
+{
+  if (numPoints <= 0)
+  {
+    return;
+  }
+
+  for (const auto& i : this->RequiredArrays)
+  {
+    vtkAbstractArray* fromArray = fromPd->Data[i];
+    vtkAbstractArray* toArray = this->Data[this->TargetIndices[i]];
+    EnsureNumberOfTuples(toArray, toStart + numPoints);
+
+    // check if the destination array needs nearest neighbor interpolation
+    int attributeIndex = this->IsArrayAnAttribute(this->TargetIndices[i]);
+    const bool nearest =
+      attributeIndex != -1 && this->CopyAttributeFlags[INTERPOLATE][attributeIndex] == 2;
+
+    vtkDataArray* fromDA = vtkDataArray::FastDownCast(fromArray);
+    vtkDataArray* toDA = vtkDataArray::FastDownCast(toArray);
+    if (fromDA && toDA && fromDA->GetNumberOfComponents() == toDA->GetNumberOfComponents())
+    {
+      InterpolateEdgesWorker worker{ toStart, numPoints, edges, t, nearest };
+      if (vtkArrayDispatch::Dispatch2SameValueType::Execute(toDA, fromDA, worker))
+      {
+        continue;
+      }
+    }
+
+    // Other arrays (e.g. vtkBitArray, vtkStringArray) go through the
+    // vtkAbstractArray API, which rounds and clamps the values like above.
+    for (vtkIdType pt = 0; pt < numPoints; ++pt)
+    {
+      const vtkIdType p1 = edges[2 * pt];
+      const vtkIdType p2 = edges[2 * pt + 1];
+      if (nearest)
+      {
+        toArray->SetTuple(toStart + pt, t[pt] < .5 ? p1 : p2, fromArray);
+      }
+      else
+      {
+        toArray->InterpolateTuple(toStart + pt, p1, fromArray, p2, fromArray, t[pt]);
+      }
+    }
+  }
+}
+
 //------------------------------------------------------------------------------
 // Interpolate data from the two points p1,p2 (forming an edge) and an
 // interpolation factor, t, along the edge. The weight ranges from (0,1),
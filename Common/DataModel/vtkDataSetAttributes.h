@@ -90,6 +90,12 @@ public:
    */
   void DeepCopy(vtkFieldData* pd) override;
 
+  /**
+   * Same as DeepCopy(), but the new arrays share the memory of the arrays of
+   * \a pd until either of them is modified (see vtkFieldData::LazyDeepCopy()).
+   */
+  void LazyDeepCopy(vtkFieldData* pd) override;
+
   /**
    * Shallow copy of data (i.e., use reference counting).
    * Ignores the copy flags but preserves them in the output.
@@ -580,6 +586,31 @@ public:
   void InterpolateEdge(
     vtkDataSetAttributes* fromPd, vtkIdType toId, vtkIdType p1, vtkIdType p2, double t);
 
+  ///@{
+  /**
+   * Batched forms of InterpolatePoint() and InterpolateEdge(), which fill the
+   * numPoints consecutive tuples starting at toStart. Each array is
+   * interpolated in a single loop specialized for its type, instead of a
+   * virtual call per array and point.
+   *
+   * InterpolatePoints() interpolates output point i from the source tuples
+   * ids[offsets[i]] to ids[offsets[i + 1] - 1] with the matching weights,
+   * so offsets holds numPoints + 1 values. InterpolateEdges() interpolates
+   * output point i on the edge (edges[2 * i], edges[2 * i + 1]) with the
+   * parameter t[i].
+   *
+   * The destination arrays are grown as needed. Once they hold at least
+   * toStart + numPoints tuples, e.g. after a call to SetNumberOfTuples(),
+   * these methods only write the requested tuples and may be called
+   * concurrently on disjoint ranges. Make sure that the method
+   * InterpolateAllocate() has been invoked before using these methods.
+   */
+  void InterpolatePoints(vtkDataSetAttributes* fromPd, vtkIdType toStart, vtkIdType numPoints,
+    const vtkIdType* offsets, const vtkIdType* ids, const double* weights);
+  void InterpolateEdges(vtkDataSetAttributes* fromPd, vtkIdType toStart, vtkIdType numPoints,
+    const vtkIdType* edges, const double* t);
+  ///@}
+
   /**
    * Interpolate data from the same id (point or cell) at different points
    * in time (parameter t). Two input data set attributes objects are input.
@@ -641,6 +672,11 @@ protected:
   void InternalCopyAllocate(vtkDataSetAttributes* pd, int ctype, vtkIdType sze = 0,
     vtkIdType ext = 1000, int shallowCopyArrays = 0, bool createNewArrays = true);
 
+  /**
+   * Implementation of DeepCopy() and LazyDeepCopy().
+   */
+  void InternalDeepCopy(vtkFieldData* fd, bool lazy);
+
   /**
    * Initialize all of the object's data to nullptr
    */
@@ -392,6 +392,19 @@ vtkAbstractArray* vtkFieldData::GetAbstractArray(int i)
 //------------------------------------------------------------------------------
 // Copy a field by creating new data arrays
 void vtkFieldData::DeepCopy(vtkFieldData* f)
+{
+  this->DeepCopyArrays(f, false);
+}
+
+//------------------------------------------------------------------------------
+// Copy a field by creating new data arrays sharing memory until modified
+void vtkFieldData::LazyDeepCopy(vtkFieldData* f)
+{
+  this->DeepCopyArrays(f, true);
+}
+
+//------------------------------------------------------------------------------
+void vtkFieldData::DeepCopyArrays(vtkFieldData* f, bool lazy)
 {
   vtkAbstractArray *data, *newData;
 
@@ -400,7 +413,14 @@ void vtkFieldData::DeepCopy(vtkFieldData* f)
   {
     data = f->GetAbstractArray(i);
     newData = data->NewInstance(); // instantiate same type of object
-    newData->DeepCopy(data);
+    if (lazy)
+    {
+      newData->LazyDeepCopy(data);
+    }
+    else
+    {
+      newData->DeepCopy(data);
+    }
     newData->SetName(data->GetName());
     if (data->HasInformation())
     {
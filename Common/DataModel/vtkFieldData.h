@@ -256,6 +256,14 @@ public:
    */
   virtual void DeepCopy(vtkFieldData* da);
 
+  /**
+   * Same result as DeepCopy(), but the new arrays share the memory of the
+   * arrays of \a da until either of them is modified (copy-on-write, see
+   * vtkAbstractArray::LazyDeepCopy()). This is useful when only a few of the
+   * arrays may be modified afterwards.
+   */
+  virtual void LazyDeepCopy(vtkFieldData* da);
+
   /**
    * Copy a field by reference counting the data arrays.
    */
@@ -371,6 +379,12 @@ protected:
    */
   void SetArray(int i, vtkAbstractArray* array);
 
+  /**
+   * Replace the arrays by deep copies of the arrays of \a f, made with
+   * LazyDeepCopy() if \a lazy is true.
+   */
+  void DeepCopyArrays(vtkFieldData* f, bool lazy);
+
   /**
    * Release all data but do not delete object.
    */
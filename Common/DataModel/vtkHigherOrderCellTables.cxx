@@ -0,0 +1,111 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkHigherOrderCellTables.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkHigherOrderCellTables.h"
+
+#include "vtkDataArray.h"
+#include "vtkPoints.h"
+
+#include <algorithm>
+#include <array>
+#include <map>
+#include <memory>
+#include <mutex>
+
+namespace
+{
+using TableKey = std::array<int, 4>;
+
+struct TableRegistry
+{
+  std::mutex Lock;
+  std::map<TableKey, std::unique_ptr<vtkHigherOrderCellTables::Table>> Tables;
+};
+
+// Constructed on first use and intentionally never destroyed, so that cells
+// released during static destruction can still safely hold table pointers.
+TableRegistry& GetRegistry()
+{
+  static TableRegistry* registry = new TableRegistry;
+  return *registry;
+}
+} // anonymous namespace
+
+//------------------------------------------------------------------------------
+const vtkHigherOrderCellTables::Table* vtkHigherOrderCellTables::GetTable(
+  int cellType, const int order[3], const std::function<void(Table&)>& build)
+{
+  TableRegistry& registry = GetRegistry();
+  const TableKey key = { { cellType, order[0], order[1], order[2] } };
+
+  std::lock_guard<std::mutex> guard(registry.Lock);
+  auto it = registry.Tables.find(key);
+  if (it != registry.Tables.end())
+  {
+    return it->second.get();
+  }
+
+  std::unique_ptr<Table> table(new Table);
+  table->CellType = cellType;
+  std::copy(order, order + 3, table->Order);
+  build(*table);
+  return (registry.Tables[key] = std::move(table)).get();
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkHigherOrderCellTables::GetNumberOfTables()
+{
+  TableRegistry& registry = GetRegistry();
+  std::lock_guard<std::mutex> guard(registry.Lock);
+  return static_cast<vtkIdType>(registry.Tables.size());
+}
+
+//------------------------------------------------------------------------------
+void vtkHigherOrderCellTables::EvaluateNodeLocation(const Table* table, vtkIdType nodeId,
+  vtkPoints* points, vtkDataArray* rationalWeights, double x[3])
+{
+  const double* shape = table->GetNodeShapeFunctions(nodeId);
+  const vtkIdType nPoints = table->NumberOfPoints;
+  double scale = 1.0;
+  const bool rational = rationalWeights && rationalWeights->GetNumberOfTuples() > 0;
+  if (rational)
+  {
+    double w = 0.0;
+    for (vtkIdType idx = 0; idx < nPoints; ++idx)
+    {
+      w += shape[idx] * rationalWeights->GetComponent(idx, 0);
+    }
+    scale = 1.0 / w;
+  }
+
+  double p[3];
+  x[0] = x[1] = x[2] = 0.;
+  for (vtkIdType idx = 0; idx < nPoints; ++idx)
+  {
+    const double weight =
+      rational ? shape[idx] * rationalWeights->GetComponent(idx, 0) * scale : shape[idx];
+    points->GetPoint(idx, p);
+    for (int jdx = 0; jdx < 3; ++jdx)
+    {
+      x[jdx] += p[jdx] * weight;
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkHigherOrderCellTables::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "Number Of Tables: " << vtkHigherOrderCellTables::GetNumberOfTables() << "\n";
+}
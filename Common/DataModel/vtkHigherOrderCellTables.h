@@ -0,0 +1,128 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkHigherOrderCellTables.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkHigherOrderCellTables
+ * @brief   process-wide tables shared by higher-order cells of equal type and order
+ *
+ * Higher-order cells (vtkLagrangeHexahedron, vtkBezierQuadrilateral, ...)
+ * approximate themselves with linear sub-cells in EvaluatePosition(),
+ * Contour(), Clip() and Triangulate(). The decomposition into sub-cells, and
+ * for Bezier cells the value of the shape functions at the parametric
+ * coordinates of the nodes (needed to project the non-interpolatory control
+ * points on the cell), depend only on the cell type and order. This class
+ * computes them once per (type, order) pair and shares the result between
+ * all cells and threads.
+ *
+ * Tables are never released before the program exits, so the pointers
+ * returned by GetTable() stay valid and can be kept by the cells as long as
+ * their order does not change. Tables are immutable once built, so they can
+ * be read concurrently without locking.
+ *
+ * @sa
+ * vtkHigherOrderHexahedron vtkHigherOrderQuadrilateral vtkHigherOrderWedge
+ */
+
+#ifndef vtkHigherOrderCellTables_h
+#define vtkHigherOrderCellTables_h
+
+#include "vtkCommonDataModelModule.h" // For export macro
+#include "vtkObject.h"
+
+#include <functional> // For std::function
+#include <vector>     // For Table
+
+class vtkDataArray;
+class vtkPoints;
+
+class VTKCOMMONDATAMODEL_EXPORT vtkHigherOrderCellTables : public vtkObject
+{
+public:
+  vtkTypeMacro(vtkHigherOrderCellTables, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * Data precomputed for one cell type and order.
+   */
+  struct Table
+  {
+    int CellType = 0;
+    int Order[3] = { 0, 0, 0 };
+    vtkIdType NumberOfPoints = 0;
+
+    /**
+     * Point indices (into the points of the higher-order cell) of the
+     * corners of each linear sub-cell, NumberOfSubCellPoints per sub-cell.
+     */
+    vtkIdType NumberOfSubCells = 0;
+    int NumberOfSubCellPoints = 0;
+    std::vector<vtkIdType> SubCellPoints;
+
+    /**
+     * Value of the NumberOfPoints shape functions at the parametric
+     * coordinates of each node, row after row. Only filled for cells whose
+     * nodes are not interpolatory (Bezier cells).
+     */
+    std::vector<double> NodeShapeFunctions;
+
+    const vtkIdType* GetSubCellPoints(vtkIdType subId) const
+    {
+      return this->SubCellPoints.data() + subId * this->NumberOfSubCellPoints;
+    }
+    const double* GetNodeShapeFunctions(vtkIdType nodeId) const
+    {
+      return this->NodeShapeFunctions.empty()
+        ? nullptr
+        : this->NodeShapeFunctions.data() + nodeId * this->NumberOfPoints;
+    }
+    bool HasOrder(const int order[3]) const
+    {
+      return this->Order[0] == order[0] && this->Order[1] == order[1] &&
+        this->Order[2] == order[2];
+    }
+  };
+
+  /**
+   * Return the table of the given cell type and order (unused trailing
+   * entries of \a order must be 0), calling \a build to fill it the first
+   * time the pair is requested. \a build receives a table whose CellType and
+   * Order are set; it must only depend on them. This method is thread safe.
+   */
+  static const Table* GetTable(
+    int cellType, const int order[3], const std::function<void(Table&)>& build);
+
+  /**
+   * Return the number of tables built so far.
+   */
+  static vtkIdType GetNumberOfTables();
+
+  /**
+   * Compute the location of node \a nodeId of a non-interpolatory cell,
+   * i.e. the sum of its control \a points weighted by the NodeShapeFunctions
+   * of \a table. When \a rationalWeights is non-empty the shape functions are
+   * weighted and normalized as for rational Bezier cells.
+   */
+  static void EvaluateNodeLocation(const Table* table, vtkIdType nodeId, vtkPoints* points,
+    vtkDataArray* rationalWeights, double x[3]);
+
+protected:
+  vtkHigherOrderCellTables() = default;
+  ~vtkHigherOrderCellTables() override = default;
+
+private:
+  vtkHigherOrderCellTables(const vtkHigherOrderCellTables&) = delete;
+  void operator=(const vtkHigherOrderCellTables&) = delete;
+};
+
+#endif // vtkHigherOrderCellTables_h
@@ -59,6 +59,7 @@ vtkHigherOrderInterpolation* vtkHigherOrderHexahedron::getInterp()
 vtkHigherOrderHexahedron::vtkHigherOrderHexahedron()
 {
   this->Approx = nullptr;
+  this->Tables = nullptr;
   this->Order[0] = this->Order[1] = this->Order[2] = 1;
   // Deliberately leave this unset. When GetOrder() is called, it will construct
   // the accompanying data arrays used for other calculations.
@@ -548,6 +549,50 @@ vtkHexahedron* vtkHigherOrderHexahedron::GetApprox()
   return this->Approx.GetPointer();
 }
 
+/**\brief Return the sub-cell tables shared by the cells of this type and order.
+ *
+ * The table is looked up again only when the order of this cell changes.
+ */
+const vtkHigherOrderCellTables::Table* vtkHigherOrderHexahedron::GetTables()
+{
+  if (!this->Tables || !this->Tables->HasOrder(this->Order))
+  {
+    this->Tables = vtkHigherOrderCellTables::GetTable(this->GetCellType(), this->Order,
+      [this](vtkHigherOrderCellTables::Table& table) { this->FillTables(table); });
+  }
+  return this->Tables;
+}
+
+/**\brief Compute the point indices of the corners of each approximating linear hex.
+ *
+ * Sub-cells are numbered as in SubCellCoordinatesFromId() and their corners
+ * follow the vtkHexahedron ordering.
+ */
+void vtkHigherOrderHexahedron::FillTables(vtkHigherOrderCellTables::Table& table)
+{
+  const int* order = table.Order;
+  table.NumberOfPoints = (order[0] + 1) * (order[1] + 1) * (order[2] + 1);
+  table.NumberOfSubCells = order[0] * order[1] * order[2];
+  table.NumberOfSubCellPoints = 8;
+  table.SubCellPoints.resize(8 * table.NumberOfSubCells);
+  vtkIdType* corners = table.SubCellPoints.data();
+  for (int k = 0; k < order[2]; ++k)
+  {
+    for (int j = 0; j < order[1]; ++j)
+    {
+      for (int i = 0; i < order[0]; ++i)
+      {
+        for (int ic = 0; ic < 8; ++ic)
+        {
+          *corners++ =
+            vtkHigherOrderHexahedron::PointIndexFromIJK(i + ((((ic + 1) / 2) % 2) ? 1 : 0),
+              j + (((ic / 2) % 2) ? 1 : 0), k + ((ic / 4) ? 1 : 0), order);
+        }
+      }
+    }
+  }
+}
+
 /**\brief Prepare point data for use by linear approximating-elements.
  *
  * This copies the point data for the current cell into a new point-data
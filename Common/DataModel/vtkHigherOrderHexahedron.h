@@ -29,6 +29,7 @@
 #include "vtkCellType.h"              // For GetCellType.
 #include "vtkCommonDataModelModule.h" // For export macro
 #include "vtkDeprecation.h"           // For deprecation macros
+#include "vtkHigherOrderCellTables.h" // For member variable.
 #include "vtkNew.h"                   // For member variable.
 #include "vtkNonLinearCell.h"
 #include "vtkSmartPointer.h" // For member variable.
@@ -128,6 +129,18 @@ protected:
   virtual vtkHexahedron* GetApproximateHex(
     int subId, vtkDataArray* scalarsIn = nullptr, vtkDataArray* scalarsOut = nullptr) = 0;
 
+  /**
+   * Return the tables shared by all the cells with the type and order of
+   * this one. You must call GetOrder() before this method.
+   */
+  const vtkHigherOrderCellTables::Table* GetTables();
+
+  /**
+   * Fill a new table for the order it holds. The base class computes the
+   * corners of the approximating linear hexahedra.
+   */
+  virtual void FillTables(vtkHigherOrderCellTables::Table& table);
+
   int Order[4];
   vtkSmartPointer<vtkPoints> PointParametricCoordinates;
   vtkSmartPointer<vtkHexahedron> Approx;
@@ -137,6 +150,7 @@ protected:
   vtkNew<vtkDoubleArray> Scalars;
   vtkNew<vtkPoints> TmpPts;
   vtkNew<vtkIdList> TmpIds;
+  const vtkHigherOrderCellTables::Table* Tables;
 
 private:
   vtkHigherOrderHexahedron(const vtkHigherOrderHexahedron&) = delete;
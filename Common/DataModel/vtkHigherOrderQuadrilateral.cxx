@@ -42,6 +42,7 @@ vtkHigherOrderCurve* vtkHigherOrderQuadrilateral::getEdgeCell()
 vtkHigherOrderQuadrilateral::vtkHigherOrderQuadrilateral()
 {
   this->Approx = nullptr;
+  this->Tables = nullptr;
   this->Order[0] = this->Order[1] = 1;
   // Deliberately leave this unset. When GetOrder() is called, it will construct
   // the accompanying data arrays used for other calculations.
@@ -475,6 +476,47 @@ void vtkHigherOrderQuadrilateral::PrepareApproxData(
   }
 }
 
+/**\brief Return the sub-cell tables shared by the cells of this type and order.
+ *
+ * The table is looked up again only when the order of this cell changes.
+ */
+const vtkHigherOrderCellTables::Table* vtkHigherOrderQuadrilateral::GetTables()
+{
+  const int order[3] = { this->Order[0], this->Order[1], 0 };
+  if (!this->Tables || !this->Tables->HasOrder(order))
+  {
+    this->Tables = vtkHigherOrderCellTables::GetTable(this->GetCellType(), order,
+      [this](vtkHigherOrderCellTables::Table& table) { this->FillTables(table); });
+  }
+  return this->Tables;
+}
+
+/**\brief Compute the point indices of the corners of each approximating linear quad.
+ *
+ * Sub-cells are numbered as in SubCellCoordinatesFromId() and their corners
+ * follow the vtkQuad ordering.
+ */
+void vtkHigherOrderQuadrilateral::FillTables(vtkHigherOrderCellTables::Table& table)
+{
+  const int* order = table.Order;
+  table.NumberOfPoints = (order[0] + 1) * (order[1] + 1);
+  table.NumberOfSubCells = order[0] * order[1];
+  table.NumberOfSubCellPoints = 4;
+  table.SubCellPoints.resize(4 * table.NumberOfSubCells);
+  vtkIdType* corners = table.SubCellPoints.data();
+  for (int j = 0; j < order[1]; ++j)
+  {
+    for (int i = 0; i < order[0]; ++i)
+    {
+      for (int ic = 0; ic < 4; ++ic)
+      {
+        *corners++ = vtkHigherOrderQuadrilateral::PointIndexFromIJK(
+          i + ((((ic + 1) / 2) % 2) ? 1 : 0), j + (((ic / 2) % 2) ? 1 : 0), order);
+      }
+    }
+  }
+}
+
 /// A convenience method; see the overloaded variant for more information.
 bool vtkHigherOrderQuadrilateral::SubCellCoordinatesFromId(vtkVector3i& ijk, int subId)
 {
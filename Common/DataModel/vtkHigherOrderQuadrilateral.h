@@ -24,6 +24,7 @@
 #include "vtkCellType.h"              // For GetCellType.
 #include "vtkCommonDataModelModule.h" // For export macro
 #include "vtkDeprecation.h"           // For deprecation macros
+#include "vtkHigherOrderCellTables.h" // For member variable.
 #include "vtkNew.h"                   // For member variable.
 #include "vtkNonLinearCell.h"
 #include "vtkSmartPointer.h" // For member variable.
@@ -110,6 +111,18 @@ protected:
   virtual vtkQuad* GetApproximateQuad(
     int subId, vtkDataArray* scalarsIn = nullptr, vtkDataArray* scalarsOut = nullptr) = 0;
 
+  /**
+   * Return the tables shared by all the cells with the type and order of
+   * this one. You must call GetOrder() before this method.
+   */
+  const vtkHigherOrderCellTables::Table* GetTables();
+
+  /**
+   * Fill a new table for the order it holds. The base class computes the
+   * corners of the approximating linear quadrilaterals.
+   */
+  virtual void FillTables(vtkHigherOrderCellTables::Table& table);
+
   int Order[3];
   vtkSmartPointer<vtkPoints> PointParametricCoordinates;
   vtkSmartPointer<vtkQuad> Approx;
@@ -119,6 +132,7 @@ protected:
   vtkNew<vtkDoubleArray> Scalars;
   vtkNew<vtkPoints> TmpPts;
   vtkNew<vtkIdList> TmpIds;
+  const vtkHigherOrderCellTables::Table* Tables;
 
 private:
   vtkHigherOrderQuadrilateral(const vtkHigherOrderQuadrilateral&) = delete;
@@ -211,6 +211,7 @@ vtkHigherOrderWedge::vtkHigherOrderWedge()
   this->Approx = nullptr;
   this->ApproxPD = nullptr;
   this->ApproxCD = nullptr;
+  this->Tables = nullptr;
   this->Order[0] = this->Order[1] = this->Order[2] = 1;
 
   // Deliberately leave this unset. When GetOrder() is called, it will construct
@@ -1005,8 +1006,6 @@ vtkWedge* vtkHigherOrderWedge::GetApproximateWedge(
   {
     scalarsOut->SetNumberOfTuples(6);
   }
-  int i, j, k;
-  bool orientation;
   const int* order = this->GetOrder();
 
 #ifdef VTK_21_POINT_WEDGE
@@ -1038,7 +1037,8 @@ vtkWedge* vtkHigherOrderWedge::GetApproximateWedge(
   }
 #endif
 
-  if (!linearWedgeLocationFromSubId(subId, order[0], order[2], i, j, k, orientation))
+  const vtkHigherOrderCellTables::Table* tables = this->GetTables();
+  if (subId < 0 || subId >= tables->NumberOfSubCells)
   {
     vtkWarningMacro(
       "Bad subId " << subId << " for order " << order[0] << " " << order[1] << " " << order[2]);
@@ -1047,23 +1047,15 @@ vtkWedge* vtkHigherOrderWedge::GetApproximateWedge(
 
   // Get the point coordinates (and optionally scalars) for each of the 6 corners
   // in the approximating wedge spanning half of (i, i+1) x (j, j+1) x (k, k+1):
-  // vtkIdType aconn[8]; // = {0, 1, 2, 3, 4, 5, 6, 7};
-  // std::cout << "Wedgeproximate " << subId << "\n";
-  const int deltas[2][3][2] = {
-    { { 0, 0 }, { 1, 0 }, { 0, 1 } }, // positive orientation: r, s axes increase as i, j increase
-    { { 1, 1 }, { 0, 1 }, { 1, 0 } }  // negative orientation: r, s axes decrease as i, j increase
-  };
+  const vtkIdType* corners = tables->GetSubCellPoints(subId);
   for (int ic = 0; ic < 6; ++ic)
   {
-    const vtkIdType corner = this->PointIndexFromIJK(i + deltas[orientation ? 0 : 1][ic % 3][0],
-      j + deltas[orientation ? 0 : 1][ic % 3][1], k + ((ic / 3) ? 1 : 0));
+    const vtkIdType corner = corners[ic];
     vtkVector3d cp;
 
     if (corner == -1)
     {
-      vtkWarningMacro("Could not determine point index for IJK = ("
-        << i + deltas[orientation ? 0 : 1][ic % 3][0] << " "
-        << j + deltas[orientation ? 0 : 1][ic % 3][1] << " " << k + ((ic / 3) ? 1 : 0) << ")");
+      vtkWarningMacro("Could not determine point index of corner " << ic << " of subId " << subId);
       return nullptr;
     }
 
@@ -1083,6 +1075,51 @@ vtkWedge* vtkHigherOrderWedge::GetApproximateWedge(
   return approx;
 }
 
+/**\brief Return the sub-cell tables shared by the cells of this type and order.
+ *
+ * The table is looked up again only when the order of this cell changes.
+ */
+const vtkHigherOrderCellTables::Table* vtkHigherOrderWedge::GetTables()
+{
+  if (!this->Tables || !this->Tables->HasOrder(this->Order))
+  {
+    this->Tables = vtkHigherOrderCellTables::GetTable(this->GetCellType(), this->Order,
+      [this](vtkHigherOrderCellTables::Table& table) { this->FillTables(table); });
+  }
+  return this->Tables;
+}
+
+/**\brief Compute the point indices of the corners of each approximating linear wedge.
+ *
+ * The 21-point wedge, which has its own decomposition, is not described by the tables.
+ */
+void vtkHigherOrderWedge::FillTables(vtkHigherOrderCellTables::Table& table)
+{
+  const int order[4] = { table.Order[0], table.Order[1], table.Order[2],
+    (table.Order[0] + 1) * (table.Order[0] + 2) / 2 * (table.Order[2] + 1) };
+  table.NumberOfPoints = order[3];
+  table.NumberOfSubCells = order[0] * order[0] * order[2];
+  table.NumberOfSubCellPoints = 6;
+  table.SubCellPoints.resize(6 * table.NumberOfSubCells);
+  const int deltas[2][3][2] = {
+    { { 0, 0 }, { 1, 0 }, { 0, 1 } }, // positive orientation: r, s axes increase as i, j increase
+    { { 1, 1 }, { 0, 1 }, { 1, 0 } }  // negative orientation: r, s axes decrease as i, j increase
+  };
+  vtkIdType* corners = table.SubCellPoints.data();
+  for (vtkIdType subId = 0; subId < table.NumberOfSubCells; ++subId)
+  {
+    int i, j, k;
+    bool orientation;
+    linearWedgeLocationFromSubId(subId, order[0], order[2], i, j, k, orientation);
+    for (int ic = 0; ic < 6; ++ic)
+    {
+      const int(&delta)[3][2] = deltas[orientation ? 0 : 1];
+      *corners++ = vtkHigherOrderWedge::PointIndexFromIJK(
+        i + delta[ic % 3][0], j + delta[ic % 3][1], k + ((ic / 3) ? 1 : 0), order);
+    }
+  }
+}
+
 void vtkHigherOrderWedge::GetTriangularFace(vtkHigherOrderTriangle* result, int faceId,
   const std::function<void(const vtkIdType&)>& set_number_of_ids_and_points,
   const std::function<void(const vtkIdType&, const vtkIdType&)>& set_ids_and_points)
@@ -39,6 +39,7 @@
 #include "vtkCellType.h"              // For GetCellType.
 #include "vtkCommonDataModelModule.h" // For export macro
 #include "vtkDeprecation.h"           // For deprecation macros
+#include "vtkHigherOrderCellTables.h" // For member variable.
 #include "vtkNew.h"                   // For member variable.
 #include "vtkNonLinearCell.h"
 #include "vtkSmartPointer.h" // For member variable.
@@ -141,6 +142,18 @@ protected:
   vtkWedge* GetApproximateWedge(
     int subId, vtkDataArray* scalarsIn = nullptr, vtkDataArray* scalarsOut = nullptr);
 
+  /**
+   * Return the tables shared by all the cells with the type and order of
+   * this one. You must call GetOrder() before this method.
+   */
+  const vtkHigherOrderCellTables::Table* GetTables();
+
+  /**
+   * Fill a new table for the order it holds. The base class computes the
+   * corners of the approximating linear wedges.
+   */
+  virtual void FillTables(vtkHigherOrderCellTables::Table& table);
+
   void GetTriangularFace(vtkHigherOrderTriangle* result, int faceId,
     const std::function<void(const vtkIdType&)>& set_number_of_ids_and_points,
     const std::function<void(const vtkIdType&, const vtkIdType&)>& set_ids_and_points);
@@ -157,6 +170,7 @@ protected:
   vtkNew<vtkDoubleArray> Scalars;
   vtkNew<vtkPoints> TmpPts;
   vtkNew<vtkIdList> TmpIds;
+  const vtkHigherOrderCellTables::Table* Tables;
 
 private:
   vtkHigherOrderWedge(const vtkHigherOrderWedge&) = delete;
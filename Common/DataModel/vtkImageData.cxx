@@ -37,6 +37,8 @@
 #include "vtkVertex.h"
 #include "vtkVoxel.h"
 
+#include <algorithm>
+
 vtkStandardNewMacro(vtkImageData);
 vtkStandardExtendedNewMacro(vtkImageData);
 
@@ -1199,6 +1201,171 @@ int vtkImageData::ComputeStructuredCoordinates(const double x[3], int ijk[3], do
   return isInBounds;
 }
 
+//------------------------------------------------------------------------------
+vtkIdType vtkImageData::ComputeStructuredCoordinates(
+  vtkIdType numPoints, const double x[], int ijk[], double pcoords[], unsigned char inside[])
+{
+  // tolerance is needed for floating points error margin
+  // (this is squared tolerance)
+  const double tol2 = 1e-12;
+  const double* m = this->PhysicalToIndexMatrix->GetData();
+  const int* extent = this->Extent;
+
+  // Points are processed by blocks: the transform to index space has no
+  // branches so that it can be vectorized, the bounds checks come after.
+  const vtkIdType blockSize = 256;
+  double loc[3 * blockSize];
+  vtkIdType numInside = 0;
+  for (vtkIdType start = 0; start < numPoints; start += blockSize)
+  {
+    const vtkIdType num = std::min(blockSize, numPoints - start);
+    const double* xb = x + 3 * start;
+    for (vtkIdType p = 0; p < num; ++p)
+    {
+      const double x0 = xb[3 * p];
+      const double x1 = xb[3 * p + 1];
+      const double x2 = xb[3 * p + 2];
+      loc[3 * p] = m[0] * x0 + m[1] * x1 + m[2] * x2 + m[3];
+      loc[3 * p + 1] = m[4] * x0 + m[5] * x1 + m[6] * x2 + m[7];
+      loc[3 * p + 2] = m[8] * x0 + m[9] * x1 + m[10] * x2 + m[11];
+    }
+
+    int* ijkb = ijk + 3 * start;
+    double* pcoordsb = pcoords + 3 * start;
+    for (vtkIdType p = 0; p < num; ++p)
+    {
+      unsigned char isInBounds = 1;
+      for (int i = 0; i < 3; i++)
+      {
+        const double doubleLoc = loc[3 * p + i];
+        int& idx = ijkb[3 * p + i];
+        double& pcoord = pcoordsb[3 * p + i];
+        idx = vtkMath::Floor(doubleLoc);
+        pcoord = doubleLoc - idx;
+
+        // Same bounds checks as the single point version
+        const int minExt = extent[i * 2];
+        const int maxExt = extent[i * 2 + 1];
+        if (minExt == maxExt || idx < minExt)
+        {
+          const double dist = doubleLoc - minExt;
+          if (dist * dist <= tol2)
+          {
+            pcoord = 0.0;
+            idx = minExt;
+          }
+          else
+          {
+            isInBounds = 0;
+          }
+        }
+        else if (idx >= maxExt)
+        {
+          const double dist = doubleLoc - maxExt;
+          if (dist * dist <= tol2)
+          {
+            pcoord = 1.0;
+            idx = maxExt - 1;
+          }
+          else
+          {
+            isInBounds = 0;
+          }
+        }
+      }
+      inside[start + p] = isInBounds;
+      numInside += isInBounds;
+    }
+  }
+  return numInside;
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkImageData::FindCells(vtkIdType numPoints, const double x[], double tol2,
+  vtkIdType cellIds[], double pcoords[], double weights[])
+{
+  const int* extent = this->Extent;
+  const double* spacing = this->Spacing;
+
+  const vtkIdType blockSize = 256;
+  int ijk[3 * blockSize];
+  double localPCoords[3 * blockSize];
+  unsigned char inside[blockSize];
+  vtkIdType numFound = 0;
+  for (vtkIdType start = 0; start < numPoints; start += blockSize)
+  {
+    const vtkIdType num = std::min(blockSize, numPoints - start);
+    double* pc = pcoords ? pcoords + 3 * start : localPCoords;
+    this->ComputeStructuredCoordinates(num, x + 3 * start, ijk, pc, inside);
+
+    for (vtkIdType p = 0; p < num; ++p, pc += 3)
+    {
+      int* idx = ijk + 3 * p;
+      if (!inside[p])
+      {
+        // Same tolerance check as FindCell()
+        double dist2 = 0.0;
+        for (int i = 0; i < 3; i++)
+        {
+          const int minIdx = extent[i * 2];
+          const int maxIdx = extent[i * 2 + 1];
+          if (idx[i] < minIdx)
+          {
+            const double dist = (idx[i] + pc[i] - minIdx) * spacing[i];
+            idx[i] = minIdx;
+            pc[i] = 0.0;
+            dist2 += dist * dist;
+          }
+          else if (idx[i] >= maxIdx)
+          {
+            const double dist = (idx[i] + pc[i] - maxIdx) * spacing[i];
+            if (maxIdx == minIdx)
+            {
+              idx[i] = minIdx;
+              pc[i] = 0.0;
+            }
+            else
+            {
+              idx[i] = maxIdx - 1;
+              pc[i] = 1.0;
+            }
+            dist2 += dist * dist;
+          }
+        }
+        if (dist2 > tol2)
+        {
+          cellIds[start + p] = -1;
+          continue;
+        }
+      }
+
+      if (weights)
+      {
+        // Shift parametric coordinates for XZ/YZ planes
+        if (this->DataDescription == VTK_XZ_PLANE)
+        {
+          pc[1] = pc[2];
+          pc[2] = 0.0;
+        }
+        else if (this->DataDescription == VTK_YZ_PLANE)
+        {
+          pc[0] = pc[1];
+          pc[1] = pc[2];
+          pc[2] = 0.0;
+        }
+        else if (this->DataDescription == VTK_XY_PLANE)
+        {
+          pc[2] = 0.0;
+        }
+        vtkVoxel::InterpolationFunctions(pc, weights + 8 * (start + p));
+      }
+      cellIds[start + p] = vtkStructuredData::ComputeCellIdForExtent(extent, idx);
+      ++numFound;
+    }
+  }
+  return numFound;
+}
+
 //------------------------------------------------------------------------------
 void vtkImageData::PrintSelf(ostream& os, vtkIndent indent)
 {
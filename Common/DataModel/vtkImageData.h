@@ -193,6 +193,34 @@ public:
    */
   virtual int ComputeStructuredCoordinates(const double x[3], int ijk[3], double pcoords[3]);
 
+  /**
+   * Compute the structured coordinates of numPoints points at once, with the
+   * same result as ComputeStructuredCoordinates() called for each point. x
+   * holds 3 coordinates per point, ijk and pcoords receive 3 values per
+   * point and inside is set to 1 for the points inside the volume, 0 for the
+   * others. Returns the number of points inside the volume. The transform to
+   * index space (including the direction matrix) is applied to the points by
+   * blocks, in loops the compiler can vectorize. This method is thread safe.
+   */
+  vtkIdType ComputeStructuredCoordinates(vtkIdType numPoints, const double x[], int ijk[],
+    double pcoords[], unsigned char inside[]) VTK_SIZEHINT(x, 3 * numPoints)
+    VTK_SIZEHINT(ijk, 3 * numPoints) VTK_SIZEHINT(pcoords, 3 * numPoints)
+    VTK_SIZEHINT(inside, numPoints);
+
+  /**
+   * Locate numPoints points at once, with the same result as the FindCell()
+   * method of vtkImageData called for each point with the tolerance tol2.
+   * cellIds receives the id of the cell containing each point, or -1. When
+   * not null, pcoords receives 3 parametric coordinates per point and weights
+   * the 8 trilinear interpolation weights of each point (see vtkVoxel), of
+   * which only the first 4 or 2 are used for 2D and 1D images. Returns the
+   * number of points found. This method is thread safe.
+   */
+  vtkIdType FindCells(vtkIdType numPoints, const double x[], double tol2, vtkIdType cellIds[],
+    double pcoords[], double weights[]) VTK_SIZEHINT(x, 3 * numPoints)
+    VTK_SIZEHINT(cellIds, numPoints) VTK_SIZEHINT(pcoords, 3 * numPoints)
+    VTK_SIZEHINT(weights, 8 * numPoints);
+
   /**
    * Given structured coordinates (i,j,k) for a voxel cell, compute the eight
    * gradient values for the voxel corners. The order in which the gradient
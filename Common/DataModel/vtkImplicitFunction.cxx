@@ -17,7 +17,9 @@
 #include "vtkAbstractTransform.h"
 #include "vtkArrayDispatch.h"
 #include "vtkDataArrayRange.h"
+#include "vtkHomogeneousTransform.h"
 #include "vtkMath.h"
+#include "vtkMatrix4x4.h"
 #include "vtkTransform.h"
 
 #include <algorithm>
@@ -251,6 +253,36 @@ void vtkImplicitFunction::PrintSelf(ostream& os, vtkIndent indent)
   }
 }
 
+bool vtkImplicitFunction::PrintParameterKey(ostream&)
+{
+  return false;
+}
+
+bool vtkImplicitFunction::PrintTransformKey(ostream& os)
+{
+  if (!this->Transform)
+  {
+    os << "Transform none\n";
+    return true;
+  }
+  vtkHomogeneousTransform* transform = vtkHomogeneousTransform::SafeDownCast(this->Transform);
+  if (!transform)
+  {
+    return false;
+  }
+  vtkMatrix4x4* matrix = transform->GetMatrix();
+  os << "Transform";
+  for (int i = 0; i < 4; ++i)
+  {
+    for (int j = 0; j < 4; ++j)
+    {
+      os << " " << matrix->GetElement(i, j);
+    }
+  }
+  os << "\n";
+  return true;
+}
+
 void vtkImplicitFunction::SetTransform(const double elements[16])
 {
   vtkTransform* transform = vtkTransform::New();
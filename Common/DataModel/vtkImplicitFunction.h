@@ -135,10 +135,25 @@ public:
    */
   virtual void EvaluateGradient(double x[3], double g[3]) = 0;
 
+  /**
+   * Print a key identifying the values of the parameters of the function,
+   * including its transform, so that the result caches of the algorithms
+   * using it (vtkAlgorithm::PrintParameterKey()) recognize a function set
+   * back to previous values. Returns false, the default, when the function
+   * provides no such key: the algorithms then rely on its modification time.
+   */
+  virtual bool PrintParameterKey(ostream& os);
+
 protected:
   vtkImplicitFunction();
   ~vtkImplicitFunction() override;
 
+  /**
+   * Print the transform of the function for PrintParameterKey(). Returns
+   * false, printing nothing, if the transform is not a linear transform.
+   */
+  bool PrintTransformKey(ostream& os);
+
   vtkAbstractTransform* Transform;
   double ReturnValue[3];
 
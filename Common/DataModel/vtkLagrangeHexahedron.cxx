@@ -94,18 +94,18 @@ vtkHexahedron* vtkLagrangeHexahedron::GetApproximateHex(
   {
     scalarsOut->SetNumberOfTuples(8);
   }
-  int i, j, k;
-  if (!this->SubCellCoordinatesFromId(i, j, k, subId))
+  const vtkHigherOrderCellTables::Table* tables = this->GetTables();
+  if (subId < 0 || subId >= tables->NumberOfSubCells)
   {
     vtkErrorMacro("Invalid subId " << subId);
     return nullptr;
   }
   // Get the point coordinates (and optionally scalars) for each of the 8 corners
   // in the approximating hexahedron spanned by (i, i+1) x (j, j+1) x (k, k+1):
+  const vtkIdType* corners = tables->GetSubCellPoints(subId);
   for (vtkIdType ic = 0; ic < 8; ++ic)
   {
-    const vtkIdType corner = this->PointIndexFromIJK(
-      i + ((((ic + 1) / 2) % 2) ? 1 : 0), j + (((ic / 2) % 2) ? 1 : 0), k + ((ic / 4) ? 1 : 0));
+    const vtkIdType corner = corners[ic];
     vtkVector3d cp;
     this->Points->GetPoint(corner, cp.GetData());
     approx->Points->SetPoint(ic, cp.GetData());
@@ -23,6 +23,7 @@
 #include "vtkSMPTools.h"
 
 #include <algorithm>
+#include <cstring>
 
 vtkStandardNewMacro(vtkPlane);
 
@@ -497,6 +498,18 @@ int vtkPlane::IntersectWithFinitePlane(
     this->GetNormal(), this->GetOrigin(), pOrigin, px, py, x0, x1);
 }
 
+//------------------------------------------------------------------------------
+bool vtkPlane::PrintParameterKey(ostream& os)
+{
+  if (strcmp(this->GetClassName(), "vtkPlane") != 0 || !this->PrintTransformKey(os))
+  {
+    return false;
+  }
+  os << "vtkPlane origin " << this->Origin[0] << " " << this->Origin[1] << " " << this->Origin[2]
+     << " normal " << this->Normal[0] << " " << this->Normal[1] << " " << this->Normal[2] << "\n";
+  return true;
+}
+
 //------------------------------------------------------------------------------
 void vtkPlane::PrintSelf(ostream& os, vtkIndent indent)
 {
@@ -55,6 +55,13 @@ public:
    */
   void EvaluateGradient(double x[3], double g[3]) override;
 
+  /**
+   * Print the parameters of the function, see
+   * vtkImplicitFunction::PrintParameterKey(). Subclasses get no key unless
+   * they override it.
+   */
+  bool PrintParameterKey(ostream& os) override;
+
   ///@{
   /**
    * Set/get plane normal. Plane is defined by point and normal.
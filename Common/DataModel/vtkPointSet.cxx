@@ -134,6 +134,17 @@ void vtkPointSet::ComputeBounds()
   }
 }
 
+//------------------------------------------------------------------------------
+vtkMTimeType vtkPointSet::GetMeshMTime()
+{
+  vtkMTimeType time = this->Superclass::GetMeshMTime();
+  if (this->Points && this->Points->GetMTime() > time)
+  {
+    time = this->Points->GetMTime();
+  }
+  return time;
+}
+
 //------------------------------------------------------------------------------
 vtkMTimeType vtkPointSet::GetMTime()
 {
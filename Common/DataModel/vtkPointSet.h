@@ -206,6 +206,11 @@ public:
    */
   vtkMTimeType GetMTime() override;
 
+  /**
+   * Get the mesh MTime which also considers its vtkPoints MTime.
+   */
+  vtkMTimeType GetMeshMTime() override;
+
   /**
    * Compute the (X, Y, Z)  bounds of the data.
    */
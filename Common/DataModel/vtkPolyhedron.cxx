@@ -31,11 +31,13 @@ PURPOSE.  See the above copyright notice for more information.
 #include "vtkPointLocator.h"
 #include "vtkPolyData.h"
 #include "vtkPolygon.h"
+#include "vtkPolyhedronTopologyCache.h"
 #include "vtkQuad.h"
 #include "vtkTetra.h"
 #include "vtkTriangle.h"
 #include "vtkVector.h"
 
+#include <algorithm>
 #include <cmath>
 #include <functional>
 #include <map>
@@ -180,6 +182,13 @@ vtkPolyhedron::vtkPolyhedron()
   this->FacesGenerated = 0;
   this->Faces = vtkIdTypeArray::New();
 
+  this->FaceTrianglesGenerated = 0;
+  this->FaceTriangles = vtkIdTypeArray::New();
+  this->FaceTriangleOffsets = vtkIdTypeArray::New();
+
+  this->Centroid[0] = this->Centroid[1] = this->Centroid[2] = 0.0;
+  this->CentroidLoaded = 0;
+
   this->BoundsComputed = 0;
 
   this->PolyDataConstructed = 0;
@@ -217,6 +226,8 @@ vtkPolyhedron::~vtkPolyhedron()
   this->Edges->Delete();
   this->EdgeFaces->Delete();
   this->Faces->Delete();
+  this->FaceTriangles->Delete();
+  this->FaceTriangleOffsets->Delete();
   this->PolyData->Delete();
   this->Polys->Delete();
   this->CellLocator->Delete();
@@ -348,6 +359,12 @@ void vtkPolyhedron::Initialize()
   // global ids to local, canonical ids.
   this->FacesGenerated = 0;
 
+  // Face triangulation and centroid are computed on demand
+  this->FaceTriangles->Reset();
+  this->FaceTriangleOffsets->Reset();
+  this->FaceTrianglesGenerated = 0;
+  this->CentroidLoaded = 0;
+
   // No bounds have been computed as of yet.
   this->BoundsComputed = 0;
 
@@ -551,24 +568,16 @@ void vtkPolyhedron::SetFaces(vtkIdType* faces)
   vtkIdType nfaces = faces[0];
   this->FaceLocations->SetNumberOfValues(nfaces);
 
-  this->GlobalFaces->InsertNextValue(nfaces);
-  vtkIdType* face = faces + 1;
+  // The face stream is copied as is; only the face locations are computed.
   vtkIdType faceLoc = 1;
-  vtkIdType i, fid, npts;
-
-  for (fid = 0; fid < nfaces; ++fid)
+  for (vtkIdType fid = 0; fid < nfaces; ++fid)
   {
-    npts = face[0];
-    this->GlobalFaces->InsertNextValue(npts);
-    for (i = 1; i <= npts; ++i)
-    {
-      this->GlobalFaces->InsertNextValue(face[i]);
-    }
     this->FaceLocations->SetValue(fid, faceLoc);
-
-    faceLoc += face[0] + 1;
-    face = faces + faceLoc;
+    faceLoc += faces[faceLoc] + 1;
   } // for all faces
+
+  this->GlobalFaces->SetNumberOfValues(faceLoc);
+  std::copy(faces, faces + faceLoc, this->GlobalFaces->GetPointer(0));
 }
 
 //------------------------------------------------------------------------------
@@ -583,6 +592,103 @@ vtkIdType* vtkPolyhedron::GetFaces()
   return this->GlobalFaces->GetPointer(0);
 }
 
+//------------------------------------------------------------------------------
+void vtkPolyhedron::GetEdgePoints(vtkIdType edgeId, const vtkIdType*& pts)
+{
+  this->GenerateEdges();
+  pts = this->Edges->GetPointer(2 * edgeId);
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkPolyhedron::GetFacePoints(vtkIdType faceId, const vtkIdType*& pts)
+{
+  this->GenerateFaces();
+  const vtkIdType* face = this->Faces->GetPointer(this->FaceLocations->GetValue(faceId));
+  pts = face + 1;
+  return face[0];
+}
+
+//------------------------------------------------------------------------------
+void vtkPolyhedron::GetEdgeToAdjacentFaces(vtkIdType edgeId, const vtkIdType*& faceIds)
+{
+  this->GenerateEdges();
+  faceIds = this->EdgeFaces->GetPointer(2 * edgeId);
+}
+
+//------------------------------------------------------------------------------
+// The centroid is the average of the cell points.
+bool vtkPolyhedron::GetCentroid(double centroid[3]) const
+{
+  if (this->CentroidLoaded)
+  {
+    std::copy(this->Centroid, this->Centroid + 3, centroid);
+    return true;
+  }
+
+  const vtkIdType numPts = this->Points->GetNumberOfPoints();
+  centroid[0] = centroid[1] = centroid[2] = 0.0;
+  if (numPts == 0)
+  {
+    return false;
+  }
+
+  double p[3];
+  for (vtkIdType i = 0; i < numPts; ++i)
+  {
+    this->Points->GetPoint(i, p);
+    centroid[0] += p[0];
+    centroid[1] += p[1];
+    centroid[2] += p[2];
+  }
+  centroid[0] /= numPts;
+  centroid[1] /= numPts;
+  centroid[2] /= numPts;
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool vtkPolyhedron::LoadTopology(vtkPolyhedronTopologyCache* cache, vtkIdType cellId)
+{
+  const vtkIdType idx = cache ? cache->GetPolyhedronIndex(cellId) : -1;
+  if (idx < 0)
+  {
+    return false;
+  }
+
+  const vtkIdType* values = cache->GetFaces(idx);
+  vtkIdType size = cache->GetFacesSize(idx);
+  this->Faces->SetNumberOfValues(size);
+  std::copy(values, values + size, this->Faces->GetPointer(0));
+  this->FacesGenerated = 1;
+
+  // The edge table is left empty, the edges are only accessed by index.
+  const vtkIdType numEdges = cache->GetNumberOfEdges(idx);
+  this->EdgeTable->Reset();
+  this->Edges->SetNumberOfTuples(numEdges);
+  this->EdgeFaces->SetNumberOfTuples(numEdges);
+  values = cache->GetEdges(idx);
+  std::copy(values, values + 2 * numEdges, this->Edges->GetPointer(0));
+  values = cache->GetEdgeFaces(idx);
+  std::copy(values, values + 2 * numEdges, this->EdgeFaces->GetPointer(0));
+  this->EdgesGenerated = 1;
+
+  size = 3 * cache->GetNumberOfFaceTriangles(idx);
+  values = cache->GetFaceTriangles(idx);
+  this->FaceTriangles->SetNumberOfValues(size);
+  std::copy(values, values + size, this->FaceTriangles->GetPointer(0));
+  size = this->Faces->GetValue(0) + 1;
+  values = cache->GetFaceTriangleOffsets(idx);
+  this->FaceTriangleOffsets->SetNumberOfValues(size);
+  std::copy(values, values + size, this->FaceTriangleOffsets->GetPointer(0));
+  this->FaceTrianglesGenerated = 1;
+
+  const double* centroid = cache->GetCentroid(idx);
+  std::copy(centroid, centroid + 3, this->Centroid);
+  this->CentroidLoaded = 1;
+
+  return true;
+}
+
 //------------------------------------------------------------------------------
 int vtkPolyhedron::IntersectWithLine(const double p1[3], const double p2[3], double tol,
   double& tMin, double xMin[3], double pc[3], int& subId)
@@ -814,7 +920,7 @@ bool vtkPolyhedron::IsConvex()
 {
   double x[2][3], n[3], c[3], c0[3], c1[3], c0p[3], c1p[3], n0[3], n1[3];
   double np[3], tmp0, tmp1;
-  vtkIdType i, w[2], edgeId, edgeFaces[2], loc, v, *face, r = 0;
+  vtkIdType i, w[2], edgeId, numEdges, edgeFaces[2], loc, v, *face, r = 0;
   const double eps = FLT_EPSILON;
 
   std::vector<double> p(this->PointIds->GetNumberOfIds());
@@ -827,9 +933,11 @@ bool vtkPolyhedron::IsConvex()
   this->ComputeBounds();
 
   // loop over all edges in the polyhedron
-  this->EdgeTable->InitTraversal();
-  while ((edgeId = this->EdgeTable->GetNextEdge(w[0], w[1])) >= 0)
+  numEdges = this->Edges->GetNumberOfTuples();
+  for (edgeId = 0; edgeId < numEdges; ++edgeId)
   {
+    this->Edges->GetTypedTuple(edgeId, w);
+
     // get the edge points
     this->Points->GetPoint(w[0], x[0]);
     this->Points->GetPoint(w[1], x[1]);
@@ -1625,6 +1733,47 @@ void TriangulateFace(vtkCell* face, FaceVector& faces, vtkIdList* triIds, vtkPoi
   }
 }
 
+//------------------------------------------------------------------------------
+vtkIdTypeArray* vtkPolyhedron::GetFaceTriangles()
+{
+  if (this->FaceTrianglesGenerated)
+  {
+    return this->FaceTriangles;
+  }
+
+  // Triangulate the faces in global id space, then renumber the triangles.
+  FaceVector triangles;
+  vtkNew<vtkIdList> triIds;
+  const int nFaces = this->GetNumberOfFaces();
+  this->FaceTriangleOffsets->SetNumberOfValues(nFaces + 1);
+  this->FaceTriangleOffsets->SetValue(0, 0);
+  for (int i = 0; i < nFaces; ++i)
+  {
+    TriangulateFace(this->GetFace(i), triangles, triIds, this->Points, this->PointIdMap);
+    this->FaceTriangleOffsets->SetValue(i + 1, static_cast<vtkIdType>(triangles.size()));
+  }
+
+  this->FaceTriangles->SetNumberOfValues(3 * static_cast<vtkIdType>(triangles.size()));
+  vtkIdType* tri = this->FaceTriangles->GetPointer(0);
+  for (const Face& triangle : triangles)
+  {
+    for (vtkIdType id : triangle)
+    {
+      *tri++ = (*this->PointIdMap)[id];
+    }
+  }
+
+  this->FaceTrianglesGenerated = 1;
+  return this->FaceTriangles;
+}
+
+//------------------------------------------------------------------------------
+vtkIdTypeArray* vtkPolyhedron::GetFaceTriangleOffsets()
+{
+  this->GetFaceTriangles();
+  return this->FaceTriangleOffsets;
+}
+
 bool CheckNonManifoldTriangulation(EdgeFaceSetMap& edgeFaceMap)
 {
   for (const auto& entry : edgeFaceMap)
@@ -1657,23 +1806,21 @@ bool GetContourPoints(double value, vtkPolyhedron* cell,
     return false;
   }
 
-  // temporaries for triangulation
-  vtkNew<vtkIdList> triIds;
+  // the face triangulation is computed in canonical id space (or loaded from
+  // a topology cache), it is converted back to global ids here.
+  const vtkIdType* triangles = cell->GetFaceTriangles()->GetPointer(0);
+  const vtkIdType* triOffsets = cell->GetFaceTriangleOffsets()->GetPointer(0);
+  vtkIdList* cellPointIds = cell->GetPointIds();
 
   for (vtkIdType i = 0; i < nFaces; ++i)
   {
-    vtkCell* face = cell->GetFace(i);
-    if (!face)
-    {
-      return false;
-    }
-
-    size_t nTris = faces.size();
-    TriangulateFace(face, faces, triIds, cell->GetPoints(), pointIdMap);
     std::vector<vtkIdType> trisOfFace;
-    for (size_t j = nTris; j < faces.size(); ++j)
+    const vtkIdType* tri = triangles + 3 * triOffsets[i];
+    for (vtkIdType j = triOffsets[i]; j < triOffsets[i + 1]; ++j, tri += 3)
     {
-      trisOfFace.push_back((vtkIdType)j);
+      trisOfFace.push_back(static_cast<vtkIdType>(faces.size()));
+      faces.push_back(Face{ cellPointIds->GetId(tri[0]), cellPointIds->GetId(tri[1]),
+        cellPointIds->GetId(tri[2]) });
     }
     oririginalFaceTriFaceMap.push_back(trisOfFace);
   }
@@ -53,6 +53,7 @@ class vtkPolyData;
 class vtkCellLocator;
 class vtkGenericCell;
 class vtkPointLocator;
+class vtkPolyhedronTopologyCache;
 
 class VTKCOMMONDATAMODEL_EXPORT vtkPolyhedron : public vtkCell3D
 {
@@ -66,15 +67,25 @@ public:
   void PrintSelf(ostream& os, vtkIndent indent) override;
   ///@}
 
+  ///@{
+  /**
+   * See vtkCell3D API for description of these methods. Edge and face
+   * point ids are returned in canonical id space (i.e., they index the points
+   * of the cell), and the adjacent faces of an edge are -1 when the edge is
+   * used by a single face.
+   */
+  void GetEdgePoints(vtkIdType edgeId, const vtkIdType*& pts) override;
+  vtkIdType GetFacePoints(vtkIdType faceId, const vtkIdType*& pts) override;
+  void GetEdgeToAdjacentFaces(vtkIdType edgeId, const vtkIdType*& faceIds) override;
+  vtkIdType GetPointToIncidentFaces(vtkIdType pointId, const vtkIdType*& faceIds) override;
+  bool GetCentroid(double centroid[3]) const override;
+  ///@}
+
   ///@{
   /**
    * See vtkCell3D API for description of these methods.
    * @warning These method are unimplemented in vtkPolyhedron
    */
-  void GetEdgePoints(vtkIdType vtkNotUsed(edgeId), const vtkIdType*& vtkNotUsed(pts)) override
-  {
-    vtkWarningMacro(<< "vtkPolyhedron::GetEdgePoints Not Implemented");
-  }
   // @deprecated Replaced by GetEdgePoints(vtkIdType, const vtkIdType*&) as of VTK 9.0
   VTK_DEPRECATED_IN_9_0_0("Replaced by vtkPolyhedron::GetEdgePoints(vtkIdType, const vtkIdType*&)")
   void GetEdgePoints(int vtkNotUsed(edgeId), int*& vtkNotUsed(pts)) override
@@ -83,11 +94,6 @@ public:
                      "Also note that this signature is deprecated. "
                      "Please use GetEdgePoints(vtkIdType, const vtkIdType*& instead");
   };
-  vtkIdType GetFacePoints(vtkIdType vtkNotUsed(faceId), const vtkIdType*& vtkNotUsed(pts)) override
-  {
-    vtkWarningMacro(<< "vtkPolyhedron::GetFacePoints Not Implemented");
-    return 0;
-  }
   // @deprecated Replaced by GetFacePoints(vtkIdType, const vtkIdType*&) as of VTK 9.0
   VTK_DEPRECATED_IN_9_0_0("Replaced by vtkPolyhedron::GetFacePoints(vtkIdType, const vtkIdType*&)")
   void GetFacePoints(int vtkNotUsed(faceId), int*& vtkNotUsed(pts)) override
@@ -96,11 +102,6 @@ public:
                        "Also note that this signature is deprecated. "
                        "Please use GetFacePoints(vtkIdType, const vtkIdType*& instead");
   };
-  void GetEdgeToAdjacentFaces(
-    vtkIdType vtkNotUsed(edgeId), const vtkIdType*& vtkNotUsed(pts)) override
-  {
-    vtkWarningMacro(<< "vtkPolyhedron::GetEdgeToAdjacentFaces Not Implemented");
-  }
   vtkIdType GetFaceToAdjacentFaces(
     vtkIdType vtkNotUsed(faceId), const vtkIdType*& vtkNotUsed(faceIds)) override
   {
@@ -113,18 +114,12 @@ public:
     vtkWarningMacro(<< "vtkPolyhedron::GetPointToIncidentEdges Not Implemented");
     return 0;
   }
-  vtkIdType GetPointToIncidentFaces(vtkIdType pointId, const vtkIdType*& faceIds) override;
   vtkIdType GetPointToOneRingPoints(
     vtkIdType vtkNotUsed(pointId), const vtkIdType*& vtkNotUsed(pts)) override
   {
     vtkWarningMacro(<< "vtkPolyhedron::GetPointToOneRingPoints Not Implemented");
     return 0;
   }
-  bool GetCentroid(double vtkNotUsed(centroid)[3]) const override
-  {
-    vtkWarningMacro(<< "vtkPolyhedron::GetCentroid Not Implemented");
-    return false;
-  }
   ///@}
 
   /**
@@ -290,6 +285,30 @@ public:
    */
   vtkPolyData* GetPolyData();
 
+  /**
+   * Return the triangulation of the faces used by Contour() and Clip(). Each
+   * face with n points is split into n-2 triangles by the fan whose internal
+   * angles are closest to 60 degrees. The triangles are stored face after
+   * face as triplets of point ids in canonical id space.
+   */
+  vtkIdTypeArray* GetFaceTriangles();
+
+  /**
+   * Return the number of faces plus one triangle indices locating the
+   * triangles of each face in GetFaceTriangles(): face i owns the triplets
+   * offsets[i] to offsets[i+1]-1. A face that could not be triangulated
+   * owns no triangle, so do not assume n-2 triangles per face.
+   */
+  vtkIdTypeArray* GetFaceTriangleOffsets();
+
+  /**
+   * Load the faces, edges, face triangles and centroid of this cell from a
+   * topology cache instead of regenerating them on demand. This is used by
+   * vtkUnstructuredGrid::GetCell() after the cell has been initialized.
+   * Returns false (and loads nothing) if the cache has no entry for cellId.
+   */
+  bool LoadTopology(vtkPolyhedronTopologyCache* cache, vtkIdType cellId);
+
 protected:
   vtkPolyhedron();
   ~vtkPolyhedron() override;
@@ -326,6 +345,15 @@ protected:
   int FacesGenerated;
   void GenerateFaces();
 
+  // Face triangulation used for contouring and clipping, in canonical space.
+  vtkIdTypeArray* FaceTriangles;
+  vtkIdTypeArray* FaceTriangleOffsets;
+  int FaceTrianglesGenerated;
+
+  // Centroid, only available when loaded from a topology cache.
+  double Centroid[3];
+  int CentroidLoaded;
+
   // Bounds management
   int BoundsComputed;
   void ComputeBounds();
@@ -0,0 +1,297 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkPolyhedronTopologyCache.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkPolyhedronTopologyCache.h"
+
+#include "vtkCellArray.h"
+#include "vtkGenericCell.h"
+#include "vtkIdTypeArray.h"
+#include "vtkObjectFactory.h"
+#include "vtkPoints.h"
+#include "vtkPolyhedron.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
+#include "vtkUnsignedCharArray.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+vtkStandardNewMacro(vtkPolyhedronTopologyCache);
+
+namespace
+{
+//------------------------------------------------------------------------------
+// Sizes of the grid arrays the cache depends on, used to detect stale caches.
+void GetSourceSizes(vtkUnstructuredGrid* grid, vtkIdType sizes[3])
+{
+  vtkIdTypeArray* faces = grid->GetFaces();
+  sizes[0] = grid->GetNumberOfPoints();
+  sizes[1] = grid->GetNumberOfCells();
+  sizes[2] = faces ? faces->GetNumberOfValues() : 0;
+}
+
+//------------------------------------------------------------------------------
+// Load each polyhedron in a thread local vtkPolyhedron and extract the
+// topology it generates. The sizes are written directly in the (shifted)
+// offset arrays, while the values are accumulated in thread local buffers
+// and copied in place once the offsets are known.
+struct ExtractPolyhedronTopology
+{
+  struct LocalData
+  {
+    std::vector<vtkIdType> Indices;
+    std::vector<vtkIdType> Faces;
+    std::vector<vtkIdType> Edges;
+    std::vector<vtkIdType> EdgeFaces;
+    std::vector<vtkIdType> Triangles;
+    std::vector<vtkIdType> FaceTriangleStarts;
+  };
+
+  vtkUnstructuredGrid* Grid;
+  const vtkIdType* CellIds;
+  vtkIdType* FaceSizes;
+  vtkIdType* EdgeSizes;
+  vtkIdType* TriangleSizes;
+  vtkIdType* FaceTriangleStartSizes;
+  double* Centroids;
+  vtkSMPThreadLocalObject<vtkGenericCell> Cell;
+  vtkSMPThreadLocal<LocalData> Local;
+
+  ExtractPolyhedronTopology(vtkUnstructuredGrid* grid, const vtkIdType* cellIds,
+    vtkIdType* faceSizes, vtkIdType* edgeSizes, vtkIdType* triSizes, vtkIdType* faceTriSizes,
+    double* centroids)
+    : Grid(grid)
+    , CellIds(cellIds)
+    , FaceSizes(faceSizes)
+    , EdgeSizes(edgeSizes)
+    , TriangleSizes(triSizes)
+    , FaceTriangleStartSizes(faceTriSizes)
+    , Centroids(centroids)
+  {
+  }
+
+  void Initialize() {}
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    vtkGenericCell* cell = this->Cell.Local();
+    LocalData& local = this->Local.Local();
+
+    for (vtkIdType idx = begin; idx < end; ++idx)
+    {
+      this->Grid->GetCell(this->CellIds[idx], cell);
+      vtkPolyhedron* polyhedron = static_cast<vtkPolyhedron*>(cell->GetRepresentativeCell());
+      local.Indices.push_back(idx);
+      const vtkIdType* ids;
+
+      // Face stream in canonical id space
+      const vtkIdType numFaces = polyhedron->GetNumberOfFaces();
+      const size_t numFaceValues = local.Faces.size();
+      local.Faces.push_back(numFaces);
+      for (vtkIdType faceId = 0; faceId < numFaces; ++faceId)
+      {
+        const vtkIdType npts = polyhedron->GetFacePoints(faceId, ids);
+        local.Faces.push_back(npts);
+        local.Faces.insert(local.Faces.end(), ids, ids + npts);
+      }
+      this->FaceSizes[idx + 1] = static_cast<vtkIdType>(local.Faces.size() - numFaceValues);
+
+      // Edges and the faces using them
+      const vtkIdType numEdges = polyhedron->GetNumberOfEdges();
+      for (vtkIdType edgeId = 0; edgeId < numEdges; ++edgeId)
+      {
+        polyhedron->GetEdgePoints(edgeId, ids);
+        local.Edges.insert(local.Edges.end(), ids, ids + 2);
+        polyhedron->GetEdgeToAdjacentFaces(edgeId, ids);
+        local.EdgeFaces.insert(local.EdgeFaces.end(), ids, ids + 2);
+      }
+      this->EdgeSizes[idx + 1] = 2 * numEdges;
+
+      // Face triangulation
+      vtkIdTypeArray* triangles = polyhedron->GetFaceTriangles();
+      const vtkIdType numTriangleValues = triangles->GetNumberOfValues();
+      ids = triangles->GetPointer(0);
+      local.Triangles.insert(local.Triangles.end(), ids, ids + numTriangleValues);
+      this->TriangleSizes[idx + 1] = numTriangleValues;
+
+      // Faces may have any number of triangles, keep where each one starts.
+      vtkIdTypeArray* faceTriOffsets = polyhedron->GetFaceTriangleOffsets();
+      ids = faceTriOffsets->GetPointer(0);
+      local.FaceTriangleStarts.insert(
+        local.FaceTriangleStarts.end(), ids, ids + faceTriOffsets->GetNumberOfValues());
+      this->FaceTriangleStartSizes[idx + 1] = faceTriOffsets->GetNumberOfValues();
+
+      polyhedron->GetCentroid(this->Centroids + 3 * idx);
+    }
+  }
+
+  void Reduce() {}
+};
+} // anonymous namespace
+
+//------------------------------------------------------------------------------
+void vtkPolyhedronTopologyCache::Initialize()
+{
+  this->CellToPolyhedron.clear();
+  this->PolyhedronCellIds.clear();
+  this->FaceOffsets.clear();
+  this->Faces.clear();
+  this->EdgeOffsets.clear();
+  this->Edges.clear();
+  this->EdgeFaces.clear();
+  this->TriangleOffsets.clear();
+  this->Triangles.clear();
+  this->FaceTriangleStartOffsets.clear();
+  this->FaceTriangleStarts.clear();
+  this->Centroids.clear();
+  std::fill(this->Source, this->Source + 4, nullptr);
+  std::fill(this->SourceSize, this->SourceSize + 3, 0);
+  this->Modified();
+}
+
+//------------------------------------------------------------------------------
+void vtkPolyhedronTopologyCache::Build(vtkUnstructuredGrid* grid)
+{
+  this->Initialize();
+  if (!grid || !grid->GetCellTypesArray() || !grid->GetPoints())
+  {
+    return;
+  }
+
+  // Number the polyhedra in cell order.
+  vtkUnsignedCharArray* types = grid->GetCellTypesArray();
+  const vtkIdType numCells = grid->GetNumberOfCells();
+  this->CellToPolyhedron.assign(numCells, -1);
+  for (vtkIdType cellId = 0; cellId < numCells; ++cellId)
+  {
+    if (types->GetValue(cellId) == VTK_POLYHEDRON)
+    {
+      this->CellToPolyhedron[cellId] = static_cast<vtkIdType>(this->PolyhedronCellIds.size());
+      this->PolyhedronCellIds.push_back(cellId);
+    }
+  }
+
+  const vtkIdType numPolyhedra = this->GetNumberOfPolyhedra();
+  this->FaceOffsets.assign(numPolyhedra + 1, 0);
+  this->EdgeOffsets.assign(numPolyhedra + 1, 0);
+  this->TriangleOffsets.assign(numPolyhedra + 1, 0);
+  this->FaceTriangleStartOffsets.assign(numPolyhedra + 1, 0);
+  this->Centroids.resize(3 * numPolyhedra);
+
+  if (numPolyhedra > 0)
+  {
+    ExtractPolyhedronTopology extract(grid, this->PolyhedronCellIds.data(),
+      this->FaceOffsets.data(), this->EdgeOffsets.data(), this->TriangleOffsets.data(),
+      this->FaceTriangleStartOffsets.data(), this->Centroids.data());
+    vtkSMPTools::For(0, numPolyhedra, extract);
+
+    // Sizes were stored one slot to the right; turn them into offsets.
+    std::partial_sum(this->FaceOffsets.begin(), this->FaceOffsets.end(), this->FaceOffsets.begin());
+    std::partial_sum(this->EdgeOffsets.begin(), this->EdgeOffsets.end(), this->EdgeOffsets.begin());
+    std::partial_sum(
+      this->TriangleOffsets.begin(), this->TriangleOffsets.end(), this->TriangleOffsets.begin());
+    std::partial_sum(this->FaceTriangleStartOffsets.begin(), this->FaceTriangleStartOffsets.end(),
+      this->FaceTriangleStartOffsets.begin());
+
+    this->Faces.resize(this->FaceOffsets.back());
+    this->Edges.resize(this->EdgeOffsets.back());
+    this->EdgeFaces.resize(this->EdgeOffsets.back());
+    this->Triangles.resize(this->TriangleOffsets.back());
+    this->FaceTriangleStarts.resize(this->FaceTriangleStartOffsets.back());
+
+    for (auto& local : extract.Local)
+    {
+      const vtkIdType* faces = local.Faces.data();
+      const vtkIdType* edges = local.Edges.data();
+      const vtkIdType* edgeFaces = local.EdgeFaces.data();
+      const vtkIdType* triangles = local.Triangles.data();
+      const vtkIdType* faceTriStarts = local.FaceTriangleStarts.data();
+      for (vtkIdType idx : local.Indices)
+      {
+        vtkIdType size = this->GetFacesSize(idx);
+        std::copy(faces, faces + size, this->Faces.begin() + this->FaceOffsets[idx]);
+        faces += size;
+
+        size = this->EdgeOffsets[idx + 1] - this->EdgeOffsets[idx];
+        std::copy(edges, edges + size, this->Edges.begin() + this->EdgeOffsets[idx]);
+        std::copy(edgeFaces, edgeFaces + size, this->EdgeFaces.begin() + this->EdgeOffsets[idx]);
+        edges += size;
+        edgeFaces += size;
+
+        size = this->TriangleOffsets[idx + 1] - this->TriangleOffsets[idx];
+        std::copy(triangles, triangles + size, this->Triangles.begin() + this->TriangleOffsets[idx]);
+        triangles += size;
+
+        size = this->FaceTriangleStartOffsets[idx + 1] - this->FaceTriangleStartOffsets[idx];
+        std::copy(faceTriStarts, faceTriStarts + size,
+          this->FaceTriangleStarts.begin() + this->FaceTriangleStartOffsets[idx]);
+        faceTriStarts += size;
+      }
+    }
+  }
+
+  this->Source[0] = grid->GetPoints();
+  this->Source[1] = grid->GetCells();
+  this->Source[2] = grid->GetFaces();
+  this->Source[3] = grid->GetFaceLocations();
+  GetSourceSizes(grid, this->SourceSize);
+  this->BuildTime.Modified();
+}
+
+//------------------------------------------------------------------------------
+bool vtkPolyhedronTopologyCache::IsUpToDate(vtkUnstructuredGrid* grid) const
+{
+  if (!grid || grid->GetPoints() != this->Source[0] || grid->GetCells() != this->Source[1] ||
+    grid->GetFaces() != this->Source[2] || grid->GetFaceLocations() != this->Source[3])
+  {
+    return false;
+  }
+
+  vtkIdType sizes[3];
+  GetSourceSizes(grid, sizes);
+  if (!std::equal(sizes, sizes + 3, this->SourceSize))
+  {
+    return false;
+  }
+
+  const vtkMTimeType buildTime = this->BuildTime.GetMTime();
+  return grid->GetPoints()->GetMTime() < buildTime && grid->GetCells()->GetMTime() < buildTime &&
+    (!grid->GetFaces() || grid->GetFaces()->GetMTime() < buildTime) &&
+    (!grid->GetFaceLocations() || grid->GetFaceLocations()->GetMTime() < buildTime);
+}
+
+//------------------------------------------------------------------------------
+unsigned long vtkPolyhedronTopologyCache::GetActualMemorySize()
+{
+  size_t size = sizeof(vtkIdType) *
+    (this->CellToPolyhedron.capacity() + this->PolyhedronCellIds.capacity() +
+      this->FaceOffsets.capacity() + this->Faces.capacity() + this->EdgeOffsets.capacity() +
+      this->Edges.capacity() + this->EdgeFaces.capacity() + this->TriangleOffsets.capacity() +
+      this->Triangles.capacity() + this->FaceTriangleStartOffsets.capacity() +
+      this->FaceTriangleStarts.capacity());
+  size += sizeof(double) * this->Centroids.capacity();
+  return static_cast<unsigned long>(std::ceil(size / 1024.0));
+}
+
+//------------------------------------------------------------------------------
+void vtkPolyhedronTopologyCache::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+
+  os << indent << "Number Of Polyhedra: " << this->GetNumberOfPolyhedra() << "\n";
+  os << indent << "Build Time: " << this->BuildTime.GetMTime() << "\n";
+}
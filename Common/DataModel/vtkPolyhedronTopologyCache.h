@@ -0,0 +1,186 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkPolyhedronTopologyCache.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkPolyhedronTopologyCache
+ * @brief   precomputed local topology of the polyhedral cells of a grid
+ *
+ * vtkPolyhedronTopologyCache is a supplemental object to vtkUnstructuredGrid
+ * which stores, for every VTK_POLYHEDRON cell of the grid, the information
+ * that vtkPolyhedron otherwise regenerates each time the cell is loaded with
+ * GetCell(): the faces renumbered in canonical (cell-local) id space, the
+ * edge list with the pair of faces using each edge, the triangulation of each
+ * face used by vtkPolyhedron::Contour() and vtkPolyhedron::Clip(), and the
+ * centroid of the cell. When a grid has an up to date cache,
+ * vtkUnstructuredGrid::GetCell() loads this information into the
+ * vtkPolyhedron instead of rebuilding it.
+ *
+ * The cache is built once (in parallel with vtkSMPTools) and is read-only
+ * afterwards, so it can be safely shared by threads calling
+ * vtkUnstructuredGrid::GetCell(cellId, vtkGenericCell*) concurrently. Like
+ * vtkStaticCellLinks, it cannot be incrementally updated: it is considered
+ * out of date (and ignored) when the points, cells or faces of the grid are
+ * replaced, resized or marked modified. Edits that bypass Modified() (e.g.
+ * vtkPoints::SetPoint() on the grid points) require rebuilding the cache.
+ *
+ * @sa
+ * vtkPolyhedron vtkUnstructuredGrid vtkStaticCellLinks
+ */
+
+#ifndef vtkPolyhedronTopologyCache_h
+#define vtkPolyhedronTopologyCache_h
+
+#include "vtkCommonDataModelModule.h" // For export macro
+#include "vtkObject.h"
+
+#include <vector> // For internal storage
+
+class vtkUnstructuredGrid;
+
+class VTKCOMMONDATAMODEL_EXPORT vtkPolyhedronTopologyCache : public vtkObject
+{
+public:
+  ///@{
+  /**
+   * Standard methods for instantiation, type manipulation and printing.
+   */
+  static vtkPolyhedronTopologyCache* New();
+  vtkTypeMacro(vtkPolyhedronTopologyCache, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+  ///@}
+
+  /**
+   * Build the cache for all the polyhedral cells of the grid. The work is
+   * distributed over the cells with vtkSMPTools.
+   */
+  void Build(vtkUnstructuredGrid* grid);
+
+  /**
+   * Release all memory and return the cache to its initial state.
+   */
+  void Initialize();
+
+  /**
+   * Return true if the cache was built from this grid and neither its
+   * points, cells nor faces have been modified since then.
+   */
+  bool IsUpToDate(vtkUnstructuredGrid* grid) const;
+
+  /**
+   * Return the number of polyhedral cells in the cache.
+   */
+  vtkIdType GetNumberOfPolyhedra() const
+  {
+    return static_cast<vtkIdType>(this->PolyhedronCellIds.size());
+  }
+
+  /**
+   * Return the index of the given grid cell in the cache, or -1 if the cell
+   * is not a polyhedron (or the cache is empty).
+   */
+  vtkIdType GetPolyhedronIndex(vtkIdType cellId) const
+  {
+    return (cellId >= 0 && cellId < static_cast<vtkIdType>(this->CellToPolyhedron.size()))
+      ? this->CellToPolyhedron[cellId]
+      : -1;
+  }
+
+  ///@{
+  /**
+   * Access the cached topology of the polyhedron at the given index (see
+   * GetPolyhedronIndex()). All ids are expressed in canonical space, i.e.
+   * they index the points of the cell (0,1,...,npts-1).
+   *
+   * GetFaces() returns the face stream [nfaces, nFace0Pts, i, j, k,
+   * nFace1Pts, i, j, k, ...] of the cell, GetFacesSize() its length.
+   * GetEdges() returns GetNumberOfEdges() pairs of point ids, and
+   * GetEdgeFaces() the pair of faces using each edge (-1 if a single face
+   * uses the edge). GetFaceTriangles() returns GetNumberOfFaceTriangles()
+   * point id triplets, face after face. GetFaceTriangleOffsets() returns
+   * nfaces+1 triangle indices: the triangles of face i are the triplets
+   * offsets[i] to offsets[i+1]-1 (a face the triangulation could not handle
+   * has none).
+   */
+  const vtkIdType* GetFaces(vtkIdType idx) const
+  {
+    return this->Faces.data() + this->FaceOffsets[idx];
+  }
+  vtkIdType GetFacesSize(vtkIdType idx) const
+  {
+    return this->FaceOffsets[idx + 1] - this->FaceOffsets[idx];
+  }
+  vtkIdType GetNumberOfEdges(vtkIdType idx) const
+  {
+    return (this->EdgeOffsets[idx + 1] - this->EdgeOffsets[idx]) / 2;
+  }
+  const vtkIdType* GetEdges(vtkIdType idx) const
+  {
+    return this->Edges.data() + this->EdgeOffsets[idx];
+  }
+  const vtkIdType* GetEdgeFaces(vtkIdType idx) const
+  {
+    return this->EdgeFaces.data() + this->EdgeOffsets[idx];
+  }
+  vtkIdType GetNumberOfFaceTriangles(vtkIdType idx) const
+  {
+    return (this->TriangleOffsets[idx + 1] - this->TriangleOffsets[idx]) / 3;
+  }
+  const vtkIdType* GetFaceTriangles(vtkIdType idx) const
+  {
+    return this->Triangles.data() + this->TriangleOffsets[idx];
+  }
+  const vtkIdType* GetFaceTriangleOffsets(vtkIdType idx) const
+  {
+    return this->FaceTriangleStarts.data() + this->FaceTriangleStartOffsets[idx];
+  }
+  const double* GetCentroid(vtkIdType idx) const { return this->Centroids.data() + 3 * idx; }
+  ///@}
+
+  /**
+   * Return the memory in kibibytes (1024 bytes) consumed by the cache.
+   */
+  unsigned long GetActualMemorySize();
+
+protected:
+  vtkPolyhedronTopologyCache() = default;
+  ~vtkPolyhedronTopologyCache() override = default;
+
+  // Map from grid cell ids to polyhedron indices, and its inverse.
+  std::vector<vtkIdType> CellToPolyhedron;
+  std::vector<vtkIdType> PolyhedronCellIds;
+
+  // Flattened per-polyhedron topology. The offsets have one more entry than
+  // the number of polyhedra; EdgeFaces shares the offsets of Edges.
+  std::vector<vtkIdType> FaceOffsets;
+  std::vector<vtkIdType> Faces;
+  std::vector<vtkIdType> EdgeOffsets;
+  std::vector<vtkIdType> Edges;
+  std::vector<vtkIdType> EdgeFaces;
+  std::vector<vtkIdType> TriangleOffsets;
+  std::vector<vtkIdType> Triangles;
+  std::vector<vtkIdType> FaceTriangleStartOffsets;
+  std::vector<vtkIdType> FaceTriangleStarts;
+  std::vector<double> Centroids;
+
+  // What the cache was built from, used to detect stale caches.
+  const void* Source[4] = { nullptr, nullptr, nullptr, nullptr };
+  vtkIdType SourceSize[3] = { 0, 0, 0 };
+  vtkTimeStamp BuildTime;
+
+private:
+  vtkPolyhedronTopologyCache(const vtkPolyhedronTopologyCache&) = delete;
+  void operator=(const vtkPolyhedronTopologyCache&) = delete;
+};
+
+#endif
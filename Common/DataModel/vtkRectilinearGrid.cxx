@@ -33,6 +33,9 @@
 #include "vtkVertex.h"
 #include "vtkVoxel.h"
 
+#include <algorithm>
+#include <vector>
+
 vtkStandardNewMacro(vtkRectilinearGrid);
 vtkStandardExtendedNewMacro(vtkRectilinearGrid);
 
@@ -1072,6 +1075,122 @@ int vtkRectilinearGrid::ComputeStructuredCoordinates(double x[3], int ijk[3], do
   return 1;
 }
 
+//------------------------------------------------------------------------------
+vtkIdType vtkRectilinearGrid::ComputeStructuredCoordinates(
+  vtkIdType numPoints, const double x[], int ijk[], double pcoords[], unsigned char inside[])
+{
+  vtkDataArray* scalars[3] = { this->XCoordinates, this->YCoordinates, this->ZCoordinates };
+
+  // Gather the coordinates once. Increasing coordinates are searched with a
+  // binary search, others fall back to the linear search of the single point
+  // version.
+  std::vector<double> coords[3];
+  bool increasing[3];
+  for (int j = 0; j < 3; j++)
+  {
+    const vtkIdType n = scalars[j]->GetNumberOfTuples();
+    coords[j].resize(n);
+    for (vtkIdType i = 0; i < n; i++)
+    {
+      coords[j][i] = scalars[j]->GetComponent(i, 0);
+    }
+    increasing[j] = std::is_sorted(coords[j].begin(), coords[j].end());
+  }
+
+  vtkIdType numInside = 0;
+  for (vtkIdType p = 0; p < numPoints; ++p)
+  {
+    const double* xp = x + 3 * p;
+    int* ijkp = ijk + 3 * p;
+    double* pcoordsp = pcoords + 3 * p;
+    ijkp[0] = ijkp[1] = ijkp[2] = 0;
+    pcoordsp[0] = pcoordsp[1] = pcoordsp[2] = 0.0;
+    unsigned char isInside = 1;
+
+    for (int j = 0; j < 3 && isInside; j++)
+    {
+      const std::vector<double>& c = coords[j];
+      const vtkIdType n = static_cast<vtkIdType>(c.size());
+      double xPrev = c[0];
+      double xNext = c[n - 1];
+      if (xNext < xPrev)
+      {
+        std::swap(xPrev, xNext);
+      }
+      if (xp[j] < xPrev || xp[j] > xNext || (xp[j] == xNext && this->Dimensions[j] != 1))
+      {
+        isInside = 0;
+        break;
+      }
+
+      if (increasing[j])
+      {
+        // First coordinate not less than x (after the first one): x lies in
+        // [c[i - 1], c[i]), or on c[i].
+        const vtkIdType i = std::max<vtkIdType>(
+          std::lower_bound(c.begin(), c.end(), xp[j]) - c.begin(), 1);
+        if (i < n)
+        {
+          ijkp[j] = static_cast<int>(i - 1);
+          pcoordsp[j] = c[i] == xp[j] ? 1.0 : (xp[j] - c[i - 1]) / (c[i] - c[i - 1]);
+        }
+        continue;
+      }
+
+      // Same search as the single point version, starting from the smallest
+      // end coordinate.
+      for (vtkIdType i = 1; i < n; i++)
+      {
+        xNext = c[i];
+        if (xp[j] >= xPrev && xp[j] < xNext)
+        {
+          ijkp[j] = static_cast<int>(i - 1);
+          pcoordsp[j] = (xp[j] - xPrev) / (xNext - xPrev);
+          break;
+        }
+        else if (xp[j] == xNext)
+        {
+          ijkp[j] = static_cast<int>(i - 1);
+          pcoordsp[j] = 1.0;
+          break;
+        }
+        xPrev = xNext;
+      }
+    }
+
+    inside[p] = isInside;
+    numInside += isInside;
+  }
+  return numInside;
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkRectilinearGrid::FindCells(
+  vtkIdType numPoints, const double x[], vtkIdType cellIds[], double pcoords[], double weights[])
+{
+  std::vector<int> ijk(3 * numPoints);
+  std::vector<double> localPCoords(pcoords ? 0 : 3 * numPoints);
+  std::vector<unsigned char> inside(numPoints);
+  double* pc = pcoords ? pcoords : localPCoords.data();
+  const vtkIdType numFound =
+    this->ComputeStructuredCoordinates(numPoints, x, ijk.data(), pc, inside.data());
+
+  for (vtkIdType p = 0; p < numPoints; ++p)
+  {
+    if (!inside[p])
+    {
+      cellIds[p] = -1;
+      continue;
+    }
+    if (weights)
+    {
+      vtkVoxel::InterpolationFunctions(pc + 3 * p, weights + 8 * p);
+    }
+    cellIds[p] = this->ComputeCellId(ijk.data() + 3 * p);
+  }
+  return numFound;
+}
+
 //------------------------------------------------------------------------------
 unsigned long vtkRectilinearGrid::GetActualMemorySize()
 {
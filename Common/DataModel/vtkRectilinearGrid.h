@@ -176,6 +176,32 @@ public:
    */
   int ComputeStructuredCoordinates(double x[3], int ijk[3], double pcoords[3]);
 
+  /**
+   * Compute the structured coordinates of numPoints points at once, with the
+   * same result as ComputeStructuredCoordinates() called for each point. x
+   * holds 3 coordinates per point, ijk and pcoords receive 3 values per
+   * point and inside is set to 1 for the points inside the grid, 0 for the
+   * others. Returns the number of points inside the grid. Each point is
+   * located with a binary search per axis on increasing coordinates, instead
+   * of a linear one. This method is thread safe.
+   */
+  vtkIdType ComputeStructuredCoordinates(vtkIdType numPoints, const double x[], int ijk[],
+    double pcoords[], unsigned char inside[]) VTK_SIZEHINT(x, 3 * numPoints)
+    VTK_SIZEHINT(ijk, 3 * numPoints) VTK_SIZEHINT(pcoords, 3 * numPoints)
+    VTK_SIZEHINT(inside, numPoints);
+
+  /**
+   * Locate numPoints points at once, with the same result as the FindCell()
+   * method of vtkRectilinearGrid called for each point. cellIds receives the
+   * id of the cell containing each point, or -1. When not null, pcoords
+   * receives 3 parametric coordinates per point and weights the 8 trilinear
+   * interpolation weights of each point (see vtkVoxel). Returns the number of
+   * points found. This method is thread safe.
+   */
+  vtkIdType FindCells(vtkIdType numPoints, const double x[], vtkIdType cellIds[], double pcoords[],
+    double weights[]) VTK_SIZEHINT(x, 3 * numPoints) VTK_SIZEHINT(cellIds, numPoints)
+    VTK_SIZEHINT(pcoords, 3 * numPoints) VTK_SIZEHINT(weights, 8 * numPoints);
+
   /**
    * Given a location in structured coordinates (i-j-k), return the point id.
    */
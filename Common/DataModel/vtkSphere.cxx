@@ -17,6 +17,7 @@
 #include "vtkObjectFactory.h"
 
 #include <algorithm>
+#include <cstring>
 
 vtkStandardNewMacro(vtkSphere);
 
@@ -380,6 +381,18 @@ void vtkSphere::ComputeBoundingSphere(
   vtkSphereComputeBoundingSphere(spheres, numSpheres, sphere, hints);
 }
 
+//------------------------------------------------------------------------------
+bool vtkSphere::PrintParameterKey(ostream& os)
+{
+  if (strcmp(this->GetClassName(), "vtkSphere") != 0 || !this->PrintTransformKey(os))
+  {
+    return false;
+  }
+  os << "vtkSphere center " << this->Center[0] << " " << this->Center[1] << " " << this->Center[2]
+     << " radius " << this->Radius << "\n";
+  return true;
+}
+
 //------------------------------------------------------------------------------
 void vtkSphere::PrintSelf(ostream& os, vtkIndent indent)
 {
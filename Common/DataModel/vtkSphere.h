@@ -52,6 +52,13 @@ public:
    */
   void EvaluateGradient(double x[3], double n[3]) override;
 
+  /**
+   * Print the parameters of the function, see
+   * vtkImplicitFunction::PrintParameterKey(). Subclasses get no key unless
+   * they override it.
+   */
+  bool PrintParameterKey(ostream& os) override;
+
   ///@{
   /**
    * Set / get the radius of the sphere. The default is 0.5.
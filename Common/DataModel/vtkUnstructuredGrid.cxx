@@ -60,6 +60,7 @@
 #include "vtkPolyVertex.h"
 #include "vtkPolygon.h"
 #include "vtkPolyhedron.h"
+#include "vtkPolyhedronTopologyCache.h"
 #include "vtkPyramid.h"
 #include "vtkQuad.h"
 #include "vtkQuadraticEdge.h"
@@ -411,6 +412,7 @@ void vtkUnstructuredGrid::CopyStructure(vtkDataSet* ds)
     this->DistinctCellTypesUpdateMTime = 0;
     this->Faces = ug->Faces;
     this->FaceLocations = ug->FaceLocations;
+    this->PolyhedronTopologyCache = ug->PolyhedronTopologyCache;
   }
 
   this->Superclass::CopyStructure(ds);
@@ -426,6 +428,7 @@ void vtkUnstructuredGrid::Cleanup()
   this->DistinctCellTypesUpdateMTime = 0;
   this->Faces = nullptr;
   this->FaceLocations = nullptr;
+  this->PolyhedronTopologyCache = nullptr;
 }
 
 //------------------------------------------------------------------------------
@@ -1007,6 +1010,12 @@ vtkCell* vtkUnstructuredGrid::GetCell(vtkIdType cellId)
     cell->Initialize();
   }
 
+  if (cell == this->Polyhedron && this->PolyhedronTopologyCache &&
+    this->PolyhedronTopologyCache->IsUpToDate(this))
+  {
+    this->Polyhedron->LoadTopology(this->PolyhedronTopologyCache, cellId);
+  }
+
   return cell;
 }
 
@@ -1032,6 +1041,14 @@ void vtkUnstructuredGrid::GetCell(vtkIdType cellId, vtkGenericCell* cell)
   {
     cell->Initialize();
   }
+
+  // Polyhedra may load their precomputed topology rather than rebuilding it.
+  if (cellType == VTK_POLYHEDRON && this->PolyhedronTopologyCache &&
+    this->PolyhedronTopologyCache->IsUpToDate(this))
+  {
+    static_cast<vtkPolyhedron*>(cell->GetRepresentativeCell())
+      ->LoadTopology(this->PolyhedronTopologyCache, cellId);
+  }
   this->SetCellOrderAndRationalWeights(cellId, cell);
 }
 
@@ -1302,8 +1319,10 @@ int vtkUnstructuredGrid::InitializeFacesRepresentation(vtkIdType numPrevCells)
 //------------------------------------------------------------------------------
 vtkMTimeType vtkUnstructuredGrid::GetMeshMTime()
 {
-  return vtkMath::Max(this->Points ? this->Points->GetMTime() : 0,
+  vtkMTimeType time = vtkMath::Max(this->Points ? this->Points->GetMTime() : 0,
     this->Connectivity ? this->Connectivity->GetMTime() : 0);
+  time = vtkMath::Max(this->Types ? this->Types->GetMTime() : 0, time);
+  return vtkMath::Max(this->Faces ? this->Faces->GetMTime() : 0, time);
 }
 
 //------------------------------------------------------------------------------
@@ -1452,6 +1471,20 @@ vtkAbstractCellLinks* vtkUnstructuredGrid::GetCellLinks()
   return this->Links;
 }
 
+//------------------------------------------------------------------------------
+void vtkUnstructuredGrid::BuildPolyhedronTopologyCache()
+{
+  vtkNew<vtkPolyhedronTopologyCache> cache;
+  cache->Build(this);
+  this->PolyhedronTopologyCache = cache;
+}
+
+//------------------------------------------------------------------------------
+vtkPolyhedronTopologyCache* vtkUnstructuredGrid::GetPolyhedronTopologyCache()
+{
+  return this->PolyhedronTopologyCache;
+}
+
 //------------------------------------------------------------------------------
 void vtkUnstructuredGrid::GetPointCells(vtkIdType ptId, vtkIdType& ncells, vtkIdType*& cells)
 {
@@ -1815,6 +1848,11 @@ unsigned long vtkUnstructuredGrid::GetActualMemorySize()
     size += this->FaceLocations->GetActualMemorySize();
   }
 
+  if (this->PolyhedronTopologyCache)
+  {
+    size += this->PolyhedronTopologyCache->GetActualMemorySize();
+  }
+
   return size;
 }
 
@@ -1833,6 +1871,7 @@ void vtkUnstructuredGrid::ShallowCopy(vtkDataObject* dataObject)
     this->DistinctCellTypesUpdateMTime = 0;
     this->Faces = grid->Faces;
     this->FaceLocations = grid->FaceLocations;
+    this->PolyhedronTopologyCache = grid->PolyhedronTopologyCache;
   }
   else if (vtkUnstructuredGridBase* ugb = vtkUnstructuredGridBase::SafeDownCast(dataObject))
   {
@@ -1925,6 +1964,16 @@ void vtkUnstructuredGrid::DeepCopy(vtkDataObject* dataObject)
   {
     this->BuildLinks();
   }
+
+  // And the polyhedron topology cache
+  if (grid && grid->PolyhedronTopologyCache)
+  {
+    this->BuildPolyhedronTopologyCache();
+  }
+  else
+  {
+    this->PolyhedronTopologyCache = nullptr;
+  }
 }
 
 //------------------------------------------------------------------------------
@@ -88,6 +88,7 @@ class vtkBiQuadraticQuadraticHexahedron;
 class vtkBiQuadraticTriangle;
 class vtkCubicLine;
 class vtkPolyhedron;
+class vtkPolyhedronTopologyCache;
 class vtkIdTypeArray;
 
 class VTKCOMMONDATAMODEL_EXPORT vtkUnstructuredGrid : public vtkUnstructuredGridBase
@@ -252,6 +253,24 @@ public:
    */
   vtkAbstractCellLinks* GetCellLinks();
 
+  /**
+   * Precompute the local topology (canonical faces, edges, face
+   * triangulations and centroid) of all the polyhedral cells. Once built,
+   * GetCell() loads this information into the returned vtkPolyhedron instead
+   * of regenerating it, which speeds up repeated cell access (contouring,
+   * clipping, probing) on polyhedral meshes. Like BuildLinks(), call it from a
+   * single thread before accessing cells concurrently. The cache is ignored
+   * once the points, cells or faces of the grid are replaced or modified; call
+   * this method again to rebuild it.
+   */
+  void BuildPolyhedronTopologyCache();
+
+  /**
+   * Get the polyhedron topology cache, or nullptr if it has not been built.
+   * See BuildPolyhedronTopologyCache().
+   */
+  vtkPolyhedronTopologyCache* GetPolyhedronTopologyCache();
+
   /**
    * Get the face stream of a polyhedron cell in the following format:
    * (numCellFaces, numFace0Pts, id1, id2, id3, numFace1Pts,id1, id2, id3, ...).
@@ -419,7 +438,7 @@ public:
    * track the changes on the mesh separately from the data arrays
    * (eg. static mesh over time with transient data).
    */
-  virtual vtkMTimeType GetMeshMTime();
+  vtkMTimeType GetMeshMTime() override;
 
   /**
    * A static method for converting a polyhedron vtkCellArray of format
@@ -588,6 +607,9 @@ protected:
   vtkSmartPointer<vtkIdTypeArray> Faces;
   vtkSmartPointer<vtkIdTypeArray> FaceLocations;
 
+  // Optional precomputed topology of the polyhedral cells.
+  vtkSmartPointer<vtkPolyhedronTopologyCache> PolyhedronTopologyCache;
+
   // Legacy support -- stores the old-style cell array locations.
   vtkSmartPointer<vtkIdTypeArray> CellLocations;
 
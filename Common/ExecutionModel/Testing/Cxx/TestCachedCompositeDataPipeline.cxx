@@ -0,0 +1,221 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestCachedCompositeDataPipeline.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that vtkCachedCompositeDataPipeline serves the results of previous
+// parameters from its cache, for simple and composite data.
+
+#include "vtkCachedCompositeDataPipeline.h"
+#include "vtkContourFilter.h"
+#include "vtkCutter.h"
+#include "vtkElevationFilter.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
+#include "vtkPlane.h"
+#include "vtkPolyData.h"
+#include "vtkSphere.h"
+#include "vtkSphereSource.h"
+#include "vtkThreshold.h"
+
+#include <iostream>
+
+namespace
+{
+bool Check(const char* name, vtkCachedCompositeDataPipeline* executive, int hits, int misses)
+{
+  if (executive->GetNumberOfCacheHits() != hits || executive->GetNumberOfCacheMisses() != misses)
+  {
+    std::cerr << name << ": " << executive->GetNumberOfCacheHits() << " hits and "
+              << executive->GetNumberOfCacheMisses() << " misses instead of " << hits << " and "
+              << misses << std::endl;
+    return false;
+  }
+  return true;
+}
+
+vtkIdType GetNumberOfCells(vtkAlgorithm* algorithm)
+{
+  return algorithm->GetOutputDataObject(0)->GetNumberOfElements(vtkDataObject::CELL);
+}
+} // anonymous namespace
+
+int TestCachedCompositeDataPipeline(int, char*[])
+{
+  vtkNew<vtkSphereSource> sphere;
+  sphere->SetThetaResolution(32);
+  sphere->SetPhiResolution(32);
+  vtkNew<vtkElevationFilter> elevation;
+  elevation->SetInputConnection(sphere->GetOutputPort());
+  elevation->SetLowPoint(0.0, 0.0, -0.5);
+  elevation->SetHighPoint(0.0, 0.0, 0.5);
+
+  // sphere -> elevation -> contour (cached) -> scalars (cached)
+  vtkNew<vtkContourFilter> contour;
+  vtkNew<vtkCachedCompositeDataPipeline> contourExecutive;
+  contour->SetExecutive(contourExecutive);
+  contour->SetInputConnection(elevation->GetOutputPort());
+  vtkNew<vtkElevationFilter> scalars;
+  vtkNew<vtkCachedCompositeDataPipeline> scalarsExecutive;
+  scalars->SetExecutive(scalarsExecutive);
+  scalars->SetInputConnection(contour->GetOutputPort());
+
+  contour->SetValue(0, 0.25);
+  scalars->Update();
+  const vtkIdType cells1 = GetNumberOfCells(scalars);
+  contour->SetValue(0, 0.25);
+  contour->SetValue(1, 0.75);
+  scalars->Update();
+  const vtkIdType cells2 = GetNumberOfCells(scalars);
+  if (!Check("Contour", contourExecutive, 0, 2) || !Check("Scalars", scalarsExecutive, 0, 2) ||
+    cells1 == 0 || cells2 <= cells1)
+  {
+    return EXIT_FAILURE;
+  }
+
+  // Back to the first value: both caches are hit.
+  contour->SetNumberOfContours(1);
+  scalars->Update();
+  if (!Check("Contour", contourExecutive, 1, 2) || !Check("Scalars", scalarsExecutive, 1, 2) ||
+    GetNumberOfCells(scalars) != cells1 || GetNumberOfCells(contour) != cells1)
+  {
+    std::cerr << "Wrong cached result." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // A modified input is a new result.
+  sphere->SetRadius(2.0);
+  scalars->Update();
+  if (!Check("Contour", contourExecutive, 1, 3) || !Check("Scalars", scalarsExecutive, 1, 3) ||
+    contourExecutive->GetNumberOfCachedResults() != 3 ||
+    contourExecutive->GetCacheMemorySize() == 0)
+  {
+    return EXIT_FAILURE;
+  }
+
+  // The memory limit keeps the last result only.
+  contourExecutive->SetCacheMemoryLimit(1);
+  if (contourExecutive->GetNumberOfCachedResults() != 1)
+  {
+    std::cerr << "Memory limit not enforced." << std::endl;
+    return EXIT_FAILURE;
+  }
+  contourExecutive->SetCacheMemoryLimit(0);
+  contourExecutive->ClearCache();
+  scalarsExecutive->ClearCache();
+
+  // Composite data.
+  sphere->SetRadius(0.5);
+  elevation->Update();
+  vtkNew<vtkPolyData> block;
+  block->ShallowCopy(elevation->GetOutput());
+  vtkNew<vtkMultiBlockDataSet> blocks;
+  blocks->SetBlock(0, block);
+  blocks->SetBlock(1, block);
+  contour->SetInputDataObject(blocks);
+  contour->SetValue(0, 0.25);
+  contour->Update();
+  const vtkIdType compositeCells1 = GetNumberOfCells(contour);
+  contour->SetValue(0, 0.5);
+  contour->Update();
+  contour->SetValue(0, 0.25);
+  contour->Update();
+  if (!Check("Composite", contourExecutive, 2, 5) ||
+    !vtkMultiBlockDataSet::SafeDownCast(contour->GetOutputDataObject(0)) ||
+    GetNumberOfCells(contour) != compositeCells1 || compositeCells1 != 2 * cells1)
+  {
+    std::cerr << "Wrong cached composite result." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // The cut function is identified by its parameters: setting the plane back
+  // to a previous origin, or the contour values back, hits the cache.
+  vtkNew<vtkPlane> plane;
+  vtkNew<vtkCutter> cutter;
+  vtkNew<vtkCachedCompositeDataPipeline> cutterExecutive;
+  cutter->SetExecutive(cutterExecutive);
+  cutter->SetCutFunction(plane);
+  cutter->SetInputConnection(elevation->GetOutputPort());
+  cutter->Update();
+  plane->SetOrigin(0.0, 0.0, 0.2);
+  cutter->Update();
+  const double offsetZ = cutter->GetOutput()->GetBounds()[4];
+  plane->SetOrigin(0.0, 0.0, 0.0);
+  cutter->Update();
+  const double z = cutter->GetOutput()->GetBounds()[4];
+  cutter->SetValue(0, 0.1);
+  cutter->Update();
+  cutter->SetValue(0, 0.0);
+  cutter->Update();
+  if (!Check("Cutter", cutterExecutive, 2, 3) || cutter->GetOutput()->GetBounds()[4] != 0.0 ||
+    z != 0.0 || offsetZ < 0.1)
+  {
+    std::cerr << "Wrong cached cut." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // So is a sphere.
+  vtkNew<vtkSphere> sphereFunction;
+  sphereFunction->SetRadius(0.3);
+  cutter->SetCutFunction(sphereFunction);
+  cutter->Update();
+  const vtkIdType sphereCells = GetNumberOfCells(cutter);
+  sphereFunction->SetRadius(0.4);
+  cutter->Update();
+  sphereFunction->SetRadius(0.3);
+  cutter->Update();
+  if (!Check("Sphere cut", cutterExecutive, 3, 5) || GetNumberOfCells(cutter) != sphereCells)
+  {
+    return EXIT_FAILURE;
+  }
+
+  // The parameter objects are identified by their modification time.
+  vtkNew<vtkPlane> parameter;
+  cutterExecutive->AddParameterObject(parameter);
+  cutter->Modified();
+  cutter->Update();
+  cutter->Modified();
+  cutter->Update();
+  parameter->Modified();
+  cutter->Modified();
+  cutter->Update();
+  if (!Check("Parameter object", cutterExecutive, 4, 7))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // vtkThreshold prints its thresholds and modes.
+  vtkNew<vtkThreshold> threshold;
+  vtkNew<vtkCachedCompositeDataPipeline> thresholdExecutive;
+  threshold->SetExecutive(thresholdExecutive);
+  threshold->SetInputConnection(elevation->GetOutputPort());
+  threshold->ThresholdBetween(0.2, 0.8);
+  threshold->Update();
+  const vtkIdType thresholdCells = GetNumberOfCells(threshold);
+  threshold->ThresholdByUpper(0.5);
+  threshold->Update();
+  threshold->ThresholdBetween(0.2, 0.8);
+  threshold->Update();
+  if (!Check("Threshold", thresholdExecutive, 1, 2) || thresholdCells == 0 ||
+    GetNumberOfCells(threshold) != thresholdCells)
+  {
+    return EXIT_FAILURE;
+  }
+  threshold->InvertOn();
+  threshold->Update();
+  if (!Check("Inverted threshold", thresholdExecutive, 1, 3))
+  {
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,365 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestExecutionScheduler.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that vtkExecutionScheduler executes independent branches
+// concurrently, and only the algorithms that are out of date. The consumers
+// of a composite data set, and the algorithms that do not declare
+// CONCURRENT_INPUT_READS, execute one after the other.
+
+#include "vtkAlgorithm.h"
+#include "vtkDoubleArray.h"
+#include "vtkExecutionScheduler.h"
+#include "vtkInformation.h"
+#include "vtkInformationVector.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkMultiBlockDataSetAlgorithm.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkPolyDataAlgorithm.h"
+#include "vtkSMPTools.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <thread>
+
+namespace
+{
+std::atomic<int> Running(0);
+std::atomic<int> MaximumRunning(0);
+
+// Count the algorithms executing at the same time.
+struct RunningGuard
+{
+  RunningGuard()
+  {
+    const int running = ++Running;
+    int maximum = MaximumRunning;
+    while (running > maximum && !MaximumRunning.compare_exchange_weak(maximum, running))
+    {
+    }
+  }
+  ~RunningGuard() { --Running; }
+};
+
+void FillPoints(vtkPolyData* output)
+{
+  vtkNew<vtkPoints> points;
+  vtkNew<vtkDoubleArray> values;
+  values->SetName("Value");
+  for (int i = 0; i < 100; ++i)
+  {
+    points->InsertNextPoint(i, 0.0, 0.0);
+    values->InsertNextValue(i);
+  }
+  output->SetPoints(points);
+  output->GetPointData()->AddArray(values);
+}
+
+// A source of 100 points with a "Value" array set to the point index.
+class vtkCountingSource : public vtkPolyDataAlgorithm
+{
+public:
+  static vtkCountingSource* New();
+  vtkTypeMacro(vtkCountingSource, vtkPolyDataAlgorithm);
+
+  int NumberOfExecutions = 0;
+
+protected:
+  vtkCountingSource() { this->SetNumberOfInputPorts(0); }
+
+  int RequestData(
+    vtkInformation*, vtkInformationVector**, vtkInformationVector* outputVector) override
+  {
+    RunningGuard guard;
+    this->NumberOfExecutions++;
+    FillPoints(vtkPolyData::GetData(outputVector));
+    return 1;
+  }
+};
+vtkStandardNewMacro(vtkCountingSource);
+
+// A source of 2 blocks of 100 points.
+class vtkCountingBlocksSource : public vtkMultiBlockDataSetAlgorithm
+{
+public:
+  static vtkCountingBlocksSource* New();
+  vtkTypeMacro(vtkCountingBlocksSource, vtkMultiBlockDataSetAlgorithm);
+
+protected:
+  vtkCountingBlocksSource() { this->SetNumberOfInputPorts(0); }
+
+  int RequestData(
+    vtkInformation*, vtkInformationVector**, vtkInformationVector* outputVector) override
+  {
+    vtkMultiBlockDataSet* output = vtkMultiBlockDataSet::GetData(outputVector);
+    for (unsigned int i = 0; i < 2; ++i)
+    {
+      vtkNew<vtkPolyData> block;
+      FillPoints(block);
+      output->SetBlock(i, block);
+    }
+    return 1;
+  }
+};
+vtkStandardNewMacro(vtkCountingBlocksSource);
+
+// A slow filter scaling the "Value" array.
+class vtkSlowScale : public vtkPolyDataAlgorithm
+{
+public:
+  static vtkSlowScale* New();
+  vtkTypeMacro(vtkSlowScale, vtkPolyDataAlgorithm);
+
+  vtkSetMacro(Factor, double);
+  vtkGetMacro(Factor, double);
+
+  int NumberOfExecutions = 0;
+
+protected:
+  vtkSlowScale()
+  {
+    this->GetInformation()->Set(vtkExecutionScheduler::CONCURRENT_INPUT_READS(), 1);
+  }
+
+  double Factor = 1.0;
+
+  int RequestData(vtkInformation*, vtkInformationVector** inputVector,
+    vtkInformationVector* outputVector) override
+  {
+    RunningGuard guard;
+    this->NumberOfExecutions++;
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    vtkPolyData* input = vtkPolyData::GetData(inputVector[0]);
+    vtkPolyData* output = vtkPolyData::GetData(outputVector);
+    output->ShallowCopy(input);
+    vtkDataArray* inValues = input->GetPointData()->GetArray("Value");
+    vtkNew<vtkDoubleArray> values;
+    values->SetName("Value");
+    values->SetNumberOfTuples(inValues->GetNumberOfTuples());
+    for (vtkIdType i = 0; i < inValues->GetNumberOfTuples(); ++i)
+    {
+      values->SetValue(i, this->Factor * inValues->GetComponent(i, 0));
+    }
+    output->GetPointData()->AddArray(values);
+    return 1;
+  }
+};
+vtkStandardNewMacro(vtkSlowScale);
+
+// A sink summing the "Value" arrays of all its inputs.
+class vtkSumSink : public vtkPolyDataAlgorithm
+{
+public:
+  static vtkSumSink* New();
+  vtkTypeMacro(vtkSumSink, vtkPolyDataAlgorithm);
+
+  int NumberOfExecutions = 0;
+
+protected:
+  int FillInputPortInformation(int port, vtkInformation* info) override
+  {
+    this->Superclass::FillInputPortInformation(port, info);
+    info->Set(vtkAlgorithm::INPUT_IS_REPEATABLE(), 1);
+    return 1;
+  }
+
+  int RequestData(vtkInformation*, vtkInformationVector** inputVector,
+    vtkInformationVector* outputVector) override
+  {
+    this->NumberOfExecutions++;
+    vtkPolyData* output = vtkPolyData::GetData(outputVector);
+    vtkNew<vtkDoubleArray> values;
+    values->SetName("Value");
+    values->SetNumberOfTuples(100);
+    values->Fill(0.0);
+    for (int j = 0; j < inputVector[0]->GetNumberOfInformationObjects(); ++j)
+    {
+      vtkDataArray* inValues =
+        vtkPolyData::GetData(inputVector[0], j)->GetPointData()->GetArray("Value");
+      for (vtkIdType i = 0; i < 100; ++i)
+      {
+        values->SetValue(i, values->GetValue(i) + inValues->GetComponent(i, 0));
+      }
+    }
+    output->GetPointData()->AddArray(values);
+    return 1;
+  }
+};
+vtkStandardNewMacro(vtkSumSink);
+
+bool CheckValues(vtkDataObject* output, double factor)
+{
+  vtkDataArray* values = vtkPolyData::SafeDownCast(output)->GetPointData()->GetArray("Value");
+  for (vtkIdType i = 0; i < 100; ++i)
+  {
+    if (values->GetComponent(i, 0) != factor * i)
+    {
+      std::cerr << "Wrong value " << values->GetComponent(i, 0) << " at " << i << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+bool CheckOutput(vtkSumSink* sink, double factor)
+{
+  return CheckValues(sink->GetOutputDataObject(0), factor);
+}
+
+bool CheckExecutions(const char* name, int executions, int expected)
+{
+  if (executions != expected)
+  {
+    std::cerr << name << " executed " << executions << " times instead of " << expected
+              << std::endl;
+    return false;
+  }
+  return true;
+}
+} // anonymous namespace
+
+int TestExecutionScheduler(int, char*[])
+{
+  // source -> { scale1, scale2, scale3 } -> sink
+  vtkNew<vtkCountingSource> source;
+  vtkNew<vtkSlowScale> scales[3];
+  vtkNew<vtkSumSink> sink;
+  for (int i = 0; i < 3; ++i)
+  {
+    scales[i]->SetFactor(i + 1);
+    scales[i]->SetInputConnection(source->GetOutputPort());
+    sink->AddInputConnection(scales[i]->GetOutputPort());
+  }
+
+  vtkNew<vtkExecutionScheduler> scheduler;
+  scheduler->AddAlgorithm(sink);
+  if (!scheduler->Update() || !CheckOutput(sink, 6.0) ||
+    !CheckExecutions("Source", source->NumberOfExecutions, 1) ||
+    !CheckExecutions("Sink", sink->NumberOfExecutions, 1))
+  {
+    return EXIT_FAILURE;
+  }
+  for (auto& scale : scales)
+  {
+    if (!CheckExecutions("Scale", scale->NumberOfExecutions, 1))
+    {
+      return EXIT_FAILURE;
+    }
+  }
+  if (scheduler->GetNumberOfExecutedAlgorithms() != 5 || scheduler->GetNumberOfStages() != 3 ||
+    scheduler->GetMaximumConcurrency() != 3)
+  {
+    std::cerr << "Unexpected schedule: " << scheduler->GetNumberOfExecutedAlgorithms()
+              << " algorithms in " << scheduler->GetNumberOfStages() << " stages of at most "
+              << scheduler->GetMaximumConcurrency() << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (strcmp(vtkSMPTools::GetBackend(), "Sequential") != 0 &&
+    vtkSMPTools::GetEstimatedNumberOfThreads() > 1 && MaximumRunning < 2)
+  {
+    std::cerr << "The branches were not executed concurrently." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Nothing is out of date.
+  if (!scheduler->Update() || scheduler->GetNumberOfExecutedAlgorithms() != 0 ||
+    !CheckExecutions("Sink", sink->NumberOfExecutions, 1))
+  {
+    std::cerr << "Up to date pipeline executed again." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Only the modified branch and the sink execute.
+  scales[1]->SetFactor(4.0);
+  if (!scheduler->Update() || !CheckOutput(sink, 8.0) ||
+    scheduler->GetNumberOfExecutedAlgorithms() != 2 ||
+    !CheckExecutions("Source", source->NumberOfExecutions, 1) ||
+    !CheckExecutions("Scale 1", scales[0]->NumberOfExecutions, 1) ||
+    !CheckExecutions("Scale 2", scales[1]->NumberOfExecutions, 2) ||
+    !CheckExecutions("Sink", sink->NumberOfExecutions, 2))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // The branches can also be updated as separate outputs.
+  scheduler->RemoveAllOutputPorts();
+  source->Modified();
+  for (auto& scale : scales)
+  {
+    scheduler->AddOutputPort(scale->GetOutputPort());
+  }
+  if (!scheduler->Update() || scheduler->GetNumberOfExecutedAlgorithms() != 4 ||
+    scheduler->GetNumberOfStages() != 2 ||
+    !CheckExecutions("Sink", sink->NumberOfExecutions, 2))
+  {
+    std::cerr << "Wrong update of separate outputs." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Algorithms that may use the non reentrant vtkDataSet API do not read a
+  // shared input concurrently.
+  for (auto& scale : scales)
+  {
+    scale->GetInformation()->Remove(vtkExecutionScheduler::CONCURRENT_INPUT_READS());
+  }
+  source->Modified();
+  MaximumRunning = 0;
+  if (!scheduler->Update() || scheduler->GetNumberOfExecutedAlgorithms() != 4 ||
+    scheduler->GetNumberOfStages() != 4 || scheduler->GetMaximumConcurrency() != 1 ||
+    MaximumRunning != 1)
+  {
+    std::cerr << "Undeclared readers of a shared input executed concurrently." << std::endl;
+    return EXIT_FAILURE;
+  }
+  for (auto& scale : scales)
+  {
+    scale->GetInformation()->Set(vtkExecutionScheduler::CONCURRENT_INPUT_READS(), 1);
+  }
+
+  // vtkCompositeDataPipeline executes the scales once per block, modifying
+  // the information of their common input: they must not run concurrently.
+  vtkNew<vtkCountingBlocksSource> blocksSource;
+  scheduler->RemoveAllOutputPorts();
+  for (int i = 0; i < 3; ++i)
+  {
+    scales[i]->SetInputConnection(blocksSource->GetOutputPort());
+    scheduler->AddOutputPort(scales[i]->GetOutputPort());
+  }
+  MaximumRunning = 0;
+  if (!scheduler->Update() || scheduler->GetNumberOfExecutedAlgorithms() != 4 ||
+    scheduler->GetNumberOfStages() != 4 || scheduler->GetMaximumConcurrency() != 1 ||
+    MaximumRunning != 1)
+  {
+    std::cerr << "Consumers of a composite data set executed concurrently." << std::endl;
+    return EXIT_FAILURE;
+  }
+  for (int i = 0; i < 3; ++i)
+  {
+    auto output = vtkMultiBlockDataSet::SafeDownCast(scales[i]->GetOutputDataObject(0));
+    if (!output || output->GetNumberOfBlocks() != 2 ||
+      !CheckValues(output->GetBlock(0), scales[i]->GetFactor()) ||
+      !CheckValues(output->GetBlock(1), scales[i]->GetFactor()))
+    {
+      std::cerr << "Wrong output for the blocks of scale " << i << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,163 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestExecutionTrace.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that vtkExecutionTrace records the requests of the algorithms and
+// the parallel regions they run.
+
+#include "vtkDoubleArray.h"
+#include "vtkExecutionTrace.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPointData.h"
+#include "vtkPolyData.h"
+#include "vtkPolyDataAlgorithm.h"
+#include "vtkSMPTools.h"
+#include "vtkSphereSource.h"
+
+#include <iostream>
+#include <sstream>
+#include <string>
+
+namespace
+{
+// Add a "Norm" point array computed with vtkSMPTools.
+class vtkNormFilter : public vtkPolyDataAlgorithm
+{
+public:
+  static vtkNormFilter* New();
+  vtkTypeMacro(vtkNormFilter, vtkPolyDataAlgorithm);
+
+protected:
+  int RequestData(vtkInformation*, vtkInformationVector** inputVector,
+    vtkInformationVector* outputVector) override
+  {
+    vtkPolyData* input = vtkPolyData::GetData(inputVector[0]);
+    vtkPolyData* output = vtkPolyData::GetData(outputVector);
+    output->ShallowCopy(input);
+    vtkNew<vtkDoubleArray> norms;
+    norms->SetName("Norm");
+    norms->SetNumberOfTuples(input->GetNumberOfPoints());
+    vtkSMPTools::For(0, input->GetNumberOfPoints(), [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        double p[3];
+        input->GetPoint(i, p);
+        norms->SetValue(i, p[0] * p[0] + p[1] * p[1] + p[2] * p[2]);
+      }
+    });
+    output->GetPointData()->AddArray(norms);
+    return 1;
+  }
+};
+vtkStandardNewMacro(vtkNormFilter);
+
+bool Contains(const std::string& str, const std::string& pattern)
+{
+  if (str.find(pattern) == std::string::npos)
+  {
+    std::cerr << "Missing " << pattern << " in:\n" << str << std::endl;
+    return false;
+  }
+  return true;
+}
+} // anonymous namespace
+
+int TestExecutionTrace(int, char*[])
+{
+  vtkNew<vtkSphereSource> sphere;
+  sphere->SetThetaResolution(16);
+  sphere->SetPhiResolution(16);
+  vtkNew<vtkNormFilter> filter;
+  filter->SetInputConnection(sphere->GetOutputPort());
+
+  vtkExecutionTrace::SetEnabled(true);
+  vtkExecutionTrace::Clear();
+  filter->Update();
+  const int numberOfEvents = vtkExecutionTrace::GetNumberOfEvents();
+
+  std::ostringstream trace;
+  vtkExecutionTrace::PrintChromeTrace(trace);
+  const std::string filterId = vtkLogger::GetIdentifier(filter);
+  const std::string points = std::to_string(sphere->GetOutput()->GetNumberOfPoints());
+  const std::string cells = std::to_string(sphere->GetOutput()->GetNumberOfCells());
+  if (!Contains(trace.str(), "{\"traceEvents\":[") ||
+    !Contains(trace.str(), "\"name\":\"vtkNormFilter::RequestInformation\"") ||
+    !Contains(trace.str(), "\"name\":\"vtkNormFilter::RequestUpdateExtent\"") ||
+    !Contains(trace.str(), "\"name\":\"vtkSphereSource::RequestData\"") ||
+    !Contains(trace.str(),
+      "\"name\":\"vtkNormFilter::RequestData\",\"cat\":\"RequestData\",\"ph\":\"X\"") ||
+    !Contains(trace.str(),
+      "\"algorithm\":\"" + filterId + "\",\"input_points\":" + points +
+        ",\"input_cells\":" + cells + ",\"output_points\":" + points +
+        ",\"output_cells\":" + cells) ||
+    !Contains(trace.str(),
+      "\"name\":\"vtkSMPTools::For\",\"cat\":\"SMP\"") ||
+    !Contains(trace.str(),
+      "\"algorithm\":\"" + filterId + "\",\"first\":0,\"last\":" + points))
+  {
+    return EXIT_FAILURE;
+  }
+
+  std::ostringstream summary;
+  vtkExecutionTrace::PrintSummary(summary);
+  if (!Contains(summary.str(), "Parallel (s)") || !Contains(summary.str(), filterId) ||
+    !Contains(summary.str(), vtkLogger::GetIdentifier(sphere)))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // Nothing is recorded when disabled.
+  vtkExecutionTrace::SetEnabled(false);
+  filter->Modified();
+  filter->Update();
+  if (vtkExecutionTrace::GetEnabled() || vtkExecutionTrace::GetNumberOfEvents() != numberOfEvents)
+  {
+    std::cerr << "Events recorded while disabled." << std::endl;
+    return EXIT_FAILURE;
+  }
+  vtkExecutionTrace::Clear();
+  if (vtkExecutionTrace::GetNumberOfEvents() != 0)
+  {
+    std::cerr << "Events not cleared." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Only the most recent events are kept.
+  const int maximum = vtkExecutionTrace::GetMaximumNumberOfEvents();
+  vtkExecutionTrace::SetMaximumNumberOfEvents(3);
+  vtkExecutionTrace::SetEnabled(true);
+  filter->Modified();
+  filter->Update();
+  vtkExecutionTrace::SetEnabled(false);
+  std::ostringstream lastEvents;
+  vtkExecutionTrace::PrintChromeTrace(lastEvents);
+  if (vtkExecutionTrace::GetNumberOfEvents() != 3 ||
+    vtkExecutionTrace::GetNumberOfDiscardedEvents() == 0 ||
+    !Contains(lastEvents.str(), "\"name\":\"vtkNormFilter::RequestData\"") ||
+    lastEvents.str().find("vtkNormFilter::RequestInformation") != std::string::npos)
+  {
+    std::cerr << "Wrong events kept: " << lastEvents.str() << std::endl;
+    return EXIT_FAILURE;
+  }
+  vtkExecutionTrace::SetMaximumNumberOfEvents(maximum);
+  vtkExecutionTrace::Clear();
+  if (vtkExecutionTrace::GetNumberOfDiscardedEvents() != 0)
+  {
+    std::cerr << "Discarded events not cleared." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
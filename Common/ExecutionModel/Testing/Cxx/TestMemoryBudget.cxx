@@ -0,0 +1,181 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestMemoryBudget.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that the executives release the consumed intermediate outputs
+// exceeding the memory budget, and generate them again on demand, but never
+// release the input of a sink.
+
+#include "vtkCallbackCommand.h"
+#include "vtkCellData.h"
+#include "vtkCommand.h"
+#include "vtkDataArray.h"
+#include "vtkDataSet.h"
+#include "vtkDemandDrivenPipeline.h"
+#include "vtkElevationFilter.h"
+#include "vtkInformation.h"
+#include "vtkInformationVector.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPointDataToCellData.h"
+#include "vtkPolyData.h"
+#include "vtkPolyDataAlgorithm.h"
+#include "vtkSphereSource.h"
+
+#include <iostream>
+
+namespace
+{
+// A sink without output port, as a mapper or a writer, that keeps using
+// its input after its execution.
+class vtkRangeSink : public vtkPolyDataAlgorithm
+{
+public:
+  static vtkRangeSink* New();
+  vtkTypeMacro(vtkRangeSink, vtkPolyDataAlgorithm);
+
+  double Range[2] = { 0.0, 0.0 };
+  int Executions = 0;
+
+protected:
+  vtkRangeSink() { this->SetNumberOfOutputPorts(0); }
+
+  int RequestData(
+    vtkInformation*, vtkInformationVector** inputVector, vtkInformationVector*) override
+  {
+    vtkPolyData* input = vtkPolyData::GetData(inputVector[0]);
+    vtkDataArray* array = input->GetCellData()->GetArray("Elevation");
+    if (!array || input->GetNumberOfCells() != 128 * 62 * 2)
+    {
+      vtkErrorMacro("Wrong input.");
+      return 0;
+    }
+    array->GetRange(this->Range);
+    ++this->Executions;
+    return 1;
+  }
+};
+vtkStandardNewMacro(vtkRangeSink);
+
+void CountExecution(vtkObject*, unsigned long, void* clientData, void*)
+{
+  ++*static_cast<int*>(clientData);
+}
+} // anonymous namespace
+
+int TestMemoryBudget(int, char*[])
+{
+  vtkNew<vtkSphereSource> sphere;
+  sphere->SetThetaResolution(128);
+  sphere->SetPhiResolution(64);
+  vtkNew<vtkElevationFilter> elevation;
+  elevation->SetInputConnection(sphere->GetOutputPort());
+  vtkNew<vtkPointDataToCellData> toCells;
+  toCells->SetInputConnection(elevation->GetOutputPort());
+  vtkNew<vtkRangeSink> sink;
+  sink->SetInputConnection(toCells->GetOutputPort());
+
+  int executions = 0;
+  vtkNew<vtkCallbackCommand> counter;
+  counter->SetCallback(&CountExecution);
+  counter->SetClientData(&executions);
+  sphere->AddObserver(vtkCommand::EndEvent, counter);
+  elevation->AddObserver(vtkCommand::EndEvent, counter);
+  toCells->AddObserver(vtkCommand::EndEvent, counter);
+
+  // Without a budget, every output is kept.
+  sink->Update();
+  const double range[2] = { sink->Range[0], sink->Range[1] };
+  if (executions != 3 || sink->Executions != 1 || sphere->GetOutput()->GetDataReleased())
+  {
+    std::cerr << "Outputs were released without a memory budget." << std::endl;
+    return EXIT_FAILURE;
+  }
+  const unsigned long outputsSize = sphere->GetOutput()->GetActualMemorySize() +
+    elevation->GetOutput()->GetActualMemorySize() + toCells->GetOutput()->GetActualMemorySize();
+
+  // The arrays passed from an output to the next are counted once.
+  vtkDemandDrivenPipeline::SetMemoryBudget(outputsSize * 2);
+  sphere->Modified();
+  sink->Update();
+  const unsigned long shared = vtkDemandDrivenPipeline::GetCachedMemorySize();
+  if (executions != 6 || shared >= outputsSize)
+  {
+    std::cerr << "Wrong cached memory size " << shared << " for outputs of " << outputsSize
+              << std::endl;
+    vtkDemandDrivenPipeline::SetMemoryBudget(0);
+    return EXIT_FAILURE;
+  }
+
+  // With a budget smaller than the outputs, the consumed intermediate
+  // outputs are released before the next execution, but not the input of
+  // the sink, which uses it after its execution.
+  vtkDemandDrivenPipeline::SetMemoryBudget(1);
+  vtkDemandDrivenPipeline::ResetPeakMemorySize();
+  sphere->Modified();
+  sink->Update();
+  vtkDataSet* output = toCells->GetOutput();
+  if (executions != 9 || sink->Executions != 3 || !sphere->GetOutput()->GetDataReleased() ||
+    !elevation->GetOutput()->GetDataReleased() || output->GetDataReleased() ||
+    sink->Range[0] != range[0] || sink->Range[1] != range[1])
+  {
+    std::cerr << "The intermediate outputs were not released." << std::endl;
+    vtkDemandDrivenPipeline::SetMemoryBudget(0);
+    return EXIT_FAILURE;
+  }
+  const unsigned long cached = vtkDemandDrivenPipeline::GetCachedMemorySize();
+  const unsigned long peak = vtkDemandDrivenPipeline::GetPeakMemorySize();
+  if (cached < output->GetActualMemorySize() || peak <= cached)
+  {
+    std::cerr << "Wrong cached memory size " << cached << " or peak " << peak << std::endl;
+    vtkDemandDrivenPipeline::SetMemoryBudget(0);
+    return EXIT_FAILURE;
+  }
+
+  // Released outputs are not generated again until requested: the sink
+  // executes again with its input...
+  sink->Modified();
+  sink->Update();
+  if (executions != 9 || sink->Executions != 4 || output->GetDataReleased())
+  {
+    std::cerr << "An up to date pipeline was executed again." << std::endl;
+    vtkDemandDrivenPipeline::SetMemoryBudget(0);
+    return EXIT_FAILURE;
+  }
+
+  // ...but the released outputs are generated again when the input of the
+  // sink is.
+  toCells->Modified();
+  sink->Update();
+  if (executions != 12 || sink->Executions != 5 || sink->Range[0] != range[0] ||
+    sink->Range[1] != range[1])
+  {
+    std::cerr << "The released outputs were not generated again." << std::endl;
+    vtkDemandDrivenPipeline::SetMemoryBudget(0);
+    return EXIT_FAILURE;
+  }
+
+  // Nothing is released when the outputs fit in the budget.
+  vtkDemandDrivenPipeline::SetMemoryBudget(peak * 2);
+  sphere->Modified();
+  sink->Update();
+  vtkDemandDrivenPipeline::SetMemoryBudget(0);
+  if (executions != 15 || sphere->GetOutput()->GetDataReleased() ||
+    elevation->GetOutput()->GetDataReleased() || output->GetDataReleased())
+  {
+    std::cerr << "Outputs fitting in the budget were released." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -145,6 +145,35 @@ void vtkAlgorithm::SetProgressObserver(vtkProgressObserver* po)
   }
 }
 
+//------------------------------------------------------------------------------
+bool vtkAlgorithm::CopyParameters(vtkAlgorithm*)
+{
+  return false;
+}
+
+//------------------------------------------------------------------------------
+void vtkAlgorithm::CopyInputArraysToProcess(vtkAlgorithm* source)
+{
+  if (!source || source == this)
+  {
+    return;
+  }
+  if (source->Information->Has(INPUT_ARRAYS_TO_PROCESS()))
+  {
+    this->Information->CopyEntry(source->Information, INPUT_ARRAYS_TO_PROCESS(), 1);
+  }
+  else
+  {
+    this->Information->Remove(INPUT_ARRAYS_TO_PROCESS());
+  }
+}
+
+//------------------------------------------------------------------------------
+bool vtkAlgorithm::PrintParameterKey(ostream&)
+{
+  return false;
+}
+
 //------------------------------------------------------------------------------
 void vtkAlgorithm::SetProgressShiftScale(double shift, double scale)
 {
@@ -705,6 +705,28 @@ public:
   vtkGetObjectMacro(ProgressObserver, vtkProgressObserver);
   ///@}
 
+  /**
+   * Copy the parameters of another algorithm of the same class into this
+   * one, so that both produce the same output from the same input. This is
+   * used by vtkThreadedCompositeDataPipeline to execute a copy of the
+   * algorithm per thread. Returns false if some state cannot be copied. The
+   * default implementation returns false: algorithms opt in by overriding it
+   * to copy all their parameters, including the input arrays to process
+   * (CopyInputArraysToProcess()).
+   */
+  virtual bool CopyParameters(vtkAlgorithm* source);
+
+  /**
+   * Print a key identifying the parameters that define the outputs of the
+   * algorithm, so that result caches such as vtkCachedCompositeDataPipeline
+   * recognize the parameters it already executed with. The key must change
+   * whenever the outputs may change, including with the objects referenced
+   * by the algorithm. Returns false, the default, when the algorithm provides
+   * no such key: the caches then rely on the modification time of the
+   * algorithm.
+   */
+  virtual bool PrintParameterKey(ostream& os);
+
 protected:
   vtkAlgorithm();
   ~vtkAlgorithm() override;
@@ -825,6 +847,12 @@ protected:
    */
   vtkInformation* GetInputArrayFieldInformation(int idx, vtkInformationVector** inputVector);
 
+  /**
+   * Copy the input arrays to process selected on another algorithm, for the
+   * implementations of CopyParameters().
+   */
+  void CopyInputArraysToProcess(vtkAlgorithm* source);
+
   /**
    * Create a default executive.
    * If the DefaultExecutivePrototype is set, a copy of it is created
@@ -0,0 +1,365 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkCachedCompositeDataPipeline.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkCachedCompositeDataPipeline.h"
+
+#include "vtkAlgorithm.h"
+#include "vtkDataObject.h"
+#include "vtkInformation.h"
+#include "vtkInformationDoubleKey.h"
+#include "vtkInformationIntegerKey.h"
+#include "vtkInformationIntegerVectorKey.h"
+#include "vtkInformationStringKey.h"
+#include "vtkInformationVector.h"
+#include "vtkObjectFactory.h"
+#include "vtkSmartPointer.h"
+
+#include <cstring>
+#include <functional>
+#include <iomanip>
+#include <list>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+vtkStandardNewMacro(vtkCachedCompositeDataPipeline);
+
+vtkInformationKeyMacro(vtkCachedCompositeDataPipeline, RESULT_KEY, String);
+
+//------------------------------------------------------------------------------
+class vtkCachedCompositeDataPipeline::vtkInternals
+{
+public:
+  struct Result
+  {
+    std::string Key;
+    std::vector<vtkSmartPointer<vtkDataObject>> Outputs;
+    vtkTypeUInt64 MemorySize;
+  };
+
+  // Most recently used first.
+  std::list<Result> Results;
+  std::map<std::string, std::list<Result>::iterator> Index;
+  vtkTypeUInt64 MemorySize = 0;
+  std::vector<vtkSmartPointer<vtkObject>> ParameterObjects;
+
+  Result* Find(const std::string& key)
+  {
+    auto found = this->Index.find(key);
+    if (found == this->Index.end())
+    {
+      return nullptr;
+    }
+    this->Results.splice(this->Results.begin(), this->Results, found->second);
+    return &this->Results.front();
+  }
+
+  void Add(Result&& result)
+  {
+    auto found = this->Index.find(result.Key);
+    if (found != this->Index.end())
+    {
+      this->MemorySize -= found->second->MemorySize;
+      this->Results.erase(found->second);
+    }
+    this->MemorySize += result.MemorySize;
+    this->Results.push_front(std::move(result));
+    this->Index[this->Results.front().Key] = this->Results.begin();
+  }
+
+  // Evict the least recently used results, but the last one, until the
+  // limits are met.
+  void Evict(int cacheSize, vtkTypeUInt64 memoryLimit)
+  {
+    if (cacheSize <= 0)
+    {
+      this->Clear();
+      return;
+    }
+    while (this->Results.size() > 1 &&
+      (this->Results.size() > static_cast<size_t>(cacheSize) ||
+        (memoryLimit > 0 && this->MemorySize > memoryLimit)))
+    {
+      this->MemorySize -= this->Results.back().MemorySize;
+      this->Index.erase(this->Results.back().Key);
+      this->Results.pop_back();
+    }
+  }
+
+  void Clear()
+  {
+    this->Results.clear();
+    this->Index.clear();
+    this->MemorySize = 0;
+  }
+};
+
+//------------------------------------------------------------------------------
+vtkCachedCompositeDataPipeline::vtkCachedCompositeDataPipeline()
+{
+  this->CacheSize = 10;
+  this->CacheMemoryLimit = 0;
+  this->NumberOfCacheHits = 0;
+  this->NumberOfCacheMisses = 0;
+  this->Internals = new vtkInternals;
+}
+
+//------------------------------------------------------------------------------
+vtkCachedCompositeDataPipeline::~vtkCachedCompositeDataPipeline()
+{
+  delete this->Internals;
+}
+
+//------------------------------------------------------------------------------
+void vtkCachedCompositeDataPipeline::SetCacheSize(int size)
+{
+  if (size == this->CacheSize)
+  {
+    return;
+  }
+  this->CacheSize = size;
+  this->Internals->Evict(this->CacheSize, this->CacheMemoryLimit);
+  this->Modified();
+}
+
+//------------------------------------------------------------------------------
+void vtkCachedCompositeDataPipeline::SetCacheMemoryLimit(vtkTypeUInt64 limit)
+{
+  if (limit == this->CacheMemoryLimit)
+  {
+    return;
+  }
+  this->CacheMemoryLimit = limit;
+  this->Internals->Evict(this->CacheSize, this->CacheMemoryLimit);
+  this->Modified();
+}
+
+//------------------------------------------------------------------------------
+vtkTypeUInt64 vtkCachedCompositeDataPipeline::GetCacheMemorySize()
+{
+  return this->Internals->MemorySize;
+}
+
+//------------------------------------------------------------------------------
+int vtkCachedCompositeDataPipeline::GetNumberOfCachedResults()
+{
+  return static_cast<int>(this->Internals->Results.size());
+}
+
+//------------------------------------------------------------------------------
+void vtkCachedCompositeDataPipeline::ClearCache()
+{
+  this->Internals->Clear();
+}
+
+//------------------------------------------------------------------------------
+void vtkCachedCompositeDataPipeline::AddParameterObject(vtkObject* object)
+{
+  if (object)
+  {
+    this->Internals->ParameterObjects.emplace_back(object);
+    this->Modified();
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkCachedCompositeDataPipeline::RemoveAllParameterObjects()
+{
+  if (!this->Internals->ParameterObjects.empty())
+  {
+    this->Internals->ParameterObjects.clear();
+    this->Modified();
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkCachedCompositeDataPipeline::ComputeParameterKey(ostream& os)
+{
+  vtkAlgorithm* algorithm = this->Algorithm;
+  os << algorithm->GetClassName() << "\n";
+  if (!algorithm->PrintParameterKey(os))
+  {
+    os << "Modified time " << algorithm->GetMTime() << "\n";
+  }
+
+  vtkInformationVector* arrays =
+    algorithm->GetInformation()->Get(vtkAlgorithm::INPUT_ARRAYS_TO_PROCESS());
+  for (int i = 0; arrays && i < arrays->GetNumberOfInformationObjects(); ++i)
+  {
+    os << "Input array " << i << ":\n";
+    arrays->GetInformationObject(i)->PrintKeys(os, vtkIndent().GetNextIndent());
+  }
+
+  for (const auto& object : this->Internals->ParameterObjects)
+  {
+    os << "Parameter object " << object.GetPointer() << " " << object->GetMTime() << "\n";
+  }
+}
+
+//------------------------------------------------------------------------------
+std::string vtkCachedCompositeDataPipeline::ComputeResultKey(
+  vtkInformationVector** inInfoVec, vtkInformationVector* outInfoVec)
+{
+  std::ostringstream key;
+  key << std::setprecision(17);
+  this->ComputeParameterKey(key);
+
+  for (int port = 0; port < this->Algorithm->GetNumberOfInputPorts(); ++port)
+  {
+    for (int i = 0; i < inInfoVec[port]->GetNumberOfInformationObjects(); ++i)
+    {
+      vtkInformation* inInfo = inInfoVec[port]->GetInformationObject(i);
+      key << "Input " << port << " " << i << ": ";
+      if (inInfo->Has(RESULT_KEY()))
+      {
+        key << inInfo->Get(RESULT_KEY());
+      }
+      else
+      {
+        vtkDataObject* input = inInfo->Get(vtkDataObject::DATA_OBJECT());
+        key << input << " " << (input ? input->GetMTime() : 0);
+      }
+      key << "\n";
+    }
+  }
+
+  for (int i = 0; i < outInfoVec->GetNumberOfInformationObjects(); ++i)
+  {
+    vtkInformation* outInfo = outInfoVec->GetInformationObject(i);
+    key << "Output " << i << ": " << outInfo->Get(UPDATE_PIECE_NUMBER()) << " "
+        << outInfo->Get(UPDATE_NUMBER_OF_PIECES()) << " "
+        << outInfo->Get(UPDATE_NUMBER_OF_GHOST_LEVELS());
+    if (int* extent = outInfo->Get(UPDATE_EXTENT()))
+    {
+      for (int j = 0; j < 6; ++j)
+      {
+        key << " " << extent[j];
+      }
+    }
+    if (outInfo->Has(UPDATE_TIME_STEP()))
+    {
+      key << " t " << outInfo->Get(UPDATE_TIME_STEP());
+    }
+    if (outInfo->Has(UPDATE_COMPOSITE_INDICES()))
+    {
+      key << " blocks";
+      const int* indices = outInfo->Get(UPDATE_COMPOSITE_INDICES());
+      for (int j = 0; j < outInfo->Length(UPDATE_COMPOSITE_INDICES()); ++j)
+      {
+        key << " " << indices[j];
+      }
+    }
+    key << "\n";
+  }
+  return key.str();
+}
+
+//------------------------------------------------------------------------------
+int vtkCachedCompositeDataPipeline::ExecuteData(
+  vtkInformation* request, vtkInformationVector** inInfoVec, vtkInformationVector* outInfoVec)
+{
+  const int numberOfOutputs = outInfoVec->GetNumberOfInformationObjects();
+  for (int i = 0; i < numberOfOutputs; ++i)
+  {
+    outInfoVec->GetInformationObject(i)->Remove(RESULT_KEY());
+  }
+
+  // Streaming algorithms executing several passes are not cached.
+  if (this->CacheSize <= 0 || this->ContinueExecuting)
+  {
+    return this->Superclass::ExecuteData(request, inInfoVec, outInfoVec);
+  }
+
+  std::string key = this->ComputeResultKey(inInfoVec, outInfoVec);
+  vtkInternals::Result* cached = this->Internals->Find(key);
+  for (int i = 0; cached && i < numberOfOutputs; ++i)
+  {
+    vtkDataObject* output = outInfoVec->GetInformationObject(i)->Get(vtkDataObject::DATA_OBJECT());
+    vtkDataObject* result = cached->Outputs[i];
+    if (result && (!output || strcmp(output->GetClassName(), result->GetClassName()) != 0))
+    {
+      cached = nullptr;
+    }
+  }
+
+  int success = 1;
+  if (cached)
+  {
+    this->NumberOfCacheHits++;
+    this->ExecuteDataStart(request, inInfoVec, outInfoVec);
+    for (int i = 0; i < numberOfOutputs; ++i)
+    {
+      vtkInformation* outInfo = outInfoVec->GetInformationObject(i);
+      vtkDataObject* output = outInfo->Get(vtkDataObject::DATA_OBJECT());
+      if (cached->Outputs[i] && !outInfo->Get(DATA_NOT_GENERATED()))
+      {
+        output->ShallowCopy(cached->Outputs[i]);
+      }
+    }
+    this->ExecuteDataEnd(request, inInfoVec, outInfoVec);
+  }
+  else
+  {
+    this->NumberOfCacheMisses++;
+    success = this->Superclass::ExecuteData(request, inInfoVec, outInfoVec);
+    if (!success || request->Get(CONTINUE_EXECUTING()) || this->ContinueExecuting)
+    {
+      return success;
+    }
+
+    // Executing may change the key of the algorithm, e.g. by creating a
+    // default locator, which the next lookups will see.
+    key = this->ComputeResultKey(inInfoVec, outInfoVec);
+    vtkInternals::Result result;
+    result.Key = key;
+    result.MemorySize = 0;
+    for (int i = 0; i < numberOfOutputs; ++i)
+    {
+      vtkInformation* outInfo = outInfoVec->GetInformationObject(i);
+      vtkDataObject* output = outInfo->Get(vtkDataObject::DATA_OBJECT());
+      vtkSmartPointer<vtkDataObject> copy;
+      if (output && !outInfo->Get(DATA_NOT_GENERATED()))
+      {
+        copy.TakeReference(output->NewInstance());
+        copy->ShallowCopy(output);
+        result.MemorySize += 1024 * static_cast<vtkTypeUInt64>(copy->GetActualMemorySize());
+      }
+      result.Outputs.push_back(copy);
+    }
+    this->Internals->Add(std::move(result));
+    this->Internals->Evict(this->CacheSize, this->CacheMemoryLimit);
+  }
+
+  std::ostringstream resultKey;
+  resultKey << std::hex << std::hash<std::string>()(key);
+  for (int i = 0; i < numberOfOutputs; ++i)
+  {
+    std::ostringstream portKey;
+    portKey << resultKey.str() << ":" << i;
+    outInfoVec->GetInformationObject(i)->Set(RESULT_KEY(), portKey.str().c_str());
+  }
+  return success;
+}
+
+//------------------------------------------------------------------------------
+void vtkCachedCompositeDataPipeline::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "CacheSize: " << this->CacheSize << "\n";
+  os << indent << "CacheMemoryLimit: " << this->CacheMemoryLimit << "\n";
+  os << indent << "NumberOfCachedResults: " << this->GetNumberOfCachedResults() << "\n";
+  os << indent << "NumberOfCacheHits: " << this->NumberOfCacheHits << "\n";
+  os << indent << "NumberOfCacheMisses: " << this->NumberOfCacheMisses << "\n";
+}
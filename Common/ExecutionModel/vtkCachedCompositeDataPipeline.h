@@ -0,0 +1,161 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkCachedCompositeDataPipeline.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkCachedCompositeDataPipeline
+ * @brief   executive keeping the results of recent executions of its algorithm
+ *
+ * vtkCachedCompositeDataPipeline is a vtkCompositeDataPipeline that keeps
+ * the outputs produced by its algorithm for the last parameters it executed
+ * with. When the algorithm has to execute again with parameters it already
+ * executed with (e.g. when toggling between a few contour values, thresholds
+ * or slice positions), the cached outputs are shallow copied to the outputs
+ * instead. It works with any type of data, including composite data.
+ *
+ * The results are identified by:
+ * * the parameters of the algorithm, as printed by its
+ *   vtkAlgorithm::PrintParameterKey() method, or its modification time for
+ *   algorithms that do not implement it, and the arrays it is asked to
+ *   process,
+ * * the identity of its input data: the result key of the inputs produced by
+ *   another vtkCachedCompositeDataPipeline, or the input data objects and
+ *   their modification times otherwise,
+ * * the requested pieces, extents and time steps.
+ *
+ * Objects referenced by the algorithm that are not accounted for by its key
+ * or its modification time can be added with AddParameterObject(): their
+ * modification times are part of the key.
+ *
+ * The results are kept in least recently used order, within the limits of
+ * CacheSize and CacheMemoryLimit.
+ *
+ * @sa
+ * vtkCachedStreamingDemandDrivenPipeline vtkTemporalDataSetCache
+ */
+
+#ifndef vtkCachedCompositeDataPipeline_h
+#define vtkCachedCompositeDataPipeline_h
+
+#include "vtkCommonExecutionModelModule.h" // For export macro
+#include "vtkCompositeDataPipeline.h"
+
+#include <string> // For std::string
+
+class vtkInformationStringKey;
+
+class VTKCOMMONEXECUTIONMODEL_EXPORT vtkCachedCompositeDataPipeline
+  : public vtkCompositeDataPipeline
+{
+public:
+  static vtkCachedCompositeDataPipeline* New();
+  vtkTypeMacro(vtkCachedCompositeDataPipeline, vtkCompositeDataPipeline);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  ///@{
+  /**
+   * This is the maximum number of results that can be retained in memory.
+   * It defaults to 10.
+   */
+  void SetCacheSize(int size);
+  vtkGetMacro(CacheSize, int);
+  ///@}
+
+  ///@{
+  /**
+   * Maximum amount of memory, in bytes, used by the cached results as
+   * reported by vtkDataObject::GetActualMemorySize(). The least recently used
+   * results are evicted when it is exceeded, but the last one is always
+   * kept. 0, the default, means no limit.
+   */
+  void SetCacheMemoryLimit(vtkTypeUInt64 limit);
+  vtkGetMacro(CacheMemoryLimit, vtkTypeUInt64);
+  ///@}
+
+  ///@{
+  /**
+   * Add an object whose modification time is part of the key of the
+   * results, for objects defining the outputs of the algorithm that are not
+   * accounted for by its parameter key or its modification time.
+   */
+  void AddParameterObject(vtkObject* object);
+  void RemoveAllParameterObjects();
+  ///@}
+
+  /**
+   * Return the memory used by the cached results, in bytes.
+   */
+  vtkTypeUInt64 GetCacheMemorySize();
+
+  /**
+   * Return the number of cached results.
+   */
+  int GetNumberOfCachedResults();
+
+  /**
+   * Discard the cached results.
+   */
+  void ClearCache();
+
+  ///@{
+  /**
+   * Number of executions served from the cache, and of executions of the
+   * algorithm, since the executive was created.
+   */
+  vtkGetMacro(NumberOfCacheHits, int);
+  vtkGetMacro(NumberOfCacheMisses, int);
+  ///@}
+
+  /**
+   * Key identifying the data of an output port of a
+   * vtkCachedCompositeDataPipeline, set in the output port information.
+   * Downstream caches use it to identify their input.
+   * @ingroup InformationKeys
+   */
+  static vtkInformationStringKey* RESULT_KEY();
+
+protected:
+  vtkCachedCompositeDataPipeline();
+  ~vtkCachedCompositeDataPipeline() override;
+
+  int ExecuteData(vtkInformation* request, vtkInformationVector** inInfoVec,
+    vtkInformationVector* outInfoVec) override;
+
+  /**
+   * Print the parameters of the algorithm that affect its outputs. The
+   * default prints the parameter key of the algorithm, or its modification
+   * time, the input arrays to process and the modification times of the
+   * parameter objects.
+   */
+  virtual void ComputeParameterKey(ostream& os);
+
+  /**
+   * Compute the key of the outputs the algorithm is about to generate.
+   */
+  virtual std::string ComputeResultKey(
+    vtkInformationVector** inInfoVec, vtkInformationVector* outInfoVec);
+
+  int CacheSize;
+  vtkTypeUInt64 CacheMemoryLimit;
+  int NumberOfCacheHits;
+  int NumberOfCacheMisses;
+
+private:
+  vtkCachedCompositeDataPipeline(const vtkCachedCompositeDataPipeline&) = delete;
+  void operator=(const vtkCachedCompositeDataPipeline&) = delete;
+
+  class vtkInternals;
+  vtkInternals* Internals;
+};
+
+#endif
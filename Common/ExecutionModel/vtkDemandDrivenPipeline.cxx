@@ -16,8 +16,11 @@
 
 #include "vtkAlgorithm.h"
 #include "vtkAlgorithmOutput.h"
+#include "vtkCellArray.h"
 #include "vtkCellData.h"
 #include "vtkCommand.h"
+#include "vtkCompositeDataIterator.h"
+#include "vtkCompositeDataSet.h"
 #include "vtkDataArray.h"
 #include "vtkDataObject.h"
 #include "vtkDataObjectTypes.h"
@@ -34,18 +37,219 @@
 #include "vtkLogger.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
-
+#include "vtkPointSet.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkRectilinearGrid.h"
+#include "vtkSmartPointer.h"
+#include "vtkTrivialProducer.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <set>
 #include <vector>
 
 vtkStandardNewMacro(vtkDemandDrivenPipeline);
 
 vtkInformationKeyMacro(vtkDemandDrivenPipeline, DATA_NOT_GENERATED, Integer);
+vtkInformationKeyMacro(vtkDemandDrivenPipeline, INPUTS_UP_TO_DATE, Integer);
 vtkInformationKeyMacro(vtkDemandDrivenPipeline, RELEASE_DATA, Integer);
 vtkInformationKeyMacro(vtkDemandDrivenPipeline, REQUEST_DATA, Request);
 vtkInformationKeyMacro(vtkDemandDrivenPipeline, REQUEST_DATA_NOT_GENERATED, Request);
 vtkInformationKeyMacro(vtkDemandDrivenPipeline, REQUEST_DATA_OBJECT, Request);
 vtkInformationKeyMacro(vtkDemandDrivenPipeline, REQUEST_INFORMATION, Request);
 
+namespace
+{
+// The executives whose outputs are tracked by the memory budget, and those
+// executing an algorithm, whose inputs and outputs are in use.
+struct MemoryBudgetState
+{
+  std::atomic<unsigned long> Budget{ 0 };
+  std::mutex Mutex;
+  std::set<vtkDemandDrivenPipeline*> Executives;
+  std::map<vtkDemandDrivenPipeline*, int> Executing;
+  unsigned long Peak = 0;
+};
+
+MemoryBudgetState& GetMemoryBudgetState()
+{
+  // Never destroyed, so that executives deleted at exit can unregister.
+  static MemoryBudgetState* state = new MemoryBudgetState;
+  return *state;
+}
+
+// Collect the arrays holding the data of a data object.
+void GatherArrays(vtkFieldData* fieldData, std::vector<vtkAbstractArray*>& arrays)
+{
+  for (int i = 0; fieldData && i < fieldData->GetNumberOfArrays(); ++i)
+  {
+    arrays.push_back(fieldData->GetAbstractArray(i));
+  }
+}
+
+void GatherArrays(vtkCellArray* cells, std::vector<vtkAbstractArray*>& arrays)
+{
+  if (cells)
+  {
+    arrays.push_back(cells->GetOffsetsArray());
+    arrays.push_back(cells->GetConnectivityArray());
+  }
+}
+
+void GatherArrays(vtkDataObject* data, std::vector<vtkAbstractArray*>& arrays)
+{
+  if (auto composite = vtkCompositeDataSet::SafeDownCast(data))
+  {
+    vtkSmartPointer<vtkCompositeDataIterator> iter;
+    iter.TakeReference(composite->NewIterator());
+    for (iter->InitTraversal(); !iter->IsDoneWithTraversal(); iter->GoToNextItem())
+    {
+      GatherArrays(iter->GetCurrentDataObject(), arrays);
+    }
+  }
+  for (int type = 0; type < vtkDataObject::NUMBER_OF_ATTRIBUTE_TYPES; ++type)
+  {
+    GatherArrays(data->GetAttributesAsFieldData(type), arrays);
+  }
+  GatherArrays(data->GetFieldData(), arrays);
+  if (auto pointSet = vtkPointSet::SafeDownCast(data))
+  {
+    if (pointSet->GetPoints())
+    {
+      arrays.push_back(pointSet->GetPoints()->GetData());
+    }
+  }
+  if (auto polyData = vtkPolyData::SafeDownCast(data))
+  {
+    GatherArrays(polyData->GetVerts(), arrays);
+    GatherArrays(polyData->GetLines(), arrays);
+    GatherArrays(polyData->GetPolys(), arrays);
+    GatherArrays(polyData->GetStrips(), arrays);
+  }
+  else if (auto grid = vtkUnstructuredGrid::SafeDownCast(data))
+  {
+    GatherArrays(grid->GetCells(), arrays);
+    arrays.push_back(grid->GetCellTypesArray());
+    arrays.push_back(grid->GetFaces());
+    arrays.push_back(grid->GetFaceLocations());
+  }
+  else if (auto rectilinear = vtkRectilinearGrid::SafeDownCast(data))
+  {
+    arrays.push_back(rectilinear->GetXCoordinates());
+    arrays.push_back(rectilinear->GetYCoordinates());
+    arrays.push_back(rectilinear->GetZCoordinates());
+  }
+}
+
+// The memory size, in kibibytes, of a set of data objects. The array
+// buffers shared by several of them, e.g. passed by a filter with
+// ShallowCopy(), are counted once.
+class MemoryAccount
+{
+public:
+  // Add a data object and return its index.
+  size_t Add(vtkDataObject* data)
+  {
+    std::vector<vtkAbstractArray*> arrays;
+    GatherArrays(data, arrays);
+    Entry entry;
+    unsigned long arraysSize = 0;
+    for (vtkAbstractArray* array : arrays)
+    {
+      if (!array || array->GetNumberOfValues() == 0)
+      {
+        continue;
+      }
+      // Arrays sharing their memory have the same buffer.
+      const void* key = array->HasStandardMemoryLayout() ? array->GetVoidPointer(0) : array;
+      if (std::find(entry.Buffers.begin(), entry.Buffers.end(), key) != entry.Buffers.end())
+      {
+        continue;
+      }
+      const unsigned long size = array->GetActualMemorySize();
+      arraysSize += size;
+      entry.Buffers.push_back(key);
+      Buffer& buffer = this->Buffers[key];
+      if (buffer.Holders++ == 0)
+      {
+        buffer.Size = size;
+        this->Total += size;
+      }
+    }
+    // The memory of the data object not held by its arrays, e.g. cell links.
+    const unsigned long size = data->GetActualMemorySize();
+    entry.Overhead = size - std::min(size, arraysSize);
+    this->Total += entry.Overhead;
+    this->Entries.push_back(std::move(entry));
+    return this->Entries.size() - 1;
+  }
+
+  // Remove a data object and return the memory that releasing it frees:
+  // the buffers not shared with the remaining data objects.
+  unsigned long Remove(size_t index)
+  {
+    Entry& entry = this->Entries[index];
+    unsigned long freed = entry.Overhead;
+    for (const void* key : entry.Buffers)
+    {
+      Buffer& buffer = this->Buffers[key];
+      if (--buffer.Holders == 0)
+      {
+        freed += buffer.Size;
+      }
+    }
+    entry.Buffers.clear();
+    entry.Overhead = 0;
+    this->Total -= std::min(this->Total, freed);
+    return freed;
+  }
+
+  unsigned long GetTotal() const { return this->Total; }
+
+private:
+  struct Buffer
+  {
+    unsigned long Size = 0;
+    int Holders = 0;
+  };
+  struct Entry
+  {
+    unsigned long Overhead = 0;
+    std::vector<const void*> Buffers;
+  };
+  std::map<const void*, Buffer> Buffers;
+  std::vector<Entry> Entries;
+  unsigned long Total = 0;
+};
+
+// The memory size of the outputs of the tracked executives that are not
+// executing. The mutex of the state must be locked.
+unsigned long ComputeCachedMemorySize(MemoryBudgetState& state)
+{
+  MemoryAccount account;
+  for (vtkDemandDrivenPipeline* executive : state.Executives)
+  {
+    if (state.Executing.count(executive))
+    {
+      continue;
+    }
+    for (int port = 0; port < executive->GetNumberOfOutputPorts(); ++port)
+    {
+      vtkDataObject* data = executive->GetOutputData(port);
+      if (data && !data->GetDataReleased())
+      {
+        account.Add(data);
+      }
+    }
+  }
+  return account.GetTotal();
+}
+} // anonymous namespace
+
 //------------------------------------------------------------------------------
 vtkDemandDrivenPipeline::vtkDemandDrivenPipeline()
 {
@@ -58,6 +262,12 @@ vtkDemandDrivenPipeline::vtkDemandDrivenPipeline()
 //------------------------------------------------------------------------------
 vtkDemandDrivenPipeline::~vtkDemandDrivenPipeline()
 {
+  {
+    MemoryBudgetState& state = GetMemoryBudgetState();
+    std::lock_guard<std::mutex> lock(state.Mutex);
+    state.Executives.erase(this);
+    state.Executing.erase(this);
+  }
   if (this->InfoRequest)
   {
     this->InfoRequest->Delete();
@@ -243,8 +453,8 @@ vtkTypeBool vtkDemandDrivenPipeline::ProcessRequest(
     int result = 1;
     if (this->NeedToExecuteData(outputPort, inInfoVec, outInfoVec))
     {
-      // Update inputs first.
-      if (!this->ForwardUpstream(request))
+      // Update inputs first, unless the caller already did.
+      if (!request->Get(INPUTS_UP_TO_DATE()) && !this->ForwardUpstream(request))
       {
         return 0;
       }
@@ -516,6 +726,17 @@ void vtkDemandDrivenPipeline::ExecuteDataStart(
     }
   }
 
+  // The inputs and outputs are in use until the end of the execution. The
+  // cached data exceeding the memory budget are released before the
+  // execution allocates more, and once their consumers are done with them.
+  if (vtkDemandDrivenPipeline::GetMemoryBudget() > 0)
+  {
+    MemoryBudgetState& state = GetMemoryBudgetState();
+    std::lock_guard<std::mutex> lock(state.Mutex);
+    state.Executing[this]++;
+    this->EnforceMemoryBudget();
+  }
+
   // Tell observers the algorithm is about to execute.
   this->Algorithm->InvokeEvent(vtkCommand::StartEvent, nullptr);
 
@@ -561,6 +782,105 @@ void vtkDemandDrivenPipeline::ExecuteDataEnd(
       }
     }
   }
+
+  // Track the generated outputs for the memory budget.
+  if (vtkDemandDrivenPipeline::GetMemoryBudget() > 0)
+  {
+    MemoryBudgetState& state = GetMemoryBudgetState();
+    std::lock_guard<std::mutex> lock(state.Mutex);
+    auto executing = state.Executing.find(this);
+    if (executing != state.Executing.end() && --executing->second == 0)
+    {
+      state.Executing.erase(executing);
+    }
+    if (!vtkTrivialProducer::SafeDownCast(this->Algorithm))
+    {
+      state.Executives.insert(this);
+    }
+    state.Peak = std::max(state.Peak, ComputeCachedMemorySize(state));
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkDemandDrivenPipeline::EnforceMemoryBudget()
+{
+  // Called with the mutex of the memory budget state locked.
+  MemoryBudgetState& state = GetMemoryBudgetState();
+  struct Candidate
+  {
+    vtkDataObject* Data;
+    vtkMTimeType UpdateTime;
+    size_t Index;
+  };
+  std::vector<Candidate> candidates;
+  MemoryAccount account;
+  for (vtkDemandDrivenPipeline* executive : state.Executives)
+  {
+    // The outputs of an executing algorithm are being generated.
+    if (state.Executing.count(executive))
+    {
+      continue;
+    }
+    for (int port = 0; port < executive->GetNumberOfOutputPorts(); ++port)
+    {
+      vtkInformation* outInfo = executive->GetOutputInformation(port);
+      vtkDataObject* data = outInfo->Get(vtkDataObject::DATA_OBJECT());
+      if (!data || data->GetDataReleased())
+      {
+        continue;
+      }
+      const size_t index = account.Add(data);
+      if (vtkDemandDrivenPipeline::CanReleaseOutput(outInfo, data))
+      {
+        candidates.push_back(Candidate{ data, data->GetUpdateTime(), index });
+      }
+    }
+  }
+  state.Peak = std::max(state.Peak, account.GetTotal());
+
+  const unsigned long budget = state.Budget.load();
+  if (account.GetTotal() <= budget)
+  {
+    return;
+  }
+  std::sort(candidates.begin(), candidates.end(),
+    [](const Candidate& a, const Candidate& b) { return a.UpdateTime < b.UpdateTime; });
+  for (const Candidate& candidate : candidates)
+  {
+    if (account.GetTotal() <= budget)
+    {
+      break;
+    }
+    vtkLogF(TRACE, "releasing %s to fit in the memory budget", vtkLogIdentifier(candidate.Data));
+    candidate.Data->ReleaseData();
+    account.Remove(candidate.Index);
+  }
+}
+
+//------------------------------------------------------------------------------
+bool vtkDemandDrivenPipeline::CanReleaseOutput(vtkInformation* outInfo, vtkDataObject* data)
+{
+  // Only outputs consumed by all their consumers since they were generated,
+  // and not in use by an executing consumer, can be released. Sinks, such as
+  // mappers and writers, have no output port and may use their inputs
+  // outside of their execution, e.g. when rendering, so their inputs are kept.
+  MemoryBudgetState& state = GetMemoryBudgetState();
+  const int numberOfConsumers = vtkExecutive::CONSUMERS()->Length(outInfo);
+  if (numberOfConsumers == 0)
+  {
+    return false;
+  }
+  vtkExecutive** consumers = vtkExecutive::CONSUMERS()->GetExecutives(outInfo);
+  for (int i = 0; i < numberOfConsumers; ++i)
+  {
+    vtkDemandDrivenPipeline* consumer = vtkDemandDrivenPipeline::SafeDownCast(consumers[i]);
+    if (!consumer || consumer->GetNumberOfOutputPorts() == 0 ||
+      state.Executing.count(consumer) || consumer->DataTime.GetMTime() < data->GetUpdateTime())
+    {
+      return false;
+    }
+  }
+  return true;
 }
 
 //------------------------------------------------------------------------------
@@ -999,7 +1319,7 @@ int vtkDemandDrivenPipeline ::NeedToExecuteData(
     // then we must execute.
     vtkInformation* info = outInfoVec->GetInformationObject(outputPort);
     vtkDataObject* data = info->Get(vtkDataObject::DATA_OBJECT());
-    if (!data || this->PipelineMTime > data->GetUpdateTime())
+    if (!data || data->GetDataReleased() || this->PipelineMTime > data->GetUpdateTime())
     {
       return 1;
     }
@@ -1036,6 +1356,49 @@ int vtkDemandDrivenPipeline::SetReleaseDataFlag(int port, int n)
   return 0;
 }
 
+//------------------------------------------------------------------------------
+void vtkDemandDrivenPipeline::SetMemoryBudget(unsigned long kibibytes)
+{
+  MemoryBudgetState& state = GetMemoryBudgetState();
+  std::lock_guard<std::mutex> lock(state.Mutex);
+  state.Budget = kibibytes;
+  if (kibibytes == 0)
+  {
+    state.Executives.clear();
+    state.Executing.clear();
+  }
+}
+
+//------------------------------------------------------------------------------
+unsigned long vtkDemandDrivenPipeline::GetMemoryBudget()
+{
+  return GetMemoryBudgetState().Budget.load(std::memory_order_relaxed);
+}
+
+//------------------------------------------------------------------------------
+unsigned long vtkDemandDrivenPipeline::GetCachedMemorySize()
+{
+  MemoryBudgetState& state = GetMemoryBudgetState();
+  std::lock_guard<std::mutex> lock(state.Mutex);
+  return ComputeCachedMemorySize(state);
+}
+
+//------------------------------------------------------------------------------
+unsigned long vtkDemandDrivenPipeline::GetPeakMemorySize()
+{
+  MemoryBudgetState& state = GetMemoryBudgetState();
+  std::lock_guard<std::mutex> lock(state.Mutex);
+  return state.Peak;
+}
+
+//------------------------------------------------------------------------------
+void vtkDemandDrivenPipeline::ResetPeakMemorySize()
+{
+  MemoryBudgetState& state = GetMemoryBudgetState();
+  std::lock_guard<std::mutex> lock(state.Mutex);
+  state.Peak = 0;
+}
+
 //------------------------------------------------------------------------------
 int vtkDemandDrivenPipeline::GetReleaseDataFlag(int port)
 {
@@ -19,6 +19,12 @@
  * vtkDemandDrivenPipeline is an executive that will execute an
  * algorithm only when its outputs are out-of-date with respect to its
  * inputs.
+ *
+ * The data cached in the outputs of the pipelines can be bounded with
+ * SetMemoryBudget(). The executives then release the intermediate outputs
+ * that have been consumed, the oldest first, when the memory size of all
+ * the cached outputs exceeds the budget. Released outputs are generated
+ * again when they are requested.
  */
 
 #ifndef vtkDemandDrivenPipeline_h
@@ -92,6 +98,40 @@ public:
    */
   virtual int GetReleaseDataFlag(int port);
 
+  ///@{
+  /**
+   * Set/Get the memory budget, in kibibytes, of the data cached in the
+   * outputs of all the pipelines. When it is not 0, the executives track the
+   * memory size of the outputs they generate; arrays shared by several
+   * outputs, e.g. passed with ShallowCopy(), are counted once. Before each
+   * execution, if the total exceeds the budget, they release the outputs
+   * whose consumers have all executed since the outputs were generated, the
+   * oldest first, until the total fits in the budget. Outputs of
+   * vtkTrivialProducer, which cannot be generated again, and the inputs of
+   * sinks such as mappers and writers, which have no output port and may
+   * still use them, are never released. Default is 0: no budget, outputs are
+   * only released according to their release data flag.
+   */
+  static void SetMemoryBudget(unsigned long kibibytes);
+  static unsigned long GetMemoryBudget();
+  ///@}
+
+  /**
+   * Return the memory size, in kibibytes, of the outputs currently cached
+   * by the executives tracked with a memory budget.
+   */
+  static unsigned long GetCachedMemorySize();
+
+  ///@{
+  /**
+   * Get the largest memory size of the cached outputs observed before or
+   * after an execution while a memory budget was set, before the release of
+   * the outputs exceeding it. ResetPeakMemorySize() restarts the measure.
+   */
+  static unsigned long GetPeakMemorySize();
+  static void ResetPeakMemorySize();
+  ///@}
+
   /**
    * Bring the PipelineMTime up to date.
    */
@@ -156,6 +196,14 @@ public:
    */
   static vtkInformationIntegerKey* DATA_NOT_GENERATED();
 
+  /**
+   * Key set in a REQUEST_DATA request whose inputs are known to be up to
+   * date, so that the request is not forwarded upstream. Used by
+   * vtkExecutionScheduler, which executes the upstream algorithms itself.
+   * @ingroup InformationKeys
+   */
+  static vtkInformationIntegerKey* INPUTS_UP_TO_DATE();
+
   /**
    * Create (New) and return a data object of the given type.
    * This is here for backwards compatibility. Use
@@ -213,6 +261,15 @@ protected:
   virtual void MarkOutputsGenerated(
     vtkInformation* request, vtkInformationVector** inInfoVec, vtkInformationVector* outInfoVec);
 
+  // Release the consumed outputs of the tracked executives while the
+  // cached data exceed the memory budget. Called before an execution, with
+  // the memory budget locked.
+  void EnforceMemoryBudget();
+
+  // Whether the given output has been consumed and is no longer in use, so
+  // that it can be released by the memory budget.
+  static bool CanReleaseOutput(vtkInformation* outInfo, vtkDataObject* data);
+
   // Largest MTime of any algorithm on this executive or preceding
   // executives.
   vtkMTimeType PipelineMTime;
@@ -223,6 +280,7 @@ protected:
   vtkTimeStamp DataTime;
 
   friend class vtkCompositeDataPipeline;
+  friend class vtkExecutionScheduler;
 
   vtkInformation* InfoRequest;
   vtkInformation* DataObjectRequest;
@@ -0,0 +1,584 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkExecutionScheduler.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkExecutionScheduler.h"
+
+#include "vtkAlgorithm.h"
+#include "vtkAlgorithmOutput.h"
+#include "vtkCellData.h"
+#include "vtkCompositeDataIterator.h"
+#include "vtkCompositeDataPipeline.h"
+#include "vtkCompositeDataSet.h"
+#include "vtkDataArray.h"
+#include "vtkDataSet.h"
+#include "vtkDataSetAttributes.h"
+#include "vtkGenericCell.h"
+#include "vtkInformation.h"
+#include "vtkInformationExecutivePortKey.h"
+#include "vtkInformationIntegerKey.h"
+#include "vtkInformationVector.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPointData.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+#include "vtkStreamingDemandDrivenPipeline.h"
+
+#include <algorithm>
+#include <map>
+#include <set>
+#include <utility>
+#include <vector>
+
+vtkStandardNewMacro(vtkExecutionScheduler);
+vtkInformationKeyMacro(vtkExecutionScheduler, CONCURRENT_INPUT_READS, Integer);
+
+namespace
+{
+//------------------------------------------------------------------------------
+// Compute the ranges of the array selected by an INPUT_ARRAYS_TO_PROCESS
+// information, as vtkAlgorithm::GetInputArrayToProcess() resolves it.
+void PrepareArrayRanges(vtkDataSet* dataSet, vtkInformation* arrayInfo)
+{
+  std::vector<vtkFieldData*> fields;
+  switch (arrayInfo->Get(vtkDataObject::FIELD_ASSOCIATION()))
+  {
+    case vtkDataObject::FIELD_ASSOCIATION_POINTS:
+      fields.push_back(dataSet->GetPointData());
+      break;
+    case vtkDataObject::FIELD_ASSOCIATION_CELLS:
+      fields.push_back(dataSet->GetCellData());
+      break;
+    case vtkDataObject::FIELD_ASSOCIATION_NONE:
+      fields.push_back(dataSet->GetFieldData());
+      break;
+    case vtkDataObject::FIELD_ASSOCIATION_POINTS_THEN_CELLS:
+      fields.push_back(dataSet->GetPointData());
+      fields.push_back(dataSet->GetCellData());
+      break;
+    default:
+      return;
+  }
+
+  for (vtkFieldData* fieldData : fields)
+  {
+    vtkDataArray* array = nullptr;
+    if (arrayInfo->Has(vtkDataObject::FIELD_NAME()))
+    {
+      array = fieldData->GetArray(arrayInfo->Get(vtkDataObject::FIELD_NAME()));
+    }
+    else if (arrayInfo->Has(vtkDataObject::FIELD_ATTRIBUTE_TYPE()))
+    {
+      if (vtkDataSetAttributes* attributes = vtkDataSetAttributes::SafeDownCast(fieldData))
+      {
+        array = attributes->GetAttribute(arrayInfo->Get(vtkDataObject::FIELD_ATTRIBUTE_TYPE()));
+      }
+    }
+    for (int comp = -1; array && comp < array->GetNumberOfComponents(); ++comp)
+    {
+      array->GetRange(comp);
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+// Build the lazily computed state of a data object that several algorithms
+// are about to read concurrently: bounds, range of the active scalars, cell
+// structures, and the ranges of the arrays the algorithms select with
+// SetInputArrayToProcess().
+void PrepareForConcurrentReads(
+  vtkDataObject* dataObject, const std::vector<vtkInformation*>& arrayInfos)
+{
+  if (vtkCompositeDataSet* composite = vtkCompositeDataSet::SafeDownCast(dataObject))
+  {
+    vtkSmartPointer<vtkCompositeDataIterator> iter;
+    iter.TakeReference(composite->NewIterator());
+    for (iter->InitTraversal(); !iter->IsDoneWithTraversal(); iter->GoToNextItem())
+    {
+      PrepareForConcurrentReads(iter->GetCurrentDataObject(), arrayInfos);
+    }
+    return;
+  }
+
+  vtkDataSet* dataSet = vtkDataSet::SafeDownCast(dataObject);
+  if (!dataSet)
+  {
+    return;
+  }
+  double bounds[6];
+  dataSet->GetBounds(bounds);
+  dataSet->GetScalarRange();
+  if (dataSet->GetNumberOfCells() > 0)
+  {
+    vtkNew<vtkGenericCell> cell;
+    dataSet->GetCell(0, cell);
+  }
+  for (vtkInformation* arrayInfo : arrayInfos)
+  {
+    PrepareArrayRanges(dataSet, arrayInfo);
+  }
+}
+
+//------------------------------------------------------------------------------
+// Whether the algorithm declared that it reads its inputs through the
+// thread safe API only.
+bool ReadsInputsConcurrently(vtkAlgorithm* algorithm)
+{
+  vtkInformation* info = algorithm->GetInformation();
+  return info->Has(vtkExecutionScheduler::CONCURRENT_INPUT_READS()) &&
+    info->Get(vtkExecutionScheduler::CONCURRENT_INPUT_READS()) != 0;
+}
+
+//------------------------------------------------------------------------------
+struct Node
+{
+  vtkDemandDrivenPipeline* Executive;
+  std::vector<int> Ports;
+  std::vector<size_t> Consumers;
+  int NumberOfPendingProducers = 0;
+  bool Failed = false;
+};
+} // anonymous namespace
+
+//------------------------------------------------------------------------------
+class vtkExecutionScheduler::vtkInternals
+{
+public:
+  std::vector<std::pair<vtkSmartPointer<vtkAlgorithm>, int>> OutputPorts;
+  std::vector<Node> Nodes;
+  std::map<vtkExecutive*, size_t> NodeIds;
+
+  bool BuildGraph();
+  void AddNode(vtkExecutive* executive, int port, size_t consumer, bool& valid);
+  std::vector<std::vector<size_t>> SplitStage(const std::vector<size_t>& stage);
+  void PrepareStage(const std::vector<size_t>& stage);
+  static int ExecuteNode(Node& node);
+};
+
+//------------------------------------------------------------------------------
+// Gather the algorithms that need to execute for the requested output ports,
+// and the dependencies between them. Returns false if the graph contains
+// executives that cannot be scheduled.
+bool vtkExecutionScheduler::vtkInternals::BuildGraph()
+{
+  this->Nodes.clear();
+  this->NodeIds.clear();
+  bool valid = true;
+  for (auto& output : this->OutputPorts)
+  {
+    this->AddNode(output.first->GetExecutive(), output.second, static_cast<size_t>(-1), valid);
+  }
+  return valid;
+}
+
+//------------------------------------------------------------------------------
+void vtkExecutionScheduler::vtkInternals::AddNode(
+  vtkExecutive* executive, int port, size_t consumer, bool& valid)
+{
+  if (!valid || !executive)
+  {
+    return;
+  }
+
+  size_t nodeId;
+  auto known = this->NodeIds.find(executive);
+  if (known != this->NodeIds.end())
+  {
+    nodeId = known->second;
+    Node& node = this->Nodes[nodeId];
+    if (std::find(node.Ports.begin(), node.Ports.end(), port) == node.Ports.end())
+    {
+      node.Ports.push_back(port);
+    }
+  }
+  else
+  {
+    vtkDemandDrivenPipeline* ddp = vtkDemandDrivenPipeline::SafeDownCast(executive);
+    if (!ddp)
+    {
+      valid = false;
+      return;
+    }
+    // Up to date outputs do not need their inputs either.
+    if (!ddp->NeedToExecuteData(port, ddp->GetInputInformation(), ddp->GetOutputInformation()))
+    {
+      return;
+    }
+
+    nodeId = this->Nodes.size();
+    this->NodeIds[executive] = nodeId;
+    Node node;
+    node.Executive = ddp;
+    node.Ports.push_back(port);
+    this->Nodes.push_back(node);
+
+    vtkAlgorithm* algorithm = executive->GetAlgorithm();
+    for (int i = 0; i < algorithm->GetNumberOfInputPorts(); ++i)
+    {
+      for (int j = 0; j < algorithm->GetNumberOfInputConnections(i); ++j)
+      {
+        vtkExecutive* producer;
+        int producerPort;
+        vtkExecutive::PRODUCER()->Get(executive->GetInputInformation(i, j), producer, producerPort);
+        this->AddNode(producer, producerPort, nodeId, valid);
+      }
+    }
+  }
+
+  if (consumer != static_cast<size_t>(-1))
+  {
+    std::vector<size_t>& consumers = this->Nodes[nodeId].Consumers;
+    if (std::find(consumers.begin(), consumers.end(), consumer) == consumers.end())
+    {
+      consumers.push_back(consumer);
+      this->Nodes[consumer].NumberOfPendingProducers++;
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+// Split a stage in batches of algorithms that can execute concurrently.
+// vtkCompositeDataPipeline modifies the information of a composite input
+// while its consumer executes (e.g. when it iterates over the blocks for an
+// algorithm that does not support composite data), so the consumers of a
+// composite output execute one after the other. So do the algorithms that
+// did not set CONCURRENT_INPUT_READS and share an input: they may use
+// accessors relying on scratch space of the data set (e.g.
+// vtkDataSet::GetCell(vtkIdType)).
+std::vector<std::vector<size_t>> vtkExecutionScheduler::vtkInternals::SplitStage(
+  const std::vector<size_t>& stage)
+{
+  std::vector<std::vector<size_t>> batches(1);
+  std::vector<std::set<vtkInformation*>> batchInputs(1);
+  for (size_t nodeId : stage)
+  {
+    vtkDemandDrivenPipeline* executive = this->Nodes[nodeId].Executive;
+    const bool composite = vtkCompositeDataPipeline::SafeDownCast(executive) != nullptr;
+    const bool concurrentReads = ReadsInputsConcurrently(executive->GetAlgorithm());
+    std::vector<vtkInformation*> exclusiveInputs;
+    vtkInformationVector** inInfoVec = executive->GetInputInformation();
+    for (int i = 0; i < executive->GetNumberOfInputPorts(); ++i)
+    {
+      for (int j = 0; j < inInfoVec[i]->GetNumberOfInformationObjects(); ++j)
+      {
+        vtkInformation* inInfo = inInfoVec[i]->GetInformationObject(j);
+        if (!concurrentReads ||
+          (composite &&
+            vtkCompositeDataSet::SafeDownCast(inInfo->Get(vtkDataObject::DATA_OBJECT()))))
+        {
+          exclusiveInputs.push_back(inInfo);
+        }
+      }
+    }
+
+    // The first batch not reading any of these inputs exclusively.
+    size_t batch = 0;
+    while (batch < batches.size() &&
+      std::any_of(exclusiveInputs.begin(), exclusiveInputs.end(),
+        [&](vtkInformation* inInfo) { return batchInputs[batch].count(inInfo) != 0; }))
+    {
+      ++batch;
+    }
+    if (batch == batches.size())
+    {
+      batches.emplace_back();
+      batchInputs.emplace_back();
+    }
+    batches[batch].push_back(nodeId);
+    batchInputs[batch].insert(exclusiveInputs.begin(), exclusiveInputs.end());
+  }
+  return batches;
+}
+
+//------------------------------------------------------------------------------
+void vtkExecutionScheduler::vtkInternals::PrepareStage(const std::vector<size_t>& stage)
+{
+  if (stage.size() < 2)
+  {
+    return;
+  }
+  struct Readers
+  {
+    int Count = 0;
+    std::vector<vtkInformation*> ArrayInfos;
+  };
+  std::map<vtkDataObject*, Readers> readers;
+  for (size_t nodeId : stage)
+  {
+    vtkExecutive* executive = this->Nodes[nodeId].Executive;
+    vtkAlgorithm* algorithm = executive->GetAlgorithm();
+    vtkInformationVector* arrayInfos =
+      algorithm->GetInformation()->Get(vtkAlgorithm::INPUT_ARRAYS_TO_PROCESS());
+    for (int i = 0; i < algorithm->GetNumberOfInputPorts(); ++i)
+    {
+      for (int j = 0; j < algorithm->GetNumberOfInputConnections(i); ++j)
+      {
+        vtkDataObject* input = executive->GetInputData(i, j);
+        if (!input)
+        {
+          continue;
+        }
+        Readers& inputReaders = readers[input];
+        inputReaders.Count++;
+        for (int k = 0; arrayInfos && k < arrayInfos->GetNumberOfInformationObjects(); ++k)
+        {
+          vtkInformation* arrayInfo = arrayInfos->GetInformationObject(k);
+          if (arrayInfo->Get(vtkAlgorithm::INPUT_PORT()) == i &&
+            arrayInfo->Get(vtkAlgorithm::INPUT_CONNECTION()) == j)
+          {
+            inputReaders.ArrayInfos.push_back(arrayInfo);
+          }
+        }
+      }
+    }
+  }
+  for (auto& reader : readers)
+  {
+    if (reader.second.Count > 1)
+    {
+      PrepareForConcurrentReads(reader.first, reader.second.ArrayInfos);
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+int vtkExecutionScheduler::vtkInternals::ExecuteNode(Node& node)
+{
+  // The inputs were brought up to date by the previous stages: the request
+  // must not be forwarded upstream, where other threads may be reading.
+  vtkNew<vtkInformation> request;
+  request->Set(vtkDemandDrivenPipeline::REQUEST_DATA());
+  request->Set(vtkExecutive::FORWARD_DIRECTION(), vtkExecutive::RequestUpstream);
+  request->Set(vtkExecutive::ALGORITHM_AFTER_FORWARD(), 1);
+  request->Set(vtkDemandDrivenPipeline::INPUTS_UP_TO_DATE(), 1);
+
+  int result = 1;
+  vtkDemandDrivenPipeline* executive = node.Executive;
+  for (int port : node.Ports)
+  {
+    request->Set(vtkExecutive::FROM_OUTPUT_PORT(), port);
+    if (!executive->ProcessRequest(
+          request, executive->GetInputInformation(), executive->GetOutputInformation()))
+    {
+      result = 0;
+    }
+  }
+  return result;
+}
+
+//------------------------------------------------------------------------------
+vtkExecutionScheduler::vtkExecutionScheduler()
+{
+  this->NumberOfExecutedAlgorithms = 0;
+  this->NumberOfStages = 0;
+  this->MaximumConcurrency = 0;
+  this->Internals = new vtkInternals;
+}
+
+//------------------------------------------------------------------------------
+vtkExecutionScheduler::~vtkExecutionScheduler()
+{
+  delete this->Internals;
+}
+
+//------------------------------------------------------------------------------
+void vtkExecutionScheduler::AddOutputPort(vtkAlgorithmOutput* output)
+{
+  if (output && output->GetProducer())
+  {
+    this->Internals->OutputPorts.emplace_back(output->GetProducer(), output->GetIndex());
+    this->Modified();
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkExecutionScheduler::AddAlgorithm(vtkAlgorithm* algorithm)
+{
+  if (!algorithm)
+  {
+    return;
+  }
+  const int numberOfPorts = algorithm->GetNumberOfOutputPorts();
+  if (numberOfPorts == 0)
+  {
+    this->Internals->OutputPorts.emplace_back(algorithm, -1);
+  }
+  for (int port = 0; port < numberOfPorts; ++port)
+  {
+    this->Internals->OutputPorts.emplace_back(algorithm, port);
+  }
+  this->Modified();
+}
+
+//------------------------------------------------------------------------------
+void vtkExecutionScheduler::RemoveAllOutputPorts()
+{
+  this->Internals->OutputPorts.clear();
+  this->Modified();
+}
+
+//------------------------------------------------------------------------------
+int vtkExecutionScheduler::GetNumberOfOutputPorts()
+{
+  return static_cast<int>(this->Internals->OutputPorts.size());
+}
+
+//------------------------------------------------------------------------------
+int vtkExecutionScheduler::Update()
+{
+  vtkInternals& internals = *this->Internals;
+  this->NumberOfExecutedAlgorithms = 0;
+  this->NumberOfStages = 0;
+  this->MaximumConcurrency = 0;
+
+  // Meta-data passes, on this thread as they update pipeline information
+  // shared between the branches.
+  bool concurrent = !vtkDataObject::GetGlobalReleaseDataFlag();
+  for (auto& output : internals.OutputPorts)
+  {
+    vtkStreamingDemandDrivenPipeline* sddp =
+      vtkStreamingDemandDrivenPipeline::SafeDownCast(output.first->GetExecutive());
+    if (!sddp)
+    {
+      concurrent = false;
+      break;
+    }
+    const int port = output.second;
+    if (!sddp->UpdateInformation())
+    {
+      return 0;
+    }
+    sddp->PropagateTime(port);
+    sddp->UpdateTimeDependentInformation(port);
+    if (!sddp->PropagateUpdateExtent(port))
+    {
+      return 0;
+    }
+  }
+
+  int result = 1;
+  if (concurrent && internals.BuildGraph())
+  {
+    std::vector<Node>& nodes = internals.Nodes;
+
+    // Shared inputs are released once all their consumers have executed.
+    std::map<vtkInformation*, int> consumers;
+    for (Node& node : nodes)
+    {
+      vtkInformationVector** inInfoVec = node.Executive->GetInputInformation();
+      for (int i = 0; i < node.Executive->GetNumberOfInputPorts(); ++i)
+      {
+        for (int j = 0; j < inInfoVec[i]->GetNumberOfInformationObjects(); ++j)
+        {
+          consumers[inInfoVec[i]->GetInformationObject(j)]++;
+        }
+      }
+    }
+    std::vector<vtkInformation*> released;
+    for (auto& consumer : consumers)
+    {
+      if (consumer.second > 1 && consumer.first->Get(vtkDemandDrivenPipeline::RELEASE_DATA()))
+      {
+        consumer.first->Set(vtkDemandDrivenPipeline::RELEASE_DATA(), 0);
+        released.push_back(consumer.first);
+      }
+    }
+
+    std::vector<size_t> stage;
+    for (size_t nodeId = 0; nodeId < nodes.size(); ++nodeId)
+    {
+      if (nodes[nodeId].NumberOfPendingProducers == 0)
+      {
+        stage.push_back(nodeId);
+      }
+    }
+    while (!stage.empty())
+    {
+      for (const std::vector<size_t>& batch : internals.SplitStage(stage))
+      {
+        internals.PrepareStage(batch);
+        vtkSMPTools::For(0, static_cast<vtkIdType>(batch.size()), 1,
+          [&](vtkIdType begin, vtkIdType end) {
+            for (vtkIdType i = begin; i < end; ++i)
+            {
+              Node& node = nodes[batch[i]];
+              node.Failed = node.Failed || !vtkInternals::ExecuteNode(node);
+            }
+          });
+        this->NumberOfStages++;
+        this->MaximumConcurrency =
+          std::max(this->MaximumConcurrency, static_cast<int>(batch.size()));
+      }
+
+      // The consumers of failed algorithms are not executed, as when the
+      // request is forwarded upstream.
+      std::vector<size_t> next;
+      for (size_t nodeId : stage)
+      {
+        Node& node = nodes[nodeId];
+        if (node.Failed)
+        {
+          result = 0;
+        }
+        else
+        {
+          this->NumberOfExecutedAlgorithms++;
+        }
+        for (size_t consumerId : node.Consumers)
+        {
+          Node& consumer = nodes[consumerId];
+          consumer.Failed = consumer.Failed || node.Failed;
+          if (--consumer.NumberOfPendingProducers == 0)
+          {
+            next.push_back(consumerId);
+          }
+        }
+      }
+      stage.swap(next);
+    }
+
+    for (vtkInformation* info : released)
+    {
+      info->Set(vtkDemandDrivenPipeline::RELEASE_DATA(), 1);
+      if (vtkDataObject* dataObject = info->Get(vtkDataObject::DATA_OBJECT()))
+      {
+        dataObject->ReleaseData();
+      }
+    }
+    internals.Nodes.clear();
+    internals.NodeIds.clear();
+  }
+
+  // Finish as the executives would: nothing executes again if the outputs
+  // are up to date, but streaming algorithms asking to continue executing
+  // and pipelines that could not be scheduled are updated here.
+  for (auto& output : internals.OutputPorts)
+  {
+    if (!output.first->GetExecutive()->Update(output.second))
+    {
+      result = 0;
+    }
+  }
+  return result;
+}
+
+//------------------------------------------------------------------------------
+void vtkExecutionScheduler::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "NumberOfOutputPorts: " << this->Internals->OutputPorts.size() << "\n";
+  os << indent << "NumberOfExecutedAlgorithms: " << this->NumberOfExecutedAlgorithms << "\n";
+  os << indent << "NumberOfStages: " << this->NumberOfStages << "\n";
+  os << indent << "MaximumConcurrency: " << this->MaximumConcurrency << "\n";
+}
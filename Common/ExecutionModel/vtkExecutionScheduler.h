@@ -0,0 +1,130 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkExecutionScheduler.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkExecutionScheduler
+ * @brief   update several pipeline outputs, running independent branches concurrently
+ *
+ * The executives bring the outputs of a pipeline up to date depth first, on
+ * the calling thread: the branches feeding an algorithm with several inputs,
+ * or the pipelines of several mappers sharing a reader, execute one after the
+ * other. vtkExecutionScheduler updates a set of output ports as their
+ * executives would, but resolves the graph of algorithms that need to
+ * execute first and then runs the REQUEST_DATA passes by stages: all the
+ * algorithms whose inputs are up to date execute concurrently with
+ * vtkSMPTools, then the algorithms depending on them, and so on. The
+ * REQUEST_DATA_OBJECT, REQUEST_INFORMATION and REQUEST_UPDATE_EXTENT passes
+ * still run on the calling thread.
+ *
+ * Shared inputs are read only: algorithms executing concurrently may read
+ * the same input data object, but must not modify it, which stock VTK
+ * filters do not. Several vtkDataSet accessors are not reentrant either:
+ * GetCell(vtkIdType) and, for vtkImageData, GetPoint(vtkIdType) return
+ * scratch space owned by the data set.
+ * Algorithms therefore execute concurrently with other readers of the same
+ * input only if they set CONCURRENT_INPUT_READS() in their information,
+ * declaring that they use the thread safe API (e.g. GetCell(vtkIdType,
+ * vtkGenericCell*), GetPoint(vtkIdType, double[3])); the other ones are
+ * scheduled in separate stages. Before a stage, the lazily computed state
+ * of the inputs read by several of its algorithms is built on the calling
+ * thread: bounds, range of the active scalars, cell structures of
+ * vtkPolyData and the ranges of the arrays the algorithms select with
+ * SetInputArrayToProcess(). Ranges of other arrays must not be computed by
+ * concurrent readers. Shared inputs whose producer asks to release data are
+ * only released once all their consumers have executed.
+ *
+ * vtkCompositeDataPipeline modifies the information of a composite input
+ * while its consumer executes, so the algorithms reading the same composite
+ * data object execute in separate stages.
+ *
+ * Algorithms executing concurrently must not share other objects that
+ * their execution modifies (locators, implicit functions with lazily
+ * computed state, non thread safe observers). Executives that are not
+ * vtkDemandDrivenPipeline, and pipelines run with the global release data
+ * flag, are updated sequentially.
+ *
+ * @sa
+ * vtkStreamingDemandDrivenPipeline vtkSMPTools
+ */
+
+#ifndef vtkExecutionScheduler_h
+#define vtkExecutionScheduler_h
+
+#include "vtkCommonExecutionModelModule.h" // For export macro
+#include "vtkObject.h"
+
+class vtkAlgorithm;
+class vtkAlgorithmOutput;
+class vtkInformationIntegerKey;
+
+class VTKCOMMONEXECUTIONMODEL_EXPORT vtkExecutionScheduler : public vtkObject
+{
+public:
+  static vtkExecutionScheduler* New();
+  vtkTypeMacro(vtkExecutionScheduler, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  ///@{
+  /**
+   * Add an output port to bring up to date. AddAlgorithm() adds all the
+   * output ports of the algorithm, or its inputs if it has no output (e.g.
+   * a mapper). The algorithms are referenced until RemoveAllOutputPorts().
+   */
+  void AddOutputPort(vtkAlgorithmOutput* output);
+  void AddAlgorithm(vtkAlgorithm* algorithm);
+  void RemoveAllOutputPorts();
+  int GetNumberOfOutputPorts();
+  ///@}
+
+  /**
+   * Bring all the output ports up to date. Returns 1 on success, 0 if an
+   * algorithm failed.
+   */
+  virtual int Update();
+
+  ///@{
+  /**
+   * Statistics of the last Update(): the number of algorithms executed
+   * concurrently, the number of stages they were run in and the largest
+   * number of algorithms of a stage.
+   */
+  vtkGetMacro(NumberOfExecutedAlgorithms, int);
+  vtkGetMacro(NumberOfStages, int);
+  vtkGetMacro(MaximumConcurrency, int);
+  ///@}
+
+  /**
+   * Set to 1 in the information of an algorithm (vtkAlgorithm::GetInformation())
+   * that reads its inputs through the thread safe vtkDataSet API only, so that
+   * it may execute concurrently with other algorithms reading the same input.
+   */
+  static vtkInformationIntegerKey* CONCURRENT_INPUT_READS();
+
+protected:
+  vtkExecutionScheduler();
+  ~vtkExecutionScheduler() override;
+
+  int NumberOfExecutedAlgorithms;
+  int NumberOfStages;
+  int MaximumConcurrency;
+
+private:
+  vtkExecutionScheduler(const vtkExecutionScheduler&) = delete;
+  void operator=(const vtkExecutionScheduler&) = delete;
+
+  class vtkInternals;
+  vtkInternals* Internals;
+};
+
+#endif
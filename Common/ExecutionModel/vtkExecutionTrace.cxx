@@ -0,0 +1,544 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkExecutionTrace.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkExecutionTrace.h"
+
+#include "vtkAlgorithm.h"
+#include "vtkDataObject.h"
+#include "vtkInformation.h"
+#include "vtkInformationVector.h"
+#include "vtkLogger.h"
+#include "vtkObjectFactory.h"
+#include "vtkSMPTools.h"
+#include "vtkStreamingDemandDrivenPipeline.h"
+
+#include "vtksys/FStream.hxx"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+vtkStandardNewMacro(vtkExecutionTrace);
+
+namespace
+{
+struct TraceEvent
+{
+  std::string Name;
+  std::string Category;
+  std::string Algorithm;
+  double Start;
+  double Duration;
+  int Thread;
+  bool HasData;
+  vtkIdType Values[4];
+  long long OutputMemory;
+  long long AllocatedMemory;
+};
+
+// The indices of the input and output sizes in TraceEvent::Values, which are
+// the range and the grain of the vtkSMPTools::For() events.
+enum
+{
+  InputPoints,
+  InputCells,
+  OutputPoints,
+  OutputCells
+};
+
+struct TraceState
+{
+  std::atomic<bool> Enabled{ false };
+  std::once_flag EnvironmentFlag;
+  std::string FileName;
+  std::chrono::steady_clock::time_point Epoch = std::chrono::steady_clock::now();
+  std::mutex Mutex;
+  // The most recent events, at most MaximumNumberOfEvents.
+  std::deque<TraceEvent> Events;
+  std::size_t MaximumNumberOfEvents = 1000000;
+  long long NumberOfDiscardedEvents = 0;
+  std::map<std::thread::id, int> Threads;
+};
+
+// Never destroyed, the trace is written by an atexit() handler and the
+// SMP observer can be called until the process exits.
+TraceState& GetState()
+{
+  static TraceState* state = new TraceState;
+  return *state;
+}
+
+double Now()
+{
+  return std::chrono::duration<double, std::micro>(
+    std::chrono::steady_clock::now() - GetState().Epoch)
+    .count();
+}
+
+int GetThreadIndex()
+{
+  thread_local int index = -1;
+  if (index < 0)
+  {
+    TraceState& state = GetState();
+    std::lock_guard<std::mutex> lock(state.Mutex);
+    auto inserted = state.Threads.emplace(
+      std::this_thread::get_id(), static_cast<int>(state.Threads.size()));
+    index = inserted.first->second;
+  }
+  return index;
+}
+
+void AddEvent(TraceEvent&& event)
+{
+  TraceState& state = GetState();
+  std::lock_guard<std::mutex> lock(state.Mutex);
+  if (state.MaximumNumberOfEvents == 0)
+  {
+    state.NumberOfDiscardedEvents++;
+    return;
+  }
+  if (state.Events.size() >= state.MaximumNumberOfEvents)
+  {
+    state.Events.pop_front();
+    state.NumberOfDiscardedEvents++;
+  }
+  state.Events.push_back(std::move(event));
+}
+
+// The algorithms executing a request on this thread, innermost last, and the
+// start of the parallel regions they opened.
+thread_local std::vector<std::string> CurrentAlgorithms;
+thread_local std::vector<double> ParallelStarts;
+
+void ObserveFor(bool begin, vtkIdType first, vtkIdType last, vtkIdType grain)
+{
+  if (begin)
+  {
+    ParallelStarts.push_back(Now());
+    return;
+  }
+  if (ParallelStarts.empty())
+  {
+    // Enabled while the region was running.
+    return;
+  }
+  TraceEvent event;
+  event.Name = "vtkSMPTools::For";
+  event.Category = "SMP";
+  event.Algorithm = CurrentAlgorithms.empty() ? std::string() : CurrentAlgorithms.back();
+  event.Start = ParallelStarts.back();
+  event.Duration = Now() - event.Start;
+  event.Thread = GetThreadIndex();
+  event.HasData = false;
+  event.Values[0] = first;
+  event.Values[1] = last;
+  event.Values[2] = grain;
+  event.Values[3] = 0;
+  event.OutputMemory = 0;
+  event.AllocatedMemory = 0;
+  ParallelStarts.pop_back();
+  AddEvent(std::move(event));
+}
+
+const char* GetRequestName(vtkInformation* request)
+{
+  if (request->Has(vtkDemandDrivenPipeline::REQUEST_DATA()))
+  {
+    return "RequestData";
+  }
+  if (request->Has(vtkStreamingDemandDrivenPipeline::REQUEST_UPDATE_EXTENT()))
+  {
+    return "RequestUpdateExtent";
+  }
+  if (request->Has(vtkDemandDrivenPipeline::REQUEST_INFORMATION()))
+  {
+    return "RequestInformation";
+  }
+  if (request->Has(vtkDemandDrivenPipeline::REQUEST_DATA_OBJECT()))
+  {
+    return "RequestDataObject";
+  }
+  if (request->Has(vtkStreamingDemandDrivenPipeline::REQUEST_UPDATE_TIME()))
+  {
+    return "RequestUpdateTime";
+  }
+  if (request->Has(vtkStreamingDemandDrivenPipeline::REQUEST_TIME_DEPENDENT_INFORMATION()))
+  {
+    return "RequestTimeDependentInformation";
+  }
+  if (request->Has(vtkDemandDrivenPipeline::REQUEST_DATA_NOT_GENERATED()))
+  {
+    return "RequestDataNotGenerated";
+  }
+  return "ProcessRequest";
+}
+
+// Add the number of points and cells of the data objects of the vector.
+void AddSizes(vtkInformationVector* infoVector, vtkIdType& points, vtkIdType& cells)
+{
+  for (int i = 0; infoVector && i < infoVector->GetNumberOfInformationObjects(); ++i)
+  {
+    vtkDataObject* data = infoVector->GetInformationObject(i)->Get(vtkDataObject::DATA_OBJECT());
+    if (data)
+    {
+      points += data->GetNumberOfElements(vtkDataObject::POINT);
+      cells += data->GetNumberOfElements(vtkDataObject::CELL);
+    }
+  }
+}
+
+unsigned long GetMemorySize(vtkInformationVector* infoVector)
+{
+  unsigned long size = 0;
+  for (int i = 0; infoVector && i < infoVector->GetNumberOfInformationObjects(); ++i)
+  {
+    vtkDataObject* data = infoVector->GetInformationObject(i)->Get(vtkDataObject::DATA_OBJECT());
+    if (data)
+    {
+      size += data->GetActualMemorySize();
+    }
+  }
+  return size;
+}
+
+void PrintString(ostream& os, const std::string& str)
+{
+  os << '"';
+  for (char c : str)
+  {
+    if (c == '"' || c == '\\')
+    {
+      os << '\\' << c;
+    }
+    else if (static_cast<unsigned char>(c) < 0x20)
+    {
+      char escaped[8];
+      snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned int>(c));
+      os << escaped;
+    }
+    else
+    {
+      os << c;
+    }
+  }
+  os << '"';
+}
+
+void WriteAtExit()
+{
+  TraceState& state = GetState();
+  if (!vtkExecutionTrace::WriteChromeTrace(state.FileName.c_str()))
+  {
+    std::cerr << "vtkExecutionTrace: cannot write " << state.FileName << std::endl;
+  }
+  vtkExecutionTrace::PrintSummary(std::cerr);
+}
+
+void SetObserver(bool enabled)
+{
+  vtk::detail::smp::vtkSMPToolsAPI::GetInstance().SetForObserver(
+    enabled ? &ObserveFor : nullptr);
+}
+} // anonymous namespace
+
+//------------------------------------------------------------------------------
+void vtkExecutionTrace::SetEnabled(bool enabled)
+{
+  // Let the environment variable be read first, so that it does not
+  // override this call.
+  vtkExecutionTrace::GetEnabled();
+  GetState().Enabled = enabled;
+  SetObserver(enabled);
+}
+
+//------------------------------------------------------------------------------
+bool vtkExecutionTrace::GetEnabled()
+{
+  TraceState& state = GetState();
+  std::call_once(state.EnvironmentFlag, [&state]() {
+    const char* fileName = std::getenv("VTK_EXECUTION_TRACE");
+    if (fileName && *fileName)
+    {
+      state.FileName = fileName;
+      state.Enabled = true;
+      SetObserver(true);
+      std::atexit(&WriteAtExit);
+    }
+  });
+  return state.Enabled.load(std::memory_order_relaxed);
+}
+
+//------------------------------------------------------------------------------
+void vtkExecutionTrace::Clear()
+{
+  TraceState& state = GetState();
+  std::lock_guard<std::mutex> lock(state.Mutex);
+  state.Events.clear();
+  state.NumberOfDiscardedEvents = 0;
+}
+
+//------------------------------------------------------------------------------
+void vtkExecutionTrace::SetMaximumNumberOfEvents(int maximum)
+{
+  TraceState& state = GetState();
+  std::lock_guard<std::mutex> lock(state.Mutex);
+  state.MaximumNumberOfEvents = static_cast<std::size_t>(std::max(maximum, 0));
+  while (state.Events.size() > state.MaximumNumberOfEvents)
+  {
+    state.Events.pop_front();
+    state.NumberOfDiscardedEvents++;
+  }
+}
+
+//------------------------------------------------------------------------------
+int vtkExecutionTrace::GetMaximumNumberOfEvents()
+{
+  TraceState& state = GetState();
+  std::lock_guard<std::mutex> lock(state.Mutex);
+  return static_cast<int>(state.MaximumNumberOfEvents);
+}
+
+//------------------------------------------------------------------------------
+long long vtkExecutionTrace::GetNumberOfDiscardedEvents()
+{
+  TraceState& state = GetState();
+  std::lock_guard<std::mutex> lock(state.Mutex);
+  return state.NumberOfDiscardedEvents;
+}
+
+//------------------------------------------------------------------------------
+int vtkExecutionTrace::GetNumberOfEvents()
+{
+  TraceState& state = GetState();
+  std::lock_guard<std::mutex> lock(state.Mutex);
+  return static_cast<int>(state.Events.size());
+}
+
+//------------------------------------------------------------------------------
+void vtkExecutionTrace::PrintChromeTrace(ostream& os)
+{
+  TraceState& state = GetState();
+  std::lock_guard<std::mutex> lock(state.Mutex);
+  os << "{\"traceEvents\":[";
+  const char* separator = "\n";
+  for (const TraceEvent& event : state.Events)
+  {
+    os << separator << "{\"name\":";
+    PrintString(os, event.Name);
+    os << ",\"cat\":";
+    PrintString(os, event.Category);
+    os << ",\"ph\":\"X\",\"ts\":" << std::fixed << std::setprecision(3) << event.Start
+       << ",\"dur\":" << event.Duration << ",\"pid\":0,\"tid\":" << event.Thread
+       << ",\"args\":{\"algorithm\":";
+    PrintString(os, event.Algorithm);
+    if (event.Category == "SMP")
+    {
+      os << ",\"first\":" << event.Values[0] << ",\"last\":" << event.Values[1]
+         << ",\"grain\":" << event.Values[2];
+    }
+    else if (event.HasData)
+    {
+      os << ",\"input_points\":" << event.Values[InputPoints]
+         << ",\"input_cells\":" << event.Values[InputCells]
+         << ",\"output_points\":" << event.Values[OutputPoints]
+         << ",\"output_cells\":" << event.Values[OutputCells]
+         << ",\"output_memory_kib\":" << event.OutputMemory
+         << ",\"allocated_memory_kib\":" << event.AllocatedMemory;
+    }
+    os << "}}";
+    separator = ",\n";
+  }
+  os << "\n],\"displayTimeUnit\":\"ms\"}\n";
+  os.unsetf(std::ios_base::floatfield);
+}
+
+//------------------------------------------------------------------------------
+bool vtkExecutionTrace::WriteChromeTrace(const char* fileName)
+{
+  if (!fileName)
+  {
+    return false;
+  }
+  vtksys::ofstream file(fileName);
+  if (!file)
+  {
+    return false;
+  }
+  vtkExecutionTrace::PrintChromeTrace(file);
+  return static_cast<bool>(file);
+}
+
+//------------------------------------------------------------------------------
+void vtkExecutionTrace::PrintSummary(ostream& os)
+{
+  struct Summary
+  {
+    std::string Algorithm;
+    int Executions = 0;
+    double DataTime = 0.0;
+    double MetaDataTime = 0.0;
+    double ParallelTime = 0.0;
+    vtkIdType OutputCells = 0;
+    long long OutputMemory = 0;
+  };
+  std::map<std::string, Summary> summaries;
+  long long discarded;
+  {
+    TraceState& state = GetState();
+    std::lock_guard<std::mutex> lock(state.Mutex);
+    discarded = state.NumberOfDiscardedEvents;
+    for (const TraceEvent& event : state.Events)
+    {
+      if (event.Algorithm.empty())
+      {
+        continue;
+      }
+      Summary& summary = summaries[event.Algorithm];
+      summary.Algorithm = event.Algorithm;
+      if (event.Category == "SMP")
+      {
+        summary.ParallelTime += event.Duration;
+      }
+      else if (event.HasData)
+      {
+        summary.Executions++;
+        summary.DataTime += event.Duration;
+        summary.OutputCells = event.Values[OutputCells];
+        summary.OutputMemory = event.OutputMemory;
+      }
+      else
+      {
+        summary.MetaDataTime += event.Duration;
+      }
+    }
+  }
+  std::vector<Summary> sorted;
+  for (auto& item : summaries)
+  {
+    sorted.push_back(item.second);
+  }
+  std::stable_sort(sorted.begin(), sorted.end(),
+    [](const Summary& a, const Summary& b) { return a.DataTime > b.DataTime; });
+
+  std::size_t width = 9;
+  for (const Summary& summary : sorted)
+  {
+    width = std::max(width, summary.Algorithm.size());
+  }
+  const std::ios_base::fmtflags flags = os.flags();
+  os << std::left << std::setw(static_cast<int>(width)) << "Algorithm" << std::right
+     << std::setw(7) << "Execs" << std::setw(12) << "Data (s)" << std::setw(12) << "Meta (s)"
+     << std::setw(14) << "Parallel (s)" << std::setw(12) << "Cells" << std::setw(14)
+     << "Memory (KiB)" << "\n";
+  os << std::fixed << std::setprecision(6);
+  for (const Summary& summary : sorted)
+  {
+    os << std::left << std::setw(static_cast<int>(width)) << summary.Algorithm << std::right
+       << std::setw(7) << summary.Executions << std::setw(12) << summary.DataTime * 1e-6
+       << std::setw(12) << summary.MetaDataTime * 1e-6 << std::setw(14)
+       << summary.ParallelTime * 1e-6 << std::setw(12) << summary.OutputCells << std::setw(14)
+       << summary.OutputMemory << "\n";
+  }
+  if (vtkDemandDrivenPipeline::GetMemoryBudget() > 0)
+  {
+    os << "Peak cached memory (KiB): " << vtkDemandDrivenPipeline::GetPeakMemorySize()
+       << ", budget (KiB): " << vtkDemandDrivenPipeline::GetMemoryBudget() << "\n";
+  }
+  if (discarded > 0)
+  {
+    os << "Oldest events discarded: " << discarded << "\n";
+  }
+  os.flags(flags);
+}
+
+//------------------------------------------------------------------------------
+vtkExecutionTrace::RequestScope::RequestScope(vtkAlgorithm* algorithm, vtkInformation* request,
+  vtkInformationVector** inInfo, vtkInformationVector* outInfo)
+  : Algorithm(algorithm)
+  , Request(request)
+  , InputInformation(inInfo)
+  , OutputInformation(outInfo)
+  , StartTime(0.0)
+  , InitialOutputMemorySize(0)
+  , Active(vtkExecutionTrace::GetEnabled() && algorithm && request)
+{
+  if (!this->Active)
+  {
+    return;
+  }
+  if (this->Request->Has(vtkDemandDrivenPipeline::REQUEST_DATA()))
+  {
+    this->InitialOutputMemorySize = GetMemorySize(this->OutputInformation);
+  }
+  CurrentAlgorithms.push_back(vtkLogger::GetIdentifier(this->Algorithm));
+  this->StartTime = Now();
+}
+
+//------------------------------------------------------------------------------
+vtkExecutionTrace::RequestScope::~RequestScope()
+{
+  if (!this->Active)
+  {
+    return;
+  }
+  TraceEvent event;
+  event.Start = this->StartTime;
+  event.Duration = Now() - this->StartTime;
+  event.Thread = GetThreadIndex();
+  event.Category = GetRequestName(this->Request);
+  event.Name = std::string(this->Algorithm->GetClassName()) + "::" + event.Category;
+  event.Algorithm = std::move(CurrentAlgorithms.back());
+  CurrentAlgorithms.pop_back();
+  event.HasData = this->Request->Has(vtkDemandDrivenPipeline::REQUEST_DATA()) != 0;
+  std::fill(event.Values, event.Values + 4, 0);
+  event.OutputMemory = 0;
+  event.AllocatedMemory = 0;
+  if (event.HasData)
+  {
+    for (int i = 0; i < this->Algorithm->GetNumberOfInputPorts(); ++i)
+    {
+      AddSizes(this->InputInformation[i], event.Values[InputPoints], event.Values[InputCells]);
+    }
+    AddSizes(this->OutputInformation, event.Values[OutputPoints], event.Values[OutputCells]);
+    const unsigned long memorySize = GetMemorySize(this->OutputInformation);
+    event.OutputMemory = static_cast<long long>(memorySize);
+    // The executive already released the previous outputs: this is the memory
+    // the request allocated for them, not the change since the last execution.
+    event.AllocatedMemory =
+      static_cast<long long>(memorySize) - static_cast<long long>(this->InitialOutputMemorySize);
+  }
+  AddEvent(std::move(event));
+}
+
+//------------------------------------------------------------------------------
+void vtkExecutionTrace::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "Enabled: " << vtkExecutionTrace::GetEnabled() << "\n";
+  os << indent << "NumberOfEvents: " << vtkExecutionTrace::GetNumberOfEvents() << "\n";
+  os << indent << "MaximumNumberOfEvents: " << vtkExecutionTrace::GetMaximumNumberOfEvents()
+     << "\n";
+  os << indent << "NumberOfDiscardedEvents: " << vtkExecutionTrace::GetNumberOfDiscardedEvents()
+     << "\n";
+}
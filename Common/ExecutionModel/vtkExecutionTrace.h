@@ -0,0 +1,146 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkExecutionTrace.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkExecutionTrace
+ * @brief   record the requests executed by all the algorithms of the pipelines
+ *
+ * When enabled, vtkExecutionTrace records every request that the executives
+ * pass to an algorithm (REQUEST_DATA_OBJECT, REQUEST_INFORMATION,
+ * REQUEST_UPDATE_EXTENT, REQUEST_DATA...): its wall time, the thread it ran
+ * on and, for REQUEST_DATA, the number of points and cells of the inputs and
+ * outputs, the memory size of the outputs and the part of it allocated by
+ * the request (the executives release the previous outputs before it). The parallel
+ * regions of vtkSMPTools::For() are recorded as well, and attributed to the
+ * algorithm executing on the calling thread.
+ *
+ * The trace can be written in the Chrome trace event format, to be loaded in
+ * chrome://tracing or https://ui.perfetto.dev, and summarized per algorithm
+ * with PrintSummary().
+ *
+ * Tracing can be enabled without rebuilding the application by setting the
+ * VTK_EXECUTION_TRACE environment variable to a file name: the trace is then
+ * written to that file when the application exits, and the summary is
+ * printed on the standard error.
+ *
+ * Only the most recent events are kept, up to SetMaximumNumberOfEvents().
+ *
+ * vtkExecutionTrace only has static methods, and is thread safe.
+ *
+ * @sa
+ * vtkExecutionTimer vtkLogger
+ */
+
+#ifndef vtkExecutionTrace_h
+#define vtkExecutionTrace_h
+
+#include "vtkCommonExecutionModelModule.h" // For export macro
+#include "vtkObject.h"
+
+class vtkAlgorithm;
+class vtkInformation;
+class vtkInformationVector;
+
+class VTKCOMMONEXECUTIONMODEL_EXPORT vtkExecutionTrace : public vtkObject
+{
+public:
+  static vtkExecutionTrace* New();
+  vtkTypeMacro(vtkExecutionTrace, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  ///@{
+  /**
+   * Enable or disable the recording. It is disabled by default, unless the
+   * VTK_EXECUTION_TRACE environment variable is set.
+   */
+  static void SetEnabled(bool enabled);
+  static bool GetEnabled();
+  ///@}
+
+  /**
+   * Discard the recorded events.
+   */
+  static void Clear();
+
+  /**
+   * Return the number of recorded events.
+   */
+  static int GetNumberOfEvents();
+
+  ///@{
+  /**
+   * Maximum number of events kept, 1000000 by default: when it is reached,
+   * the oldest events are discarded.
+   */
+  static void SetMaximumNumberOfEvents(int maximum);
+  static int GetMaximumNumberOfEvents();
+  ///@}
+
+  /**
+   * Return the number of events discarded since the last Clear().
+   */
+  static long long GetNumberOfDiscardedEvents();
+
+  ///@{
+  /**
+   * Write the recorded events in the Chrome trace event format.
+   * WriteChromeTrace() returns false if the file cannot be written.
+   */
+  static void PrintChromeTrace(ostream& os);
+  static bool WriteChromeTrace(const char* fileName);
+  ///@}
+
+  /**
+   * Print a table with, for each algorithm, the number and the duration of
+   * its executions, the time spent in parallel regions, the size of its
+   * outputs and the memory they use, the most expensive algorithms first.
+   * When a memory budget is set on the executives, the peak memory size of
+   * the cached outputs is printed as well.
+   */
+  static void PrintSummary(ostream& os);
+
+  /**
+   * Record the request passed to an algorithm during the lifetime of the
+   * scope. Used by the executives around vtkAlgorithm::ProcessRequest().
+   */
+  class VTKCOMMONEXECUTIONMODEL_EXPORT RequestScope
+  {
+  public:
+    RequestScope(vtkAlgorithm* algorithm, vtkInformation* request, vtkInformationVector** inInfo,
+      vtkInformationVector* outInfo);
+    ~RequestScope();
+
+  private:
+    RequestScope(const RequestScope&) = delete;
+    void operator=(const RequestScope&) = delete;
+
+    vtkAlgorithm* Algorithm;
+    vtkInformation* Request;
+    vtkInformationVector** InputInformation;
+    vtkInformationVector* OutputInformation;
+    double StartTime;
+    unsigned long InitialOutputMemorySize;
+    bool Active;
+  };
+
+protected:
+  vtkExecutionTrace() = default;
+  ~vtkExecutionTrace() override = default;
+
+private:
+  vtkExecutionTrace(const vtkExecutionTrace&) = delete;
+  void operator=(const vtkExecutionTrace&) = delete;
+};
+
+#endif
@@ -17,6 +17,7 @@
 #include "vtkAlgorithm.h"
 #include "vtkAlgorithmOutput.h"
 #include "vtkDataObject.h"
+#include "vtkExecutionTrace.h"
 #include "vtkGarbageCollector.h"
 #include "vtkInformation.h"
 #include "vtkInformationExecutivePortKey.h"
@@ -743,7 +744,11 @@ int vtkExecutive::CallAlgorithm(vtkInformation* request, int direction,
 
   // Invoke the request on the algorithm.
   this->InAlgorithm = 1;
-  int result = this->Algorithm->ProcessRequest(request, inInfo, outInfo);
+  int result;
+  {
+    vtkExecutionTrace::RequestScope trace(this->Algorithm, request, inInfo, outInfo);
+    result = this->Algorithm->ProcessRequest(request, inInfo, outInfo);
+  }
   this->InAlgorithm = 0;
 
   // If the algorithm failed report it now.
@@ -17,6 +17,7 @@
 
 #include "vtkAlgorithm.h"
 #include "vtkAlgorithmOutput.h"
+#include "vtkExecutionTrace.h"
 #include "vtkExecutive.h"
 #include "vtkInformation.h"
 #include "vtkInformationExecutivePortKey.h"
@@ -40,12 +41,16 @@
 #include "vtkSMPThreadLocalObject.h"
 #include "vtkSMPTools.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <vector>
 
 //------------------------------------------------------------------------------
 vtkStandardNewMacro(vtkThreadedCompositeDataPipeline);
 
+vtkInformationKeyMacro(vtkThreadedCompositeDataPipeline, BLOCK_EXECUTION_MODE, Integer);
+
 //------------------------------------------------------------------------------
 namespace
 {
@@ -67,6 +72,21 @@ void DeleteAll(vtkInformationVector** dst, int n)
   }
   delete[] dst;
 }
+
+// The copy of the algorithm that an executive calls on the current thread.
+struct BlockAlgorithm
+{
+  vtkExecutive* Executive;
+  vtkAlgorithm* Algorithm;
+};
+thread_local BlockAlgorithm CurrentBlockAlgorithm = { nullptr, nullptr };
+
+// Estimated cost of the execution of an algorithm for a block.
+vtkIdType EstimateCost(vtkDataObject* dobj)
+{
+  vtkIdType cost = dobj->GetNumberOfElements(vtkDataObject::CELL);
+  return cost > 0 ? cost : dobj->GetNumberOfElements(vtkDataObject::POINT);
+}
 };
 
 //------------------------------------------------------------------------------
@@ -114,7 +134,8 @@ class ProcessBlock
 public:
   ProcessBlock(vtkThreadedCompositeDataPipeline* exec, vtkInformationVector** inInfoVec,
     vtkInformationVector* outInfoVec, int compositePort, int connection, vtkInformation* request,
-    const std::vector<vtkDataObject*>& inObjs, std::vector<vtkDataObject*>& outObjs)
+    const std::vector<vtkDataObject*>& inObjs, const std::vector<vtkIdType>& order,
+    std::vector<vtkDataObject*>& outObjs, vtkAlgorithm* firstClone)
     : Exec(exec)
     , InInfoVec(inInfoVec)
     , OutInfoVec(outInfoVec)
@@ -122,6 +143,9 @@ public:
     , Connection(connection)
     , Request(request)
     , InObjs(inObjs)
+    , Order(order)
+    , CloneAlgorithm(firstClone != nullptr)
+    , FirstClone(firstClone)
   {
     int numInputPorts = this->Exec->GetNumberOfInputPorts();
     this->OutObjs = &outObjs[0];
@@ -146,6 +170,18 @@ public:
       (*itr2)->Delete();
       ++itr2;
     }
+
+    for (vtkAlgorithm* algorithm : this->Algorithms)
+    {
+      if (algorithm)
+      {
+        algorithm->Delete();
+      }
+    }
+    if (vtkAlgorithm* firstClone = this->FirstClone.exchange(nullptr))
+    {
+      firstClone->Delete();
+    }
   }
 
   void Initialize()
@@ -159,6 +195,19 @@ public:
 
     vtkInformation*& request = this->Requests.Local();
     request->Copy(this->Request, 1);
+
+    vtkAlgorithm*& algorithm = this->Algorithms.Local();
+    algorithm = nullptr;
+    if (this->CloneAlgorithm)
+    {
+      // The first thread takes the copy made by ExecuteEach().
+      algorithm = this->FirstClone.exchange(nullptr);
+      if (!algorithm)
+      {
+        algorithm = this->Exec->GetAlgorithm()->NewInstance();
+        algorithm->CopyParameters(this->Exec->GetAlgorithm());
+      }
+    }
   }
 
   void operator()(vtkIdType begin, vtkIdType end)
@@ -169,8 +218,11 @@ public:
 
     vtkInformation* inInfo = inInfoVec[this->CompositePort]->GetInformationObject(this->Connection);
 
-    for (vtkIdType i = begin; i < end; ++i)
+    const BlockAlgorithm previous = CurrentBlockAlgorithm;
+    CurrentBlockAlgorithm = { this->Exec, this->Algorithms.Local() };
+    for (vtkIdType k = begin; k < end; ++k)
     {
+      const vtkIdType i = this->Order[k];
       std::vector<vtkDataObject*> outObjList = this->Exec->ExecuteSimpleAlgorithmForBlock(
         &inInfoVec[0], outInfoVec, inInfo, request, this->InObjs[i]);
       for (int j = 0; j < outInfoVec->GetNumberOfInformationObjects(); ++j)
@@ -178,6 +230,7 @@ public:
         this->OutObjs[i * outInfoVec->GetNumberOfInformationObjects() + j] = outObjList[j];
       }
     }
+    CurrentBlockAlgorithm = previous;
   }
 
   void Reduce() {}
@@ -191,11 +244,15 @@ protected:
   int Connection;
   vtkInformation* Request;
   const std::vector<vtkDataObject*>& InObjs;
+  const std::vector<vtkIdType>& Order;
   vtkDataObject** OutObjs;
+  bool CloneAlgorithm;
+  std::atomic<vtkAlgorithm*> FirstClone;
 
   vtkSMPThreadLocal<vtkInformationVector**> InInfoVecs;
   vtkSMPThreadLocal<vtkInformationVector*> OutInfoVecs;
   vtkSMPThreadLocalObject<vtkInformation> Requests;
+  vtkSMPThreadLocal<vtkAlgorithm*> Algorithms;
 };
 
 //------------------------------------------------------------------------------
@@ -216,6 +273,32 @@ void vtkThreadedCompositeDataPipeline::ExecuteEach(vtkCompositeDataIterator* ite
   int connection, vtkInformation* request,
   std::vector<vtkSmartPointer<vtkCompositeDataSet>>& compositeOutput)
 {
+  vtkInformation* algorithmInfo = this->Algorithm->GetInformation();
+  int mode = Reentrant;
+  if (algorithmInfo->Has(BLOCK_EXECUTION_MODE()))
+  {
+    mode = algorithmInfo->Get(BLOCK_EXECUTION_MODE());
+  }
+  // The first copy of the algorithm tells whether it can be copied; it is
+  // then handed to the first thread executing blocks.
+  vtkAlgorithm* firstClone = nullptr;
+  if (mode == CloneAlgorithm)
+  {
+    firstClone = this->Algorithm->NewInstance();
+    if (!firstClone->CopyParameters(this->Algorithm))
+    {
+      firstClone->Delete();
+      firstClone = nullptr;
+      mode = Sequential;
+    }
+  }
+  if (mode == Sequential)
+  {
+    this->Superclass::ExecuteEach(
+      iter, inInfoVec, outInfoVec, compositePort, connection, request, compositeOutput);
+    return;
+  }
+
   // from input data objects  itr -> (inObjs, indices)
   // inObjs are the non-null objects that we will loop over.
   // indices map the input objects to inObjs
@@ -239,14 +322,26 @@ void vtkThreadedCompositeDataPipeline::ExecuteEach(vtkCompositeDataIterator* ite
   std::vector<vtkDataObject*> outObjs;
   outObjs.resize(indices.size() * outInfoVec->GetNumberOfInformationObjects(), nullptr);
 
+  // execute the most expensive blocks first, one at a time, so that the
+  // threads do not wait for a large block scheduled last
+  std::vector<vtkIdType> costs(inObjs.size());
+  std::vector<vtkIdType> order(inObjs.size());
+  for (size_t i = 0; i < inObjs.size(); ++i)
+  {
+    costs[i] = EstimateCost(inObjs[i]);
+    order[i] = static_cast<vtkIdType>(i);
+  }
+  std::stable_sort(order.begin(), order.end(),
+    [&costs](vtkIdType a, vtkIdType b) { return costs[a] > costs[b]; });
+
   // create the parallel task processBlock
-  ProcessBlock processBlock(
-    this, inInfoVec, outInfoVec, compositePort, connection, request, inObjs, outObjs);
+  ProcessBlock processBlock(this, inInfoVec, outInfoVec, compositePort, connection, request,
+    inObjs, order, outObjs, firstClone);
 
   vtkSmartPointer<vtkProgressObserver> origPo(this->Algorithm->GetProgressObserver());
   vtkNew<vtkSMPProgressObserver> po;
   this->Algorithm->SetProgressObserver(po);
-  vtkSMPTools::For(0, static_cast<vtkIdType>(inObjs.size()), processBlock);
+  vtkSMPTools::For(0, static_cast<vtkIdType>(inObjs.size()), 1, processBlock);
   this->Algorithm->SetProgressObserver(origPo);
 
   int i = 0;
@@ -275,8 +370,18 @@ int vtkThreadedCompositeDataPipeline::CallAlgorithm(vtkInformation* request, int
   // Copy default information in the direction of information flow.
   this->CopyDefaultInformation(request, direction, inInfo, outInfo);
 
-  // Invoke the request on the algorithm.
-  int result = this->Algorithm->ProcessRequest(request, inInfo, outInfo);
+  // Invoke the request on the algorithm, or on the copy executing the
+  // blocks of the current thread.
+  vtkAlgorithm* algorithm = this->Algorithm;
+  if (CurrentBlockAlgorithm.Executive == this && CurrentBlockAlgorithm.Algorithm)
+  {
+    algorithm = CurrentBlockAlgorithm.Algorithm;
+  }
+  int result;
+  {
+    vtkExecutionTrace::RequestScope trace(algorithm, request, inInfo, outInfo);
+    result = algorithm->ProcessRequest(request, inInfo, outInfo);
+  }
 
   // If the algorithm failed report it now.
   if (!result)
@@ -19,10 +19,19 @@
  * vtkThreadedCompositeDataPipeline processes a composite data object in
  * parallel using the SMP framework. It does this by creating a vector of
  * data objects (the pieces of the composite data) and processing them
- * using vtkSMPTools::For. Note that this requires that the
- * algorithm implement all pipeline passes in a re-entrant way. It should
- * store/retrieve all state changes using input and output information
- * objects, which are unique to each thread.
+ * using vtkSMPTools::For. The largest blocks, by number of cells, are
+ * executed first so that the threads finish together.
+ *
+ * Algorithms declare how their blocks can be executed concurrently with the
+ * BLOCK_EXECUTION_MODE() key of their information. Reentrant algorithms
+ * implement all pipeline passes in a re-entrant way: they store/retrieve all
+ * state changes using input and output information objects, which are unique
+ * to each thread. Algorithms that keep state on themselves during execution
+ * (locators, scratch lists, internal filters) use CloneAlgorithm: each thread
+ * executes its own copy of the algorithm, created with NewInstance() and
+ * vtkAlgorithm::CopyParameters(), which must copy every parameter of the
+ * algorithm and fails unless the algorithm overrides it. Algorithms that can do neither opt out with Sequential: their
+ * blocks are executed one after the other.
  */
 
 #ifndef vtkThreadedCompositeDataPipeline_h
@@ -31,6 +40,7 @@
 #include "vtkCommonExecutionModelModule.h" // For export macro
 #include "vtkCompositeDataPipeline.h"
 
+class vtkInformationIntegerKey;
 class vtkInformationVector;
 class vtkInformation;
 
@@ -49,6 +59,25 @@ public:
   int CallAlgorithm(vtkInformation* request, int direction, vtkInformationVector** inInfo,
     vtkInformationVector* outInfo) override;
 
+  /**
+   * How the blocks of a composite input can be executed concurrently.
+   */
+  enum BlockExecutionModes
+  {
+    Reentrant,
+    CloneAlgorithm,
+    Sequential
+  };
+
+  /**
+   * Key of the information of an algorithm (vtkAlgorithm::GetInformation())
+   * holding its BlockExecutionModes. Algorithms without it are Reentrant, as
+   * this executive always assumed.
+   * CloneAlgorithm falls back to Sequential when CopyParameters() fails.
+   * @ingroup InformationKeys
+   */
+  static vtkInformationIntegerKey* BLOCK_EXECUTION_MODE();
+
 protected:
   vtkThreadedCompositeDataPipeline();
   ~vtkThreadedCompositeDataPipeline() override;
@@ -0,0 +1,130 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestAttributeStatisticsStreamer.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that vtkAttributeStatisticsStreamer computes the same statistics
+// whatever the number of pieces the input is streamed in.
+
+#include "vtkAttributeStatisticsStreamer.h"
+#include "vtkCellData.h"
+#include "vtkDataSetAttributes.h"
+#include "vtkElevationFilter.h"
+#include "vtkMathUtilities.h"
+#include "vtkNew.h"
+#include "vtkPointDataToCellData.h"
+#include "vtkPolyData.h"
+#include "vtkSphereSource.h"
+#include "vtkTable.h"
+#include "vtkUnsignedCharArray.h"
+
+#include <iostream>
+
+namespace
+{
+vtkIdType FindRow(vtkTable* table, const char* name, const char* association)
+{
+  for (vtkIdType row = 0; row < table->GetNumberOfRows(); ++row)
+  {
+    if (table->GetValueByName(row, "Array").ToString() == name &&
+      table->GetValueByName(row, "Association").ToString() == association)
+    {
+      return row;
+    }
+  }
+  return -1;
+}
+
+double Get(vtkTable* table, vtkIdType row, const char* column)
+{
+  return table->GetValueByName(row, column).ToDouble();
+}
+} // anonymous namespace
+
+int TestAttributeStatisticsStreamer(int, char*[])
+{
+  vtkNew<vtkSphereSource> sphere;
+  sphere->SetThetaResolution(64);
+  sphere->SetPhiResolution(32);
+  vtkNew<vtkElevationFilter> elevation;
+  elevation->SetInputConnection(sphere->GetOutputPort());
+  elevation->SetLowPoint(0.0, 0.0, -0.5);
+  elevation->SetHighPoint(0.0, 0.0, 0.5);
+  vtkNew<vtkPointDataToCellData> toCells;
+  toCells->SetInputConnection(elevation->GetOutputPort());
+  toCells->PassPointDataOn();
+
+  vtkNew<vtkAttributeStatisticsStreamer> statistics;
+  statistics->SetInputConnection(toCells->GetOutputPort());
+  statistics->Update();
+  vtkNew<vtkTable> reference;
+  reference->DeepCopy(statistics->GetOutputDataObject(0));
+  const vtkIdType referenceRow = FindRow(reference, "Elevation", "Cells");
+  if (referenceRow < 0 || FindRow(reference, "Elevation", "Points") < 0 ||
+    Get(reference, referenceRow, "Count") != 64 * 30 * 2)
+  {
+    std::cerr << "Wrong statistics of the whole input." << std::endl;
+    reference->Dump();
+    return EXIT_FAILURE;
+  }
+
+  statistics->SetNumberOfStreamDivisions(4);
+  statistics->Update();
+  vtkTable* streamed = vtkTable::SafeDownCast(statistics->GetOutputDataObject(0));
+  const vtkIdType row = FindRow(streamed, "Elevation", "Cells");
+  if (row < 0 || Get(streamed, row, "Count") != Get(reference, referenceRow, "Count") ||
+    Get(streamed, row, "Minimum") != Get(reference, referenceRow, "Minimum") ||
+    Get(streamed, row, "Maximum") != Get(reference, referenceRow, "Maximum") ||
+    !vtkMathUtilities::FuzzyCompare(
+      Get(streamed, row, "Sum"), Get(reference, referenceRow, "Sum"), 1e-9) ||
+    !vtkMathUtilities::FuzzyCompare(
+      Get(streamed, row, "Mean"), Get(reference, referenceRow, "Mean"), 1e-12) ||
+    !vtkMathUtilities::FuzzyCompare(
+      Get(streamed, row, "Variance"), Get(reference, referenceRow, "Variance"), 1e-12))
+  {
+    std::cerr << "Streamed statistics differ from those of the whole input." << std::endl;
+    reference->Dump();
+    streamed->Dump();
+    return EXIT_FAILURE;
+  }
+  if (!toCells->GetOutputDataObject(0)->GetDataReleased())
+  {
+    std::cerr << "The last piece was not released." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Duplicate cells are not counted, and data set by SetInputDataObject() is reduced once and kept.
+  toCells->UpdatePiece(0, 1, 0);
+  vtkNew<vtkPolyData> ghosted;
+  ghosted->ShallowCopy(toCells->GetOutput());
+  vtkNew<vtkUnsignedCharArray> ghosts;
+  ghosts->SetName(vtkDataSetAttributes::GhostArrayName());
+  ghosts->SetNumberOfValues(ghosted->GetNumberOfCells());
+  ghosts->Fill(0);
+  ghosts->SetValue(0, vtkDataSetAttributes::DUPLICATECELL);
+  ghosts->SetValue(1, vtkDataSetAttributes::DUPLICATECELL);
+  ghosted->GetCellData()->AddArray(ghosts);
+  statistics->SetInputDataObject(ghosted);
+  statistics->Update();
+  streamed = vtkTable::SafeDownCast(statistics->GetOutputDataObject(0));
+  if (Get(streamed, FindRow(streamed, "Elevation", "Cells"), "Count") !=
+      Get(reference, referenceRow, "Count") - 2 ||
+    FindRow(streamed, vtkDataSetAttributes::GhostArrayName(), "Cells") >= 0 ||
+    ghosted->GetDataReleased())
+  {
+    std::cerr << "Wrong statistics of ghosted input." << std::endl;
+    streamed->Dump();
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,258 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestSMPPipelineFilters.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that common filters produce the same blocks with
+// vtkThreadedCompositeDataPipeline as with vtkCompositeDataPipeline.
+
+#include "vtkCompositeDataIterator.h"
+#include "vtkCompositeDataPipeline.h"
+#include "vtkContourFilter.h"
+#include "vtkCutter.h"
+#include "vtkDataSet.h"
+#include "vtkGeometryFilter.h"
+#include "vtkImageData.h"
+#include "vtkInformation.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
+#include "vtkPlane.h"
+#include "vtkRTAnalyticSource.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+#include "vtkThreadedCompositeDataPipeline.h"
+#include "vtkThreshold.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <functional>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+namespace
+{
+// Images of various sizes, the unstructured grids thresholded from them and
+// an empty block.
+vtkSmartPointer<vtkMultiBlockDataSet> MakeBlocks()
+{
+  vtkNew<vtkMultiBlockDataSet> blocks;
+  for (unsigned int i = 0; i < 8; ++i)
+  {
+    const int size = 2 + 3 * (i % 4);
+    vtkNew<vtkRTAnalyticSource> source;
+    source->SetWholeExtent(-size, size, -size, size, -size, size);
+    source->Update();
+    if (i % 2)
+    {
+      vtkNew<vtkThreshold> threshold;
+      threshold->SetInputData(source->GetOutput());
+      threshold->SetInputArrayToProcess(0, 0, 0, vtkDataObject::FIELD_ASSOCIATION_POINTS, "RTData");
+      threshold->ThresholdBetween(100.0, 250.0);
+      threshold->Update();
+      blocks->SetBlock(i, threshold->GetOutput());
+    }
+    else
+    {
+      vtkNew<vtkImageData> image;
+      image->ShallowCopy(source->GetOutput());
+      blocks->SetBlock(i, image);
+    }
+  }
+  blocks->SetBlock(8, nullptr);
+  return blocks;
+}
+
+bool CompareFilter(
+  const char* name, vtkMultiBlockDataSet* input, std::function<vtkAlgorithm*()> newFilter)
+{
+  vtkSmartPointer<vtkAlgorithm> serial;
+  serial.TakeReference(newFilter());
+  vtkNew<vtkCompositeDataPipeline> serialExecutive;
+  serial->SetExecutive(serialExecutive);
+  serial->SetInputDataObject(input);
+  serial->Update();
+
+  vtkSmartPointer<vtkAlgorithm> threaded;
+  threaded.TakeReference(newFilter());
+  vtkNew<vtkThreadedCompositeDataPipeline> threadedExecutive;
+  threaded->SetExecutive(threadedExecutive);
+  threaded->SetInputDataObject(input);
+  threaded->Update();
+
+  // Executing again must give the same result.
+  threaded->Modified();
+  threaded->Update();
+
+  vtkCompositeDataSet* expected =
+    vtkCompositeDataSet::SafeDownCast(serial->GetOutputDataObject(0));
+  vtkCompositeDataSet* output = vtkCompositeDataSet::SafeDownCast(threaded->GetOutputDataObject(0));
+  if (!expected || !output)
+  {
+    std::cerr << name << ": no composite output." << std::endl;
+    return false;
+  }
+  vtkSmartPointer<vtkCompositeDataIterator> iter;
+  iter.TakeReference(expected->NewIterator());
+  int numberOfBlocks = 0;
+  vtkIdType numberOfCells = 0;
+  for (iter->InitTraversal(); !iter->IsDoneWithTraversal(); iter->GoToNextItem())
+  {
+    vtkDataSet* expectedBlock = vtkDataSet::SafeDownCast(iter->GetCurrentDataObject());
+    vtkDataSet* block = vtkDataSet::SafeDownCast(output->GetDataSet(iter));
+    if (!block || block->GetNumberOfPoints() != expectedBlock->GetNumberOfPoints() ||
+      block->GetNumberOfCells() != expectedBlock->GetNumberOfCells())
+    {
+      std::cerr << name << ": block " << iter->GetCurrentFlatIndex() << " differs." << std::endl;
+      return false;
+    }
+    numberOfBlocks++;
+    numberOfCells += block->GetNumberOfCells();
+  }
+  if (numberOfBlocks != 8 || numberOfCells == 0)
+  {
+    std::cerr << name << ": " << numberOfBlocks << " blocks with " << numberOfCells << " cells."
+              << std::endl;
+    return false;
+  }
+  return true;
+}
+
+// The parameters printed by an algorithm, without the addresses and times
+// that differ between copies.
+std::string PrintParameters(vtkAlgorithm* algorithm)
+{
+  std::ostringstream stream;
+  algorithm->Print(stream);
+  std::istringstream lines(stream.str());
+  std::string parameters;
+  for (std::string line; std::getline(lines, line);)
+  {
+    if (line.find("0x") == std::string::npos && line.find("Time") == std::string::npos)
+    {
+      parameters += line + "\n";
+    }
+  }
+  return parameters;
+}
+
+// A parameter that CopyParameters() does not copy shows in PrintSelf().
+bool CheckCopy(const char* name, vtkAlgorithm* algorithm)
+{
+  vtkSmartPointer<vtkAlgorithm> copy;
+  copy.TakeReference(algorithm->NewInstance());
+  if (!copy->CopyParameters(algorithm) || PrintParameters(copy) != PrintParameters(algorithm))
+  {
+    std::cerr << name << ": wrong copy of the parameters." << std::endl
+              << PrintParameters(algorithm) << std::endl
+              << PrintParameters(copy) << std::endl;
+    return false;
+  }
+  return true;
+}
+} // anonymous namespace
+
+int TestSMPPipelineFilters(int, char*[])
+{
+  vtkSMPTools::Initialize(4);
+  vtkSmartPointer<vtkMultiBlockDataSet> blocks = MakeBlocks();
+
+  vtkNew<vtkPlane> plane;
+  plane->SetNormal(1.0, 1.0, 0.0);
+  if (!CompareFilter("Contour", blocks,
+        []() {
+          vtkContourFilter* contour = vtkContourFilter::New();
+          contour->SetInputArrayToProcess(
+            0, 0, 0, vtkDataObject::FIELD_ASSOCIATION_POINTS, "RTData");
+          contour->SetValue(0, 150.0);
+          contour->SetValue(1, 200.0);
+          return contour;
+        }) ||
+    !CompareFilter("Cutter", blocks,
+      [&plane]() {
+        vtkCutter* cutter = vtkCutter::New();
+        cutter->SetCutFunction(plane);
+        cutter->SetValue(0, 0.0);
+        cutter->SetValue(1, 2.5);
+        return cutter;
+      }) ||
+    !CompareFilter("Threshold", blocks,
+      []() {
+        vtkThreshold* threshold = vtkThreshold::New();
+        threshold->SetInputArrayToProcess(
+          0, 0, 0, vtkDataObject::FIELD_ASSOCIATION_POINTS, "RTData");
+        threshold->ThresholdBetween(150.0, 200.0);
+        return threshold;
+      }) ||
+    !CompareFilter("Geometry", blocks, []() {
+      vtkGeometryFilter* geometry = vtkGeometryFilter::New();
+      geometry->MergingOff();
+      return geometry;
+    }))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // The parameters are copied to the algorithm of each thread.
+  vtkNew<vtkContourFilter> contour;
+  contour->SetInputArrayToProcess(0, 0, 0, vtkDataObject::FIELD_ASSOCIATION_POINTS, "RTData");
+  contour->SetValue(0, 120.0);
+  contour->ComputeScalarsOff();
+  vtkNew<vtkContourFilter> copy;
+  vtkNew<vtkCutter> cutter;
+  if (!copy->CopyParameters(contour) || copy->GetNumberOfContours() != 1 ||
+    copy->GetValue(0) != 120.0 || copy->GetComputeScalars() ||
+    copy->GetInputArrayInformation(0)->Get(vtkDataObject::FIELD_NAME()) == nullptr ||
+    copy->CopyParameters(cutter))
+  {
+    std::cerr << "Wrong copy of the contour filter parameters." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Algorithms that do not implement CopyParameters() cannot be copied.
+  vtkNew<vtkThreshold> threshold;
+  vtkSmartPointer<vtkAlgorithm> thresholdCopy;
+  thresholdCopy.TakeReference(threshold->NewInstance());
+  if (thresholdCopy->CopyParameters(threshold))
+  {
+    std::cerr << "vtkThreshold parameters copied by the default implementation." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  contour->SetNumberOfContours(3);
+  contour->GenerateTrianglesOff();
+  contour->SetOutputPointsPrecision(vtkAlgorithm::DOUBLE_PRECISION);
+  contour->UseScalarTreeOn();
+  cutter->SetCutFunction(plane);
+  cutter->GenerateValues(4, -1.0, 1.0);
+  cutter->SetSortByToSortByCell();
+  cutter->GenerateCutScalarsOn();
+  cutter->GenerateTrianglesOff();
+  vtkNew<vtkGeometryFilter> geometry;
+  geometry->PointClippingOn();
+  geometry->SetCellMaximum(10);
+  geometry->SetExtent(0.0, 1.0, 0.0, 2.0, 0.0, 3.0);
+  geometry->MergingOff();
+  geometry->FastModeOn();
+  geometry->SetDegree(2);
+  geometry->PassThroughCellIdsOn();
+  geometry->SetOriginalPointIdsName("Ids");
+  geometry->SetNonlinearSubdivisionLevel(2);
+  geometry->DelegationOff();
+  geometry->MeshCachingOff();
+  if (!CheckCopy("Contour", contour) || !CheckCopy("Cutter", cutter) ||
+    !CheckCopy("Geometry", geometry))
+  {
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
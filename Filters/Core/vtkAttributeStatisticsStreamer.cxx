@@ -0,0 +1,336 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkAttributeStatisticsStreamer.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkAttributeStatisticsStreamer.h"
+
+#include "vtkArrayDispatch.h"
+#include "vtkCellData.h"
+#include "vtkCompositeDataIterator.h"
+#include "vtkCompositeDataSet.h"
+#include "vtkDataArrayRange.h"
+#include "vtkDataSet.h"
+#include "vtkDoubleArray.h"
+#include "vtkIdTypeArray.h"
+#include "vtkInformation.h"
+#include "vtkInformationVector.h"
+#include "vtkIntArray.h"
+#include "vtkMath.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPointData.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+#include "vtkStringArray.h"
+#include "vtkTable.h"
+#include "vtkUnsignedCharArray.h"
+
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+vtkStandardNewMacro(vtkAttributeStatisticsStreamer);
+
+namespace
+{
+// Count, extrema, sum, mean and sum of squared deviations of a set of
+// values, merged with the pairwise update of Chan et al.
+struct Moments
+{
+  vtkIdType Count = 0;
+  double Minimum = std::numeric_limits<double>::max();
+  double Maximum = std::numeric_limits<double>::lowest();
+  double Sum = 0.0;
+  double Mean = 0.0;
+  double M2 = 0.0;
+
+  void Add(double x)
+  {
+    this->Count++;
+    this->Minimum = std::min(this->Minimum, x);
+    this->Maximum = std::max(this->Maximum, x);
+    this->Sum += x;
+    const double delta = x - this->Mean;
+    this->Mean += delta / this->Count;
+    this->M2 += delta * (x - this->Mean);
+  }
+
+  void Merge(const Moments& other)
+  {
+    if (other.Count == 0)
+    {
+      return;
+    }
+    if (this->Count == 0)
+    {
+      *this = other;
+      return;
+    }
+    const double count = static_cast<double>(this->Count + other.Count);
+    const double delta = other.Mean - this->Mean;
+    this->Mean += delta * other.Count / count;
+    this->M2 += other.M2 + delta * delta * this->Count * other.Count / count;
+    this->Count += other.Count;
+    this->Minimum = std::min(this->Minimum, other.Minimum);
+    this->Maximum = std::max(this->Maximum, other.Maximum);
+    this->Sum += other.Sum;
+  }
+};
+
+// Compute the moments of each component of an array in parallel, skipping
+// the tuples whose ghost value matches the mask.
+template <typename ArrayT>
+struct ComputeMomentsFunctor
+{
+  ArrayT* Array;
+  const unsigned char* Ghosts;
+  unsigned char GhostMask;
+  int NumberOfComponents;
+  vtkSMPThreadLocal<std::vector<Moments>> LocalMoments;
+  std::vector<Moments> Result;
+
+  ComputeMomentsFunctor(ArrayT* array, const unsigned char* ghosts, unsigned char ghostMask)
+    : Array(array)
+    , Ghosts(ghosts)
+    , GhostMask(ghostMask)
+    , NumberOfComponents(array->GetNumberOfComponents())
+  {
+  }
+
+  void Initialize() { this->LocalMoments.Local().resize(this->NumberOfComponents); }
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    std::vector<Moments>& moments = this->LocalMoments.Local();
+    const auto tuples = vtk::DataArrayTupleRange(this->Array, begin, end);
+    vtkIdType tupleId = begin;
+    for (const auto tuple : tuples)
+    {
+      if (!this->Ghosts || !(this->Ghosts[tupleId] & this->GhostMask))
+      {
+        for (int c = 0; c < this->NumberOfComponents; ++c)
+        {
+          const double value = static_cast<double>(tuple[c]);
+          if (!vtkMath::IsNan(value))
+          {
+            moments[c].Add(value);
+          }
+        }
+      }
+      ++tupleId;
+    }
+  }
+
+  void Reduce()
+  {
+    this->Result.assign(this->NumberOfComponents, Moments());
+    for (const std::vector<Moments>& moments : this->LocalMoments)
+    {
+      for (int c = 0; c < this->NumberOfComponents; ++c)
+      {
+        this->Result[c].Merge(moments[c]);
+      }
+    }
+  }
+};
+
+struct ComputeMomentsWorker
+{
+  template <typename ArrayT>
+  void operator()(ArrayT* array, const unsigned char* ghosts, unsigned char ghostMask,
+    std::vector<Moments>& result)
+  {
+    ComputeMomentsFunctor<ArrayT> functor(array, ghosts, ghostMask);
+    vtkSMPTools::For(0, array->GetNumberOfTuples(), functor);
+    result = std::move(functor.Result);
+  }
+};
+} // anonymous namespace
+
+//------------------------------------------------------------------------------
+class vtkAttributeStatisticsStreamer::vtkInternals
+{
+public:
+  // Moments of the components of the arrays, by association and name.
+  std::map<std::pair<int, std::string>, std::vector<Moments>> Statistics;
+};
+
+//------------------------------------------------------------------------------
+vtkAttributeStatisticsStreamer::vtkAttributeStatisticsStreamer()
+{
+  this->Internals = new vtkInternals;
+}
+
+//------------------------------------------------------------------------------
+vtkAttributeStatisticsStreamer::~vtkAttributeStatisticsStreamer()
+{
+  delete this->Internals;
+}
+
+//------------------------------------------------------------------------------
+int vtkAttributeStatisticsStreamer::InitializeReduction(vtkInformationVector* vtkNotUsed(output))
+{
+  this->Internals->Statistics.clear();
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+int vtkAttributeStatisticsStreamer::ReducePiece(vtkDataObject* piece)
+{
+  if (vtkDataSet* dataSet = vtkDataSet::SafeDownCast(piece))
+  {
+    this->ReduceDataSet(dataSet);
+  }
+  else if (vtkCompositeDataSet* composite = vtkCompositeDataSet::SafeDownCast(piece))
+  {
+    vtkSmartPointer<vtkCompositeDataIterator> iter;
+    iter.TakeReference(composite->NewIterator());
+    for (iter->InitTraversal(); !iter->IsDoneWithTraversal(); iter->GoToNextItem())
+    {
+      if (vtkDataSet* block = vtkDataSet::SafeDownCast(iter->GetCurrentDataObject()))
+      {
+        this->ReduceDataSet(block);
+      }
+    }
+  }
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+void vtkAttributeStatisticsStreamer::ReduceDataSet(vtkDataSet* dataSet)
+{
+  for (int association = vtkDataObject::FIELD_ASSOCIATION_POINTS;
+       association <= vtkDataObject::FIELD_ASSOCIATION_CELLS; ++association)
+  {
+    vtkDataSetAttributes* attributes;
+    vtkUnsignedCharArray* ghostArray;
+    unsigned char ghostMask;
+    if (association == vtkDataObject::FIELD_ASSOCIATION_POINTS)
+    {
+      attributes = dataSet->GetPointData();
+      ghostArray = dataSet->GetPointGhostArray();
+      ghostMask = vtkDataSetAttributes::DUPLICATEPOINT;
+    }
+    else
+    {
+      attributes = dataSet->GetCellData();
+      ghostArray = dataSet->GetCellGhostArray();
+      ghostMask = vtkDataSetAttributes::DUPLICATECELL;
+    }
+    const unsigned char* ghosts = ghostArray ? ghostArray->GetPointer(0) : nullptr;
+
+    for (int i = 0; i < attributes->GetNumberOfArrays(); ++i)
+    {
+      vtkDataArray* array = attributes->GetArray(i);
+      if (!array || !array->GetName() || array == ghostArray)
+      {
+        continue;
+      }
+      std::vector<Moments>& statistics =
+        this->Internals->Statistics[std::make_pair(association, std::string(array->GetName()))];
+      if (statistics.empty())
+      {
+        statistics.resize(array->GetNumberOfComponents());
+      }
+      else if (statistics.size() != static_cast<size_t>(array->GetNumberOfComponents()))
+      {
+        vtkWarningMacro("Array " << array->GetName() << " has " << array->GetNumberOfComponents()
+                                 << " components instead of " << statistics.size()
+                                 << " in a previous piece; it is ignored.");
+        continue;
+      }
+
+      std::vector<Moments> pieceStatistics;
+      ComputeMomentsWorker worker;
+      if (!vtkArrayDispatch::Dispatch::Execute(array, worker, ghosts, ghostMask, pieceStatistics))
+      {
+        worker(array, ghosts, ghostMask, pieceStatistics);
+      }
+      for (size_t c = 0; c < statistics.size(); ++c)
+      {
+        statistics[c].Merge(pieceStatistics[c]);
+      }
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+int vtkAttributeStatisticsStreamer::FinalizeReduction(vtkInformationVector* outputVector)
+{
+  vtkTable* output = vtkTable::GetData(outputVector);
+
+  vtkNew<vtkStringArray> names;
+  names->SetName("Array");
+  vtkNew<vtkStringArray> associations;
+  associations->SetName("Association");
+  vtkNew<vtkIntArray> components;
+  components->SetName("Component");
+  vtkNew<vtkIdTypeArray> counts;
+  counts->SetName("Count");
+  vtkNew<vtkDoubleArray> columns[5];
+  const char* columnNames[5] = { "Minimum", "Maximum", "Sum", "Mean", "Variance" };
+  for (int i = 0; i < 5; ++i)
+  {
+    columns[i]->SetName(columnNames[i]);
+  }
+
+  for (const auto& item : this->Internals->Statistics)
+  {
+    for (size_t c = 0; c < item.second.size(); ++c)
+    {
+      const Moments& moments = item.second[c];
+      names->InsertNextValue(item.first.second);
+      associations->InsertNextValue(
+        item.first.first == vtkDataObject::FIELD_ASSOCIATION_POINTS ? "Points" : "Cells");
+      components->InsertNextValue(static_cast<int>(c));
+      counts->InsertNextValue(moments.Count);
+      const bool empty = moments.Count == 0;
+      columns[0]->InsertNextValue(empty ? vtkMath::Nan() : moments.Minimum);
+      columns[1]->InsertNextValue(empty ? vtkMath::Nan() : moments.Maximum);
+      columns[2]->InsertNextValue(moments.Sum);
+      columns[3]->InsertNextValue(empty ? vtkMath::Nan() : moments.Mean);
+      columns[4]->InsertNextValue(
+        moments.Count > 1 ? moments.M2 / (moments.Count - 1) : (empty ? vtkMath::Nan() : 0.0));
+    }
+  }
+  this->Internals->Statistics.clear();
+
+  output->Initialize();
+  output->AddColumn(names);
+  output->AddColumn(associations);
+  output->AddColumn(components);
+  output->AddColumn(counts);
+  for (int i = 0; i < 5; ++i)
+  {
+    output->AddColumn(columns[i]);
+  }
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+int vtkAttributeStatisticsStreamer::FillOutputPortInformation(
+  int vtkNotUsed(port), vtkInformation* info)
+{
+  info->Set(vtkDataObject::DATA_TYPE_NAME(), "vtkTable");
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+void vtkAttributeStatisticsStreamer::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+}
@@ -0,0 +1,72 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkAttributeStatisticsStreamer.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkAttributeStatisticsStreamer
+ * @brief   descriptive statistics of the point and cell arrays of a streamed input
+ *
+ * vtkAttributeStatisticsStreamer computes the count, minimum, maximum, sum,
+ * mean and unbiased variance of each component of the numeric point and
+ * cell arrays of its input, one piece at a time (see vtkReductionStreamer),
+ * so that the statistics of datasets larger than the memory can be computed.
+ * The moments of each piece are computed in parallel with vtkSMPTools and
+ * merged with those of the previous pieces.
+ *
+ * The output is a vtkTable with one row per array component and the columns
+ * "Array", "Association" ("Points" or "Cells"), "Component", "Count",
+ * "Minimum", "Maximum", "Sum", "Mean" and "Variance". Composite inputs are
+ * reduced over all their leaves. Values that are not a number, and points
+ * and cells flagged as duplicate in the ghost arrays, are ignored. Points
+ * shared by several pieces without being flagged are counted in each.
+ *
+ * @sa
+ * vtkReductionStreamer vtkDescriptiveStatistics
+ */
+
+#ifndef vtkAttributeStatisticsStreamer_h
+#define vtkAttributeStatisticsStreamer_h
+
+#include "vtkFiltersCoreModule.h" // For export macro
+#include "vtkReductionStreamer.h"
+
+class vtkDataSet;
+
+class VTKFILTERSCORE_EXPORT vtkAttributeStatisticsStreamer : public vtkReductionStreamer
+{
+public:
+  static vtkAttributeStatisticsStreamer* New();
+  vtkTypeMacro(vtkAttributeStatisticsStreamer, vtkReductionStreamer);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+protected:
+  vtkAttributeStatisticsStreamer();
+  ~vtkAttributeStatisticsStreamer() override;
+
+  int InitializeReduction(vtkInformationVector* outputVector) override;
+  int ReducePiece(vtkDataObject* piece) override;
+  int FinalizeReduction(vtkInformationVector* outputVector) override;
+
+  int FillOutputPortInformation(int port, vtkInformation* info) override;
+
+  void ReduceDataSet(vtkDataSet* dataSet);
+
+private:
+  vtkAttributeStatisticsStreamer(const vtkAttributeStatisticsStreamer&) = delete;
+  void operator=(const vtkAttributeStatisticsStreamer&) = delete;
+
+  class vtkInternals;
+  vtkInternals* Internals;
+};
+
+#endif
@@ -37,11 +37,14 @@
 #include "vtkPolyDataNormals.h"
 #include "vtkRectilinearGrid.h"
 #include "vtkRectilinearSynchronizedTemplates.h"
+#include "vtkScalarTree.h"
+#include "vtkSmartPointer.h"
 #include "vtkSpanSpace.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkStructuredGrid.h"
 #include "vtkSynchronizedTemplates2D.h"
 #include "vtkSynchronizedTemplates3D.h"
+#include "vtkThreadedCompositeDataPipeline.h"
 #include "vtkTimerLog.h"
 #include "vtkUniformGrid.h"
 
@@ -95,6 +98,10 @@ vtkContourFilter::vtkContourFilter()
   // by default process active point scalars
   this->SetInputArrayToProcess(
     0, 0, 0, vtkDataObject::FIELD_ASSOCIATION_POINTS, vtkDataSetAttributes::SCALARS);
+
+  // the locator and the internal filters are not shared between threads
+  this->Information->Set(vtkThreadedCompositeDataPipeline::BLOCK_EXECUTION_MODE(),
+    vtkThreadedCompositeDataPipeline::CloneAlgorithm);
 }
 
 //------------------------------------------------------------------------------
@@ -696,6 +703,65 @@ void vtkContourFilter::CreateDefaultLocator()
   }
 }
 
+//------------------------------------------------------------------------------
+bool vtkContourFilter::CopyParameters(vtkAlgorithm* source)
+{
+  vtkContourFilter* other = vtkContourFilter::SafeDownCast(source);
+  if (!other)
+  {
+    return false;
+  }
+  if (other == this)
+  {
+    return true;
+  }
+  this->CopyInputArraysToProcess(other);
+  this->ContourValues->DeepCopy(other->ContourValues);
+  this->ComputeNormals = other->ComputeNormals;
+  this->ComputeGradients = other->ComputeGradients;
+  this->ComputeScalars = other->ComputeScalars;
+  this->UseScalarTree = other->UseScalarTree;
+  this->OutputPointsPrecision = other->OutputPointsPrecision;
+  this->GenerateTriangles = other->GenerateTriangles;
+  this->SetArrayComponent(other->GetArrayComponent());
+
+  vtkSmartPointer<vtkIncrementalPointLocator> locator;
+  if (other->Locator)
+  {
+    locator.TakeReference(other->Locator->NewInstance());
+    locator->SetTolerance(other->Locator->GetTolerance());
+  }
+  this->SetLocator(locator);
+  vtkSmartPointer<vtkScalarTree> scalarTree;
+  if (other->ScalarTree)
+  {
+    scalarTree.TakeReference(other->ScalarTree->NewInstance());
+  }
+  this->SetScalarTree(scalarTree);
+  this->Modified();
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool vtkContourFilter::PrintParameterKey(ostream& os)
+{
+  os << "Values:";
+  for (int i = 0; i < this->GetNumberOfContours(); ++i)
+  {
+    os << " " << this->GetValue(i);
+  }
+  os << "\nNormals " << this->ComputeNormals << " Gradients " << this->ComputeGradients
+     << " Scalars " << this->ComputeScalars << " Triangles " << this->GenerateTriangles
+     << " Precision " << this->OutputPointsPrecision << " Component "
+     << this->GetArrayComponent() << "\n";
+  if (this->Locator)
+  {
+    os << "Locator " << this->Locator->GetClassName() << " " << this->Locator->GetTolerance()
+       << "\n";
+  }
+  return true;
+}
+
 //------------------------------------------------------------------------------
 void vtkContourFilter::SetArrayComponent(int comp)
 {
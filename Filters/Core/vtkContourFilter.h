@@ -202,6 +202,21 @@ public:
   int GetOutputPointsPrecision() const;
   ///@}
 
+  /**
+   * Copy the contour values and the parameters of another contour filter.
+   * Its locator and scalar tree, which are modified during execution, are
+   * replaced by new instances of the same classes. A parameter added to this
+   * class must be copied here too, or the copies executing the blocks of
+   * vtkThreadedCompositeDataPipeline keep its default value.
+   */
+  bool CopyParameters(vtkAlgorithm* source) override;
+
+  /**
+   * Print the contour values and the parameters of the filter, for result
+   * caches. It must follow the parameters copied by CopyParameters().
+   */
+  bool PrintParameterKey(ostream& os) override;
+
 protected:
   vtkContourFilter();
   ~vtkContourFilter() override;
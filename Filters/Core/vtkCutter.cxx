@@ -46,6 +46,7 @@
 #include "vtkStructuredGrid.h"
 #include "vtkSynchronizedTemplates3D.h"
 #include "vtkSynchronizedTemplatesCutter3D.h"
+#include "vtkThreadedCompositeDataPipeline.h"
 #include "vtkTimerLog.h"
 #include "vtkUnstructuredGridBase.h"
 
@@ -73,6 +74,10 @@ vtkCutter::vtkCutter(vtkImplicitFunction* cf)
   this->SynchronizedTemplatesCutter3D = vtkSynchronizedTemplatesCutter3D::New();
   this->GridSynchronizedTemplates = vtkGridSynchronizedTemplates3D::New();
   this->RectilinearSynchronizedTemplates = vtkRectilinearSynchronizedTemplates::New();
+
+  // the locator and the internal filters are not shared between threads
+  this->Information->Set(vtkThreadedCompositeDataPipeline::BLOCK_EXECUTION_MODE(),
+    vtkThreadedCompositeDataPipeline::CloneAlgorithm);
 }
 
 //------------------------------------------------------------------------------
@@ -1035,6 +1040,65 @@ void vtkCutter::UnstructuredGridCutter(vtkDataSet* input, vtkPolyData* output)
   output->Squeeze();
 }
 
+//------------------------------------------------------------------------------
+bool vtkCutter::CopyParameters(vtkAlgorithm* source)
+{
+  vtkCutter* other = vtkCutter::SafeDownCast(source);
+  if (!other)
+  {
+    return false;
+  }
+  if (other == this)
+  {
+    return true;
+  }
+  this->CopyInputArraysToProcess(other);
+  this->ContourValues->DeepCopy(other->ContourValues);
+  this->SetCutFunction(other->CutFunction);
+  this->GenerateTriangles = other->GenerateTriangles;
+  this->SortBy = other->SortBy;
+  this->GenerateCutScalars = other->GenerateCutScalars;
+  this->OutputPointsPrecision = other->OutputPointsPrecision;
+
+  vtkSmartPointer<vtkIncrementalPointLocator> locator;
+  if (other->Locator)
+  {
+    locator.TakeReference(other->Locator->NewInstance());
+    locator->SetTolerance(other->Locator->GetTolerance());
+  }
+  this->SetLocator(locator);
+  this->Modified();
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool vtkCutter::PrintParameterKey(ostream& os)
+{
+  os << "Values:";
+  for (int i = 0; i < this->GetNumberOfContours(); ++i)
+  {
+    os << " " << this->GetValue(i);
+  }
+  os << "\nCut function ";
+  if (!this->CutFunction)
+  {
+    os << "none\n";
+  }
+  else if (!this->CutFunction->PrintParameterKey(os))
+  {
+    // Functions without a key are identified by their modification time.
+    os << this->CutFunction << " " << this->CutFunction->GetMTime() << "\n";
+  }
+  os << "Triangles " << this->GenerateTriangles << " Sort " << this->SortBy << " Scalars "
+     << this->GenerateCutScalars << " Precision " << this->OutputPointsPrecision << "\n";
+  if (this->Locator)
+  {
+    os << "Locator " << this->Locator->GetClassName() << " " << this->Locator->GetTolerance()
+       << "\n";
+  }
+  return true;
+}
+
 //------------------------------------------------------------------------------
 // Specify a spatial locator for merging points. By default,
 // an instance of vtkMergePoints is used.
@@ -219,6 +219,24 @@ public:
   vtkGetMacro(OutputPointsPrecision, int);
   ///@}
 
+  /**
+   * Copy the contour values and the parameters of another cutter. The cut
+   * function is shared, as it is only evaluated during execution, while the
+   * locator is replaced by a new instance of the same class. A parameter added
+   * to this class must be copied here too, or the copies executing the blocks
+   * of vtkThreadedCompositeDataPipeline keep its default value.
+   */
+  bool CopyParameters(vtkAlgorithm* source) override;
+
+  /**
+   * Print the contour values and the parameters of the cutter, for result
+   * caches. The cut function is identified by its
+   * vtkImplicitFunction::PrintParameterKey(), or by its address and
+   * modification time when it provides no key. It must follow the parameters
+   * copied by CopyParameters().
+   */
+  bool PrintParameterKey(ostream& os) override;
+
 protected:
   vtkCutter(vtkImplicitFunction* cf = nullptr);
   ~vtkCutter() override;
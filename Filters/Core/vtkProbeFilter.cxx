@@ -863,48 +863,82 @@ void vtkProbeFilter::ProbeImageDataPointsSMP(vtkDataSet* input, vtkImageData* so
   auto sourceGhostFlags =
     vtkUnsignedCharArray::SafeDownCast(cd->GetArray(vtkDataSetAttributes::GhostArrayName()));
 
+  // Plain images are searched by blocks of points with vtkImageData::FindCells().
+  // Subclasses such as vtkUniformGrid may override FindCell(), e.g. for blanking,
+  // so they are searched one point at a time.
+  const bool findCells = source->GetDataObjectType() == VTK_IMAGE_DATA ||
+    source->GetDataObjectType() == VTK_STRUCTURED_POINTS;
+  const vtkIdType blockSize = 256;
+  std::vector<vtkIdType> ptIds(blockSize), cellIds(blockSize);
+  std::vector<double> points(3 * blockSize), weights(8 * blockSize);
+
   // Loop over all input points, interpolating source data
   vtkIdType progressInterval = endId / 20 + 1;
-  for (vtkIdType ptId = startId; ptId < endId && !GetAbortExecute(); ptId++)
+  for (vtkIdType blockStart = startId; blockStart < endId && !GetAbortExecute();
+       blockStart += blockSize)
   {
-    if (baseThread && !(ptId % progressInterval))
+    // Gather the xyz coordinates of the points of the block to probe
+    const vtkIdType blockEnd = std::min(blockStart + blockSize, endId);
+    vtkIdType numPoints = 0;
+    for (vtkIdType ptId = blockStart; ptId < blockEnd; ptId++)
     {
-      // This is not ideal, because if the base thread executes more than one piece,
-      // then the progress will repeat its 0.0 to 1.0 progression for each piece.
-      this->UpdateProgress(static_cast<double>(ptId) / endId);
+      if (baseThread && !(ptId % progressInterval))
+      {
+        // This is not ideal, because if the base thread executes more than one piece,
+        // then the progress will repeat its 0.0 to 1.0 progression for each piece.
+        this->UpdateProgress(static_cast<double>(ptId) / endId);
+      }
+
+      if (maskArray[ptId] == static_cast<char>(1))
+      {
+        // skip points which have already been probed with success.
+        // This is helpful for multiblock dataset probing.
+        continue;
+      }
+
+      ptIds[numPoints] = ptId;
+      input->GetPoint(ptId, points.data() + 3 * numPoints);
+      ++numPoints;
     }
 
-    if (maskArray[ptId] == static_cast<char>(1))
+    // Find the cells and compute interpolation weights
+    if (findCells)
     {
-      // skip points which have already been probed with success.
-      // This is helpful for multiblock dataset probing.
-      continue;
+      source->FindCells(numPoints, points.data(), tol2, cellIds.data(), nullptr, weights.data());
     }
-
-    // Get the xyz coordinate of the point in the input dataset
-    double x[3];
-    input->GetPoint(ptId, x);
-
-    // Find the cell and compute interpolation weights
-    int subId;
-    double pcoords[3], weights[8];
-    vtkIdType cellId = source->FindCell(x, nullptr, -1, tol2, subId, pcoords, weights);
-    if (cellId >= 0 && !::IsBlankedCell(sourceGhostFlags, cellId))
+    else
     {
-      source->GetCellPoints(cellId, pointIds);
+      for (vtkIdType i = 0; i < numPoints; ++i)
+      {
+        int subId;
+        double pcoords[3];
+        cellIds[i] = source->FindCell(
+          points.data() + 3 * i, nullptr, -1, tol2, subId, pcoords, weights.data() + 8 * i);
+      }
+    }
 
-      // Interpolate the point data
-      outPD->InterpolatePoint((*this->PointList), pd, srcIdx, ptId, pointIds, weights);
-      vtkVectorOfArrays::iterator iter;
-      for (iter = this->CellArrays->begin(); iter != this->CellArrays->end(); ++iter)
+    for (vtkIdType i = 0; i < numPoints; ++i)
+    {
+      const vtkIdType ptId = ptIds[i];
+      const vtkIdType cellId = cellIds[i];
+      if (cellId >= 0 && !::IsBlankedCell(sourceGhostFlags, cellId))
       {
-        vtkDataArray* inArray = cd->GetArray((*iter)->GetName());
-        if (inArray)
+        source->GetCellPoints(cellId, pointIds);
+
+        // Interpolate the point data
+        outPD->InterpolatePoint(
+          (*this->PointList), pd, srcIdx, ptId, pointIds, weights.data() + 8 * i);
+        vtkVectorOfArrays::iterator iter;
+        for (iter = this->CellArrays->begin(); iter != this->CellArrays->end(); ++iter)
         {
-          outPD->CopyTuple(inArray, *iter, cellId, ptId);
+          vtkDataArray* inArray = cd->GetArray((*iter)->GetName());
+          if (inArray)
+          {
+            outPD->CopyTuple(inArray, *iter, cellId, ptId);
+          }
         }
+        maskArray[ptId] = static_cast<char>(1);
       }
-      maskArray[ptId] = static_cast<char>(1);
     }
   }
 }
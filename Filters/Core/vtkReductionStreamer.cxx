@@ -0,0 +1,126 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkReductionStreamer.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkReductionStreamer.h"
+
+#include "vtkDataObject.h"
+#include "vtkExecutive.h"
+#include "vtkInformation.h"
+#include "vtkInformationExecutivePortKey.h"
+#include "vtkInformationVector.h"
+#include "vtkStreamingDemandDrivenPipeline.h"
+#include "vtkTrivialProducer.h"
+
+//------------------------------------------------------------------------------
+vtkReductionStreamer::vtkReductionStreamer()
+{
+  this->SetNumberOfInputPorts(1);
+  this->SetNumberOfOutputPorts(1);
+  this->ReleasePieces = true;
+}
+
+//------------------------------------------------------------------------------
+vtkReductionStreamer::~vtkReductionStreamer() = default;
+
+//------------------------------------------------------------------------------
+void vtkReductionStreamer::SetNumberOfStreamDivisions(int num)
+{
+  if (num < 1 || this->NumberOfPasses == static_cast<unsigned int>(num))
+  {
+    return;
+  }
+
+  this->Modified();
+  this->NumberOfPasses = num;
+}
+
+//------------------------------------------------------------------------------
+int vtkReductionStreamer::RequestUpdateExtent(vtkInformation* vtkNotUsed(request),
+  vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  vtkInformation* outInfo = outputVector->GetInformationObject(0);
+  int outPiece = outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_PIECE_NUMBER());
+  int outNumPieces = outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_NUMBER_OF_PIECES());
+
+  for (int i = 0; i < inputVector[0]->GetNumberOfInformationObjects(); ++i)
+  {
+    vtkInformation* inInfo = inputVector[0]->GetInformationObject(i);
+    inInfo->Set(vtkStreamingDemandDrivenPipeline::UPDATE_PIECE_NUMBER(),
+      outPiece * this->NumberOfPasses + this->CurrentIndex);
+    inInfo->Set(vtkStreamingDemandDrivenPipeline::UPDATE_NUMBER_OF_PIECES(),
+      outNumPieces * this->NumberOfPasses);
+    inInfo->Set(vtkStreamingDemandDrivenPipeline::UPDATE_NUMBER_OF_GHOST_LEVELS(), 0);
+  }
+
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+int vtkReductionStreamer::ExecutePass(
+  vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  if (this->CurrentIndex == 0 && !this->InitializeReduction(outputVector))
+  {
+    return 0;
+  }
+
+  for (int i = 0; i < inputVector[0]->GetNumberOfInformationObjects(); ++i)
+  {
+    vtkInformation* inInfo = inputVector[0]->GetInformationObject(i);
+    vtkDataObject* piece = inInfo->Get(vtkDataObject::DATA_OBJECT());
+    // Data set with SetInputData() is the same for every piece: it is
+    // reduced once, and never released.
+    vtkExecutive* producer = vtkExecutive::PRODUCER()->GetExecutive(inInfo);
+    const bool trivial = !producer || vtkTrivialProducer::SafeDownCast(producer->GetAlgorithm());
+    if (!piece || (trivial && this->CurrentIndex > 0))
+    {
+      continue;
+    }
+    if (!this->ReducePiece(piece))
+    {
+      return 0;
+    }
+    // The pipeline executes the input again for the next piece, or the
+    // next update, since the data is marked as released.
+    if (this->ReleasePieces && !trivial)
+    {
+      piece->ReleaseData();
+    }
+  }
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+int vtkReductionStreamer::PostExecute(
+  vtkInformationVector** vtkNotUsed(inputVector), vtkInformationVector* outputVector)
+{
+  return this->FinalizeReduction(outputVector);
+}
+
+//------------------------------------------------------------------------------
+int vtkReductionStreamer::FillInputPortInformation(int vtkNotUsed(port), vtkInformation* info)
+{
+  info->Set(vtkAlgorithm::INPUT_REQUIRED_DATA_TYPE(), "vtkDataObject");
+  info->Set(vtkAlgorithm::INPUT_IS_REPEATABLE(), 1);
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+void vtkReductionStreamer::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+
+  os << indent << "NumberOfStreamDivisions: " << this->NumberOfPasses << endl;
+  os << indent << "ReleasePieces: " << (this->ReleasePieces ? "On" : "Off") << endl;
+}
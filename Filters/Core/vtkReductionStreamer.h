@@ -0,0 +1,104 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkReductionStreamer.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkReductionStreamer
+ * @brief   Superclass for filters reducing their input one piece at a time
+ *
+ * vtkReductionStreamer streams its input pipeline in NumberOfStreamDivisions
+ * pieces, requesting each piece in turn with UPDATE_PIECE_NUMBER, and passes
+ * each of them to ReducePiece(). Once reduced, a piece is released before
+ * the next one is requested, so that a reduction (integration, statistics,
+ * histograms...) of a dataset larger than the memory can be computed by
+ * reading it piece by piece, e.g. with vtkXMLUnstructuredGridReader.
+ *
+ * Subclasses implement InitializeReduction(), called before the first
+ * piece, ReducePiece() and FinalizeReduction(), called after the last piece
+ * to produce the output.
+ *
+ * Sources that cannot produce pieces generate their whole output for the
+ * first piece, and nothing for the others. Likewise, data set with
+ * SetInputDataObject() is reduced once, as the first piece.
+ *
+ * @sa
+ * vtkStreamerBase vtkPolyDataStreamer vtkAttributeStatisticsStreamer
+ */
+
+#ifndef vtkReductionStreamer_h
+#define vtkReductionStreamer_h
+
+#include "vtkFiltersCoreModule.h" // For export macro
+#include "vtkStreamerBase.h"
+
+class vtkDataObject;
+
+class VTKFILTERSCORE_EXPORT vtkReductionStreamer : public vtkStreamerBase
+{
+public:
+  vtkTypeMacro(vtkReductionStreamer, vtkStreamerBase);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  ///@{
+  /**
+   * Set the number of pieces the input is streamed in. It defaults to 1.
+   */
+  void SetNumberOfStreamDivisions(int num);
+  int GetNumberOfStreamDivisions() { return this->NumberOfPasses; }
+  ///@}
+
+  ///@{
+  /**
+   * When on, the default, each piece is released once reduced, so that only
+   * one piece is in memory at a time. Data set with SetInputDataObject() is never
+   * released.
+   */
+  vtkSetMacro(ReleasePieces, bool);
+  vtkGetMacro(ReleasePieces, bool);
+  vtkBooleanMacro(ReleasePieces, bool);
+  ///@}
+
+protected:
+  vtkReductionStreamer();
+  ~vtkReductionStreamer() override;
+
+  int RequestUpdateExtent(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
+  int ExecutePass(vtkInformationVector** inputVector, vtkInformationVector* outputVector) override;
+  int PostExecute(vtkInformationVector** inputVector, vtkInformationVector* outputVector) override;
+
+  int FillInputPortInformation(int port, vtkInformation* info) override;
+
+  /**
+   * Called before the first piece is reduced.
+   */
+  virtual int InitializeReduction(vtkInformationVector* outputVector) = 0;
+
+  /**
+   * Reduce a piece of the input. The piece is empty when the input cannot
+   * produce the requested piece.
+   */
+  virtual int ReducePiece(vtkDataObject* piece) = 0;
+
+  /**
+   * Called after the last piece is reduced, to produce the output.
+   */
+  virtual int FinalizeReduction(vtkInformationVector* outputVector) = 0;
+
+  bool ReleasePieces;
+
+private:
+  vtkReductionStreamer(const vtkReductionStreamer&) = delete;
+  void operator=(const vtkReductionStreamer&) = delete;
+};
+
+#endif
@@ -34,6 +34,7 @@
 #include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkStructuredPoints.h"
+#include "vtkThreadedCompositeDataPipeline.h"
 #include "vtkUnsignedCharArray.h"
 #include "vtkUnsignedIntArray.h"
 #include "vtkUnsignedLongArray.h"
@@ -60,6 +61,10 @@ vtkSynchronizedTemplates3D::vtkSynchronizedTemplates3D()
   // by default process active point scalars
   this->SetInputArrayToProcess(
     0, 0, 0, vtkDataObject::FIELD_ASSOCIATION_POINTS, vtkDataSetAttributes::SCALARS);
+
+  // the execution only uses local state
+  this->Information->Set(vtkThreadedCompositeDataPipeline::BLOCK_EXECUTION_MODE(),
+    vtkThreadedCompositeDataPipeline::Reentrant);
 }
 
 //------------------------------------------------------------------------------
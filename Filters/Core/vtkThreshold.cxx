@@ -23,6 +23,7 @@
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
+#include "vtkThreadedCompositeDataPipeline.h"
 #include "vtkUnstructuredGrid.h"
 
 #include <algorithm>
@@ -48,6 +49,10 @@ vtkThreshold::vtkThreshold()
 
   this->UseContinuousCellRange = 0;
   this->Invert = false;
+
+  // the execution only uses local state
+  this->Information->Set(vtkThreadedCompositeDataPipeline::BLOCK_EXECUTION_MODE(),
+    vtkThreadedCompositeDataPipeline::Reentrant);
 }
 
 vtkThreshold::~vtkThreshold() = default;
@@ -432,6 +437,25 @@ int vtkThreshold::FillInputPortInformation(int, vtkInformation* info)
   return 1;
 }
 
+bool vtkThreshold::PrintParameterKey(ostream& os)
+{
+  const char* method = "Between";
+  if (this->ThresholdFunction == &vtkThreshold::Upper)
+  {
+    method = "Upper";
+  }
+  else if (this->ThresholdFunction == &vtkThreshold::Lower)
+  {
+    method = "Lower";
+  }
+  os << "Threshold " << method << " " << this->LowerThreshold << " " << this->UpperThreshold
+     << "\nAttribute " << this->AttributeMode << " Component " << this->ComponentMode << " "
+     << this->SelectedComponent << " All " << this->AllScalars << " Continuous "
+     << this->UseContinuousCellRange << " Invert " << this->Invert << " Precision "
+     << this->OutputPointsPrecision << "\n";
+  return true;
+}
+
 void vtkThreshold::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
@@ -208,6 +208,14 @@ public:
   int Upper(double s) const;
   int Between(double s) const;
   ///@}
+
+  /**
+   * Print the thresholds, the threshold method and the component and
+   * attribute modes, for result caches such as vtkCachedCompositeDataPipeline.
+   * Parameters added to this class must be printed here too.
+   */
+  bool PrintParameterKey(ostream& os) override;
+
 protected:
   vtkThreshold();
   ~vtkThreshold() override;
@@ -38,6 +38,7 @@
 #include "vtkPolyhedron.h"
 #include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
+#include "vtkThreadedCompositeDataPipeline.h"
 #include "vtkUnsignedCharArray.h"
 #include "vtkUnstructuredGrid.h"
 
@@ -75,6 +76,10 @@ vtkClipDataSet::vtkClipDataSet(vtkImplicitFunction* cf)
   this->InternalProgressObserver = vtkCallbackCommand::New();
   this->InternalProgressObserver->SetCallback(&vtkClipDataSet::InternalProgressCallbackFunction);
   this->InternalProgressObserver->SetClientData(this);
+
+  // the execution inserts the points in the locator of the filter
+  this->Information->Set(vtkThreadedCompositeDataPipeline::BLOCK_EXECUTION_MODE(),
+    vtkThreadedCompositeDataPipeline::Sequential);
 }
 
 //------------------------------------------------------------------------------
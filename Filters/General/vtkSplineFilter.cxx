@@ -26,6 +26,8 @@
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
 
+#include <vector>
+
 vtkStandardNewMacro(vtkSplineFilter);
 vtkCxxSetObjectMacro(vtkSplineFilter, Spline, vtkSpline);
 
@@ -276,6 +278,8 @@ int vtkSplineFilter::GeneratePoints(vtkIdType offset, vtkIdType npts, const vtkI
   }
   double tLo = this->TCoordMap->GetValue(0);
   double tHi = this->TCoordMap->GetValue(1);
+  std::vector<vtkIdType> edges(2 * numNewPts);
+  std::vector<double> edgeT(numNewPts);
   for (idx = 0, i = 0; i < numNewPts; i++)
   {
     t = static_cast<double>(i) / numDivs;
@@ -284,19 +288,27 @@ int vtkSplineFilter::GeneratePoints(vtkIdType offset, vtkIdType npts, const vtkI
     x[2] = this->ZSpline->Evaluate(t);
     newPts->InsertPoint(offset + i, x);
 
-    // interpolate point data
+    // find the input segment to interpolate the point data from
     while (t > tHi && idx < (npts - 2))
     {
       idx++;
       tLo = this->TCoordMap->GetValue(idx);
       tHi = this->TCoordMap->GetValue(idx + 1);
     }
-    tc = (t - tLo) / (tHi - tLo);
-    outPD->InterpolateEdge(pd, offset + i, pts[idx], pts[idx + 1], tc);
+    edges[2 * i] = pts[idx];
+    edges[2 * i + 1] = pts[idx + 1];
+    edgeT[i] = (t - tLo) / (tHi - tLo);
+  }
 
-    // generate texture coordinates if desired
-    if (genTCoords != VTK_TCOORDS_OFF)
+  // interpolate point data
+  outPD->InterpolateEdges(pd, offset, numNewPts, edges.data(), edgeT.data());
+
+  // generate texture coordinates if desired
+  if (genTCoords != VTK_TCOORDS_OFF)
+  {
+    for (i = 0; i < numNewPts; i++)
     {
+      t = static_cast<double>(i) / numDivs;
       if (genTCoords == VTK_TCOORDS_FROM_NORMALIZED_LENGTH)
       {
         tc = t;
@@ -311,8 +323,8 @@ int vtkSplineFilter::GeneratePoints(vtkIdType offset, vtkIdType npts, const vtkI
         tc = (s - s0) / this->TextureLength;
       }
       newTCoords->InsertTuple2(offset + i, tc, 0.0);
-    } // if generating tcoords
-  }   // for all new points
+    } // for all new points
+  }   // if generating tcoords
 
   return numNewPts;
 }
@@ -60,6 +60,8 @@
 // NOLINTNEXTLINE(bugprone-suspicious-include)
 #include "vtkTableBasedClipCases.cxx"
 
+#include <vector>
+
 vtkStandardNewMacro(vtkTableBasedClipDataSet);
 vtkCxxSetObjectMacro(vtkTableBasedClipDataSet, ClipFunction, vtkImplicitFunction);
 
@@ -1312,8 +1314,13 @@ void vtkTableBasedClipperVolumeFromVolume::ConstructDataSet(
 
   //
   // Now construct all the points that are along edges and new and add
-  // them to the points list.
+  // them to the points list. Their attributes are interpolated in one batch
+  // once all the edges are known.
   //
+  std::vector<vtkIdType> edgeIds;
+  std::vector<double> edgeT;
+  edgeIds.reserve(2 * pt_list.GetTotalNumberOfPoints());
+  edgeT.reserve(pt_list.GetTotalNumberOfPoints());
   int nLists = pt_list.GetNumberOfLists();
   for (i = 0; i < nLists; i++)
   {
@@ -1362,7 +1369,9 @@ void vtkTableBasedClipperVolumeFromVolume::ConstructDataSet(
       pt[1] = pt1[1] * p + pt2[1] * bp;
       pt[2] = pt1[2] * p + pt2[2] * bp;
       outPts->SetPoint(ptIdx, pt);
-      outPD->InterpolateEdge(inPD, ptIdx, pe.ptIds[0], pe.ptIds[1], bp);
+      edgeIds.push_back(pe.ptIds[0]);
+      edgeIds.push_back(pe.ptIds[1]);
+      edgeT.push_back(bp);
 
       if (newOrigNodes)
       {
@@ -1372,6 +1381,8 @@ void vtkTableBasedClipperVolumeFromVolume::ConstructDataSet(
       ptIdx++;
     }
   }
+  outPD->InterpolateEdges(
+    inPD, numUsed, static_cast<vtkIdType>(edgeT.size()), edgeIds.data(), edgeT.data());
 
   //
   // Now construct the new "centroid" points and add them to the points list.
@@ -0,0 +1,170 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestGeometryFilterMeshCaching.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that the XML reader keeps the mesh of time steps whose topology does
+// not change, and that vtkGeometryFilter then reuses its surface.
+
+#include "vtkCellData.h"
+#include "vtkCellTypeSource.h"
+#include "vtkDoubleArray.h"
+#include "vtkGeometryFilter.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkUnstructuredGrid.h"
+#include "vtkXMLUnstructuredGridReader.h"
+#include "vtkXMLUnstructuredGridWriter.h"
+
+#include <iostream>
+#include <string>
+
+namespace
+{
+void SetAttributes(vtkUnstructuredGrid* grid, double offset)
+{
+  vtkNew<vtkDoubleArray> pointScalars;
+  pointScalars->SetName("PointScalars");
+  pointScalars->SetNumberOfValues(grid->GetNumberOfPoints());
+  for (vtkIdType i = 0; i < grid->GetNumberOfPoints(); ++i)
+  {
+    pointScalars->SetValue(i, offset + i);
+  }
+  grid->GetPointData()->AddArray(pointScalars);
+
+  vtkNew<vtkDoubleArray> cellScalars;
+  cellScalars->SetName("CellScalars");
+  cellScalars->SetNumberOfValues(grid->GetNumberOfCells());
+  for (vtkIdType i = 0; i < grid->GetNumberOfCells(); ++i)
+  {
+    cellScalars->SetValue(i, offset - i);
+  }
+  grid->GetCellData()->AddArray(cellScalars);
+}
+
+std::string Write(vtkUnstructuredGrid* grid)
+{
+  vtkNew<vtkXMLUnstructuredGridWriter> writer;
+  writer->SetInputData(grid);
+  writer->WriteToOutputStringOn();
+  writer->Write();
+  return writer->GetOutputString();
+}
+
+bool HaveSameValues(vtkDataArray* array1, vtkDataArray* array2)
+{
+  if (!array1 || !array2 || array1->GetNumberOfValues() != array2->GetNumberOfValues())
+  {
+    return false;
+  }
+  for (vtkIdType i = 0; i < array1->GetNumberOfValues(); ++i)
+  {
+    if (array1->GetVariantValue(i) != array2->GetVariantValue(i))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool HaveSameSurface(vtkPolyData* surface, vtkPolyData* reference)
+{
+  return surface->GetNumberOfPoints() == reference->GetNumberOfPoints() &&
+    surface->GetNumberOfCells() == reference->GetNumberOfCells() &&
+    HaveSameValues(surface->GetPoints()->GetData(), reference->GetPoints()->GetData()) &&
+    HaveSameValues(surface->GetPolys()->GetConnectivityArray(),
+      reference->GetPolys()->GetConnectivityArray()) &&
+    HaveSameValues(surface->GetPointData()->GetArray("PointScalars"),
+      reference->GetPointData()->GetArray("PointScalars")) &&
+    HaveSameValues(surface->GetCellData()->GetArray("CellScalars"),
+      reference->GetCellData()->GetArray("CellScalars"));
+}
+} // anonymous namespace
+
+int TestGeometryFilterMeshCaching(int, char*[])
+{
+  vtkNew<vtkCellTypeSource> source;
+  source->SetCellType(VTK_HEXAHEDRON);
+  source->SetBlocksDimensions(4, 4, 4);
+  source->Update();
+  vtkNew<vtkUnstructuredGrid> grid;
+  grid->ShallowCopy(source->GetOutput());
+  SetAttributes(grid, 0.0);
+  const std::string step0 = Write(grid);
+  SetAttributes(grid, 100.0);
+  const std::string step1 = Write(grid);
+
+  vtkNew<vtkXMLUnstructuredGridReader> reader;
+  reader->ReadFromInputStringOn();
+  reader->ReuseUnchangedMeshOn();
+  reader->SetInputString(step0);
+  vtkNew<vtkGeometryFilter> cached;
+  cached->SetInputConnection(reader->GetOutputPort());
+  cached->MeshCachingOn();
+  cached->Update();
+  vtkNew<vtkGeometryFilter> reference;
+  reference->SetInputConnection(reader->GetOutputPort());
+  reference->Update();
+
+  vtkUnstructuredGrid* output = reader->GetOutput();
+  vtkPoints* points = output->GetPoints();
+  vtkCellArray* polys = cached->GetOutput()->GetPolys();
+  const vtkMTimeType meshMTime = output->GetMeshMTime();
+  if (!HaveSameSurface(cached->GetOutput(), reference->GetOutput()))
+  {
+    std::cerr << "Wrong surface of the first time step." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Only the attributes change: the mesh and the surface are reused.
+  reader->SetInputString(step1);
+  reader->Modified();
+  cached->Update();
+  reference->Update();
+  if (output->GetPoints() != points || output->GetMeshMTime() != meshMTime)
+  {
+    std::cerr << "The reader did not reuse the unchanged mesh." << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (cached->GetOutput()->GetPolys() != polys)
+  {
+    std::cerr << "The geometry filter did not reuse its surface." << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (!HaveSameSurface(cached->GetOutput(), reference->GetOutput()) ||
+    cached->GetOutput()->GetPointData()->GetArray("PointScalars")->GetRange()[0] < 100.0)
+  {
+    std::cerr << "Wrong attributes of the reused surface." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // A modified mesh invalidates the surface.
+  cached->SetInputData(grid);
+  reference->SetInputData(grid);
+  cached->Update();
+  polys = cached->GetOutput()->GetPolys();
+  grid->GetPoints()->SetPoint(0, -1.0, -1.0, -1.0);
+  grid->GetPoints()->Modified();
+  grid->Modified();
+  cached->Update();
+  reference->Update();
+  if (cached->GetOutput()->GetPolys() == polys ||
+    !HaveSameSurface(cached->GetOutput(), reference->GetOutput()))
+  {
+    std::cerr << "The surface of a modified mesh was reused." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
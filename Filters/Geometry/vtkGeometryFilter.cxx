@@ -28,6 +28,7 @@
 #include "vtkGenericCell.h"
 #include "vtkHexagonalPrism.h"
 #include "vtkHexahedron.h"
+#include "vtkIdTypeArray.h"
 #include "vtkIncrementalPointLocator.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
@@ -37,12 +38,14 @@
 #include "vtkObjectFactory.h"
 #include "vtkPentagonalPrism.h"
 #include "vtkPointData.h"
+#include "vtkPoints.h"
 #include "vtkPolyData.h"
 #include "vtkPyramid.h"
 #include "vtkRectilinearGrid.h"
 #include "vtkRectilinearGridGeometryFilter.h"
 #include "vtkSMPThreadLocalObject.h"
 #include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
 #include "vtkStaticCellLinksTemplate.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkStructuredData.h"
@@ -50,6 +53,7 @@
 #include "vtkStructuredGridGeometryFilter.h"
 #include "vtkStructuredPoints.h"
 #include "vtkTetra.h"
+#include "vtkThreadedCompositeDataPipeline.h"
 #include "vtkUniformGrid.h"
 #include "vtkUnsignedCharArray.h"
 #include "vtkUnstructuredGrid.h"
@@ -57,11 +61,83 @@
 #include "vtkVoxel.h"
 #include "vtkWedge.h"
 
+#include <algorithm>
 #include <memory>
+#include <vector>
 
 vtkStandardNewMacro(vtkGeometryFilter);
 vtkCxxSetObjectMacro(vtkGeometryFilter, Locator, vtkIncrementalPointLocator);
 
+//------------------------------------------------------------------------------
+// The surface extracted from the last unstructured grid input, with the maps
+// from its points and cells to those of the input. The input mesh is
+// referenced so that its identity can be compared with that of the next input.
+struct vtkGeometryFilterMeshCache
+{
+  vtkSmartPointer<vtkPoints> InputPoints;
+  vtkSmartPointer<vtkCellArray> InputCells;
+  vtkSmartPointer<vtkUnsignedCharArray> InputTypes;
+  vtkSmartPointer<vtkIdTypeArray> InputFaces;
+  vtkMTimeType InputMeshMTime = 0;
+  std::vector<unsigned char> InputGhosts;
+  vtkMTimeType FilterMTime = 0;
+
+  // Output points, or nullptr when the input points are passed
+  vtkSmartPointer<vtkPoints> Points;
+  vtkSmartPointer<vtkCellArray> Verts;
+  vtkSmartPointer<vtkCellArray> Lines;
+  vtkSmartPointer<vtkCellArray> Polys;
+  vtkSmartPointer<vtkCellArray> Strips;
+  vtkSmartPointer<vtkIdTypeArray> PointIds;
+  vtkSmartPointer<vtkIdTypeArray> CellIds;
+
+  void Clear() { *this = vtkGeometryFilterMeshCache(); }
+
+  static vtkUnsignedCharArray* GetGhosts(vtkUnstructuredGrid* input)
+  {
+    return vtkUnsignedCharArray::SafeDownCast(
+      input->GetCellData()->GetArray(vtkDataSetAttributes::GhostArrayName()));
+  }
+
+  bool IsValid(vtkUnstructuredGrid* input, vtkMTimeType filterMTime)
+  {
+    if (!this->CellIds || this->FilterMTime != filterMTime ||
+      this->InputPoints != input->GetPoints() || this->InputCells != input->GetCells() ||
+      this->InputTypes != input->GetCellTypesArray() || this->InputFaces != input->GetFaces() ||
+      this->InputMeshMTime != input->GetMeshMTime())
+    {
+      return false;
+    }
+    vtkUnsignedCharArray* ghosts = GetGhosts(input);
+    if (!ghosts)
+    {
+      return this->InputGhosts.empty();
+    }
+    return static_cast<size_t>(ghosts->GetNumberOfValues()) == this->InputGhosts.size() &&
+      std::equal(this->InputGhosts.begin(), this->InputGhosts.end(), ghosts->GetPointer(0));
+  }
+
+  void SetInput(vtkUnstructuredGrid* input, vtkMTimeType filterMTime)
+  {
+    this->InputPoints = input->GetPoints();
+    this->InputCells = input->GetCells();
+    this->InputTypes = input->GetCellTypesArray();
+    this->InputFaces = input->GetFaces();
+    this->InputMeshMTime = input->GetMeshMTime();
+    vtkUnsignedCharArray* ghosts = GetGhosts(input);
+    if (ghosts)
+    {
+      this->InputGhosts.assign(
+        ghosts->GetPointer(0), ghosts->GetPointer(0) + ghosts->GetNumberOfValues());
+    }
+    else
+    {
+      this->InputGhosts.clear();
+    }
+    this->FilterMTime = filterMTime;
+  }
+};
+
 //------------------------------------------------------------------------------
 // Construct with all types of clipping turned off.
 vtkGeometryFilter::vtkGeometryFilter()
@@ -105,12 +181,65 @@ vtkGeometryFilter::vtkGeometryFilter()
 
   // Enable delegation to an internal vtkDataSetSurfaceFilter.
   this->Delegation = true;
+
+  this->MeshCaching = false;
+  this->MeshCache = new vtkGeometryFilterMeshCache;
+
+  // the locator and the delegate filter are not shared between threads
+  this->Information->Set(vtkThreadedCompositeDataPipeline::BLOCK_EXECUTION_MODE(),
+    vtkThreadedCompositeDataPipeline::CloneAlgorithm);
 }
 
 //------------------------------------------------------------------------------
 vtkGeometryFilter::~vtkGeometryFilter()
 {
   this->SetLocator(nullptr);
+  delete this->MeshCache;
+}
+
+//------------------------------------------------------------------------------
+bool vtkGeometryFilter::CopyParameters(vtkAlgorithm* source)
+{
+  vtkGeometryFilter* other = vtkGeometryFilter::SafeDownCast(source);
+  if (!other)
+  {
+    return false;
+  }
+  if (other == this)
+  {
+    return true;
+  }
+  this->CopyInputArraysToProcess(other);
+  this->PointMinimum = other->PointMinimum;
+  this->PointMaximum = other->PointMaximum;
+  this->CellMinimum = other->CellMinimum;
+  this->CellMaximum = other->CellMaximum;
+  std::copy(other->Extent, other->Extent + 6, this->Extent);
+  this->PointClipping = other->PointClipping;
+  this->CellClipping = other->CellClipping;
+  this->ExtentClipping = other->ExtentClipping;
+  this->OutputPointsPrecision = other->OutputPointsPrecision;
+  this->Merging = other->Merging;
+  this->FastMode = other->FastMode;
+  this->Degree = other->Degree;
+  this->PieceInvariant = other->PieceInvariant;
+  this->PassThroughCellIds = other->PassThroughCellIds;
+  this->SetOriginalCellIdsName(other->OriginalCellIdsName);
+  this->PassThroughPointIds = other->PassThroughPointIds;
+  this->SetOriginalPointIdsName(other->OriginalPointIdsName);
+  this->NonlinearSubdivisionLevel = other->NonlinearSubdivisionLevel;
+  this->Delegation = other->Delegation;
+  this->MeshCaching = other->MeshCaching;
+
+  vtkSmartPointer<vtkIncrementalPointLocator> locator;
+  if (other->Locator)
+  {
+    locator.TakeReference(other->Locator->NewInstance());
+    locator->SetTolerance(other->Locator->GetTolerance());
+  }
+  this->SetLocator(locator);
+  this->Modified();
+  return true;
 }
 
 //------------------------------------------------------------------------------
@@ -226,6 +355,11 @@ int vtkGeometryFilter::RequestData(vtkInformation* vtkNotUsed(request),
     }
     case VTK_UNSTRUCTURED_GRID:
     {
+      if (this->MeshCaching && !exc.Links)
+      {
+        return this->CachedUnstructuredGridExecute(input, output);
+      }
+      this->MeshCache->Clear();
       return this->UnstructuredGridExecute(input, output, nullptr, &exc);
     }
 
@@ -341,6 +475,7 @@ void vtkGeometryFilter::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "OriginalPointIdsName: " << this->GetOriginalPointIdsName() << endl;
 
   os << indent << "NonlinearSubdivisionLevel: " << this->GetNonlinearSubdivisionLevel() << endl;
+  os << indent << "MeshCaching: " << (this->MeshCaching ? "On\n" : "Off\n");
 }
 
 //------------------------------------------------------------------------------
@@ -2091,9 +2226,11 @@ int vtkGeometryFilter::UnstructuredGridExecute(vtkDataSet* dataSetInput, vtkPoly
   // Depending on the outcome, we may process the data ourselves, or send over
   // to the faster vtkGeometryFilter.
   bool mayDelegate = (info == nullptr && this->Delegation);
+  std::unique_ptr<vtkGeometryFilterHelper> ownedInfo;
   if (info == nullptr)
   {
     info = vtkGeometryFilterHelper::CharacterizeUnstructuredGrid(input);
+    ownedInfo.reset(info);
   }
 
   // Nonlinear cells are handled by vtkDataSetSurfaceFilter
@@ -2103,7 +2240,6 @@ int vtkGeometryFilter::UnstructuredGridExecute(vtkDataSet* dataSetInput, vtkPoly
     vtkNew<vtkDataSetSurfaceFilter> dssf;
     vtkGeometryFilterHelper::CopyFilterParams(this, dssf.Get());
     dssf->UnstructuredGridExecute(dataSetInput, output, info);
-    delete info;
     return 1;
   }
 
@@ -2300,6 +2436,131 @@ int vtkGeometryFilter::UnstructuredGridExecute(vtkDataSet* dataSetInput, vtkPoly
   return 1;
 }
 
+//------------------------------------------------------------------------------
+int vtkGeometryFilter::CachedUnstructuredGridExecute(vtkDataSet* dataSetInput, vtkPolyData* output)
+{
+  vtkUnstructuredGrid* input = static_cast<vtkUnstructuredGrid*>(dataSetInput);
+  vtkPointData* inPD = input->GetPointData();
+  vtkCellData* inCD = input->GetCellData();
+  vtkPointData* outPD = output->GetPointData();
+  vtkCellData* outCD = output->GetCellData();
+  vtkGeometryFilterMeshCache* cache = this->MeshCache;
+  const vtkMTimeType filterMTime = this->GetMTime();
+
+  if (cache->IsValid(input, filterMTime))
+  {
+    vtkDebugMacro(<< "Reusing the surface of the previous execution");
+    if (cache->Points)
+    {
+      output->SetPoints(cache->Points);
+      vtkIdType numOutputPts = cache->PointIds->GetNumberOfValues();
+      const vtkIdType* ptIds = cache->PointIds->GetPointer(0);
+      ArrayList ptArrays;
+      outPD->CopyAllocate(inPD, numOutputPts);
+      ptArrays.AddArrays(numOutputPts, inPD, outPD, 0.0, false);
+      vtkSMPTools::For(0, numOutputPts, [&](vtkIdType ptId, vtkIdType endPtId) {
+        for (; ptId < endPtId; ++ptId)
+        {
+          ptArrays.Copy(ptIds[ptId], ptId);
+        }
+      });
+      if (this->PassThroughPointIds)
+      {
+        outPD->AddArray(cache->PointIds);
+      }
+    }
+    else
+    {
+      output->SetPoints(input->GetPoints());
+      outPD->PassData(inPD);
+    }
+    output->SetVerts(cache->Verts);
+    output->SetLines(cache->Lines);
+    output->SetPolys(cache->Polys);
+    output->SetStrips(cache->Strips);
+
+    vtkIdType numOutputCells = cache->CellIds->GetNumberOfValues();
+    const vtkIdType* cellIds = cache->CellIds->GetPointer(0);
+    ArrayList cellArrays;
+    outCD->CopyGlobalIdsOn();
+    outCD->CopyAllocate(inCD, numOutputCells);
+    cellArrays.AddArrays(numOutputCells, inCD, outCD, 0.0, false);
+    vtkSMPTools::For(0, numOutputCells, [&](vtkIdType cellId, vtkIdType endCellId) {
+      for (; cellId < endCellId; ++cellId)
+      {
+        cellArrays.Copy(cellIds[cellId], cellId);
+      }
+    });
+    if (this->PassThroughCellIds)
+    {
+      outCD->AddArray(cache->CellIds);
+    }
+    return 1;
+  }
+  cache->Clear();
+
+  // Execute with the originating ids, which are the maps of the cache. Do
+  // not cache if they would replace input arrays of the same name.
+  const char* cellIdsName = this->GetOriginalCellIdsName();
+  const char* pointIdsName = this->GetOriginalPointIdsName();
+  vtkTypeBool passCellIds = this->PassThroughCellIds;
+  vtkTypeBool passPointIds = this->PassThroughPointIds;
+  if ((!passCellIds && inCD->HasArray(cellIdsName)) ||
+    (!passPointIds && inPD->HasArray(pointIdsName)))
+  {
+    return this->UnstructuredGridExecute(input, output, nullptr, nullptr);
+  }
+  this->PassThroughCellIds = 1;
+  this->PassThroughPointIds = 1;
+  int ret = this->UnstructuredGridExecute(input, output, nullptr, nullptr);
+  this->PassThroughCellIds = passCellIds;
+  this->PassThroughPointIds = passPointIds;
+
+  vtkSmartPointer<vtkIdTypeArray> cellIds =
+    vtkIdTypeArray::SafeDownCast(outCD->GetAbstractArray(cellIdsName));
+  vtkSmartPointer<vtkIdTypeArray> pointIds =
+    vtkIdTypeArray::SafeDownCast(outPD->GetAbstractArray(pointIdsName));
+  if (!passCellIds)
+  {
+    outCD->RemoveArray(cellIdsName);
+  }
+  if (!passPointIds)
+  {
+    outPD->RemoveArray(pointIdsName);
+  }
+
+  // The maps must cover the whole output: the points and cells created by
+  // the subdivision of nonlinear cells, for instance, are not cached.
+  auto isMap = [](vtkIdTypeArray* ids, vtkIdType size, vtkIdType range) {
+    if (!ids || ids->GetNumberOfValues() != size)
+    {
+      return false;
+    }
+    const vtkIdType* ptr = ids->GetPointer(0);
+    return std::all_of(ptr, ptr + size, [range](vtkIdType id) { return id >= 0 && id < range; });
+  };
+  const bool passedPoints = output->GetPoints() == input->GetPoints();
+  if (!ret || !isMap(cellIds, output->GetNumberOfCells(), input->GetNumberOfCells()) ||
+    (!passedPoints &&
+      !isMap(pointIds, output->GetNumberOfPoints(), input->GetNumberOfPoints())))
+  {
+    return ret;
+  }
+
+  cache->SetInput(input, filterMTime);
+  if (!passedPoints)
+  {
+    cache->Points = output->GetPoints();
+    cache->PointIds = pointIds;
+  }
+  cache->Verts = output->GetVerts();
+  cache->Lines = output->GetLines();
+  cache->Polys = output->GetPolys();
+  cache->Strips = output->GetStrips();
+  cache->CellIds = cellIds;
+  return ret;
+}
+
 //------------------------------------------------------------------------------
 // Process various types of structured datasets.
 int vtkGeometryFilter::StructuredExecute(vtkDataSet* input, vtkPolyData* output, vtkInformation*)
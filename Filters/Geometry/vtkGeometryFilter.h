@@ -60,6 +60,11 @@
  * input represents a list of faces that are to be excluded from the output
  * of vtkGeometryFilter.
  *
+ * When the mesh of an unstructured grid input does not change between
+ * executions, e.g. a static mesh with time-varying attributes, MeshCaching
+ * lets the filter reuse the surface extracted at the previous execution and
+ * only remap the point and cell attributes (see vtkDataSet::GetMeshMTime()).
+ *
  * @warning
  * While vtkGeometryFilter and vtkDataSetSurfaceFilter perform similar operations,
  * there are important differences as follows:
@@ -105,6 +110,7 @@ class vtkUnstructuredGrid;
 class vtkGeometryFilter;
 class vtkDataSetSurfaceFilter;
 struct vtkGeometryFilterHelper;
+struct vtkGeometryFilterMeshCache;
 struct vtkExcludedFaces;
 
 // Used to coordinate delegation to vtkDataSetSurfaceFilter
@@ -356,6 +362,29 @@ public:
   vtkBooleanMacro(Delegation, vtkTypeBool);
   ///@}
 
+  ///@{
+  /**
+   * When on, the surface extracted from an unstructured grid input, and the
+   * maps from its points and cells to those of the input, are kept after
+   * execution. If the next input has the same points, cells and ghost cells
+   * (same objects with the same mesh MTime), and the filter parameters did
+   * not change, the surface is reused and only the attributes are remapped.
+   * This is useful with readers that reuse the mesh of a static mesh over
+   * time. It is ignored when faces are excluded. Off by default.
+   */
+  vtkSetMacro(MeshCaching, bool);
+  vtkGetMacro(MeshCaching, bool);
+  vtkBooleanMacro(MeshCaching, bool);
+  ///@}
+
+  /**
+   * Copy the parameters of another geometry filter. The locator is replaced
+   * by a new instance of the same class. A parameter added to this class must
+   * be copied here too, or the copies executing the blocks of
+   * vtkThreadedCompositeDataPipeline keep its default value.
+   */
+  bool CopyParameters(vtkAlgorithm* source) override;
+
   ///@{
   /**
    * Direct access methods so that this class can be used as an
@@ -387,6 +416,10 @@ protected:
   // special cases for performance
   int RequestUpdateExtent(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
 
+  // Extract the surface of an unstructured grid, or reuse that of the
+  // previous execution when the mesh did not change.
+  int CachedUnstructuredGridExecute(vtkDataSet* input, vtkPolyData* output);
+
   vtkIdType PointMaximum;
   vtkIdType PointMinimum;
   vtkIdType CellMinimum;
@@ -415,6 +448,9 @@ protected:
 
   vtkTypeBool Delegation;
 
+  bool MeshCaching;
+  vtkGeometryFilterMeshCache* MeshCache;
+
 private:
   vtkGeometryFilter(const vtkGeometryFilter&) = delete;
   void operator=(const vtkGeometryFilter&) = delete;
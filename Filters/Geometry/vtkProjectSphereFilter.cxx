@@ -135,8 +135,19 @@ void vtkProjectSphereFilter::TransformPointInformation(
   polePointIds->Reset();
 
   // Deep copy point data since TransformPointInformation modifies
-  // the point data
-  output->GetPointData()->DeepCopy(input->GetPointData());
+  // the point data. Only the arrays with 3 components are modified, so the
+  // other arrays keep sharing the memory of the input. The modified arrays
+  // are given their own memory before their values are transformed.
+  output->GetPointData()->LazyDeepCopy(input->GetPointData());
+  vtkPointData* pointData = output->GetPointData();
+  for (int i = 0; i < pointData->GetNumberOfArrays(); i++)
+  {
+    vtkDataArray* array = pointData->GetArray(i);
+    if (array && array->GetNumberOfComponents() == 3)
+    {
+      array->Detach();
+    }
+  }
 
   vtkNew<vtkPoints> points;
   points->SetDataTypeToDouble();
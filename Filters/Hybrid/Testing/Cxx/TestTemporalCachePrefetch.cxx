@@ -0,0 +1,228 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestTemporalCachePrefetch.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check the prefetching and the memory limit of vtkTemporalDataSetCache.
+
+#include "vtkDoubleArray.h"
+#include "vtkInformation.h"
+#include "vtkInformationVector.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkPolyDataAlgorithm.h"
+#include "vtkStreamingDemandDrivenPipeline.h"
+#include "vtkTemporalDataSetCache.h"
+
+#include <iostream>
+#include <vector>
+
+namespace
+{
+// A source of 20 time steps, each with an array of about 80 KiB whose values
+// are the time, that records the times it is executed for.
+class vtkTimeStepsSource : public vtkPolyDataAlgorithm
+{
+public:
+  static vtkTimeStepsSource* New();
+  vtkTypeMacro(vtkTimeStepsSource, vtkPolyDataAlgorithm);
+
+  std::vector<double> ExecutedTimes;
+
+protected:
+  vtkTimeStepsSource() { this->SetNumberOfInputPorts(0); }
+
+  int RequestInformation(vtkInformation*, vtkInformationVector**,
+    vtkInformationVector* outputVector) override
+  {
+    vtkInformation* outInfo = outputVector->GetInformationObject(0);
+    double timeSteps[20];
+    for (int i = 0; i < 20; ++i)
+    {
+      timeSteps[i] = 0.5 * i;
+    }
+    double timeRange[2] = { timeSteps[0], timeSteps[19] };
+    outInfo->Set(vtkStreamingDemandDrivenPipeline::TIME_STEPS(), timeSteps, 20);
+    outInfo->Set(vtkStreamingDemandDrivenPipeline::TIME_RANGE(), timeRange, 2);
+    return 1;
+  }
+
+  int RequestData(
+    vtkInformation*, vtkInformationVector**, vtkInformationVector* outputVector) override
+  {
+    vtkInformation* outInfo = outputVector->GetInformationObject(0);
+    vtkPolyData* output = vtkPolyData::GetData(outInfo);
+    const double time = outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP());
+    this->ExecutedTimes.push_back(time);
+
+    vtkNew<vtkPoints> points;
+    vtkNew<vtkDoubleArray> values;
+    values->SetName("Time");
+    for (int i = 0; i < 10000; ++i)
+    {
+      points->InsertNextPoint(i, time, 0.0);
+      values->InsertNextValue(time);
+    }
+    output->SetPoints(points);
+    output->GetPointData()->AddArray(values);
+    output->GetInformation()->Set(vtkDataObject::DATA_TIME_STEP(), time);
+    return 1;
+  }
+};
+vtkStandardNewMacro(vtkTimeStepsSource);
+
+bool Request(vtkTemporalDataSetCache* cache, double time)
+{
+  cache->UpdateTimeStep(time);
+  vtkPolyData* output = vtkPolyData::SafeDownCast(cache->GetOutputDataObject(0));
+  vtkDataArray* values = output ? output->GetPointData()->GetArray("Time") : nullptr;
+  if (!values || values->GetNumberOfTuples() != 10000 || values->GetComponent(9999, 0) != time)
+  {
+    std::cerr << "Wrong output for time " << time << std::endl;
+    return false;
+  }
+  return true;
+}
+
+bool CheckTimes(const char* what, const std::vector<double>& times,
+  const std::vector<double>& expected)
+{
+  if (times != expected)
+  {
+    std::cerr << what << " executed for";
+    for (double time : times)
+    {
+      std::cerr << " " << time;
+    }
+    std::cerr << " instead of";
+    for (double time : expected)
+    {
+      std::cerr << " " << time;
+    }
+    std::cerr << std::endl;
+    return false;
+  }
+  return true;
+}
+} // anonymous namespace
+
+int TestTemporalCachePrefetch(int, char*[])
+{
+  vtkNew<vtkTimeStepsSource> source;
+  vtkNew<vtkTimeStepsSource> prefetchSource;
+  vtkNew<vtkTemporalDataSetCache> cache;
+  cache->SetInputConnection(source->GetOutputPort());
+  cache->SetCacheSize(4);
+  cache->SetPrefetchPipeline(prefetchSource);
+  cache->SetPrefetchDepth(2);
+
+  // Moving forward: the two next time steps are prefetched and the source
+  // is not executed for them anymore.
+  if (!Request(cache, 0.0) || !Request(cache, 0.5))
+  {
+    return EXIT_FAILURE;
+  }
+  cache->WaitForPrefetch();
+  if (!CheckTimes("Prefetch source", prefetchSource->ExecutedTimes, { 1.0, 1.5 }))
+  {
+    return EXIT_FAILURE;
+  }
+  for (double time : { 1.0, 1.5, 2.0, 2.5 })
+  {
+    if (!Request(cache, time))
+    {
+      return EXIT_FAILURE;
+    }
+    cache->WaitForPrefetch();
+  }
+  if (!CheckTimes("Source", source->ExecutedTimes, { 0.0, 0.5 }) ||
+    !CheckTimes("Prefetch source", prefetchSource->ExecutedTimes, { 1.0, 1.5, 2.0, 2.5, 3.0, 3.5 }))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // Going backward with a stride of 2 steps, once the source has been
+  // executed for the first two requests.
+  prefetchSource->ExecutedTimes.clear();
+  for (double time : { 9.5, 8.5, 7.5, 6.5 })
+  {
+    if (!Request(cache, time))
+    {
+      return EXIT_FAILURE;
+    }
+    cache->WaitForPrefetch();
+  }
+  if (!CheckTimes("Source", source->ExecutedTimes, { 0.0, 0.5, 9.5, 8.5 }) ||
+    !CheckTimes("Prefetch source", prefetchSource->ExecutedTimes, { 7.5, 6.5, 5.5, 4.5 }))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // Data prefetched before the prefetch pipeline is modified is not used,
+  // even though the pipeline of the cache is not modified.
+  if (!Request(cache, 5.5))
+  {
+    return EXIT_FAILURE;
+  }
+  cache->WaitForPrefetch();
+  prefetchSource->Modified();
+  if (!Request(cache, 4.5) ||
+    !CheckTimes("Source", source->ExecutedTimes, { 0.0, 0.5, 9.5, 8.5, 4.5 }))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // The memory limit evicts the least recently used time steps.
+  cache->SetPrefetchPipeline(nullptr);
+  cache->SetCacheSize(10);
+  for (double time : { 0.0, 0.5, 1.0, 1.5, 2.0 })
+  {
+    if (!Request(cache, time))
+    {
+      return EXIT_FAILURE;
+    }
+  }
+  const unsigned long stepSize = cache->GetOutputDataObject(0)->GetActualMemorySize();
+  cache->SetCacheMemoryLimit(3 * stepSize);
+  if (cache->GetCacheMemorySize() > 3 * stepSize)
+  {
+    std::cerr << "Memory limit not applied: " << cache->GetCacheMemorySize() << std::endl;
+    return EXIT_FAILURE;
+  }
+  source->ExecutedTimes.clear();
+  for (double time : { 1.0, 3.0, 1.0, 2.0, 1.5 })
+  {
+    if (!Request(cache, time))
+    {
+      return EXIT_FAILURE;
+    }
+  }
+  if (!CheckTimes("Source", source->ExecutedTimes, { 3.0, 1.5 }) ||
+    cache->GetCacheMemorySize() > 3 * stepSize)
+  {
+    return EXIT_FAILURE;
+  }
+
+  // The memory size follows the removal of time steps.
+  cache->SetCacheSize(1);
+  if (cache->GetCacheMemorySize() != stepSize)
+  {
+    std::cerr << "Bad memory size after shrinking the cache: " << cache->GetCacheMemorySize()
+              << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
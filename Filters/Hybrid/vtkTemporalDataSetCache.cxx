@@ -26,6 +26,10 @@
 #include "vtkStreamingDemandDrivenPipeline.h"
 
 #include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
 #include <vector>
 
 // A helper class to to turn on memkind, if enabled, while ensuring it always is restored
@@ -56,6 +60,137 @@ public:
   vtkTDSCMemkindRAII(vtkTDSCMemkindRAII const&) = default;
 };
 
+//------------------------------------------------------------------------------
+// State of the prefetching. The queue and the results are shared with the
+// background thread and protected by Lock, the rest is only used by the
+// foreground thread.
+class vtkTemporalDataSetCache::vtkInternals
+{
+public:
+  struct Result
+  {
+    vtkSmartPointer<vtkDataObject> Data;
+    vtkMTimeType Generation;
+  };
+
+  std::mutex Lock;
+  std::condition_variable WorkCondition;
+  std::condition_variable IdleCondition;
+  std::thread Worker;
+  bool Stop = false;
+  bool Busy = false;
+  double BusyTime = 0.0;
+  std::deque<double> Queue;
+  vtkMTimeType QueueGeneration = 0;
+  std::map<double, Result> Results;
+
+  vtkSmartPointer<vtkAlgorithm> Pipeline;
+  std::vector<double> TimeSteps;
+  std::deque<size_t> History;
+
+  // Memory used by each cached time step when it was added, and their sum,
+  // kept up to date as time steps are added and removed.
+  std::map<double, unsigned long> ItemSizes;
+  unsigned long CacheMemorySize = 0;
+
+  // Modification time of the prefetch pipeline: the most recent one of its
+  // algorithms, upstream of Pipeline included.
+  vtkMTimeType GetPipelineMTime() const
+  {
+    return this->Pipeline ? GetUpstreamMTime(this->Pipeline) : 0;
+  }
+
+  static vtkMTimeType GetUpstreamMTime(vtkAlgorithm* algorithm)
+  {
+    vtkMTimeType mtime = algorithm->GetMTime();
+    for (int port = 0; port < algorithm->GetNumberOfInputPorts(); ++port)
+    {
+      for (int i = 0; i < algorithm->GetNumberOfInputConnections(port); ++i)
+      {
+        vtkAlgorithm* input = algorithm->GetInputAlgorithm(port, i);
+        if (input)
+        {
+          mtime = std::max(mtime, GetUpstreamMTime(input));
+        }
+      }
+    }
+    return mtime;
+  }
+
+  void Start()
+  {
+    if (!this->Worker.joinable())
+    {
+      this->Stop = false;
+      this->Worker = std::thread(&vtkInternals::Run, this);
+    }
+  }
+
+  void Shutdown()
+  {
+    if (this->Worker.joinable())
+    {
+      {
+        std::lock_guard<std::mutex> guard(this->Lock);
+        this->Stop = true;
+      }
+      this->WorkCondition.notify_all();
+      this->Worker.join();
+    }
+    this->Queue.clear();
+    this->Results.clear();
+    this->History.clear();
+  }
+
+  void Wait()
+  {
+    std::unique_lock<std::mutex> lock(this->Lock);
+    this->IdleCondition.wait(
+      lock, [this] { return this->Stop || (this->Queue.empty() && !this->Busy); });
+  }
+
+  // Background thread: update the prefetch pipeline for the queued times.
+  void Run()
+  {
+    std::unique_lock<std::mutex> lock(this->Lock);
+    while (true)
+    {
+      this->WorkCondition.wait(lock, [this] { return this->Stop || !this->Queue.empty(); });
+      if (this->Stop)
+      {
+        break;
+      }
+      const double time = this->Queue.front();
+      const vtkMTimeType generation = this->QueueGeneration;
+      this->Queue.pop_front();
+      this->Busy = true;
+      this->BusyTime = time;
+      lock.unlock();
+
+      vtkSmartPointer<vtkDataObject> data;
+      if (this->Pipeline->UpdateTimeStep(time))
+      {
+        vtkDataObject* output = this->Pipeline->GetOutputDataObject(0);
+        if (output)
+        {
+          data.TakeReference(output->NewInstance());
+          data->ShallowCopy(output);
+          data->GetInformation()->Set(vtkDataObject::DATA_TIME_STEP(), time);
+        }
+      }
+
+      lock.lock();
+      this->Busy = false;
+      if (data)
+      {
+        this->Results[time] = Result{ data, generation };
+      }
+      this->IdleCondition.notify_all();
+    }
+    this->IdleCondition.notify_all();
+  }
+};
+
 //------------------------------------------------------------------------------
 vtkStandardNewMacro(vtkTemporalDataSetCache);
 
@@ -63,16 +198,22 @@ vtkStandardNewMacro(vtkTemporalDataSetCache);
 vtkTemporalDataSetCache::vtkTemporalDataSetCache()
 {
   this->CacheSize = 10;
+  this->CacheMemoryLimit = 0;
+  this->PrefetchDepth = 1;
   this->SetNumberOfInputPorts(1);
   this->SetNumberOfOutputPorts(1);
   this->CacheInMemkind = false;
   this->IsASource = false;
   this->Ejected = nullptr;
+  this->Internals = new vtkInternals;
 }
 
 //------------------------------------------------------------------------------
 vtkTemporalDataSetCache::~vtkTemporalDataSetCache()
 {
+  this->Internals->Shutdown();
+  delete this->Internals;
+
   CacheType::iterator pos = this->Cache.begin();
   for (; pos != this->Cache.end();)
   {
@@ -139,6 +280,9 @@ void vtkTemporalDataSetCache::PrintSelf(ostream& os, vtkIndent indent)
   this->Superclass::PrintSelf(os, indent);
 
   os << indent << "CacheSize: " << this->CacheSize << endl;
+  os << indent << "CacheMemoryLimit: " << this->CacheMemoryLimit << endl;
+  os << indent << "PrefetchPipeline: " << this->Internals->Pipeline.Get() << endl;
+  os << indent << "PrefetchDepth: " << this->PrefetchDepth << endl;
 }
 
 //------------------------------------------------------------------------------
@@ -163,8 +307,70 @@ void vtkTemporalDataSetCache::SetCacheSize(int size)
   CacheType::iterator pos = this->Cache.begin();
   for (; i > 0; --i)
   {
-    pos->second.second->UnRegister(this);
-    this->Cache.erase(pos++);
+    pos = this->EraseCacheItem(pos);
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkTemporalDataSetCache::SetCacheMemoryLimit(unsigned long limit)
+{
+  // Like SetCacheSize, this does not modify the filter, which would flush
+  // the cache.
+  this->CacheMemoryLimit = limit;
+  if (this->Cache.empty())
+  {
+    return;
+  }
+
+  // Keep the most recently used time step.
+  CacheType::iterator mostRecent = this->Cache.begin();
+  for (CacheType::iterator pos = this->Cache.begin(); pos != this->Cache.end(); ++pos)
+  {
+    if (pos->second.first > mostRecent->second.first)
+    {
+      mostRecent = pos;
+    }
+  }
+  this->PruneCache(mostRecent->first);
+}
+
+//------------------------------------------------------------------------------
+unsigned long vtkTemporalDataSetCache::GetCacheMemorySize()
+{
+  return this->Internals->CacheMemorySize;
+}
+
+//------------------------------------------------------------------------------
+void vtkTemporalDataSetCache::SetPrefetchPipeline(vtkAlgorithm* pipeline)
+{
+  if (this->Internals->Pipeline == pipeline)
+  {
+    return;
+  }
+  // The background thread is started again by the next request. The filter
+  // is not modified as its output does not change.
+  this->Internals->Shutdown();
+  this->Internals->Pipeline = pipeline;
+}
+
+//------------------------------------------------------------------------------
+vtkAlgorithm* vtkTemporalDataSetCache::GetPrefetchPipeline()
+{
+  return this->Internals->Pipeline;
+}
+
+//------------------------------------------------------------------------------
+void vtkTemporalDataSetCache::SetPrefetchDepth(int depth)
+{
+  this->PrefetchDepth = std::max(depth, 1);
+}
+
+//------------------------------------------------------------------------------
+void vtkTemporalDataSetCache::WaitForPrefetch()
+{
+  if (this->Internals->Worker.joinable())
+  {
+    this->Internals->Wait();
   }
 }
 
@@ -313,15 +519,14 @@ int vtkTemporalDataSetCache ::RequestUpdateExtent(vtkInformation* vtkNotUsed(req
     return 1;
   }
 
+  vtkMTimeType pmt = ddp->GetPipelineMTime();
   if (!this->IsASource)
   {
-    vtkMTimeType pmt = ddp->GetPipelineMTime();
     for (pos = this->Cache.begin(); pos != this->Cache.end();)
     {
       if (pos->second.first < pmt)
       {
-        pos->second.second->Delete();
-        this->Cache.erase(pos++);
+        pos = this->EraseCacheItem(pos);
       }
       else
       {
@@ -356,6 +561,19 @@ int vtkTemporalDataSetCache ::RequestUpdateExtent(vtkInformation* vtkNotUsed(req
   {
     double upTime = outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP());
 
+    // remember the input time steps to predict the next requests, and take
+    // the requested time step from the prefetched data if it is there
+    if (this->Internals->Pipeline)
+    {
+      std::vector<double>& timeSteps = this->Internals->TimeSteps;
+      timeSteps.resize(inInfo->Length(vtkStreamingDemandDrivenPipeline::TIME_STEPS()));
+      if (!timeSteps.empty())
+      {
+        inInfo->Get(vtkStreamingDemandDrivenPipeline::TIME_STEPS(), timeSteps.data());
+      }
+      this->AdoptPrefetchedData(this->Internals->GetPipelineMTime(), upTime);
+    }
+
     // do we have this time step?
     pos = this->Cache.find(upTime);
     if (pos == this->Cache.end())
@@ -474,8 +692,7 @@ int vtkTemporalDataSetCache::RequestData(vtkInformation* vtkNotUsed(request),
         if (oldestpos->second.first < outputUpdateTime)
         {
           this->SetEjected(oldestpos->second.second);
-          oldestpos->second.second->UnRegister(this);
-          this->Cache.erase(oldestpos);
+          this->EraseCacheItem(oldestpos);
 
           this->ReplaceCacheItem(input, inTime, outputUpdateTime);
         }
@@ -486,9 +703,161 @@ int vtkTemporalDataSetCache::RequestData(vtkInformation* vtkNotUsed(request),
       }
     }
   }
+  this->PruneCache(upTime);
+
+  if (this->Internals->Pipeline &&
+    outInfo->Has(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP()))
+  {
+    this->SchedulePrefetch(upTime, this->Internals->GetPipelineMTime());
+  }
   return 1;
 }
 
+//------------------------------------------------------------------------------
+bool vtkTemporalDataSetCache::EvictLeastRecentlyUsed(double keepTime)
+{
+  CacheType::iterator oldestpos = this->Cache.end();
+  for (CacheType::iterator pos = this->Cache.begin(); pos != this->Cache.end(); ++pos)
+  {
+    if (pos->first != keepTime &&
+      (oldestpos == this->Cache.end() || pos->second.first < oldestpos->second.first))
+    {
+      oldestpos = pos;
+    }
+  }
+  if (oldestpos == this->Cache.end())
+  {
+    return false;
+  }
+  this->SetEjected(oldestpos->second.second);
+  this->EraseCacheItem(oldestpos);
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void vtkTemporalDataSetCache::PruneCache(double keepTime)
+{
+  if (this->CacheMemoryLimit == 0)
+  {
+    return;
+  }
+  while (this->GetCacheMemorySize() > this->CacheMemoryLimit &&
+    this->EvictLeastRecentlyUsed(keepTime))
+  {
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkTemporalDataSetCache::AdoptPrefetchedData(vtkMTimeType pipelineMTime, double upTime)
+{
+  vtkInternals& internals = *this->Internals;
+  vtkSmartPointer<vtkDataObject> data;
+  {
+    std::lock_guard<std::mutex> guard(internals.Lock);
+    auto result = internals.Results.find(upTime);
+    if (result == internals.Results.end())
+    {
+      return;
+    }
+    // data prefetched before the pipeline was modified is out of date
+    if (result->second.Generation == pipelineMTime)
+    {
+      data = result->second.Data;
+    }
+    internals.Results.erase(result);
+  }
+  if (!data || this->Cache.find(upTime) != this->Cache.end())
+  {
+    return;
+  }
+
+  while (this->Cache.size() >= static_cast<unsigned long>(this->CacheSize) &&
+    this->EvictLeastRecentlyUsed(upTime))
+  {
+  }
+  vtkTimeStamp now;
+  now.Modified();
+  this->ReplaceCacheItem(data, upTime, now.GetMTime());
+  this->PruneCache(upTime);
+}
+
+//------------------------------------------------------------------------------
+void vtkTemporalDataSetCache::SchedulePrefetch(double upTime, vtkMTimeType pipelineMTime)
+{
+  vtkInternals& internals = *this->Internals;
+  const std::vector<double>& timeSteps = internals.TimeSteps;
+  auto it = std::lower_bound(timeSteps.begin(), timeSteps.end(), upTime);
+  if (it == timeSteps.end() || *it != upTime)
+  {
+    return;
+  }
+
+  // the direction and stride of the animation are given by the last two
+  // distinct requests
+  const size_t index = static_cast<size_t>(it - timeSteps.begin());
+  if (internals.History.empty() || internals.History.back() != index)
+  {
+    internals.History.push_back(index);
+    if (internals.History.size() > 2)
+    {
+      internals.History.pop_front();
+    }
+  }
+  if (internals.History.size() < 2)
+  {
+    return;
+  }
+  const long long stride = static_cast<long long>(internals.History[1]) -
+    static_cast<long long>(internals.History[0]);
+
+  std::vector<double> predicted;
+  for (int i = 1; i <= this->PrefetchDepth; ++i)
+  {
+    const long long next = static_cast<long long>(index) + i * stride;
+    if (next < 0 || next >= static_cast<long long>(timeSteps.size()))
+    {
+      break;
+    }
+    if (this->Cache.find(timeSteps[next]) == this->Cache.end())
+    {
+      predicted.push_back(timeSteps[next]);
+    }
+  }
+
+  {
+    std::lock_guard<std::mutex> guard(internals.Lock);
+    // forget what is not predicted anymore, or out of date
+    for (auto pos = internals.Results.begin(); pos != internals.Results.end();)
+    {
+      if (pos->second.Generation != pipelineMTime ||
+        std::find(predicted.begin(), predicted.end(), pos->first) == predicted.end())
+      {
+        internals.Results.erase(pos++);
+      }
+      else
+      {
+        ++pos;
+      }
+    }
+    internals.Queue.clear();
+    internals.QueueGeneration = pipelineMTime;
+    for (double time : predicted)
+    {
+      if (internals.Results.find(time) == internals.Results.end() &&
+        !(internals.Busy && internals.BusyTime == time))
+      {
+        internals.Queue.push_back(time);
+      }
+    }
+    if (internals.Queue.empty())
+    {
+      return;
+    }
+  }
+  internals.Start();
+  internals.WorkCondition.notify_one();
+}
+
 //------------------------------------------------------------------------------
 void vtkTemporalDataSetCache::ReplaceCacheItem(
   vtkDataObject* input, double inTime, vtkMTimeType outputUpdateTime)
@@ -510,7 +879,30 @@ void vtkTemporalDataSetCache::ReplaceCacheItem(
       cachedData->ShallowCopy(input);
     }
   }
+  CacheType::iterator previous = this->Cache.find(inTime);
+  if (previous != this->Cache.end())
+  {
+    this->EraseCacheItem(previous);
+  }
   this->Cache[inTime] = std::pair<unsigned long, vtkDataObject*>(outputUpdateTime, cachedData);
+
+  const unsigned long size = cachedData->GetActualMemorySize();
+  this->Internals->ItemSizes[inTime] = size;
+  this->Internals->CacheMemorySize += size;
+}
+
+//------------------------------------------------------------------------------
+vtkTemporalDataSetCache::CacheType::iterator vtkTemporalDataSetCache::EraseCacheItem(
+  CacheType::iterator pos)
+{
+  auto size = this->Internals->ItemSizes.find(pos->first);
+  if (size != this->Internals->ItemSizes.end())
+  {
+    this->Internals->CacheMemorySize -= size->second;
+    this->Internals->ItemSizes.erase(size);
+  }
+  pos->second.second->UnRegister(this);
+  return this->Cache.erase(pos);
 }
 
 //------------------------------------------------------------------------------
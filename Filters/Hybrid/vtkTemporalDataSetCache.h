@@ -18,6 +18,18 @@
  *
  * vtkTemporalDataSetCache cache time step requests of a temporal dataset,
  * when cached data is requested it is returned using a shallow copy.
+ *
+ * The cache holds at most CacheSize time steps and, when CacheMemoryLimit is
+ * set, at most that much memory. The least recently used time steps are
+ * evicted first.
+ *
+ * When a PrefetchPipeline is set, the cache predicts the next requested time
+ * steps from the recent requests (moving forward, backward or with a stride)
+ * and updates the prefetch pipeline for them on a background thread. The
+ * prefetch pipeline must be an independent copy of the upstream pipeline,
+ * e.g. a second reader on the same file, so that the foreground updates are
+ * never blocked by it. Prefetched time steps are moved into the cache when
+ * they are requested, without executing the upstream pipeline.
  * @par Thanks:
  * Ken Martin (Kitware) and John Bidiscombe of
  * CSCS - Swiss National Supercomputing Centre
@@ -53,6 +65,49 @@ public:
   vtkGetMacro(CacheSize, int);
   ///@}
 
+  ///@{
+  /**
+   * Maximum amount of memory, in kibibytes, used by the cached time steps
+   * as reported by vtkDataObject::GetActualMemorySize(). The least recently
+   * used time steps are evicted when it is exceeded, but the last requested
+   * one is always kept. 0, the default, means no limit.
+   */
+  void SetCacheMemoryLimit(unsigned long limit);
+  vtkGetMacro(CacheMemoryLimit, unsigned long);
+  ///@}
+
+  /**
+   * Return the memory used by the cached time steps, in kibibytes.
+   */
+  unsigned long GetCacheMemorySize();
+
+  ///@{
+  /**
+   * Set/Get the pipeline updated on a background thread to prefetch the time
+   * steps predicted to be requested next. It must produce the same data as
+   * the input of the cache but share no algorithm with the foreground
+   * pipeline, since it is updated concurrently with it. It is only used from
+   * the background thread once set. Prefetching is disabled when it is
+   * nullptr, the default.
+   */
+  void SetPrefetchPipeline(vtkAlgorithm* pipeline);
+  vtkAlgorithm* GetPrefetchPipeline();
+  ///@}
+
+  ///@{
+  /**
+   * Number of time steps prefetched ahead of the last request. Defaults to 1.
+   */
+  void SetPrefetchDepth(int depth);
+  vtkGetMacro(PrefetchDepth, int);
+  ///@}
+
+  /**
+   * Block until the background thread is done with the pending prefetch
+   * requests. Mostly useful for testing.
+   */
+  void WaitForPrefetch();
+
   ///@{
   /**
    * Tells the filter that it should store the dataobjects it holds in memkind
@@ -78,6 +133,8 @@ protected:
   ~vtkTemporalDataSetCache() override;
 
   int CacheSize;
+  unsigned long CacheMemoryLimit;
+  int PrefetchDepth;
 
   typedef std::map<double, std::pair<unsigned long, vtkDataObject*>> CacheType;
   CacheType Cache;
@@ -106,6 +163,11 @@ private:
   void operator=(const vtkTemporalDataSetCache&) = delete;
 
   void ReplaceCacheItem(vtkDataObject* input, double inTime, vtkMTimeType outputUpdateTime);
+  CacheType::iterator EraseCacheItem(CacheType::iterator pos);
+  bool EvictLeastRecentlyUsed(double keepTime);
+  void PruneCache(double keepTime);
+  void AdoptPrefetchedData(vtkMTimeType pipelineMTime, double keepTime);
+  void SchedulePrefetch(double upTime, vtkMTimeType pipelineMTime);
   bool CacheInMemkind;
   bool IsASource;
 
@@ -113,6 +175,9 @@ private:
   void SetEjected(vtkDataObject*);
   vtkGetObjectMacro(Ejected, vtkDataObject);
   vtkDataObject* Ejected;
+
+  class vtkInternals;
+  vtkInternals* Internals;
 };
 
 #endif
@@ -0,0 +1,200 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestAsynchronousWriter.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that the time steps written by vtkAsynchronousWriter are those given
+// to Write(), even when the input is changed while they are written, also
+// for writers given their file name by a function.
+
+#include "vtkAsynchronousWriter.h"
+#include "vtkCellArray.h"
+#include "vtkDoubleArray.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSTLReader.h"
+#include "vtkSTLWriter.h"
+#include "vtkTestUtilities.h"
+#include "vtkUnstructuredGrid.h"
+#include "vtkXMLUnstructuredGridReader.h"
+#include "vtkXMLUnstructuredGridWriter.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+namespace
+{
+const vtkIdType NumberOfPoints = 100000;
+const int NumberOfSteps = 6;
+
+//----------------------------------------------------------------------------
+// Replaces the values of the grid, like a simulation would, instead of
+// modifying its arrays in place.
+void UpdateGrid(vtkUnstructuredGrid* grid, int step)
+{
+  vtkNew<vtkPoints> points;
+  points->SetNumberOfPoints(NumberOfPoints);
+  vtkNew<vtkDoubleArray> values;
+  values->SetName("values");
+  values->SetNumberOfValues(NumberOfPoints);
+  for (vtkIdType i = 0; i < NumberOfPoints; ++i)
+  {
+    points->SetPoint(i, i, step, 0);
+    values->SetValue(i, step * NumberOfPoints + i);
+  }
+  grid->SetPoints(points);
+  grid->GetPointData()->AddArray(values);
+}
+
+//----------------------------------------------------------------------------
+bool CheckStep(const std::string& fileName, int step)
+{
+  vtkNew<vtkXMLUnstructuredGridReader> reader;
+  reader->SetFileName(fileName.c_str());
+  reader->Update();
+  vtkUnstructuredGrid* grid = reader->GetOutput();
+  vtkDataArray* values = grid->GetPointData()->GetArray("values");
+  if (grid->GetNumberOfPoints() != NumberOfPoints || !values)
+  {
+    return false;
+  }
+  for (vtkIdType i = 0; i < NumberOfPoints; ++i)
+  {
+    double point[3];
+    grid->GetPoint(i, point);
+    if (point[1] != step || values->GetComponent(i, 0) != step * NumberOfPoints + i)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+//----------------------------------------------------------------------------
+int TestAsynchronousWriter(int argc, char* argv[])
+{
+  char* tempDir =
+    vtkTestUtilities::GetArgOrEnvOrDefault("-T", argc, argv, "VTK_TEMP_DIR", "Testing/Temporary");
+  std::string prefix = std::string(tempDir) + "/TestAsynchronousWriter-";
+  delete[] tempDir;
+
+  vtkNew<vtkUnstructuredGrid> grid;
+  vtkNew<vtkXMLUnstructuredGridWriter> gridWriter;
+  vtkNew<vtkAsynchronousWriter> writer;
+  writer->SetWriter(gridWriter);
+  writer->SetInputData(grid);
+  writer->SetMaximumNumberOfPendingWrites(2);
+  for (int step = 0; step < NumberOfSteps; ++step)
+  {
+    UpdateGrid(grid, step);
+    writer->SetFileName((prefix + std::to_string(step) + ".vtu").c_str());
+    if (!writer->Write() || writer->GetNumberOfPendingWrites() > 2)
+    {
+      std::cerr << "Wrong number of pending writes at step " << step << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+  if (!writer->Flush() || writer->GetNumberOfPendingWrites() != 0)
+  {
+    std::cerr << "Writing failed" << std::endl;
+    return EXIT_FAILURE;
+  }
+  for (int step = 0; step < NumberOfSteps; ++step)
+  {
+    if (!CheckStep(prefix + std::to_string(step) + ".vtu", step))
+    {
+      std::cerr << "Wrong data written at step " << step << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // The failures of the writer are reported by Flush()
+  vtkObject::GlobalWarningDisplayOff();
+  writer->SetFileName((prefix + "missing/directory.vtu").c_str());
+  writer->Write();
+  int flushed = writer->Flush();
+  vtkObject::GlobalWarningDisplayOn();
+  if (flushed)
+  {
+    std::cerr << "Failed write not reported" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Algorithms that are not writers are rejected
+  vtkNew<vtkSTLReader> stlReader;
+  vtkObject::GlobalWarningDisplayOff();
+  writer->SetWriter(stlReader);
+  vtkObject::GlobalWarningDisplayOn();
+  if (writer->GetWriter() != gridWriter.GetPointer())
+  {
+    std::cerr << "A reader was accepted as writer" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Writers without a SetFileName() known to vtkAsynchronousWriter fail
+  // without a file name function.
+  vtkNew<vtkPolyData> triangles;
+  vtkNew<vtkSTLWriter> stlWriter;
+  writer->SetWriter(stlWriter);
+  writer->SetInputData(triangles);
+  writer->SetFileName((prefix + "0.stl").c_str());
+  vtkObject::GlobalWarningDisplayOff();
+  int written = writer->Write();
+  vtkObject::GlobalWarningDisplayOn();
+  if (written || writer->GetNumberOfPendingWrites() != 0)
+  {
+    std::cerr << "File name not given to the STL writer" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  writer->SetFileNameFunction([](vtkAlgorithm* algorithm, const char* fileName) {
+    vtkSTLWriter::SafeDownCast(algorithm)->SetFileName(fileName);
+  });
+  for (int step = 1; step <= 3; ++step)
+  {
+    vtkNew<vtkPoints> points;
+    vtkNew<vtkCellArray> polys;
+    for (vtkIdType i = 0; i < step; ++i)
+    {
+      points->InsertNextPoint(i, 0, 0);
+      points->InsertNextPoint(i, 1, 0);
+      points->InsertNextPoint(i, 0, 1);
+      const vtkIdType ids[3] = { 3 * i, 3 * i + 1, 3 * i + 2 };
+      polys->InsertNextCell(3, ids);
+    }
+    triangles->SetPoints(points);
+    triangles->SetPolys(polys);
+    writer->SetFileName((prefix + std::to_string(step) + ".stl").c_str());
+    writer->Write();
+  }
+  if (!writer->Flush())
+  {
+    std::cerr << "Writing STL files failed" << std::endl;
+    return EXIT_FAILURE;
+  }
+  for (int step = 1; step <= 3; ++step)
+  {
+    vtkNew<vtkSTLReader> reader;
+    reader->SetFileName((prefix + std::to_string(step) + ".stl").c_str());
+    reader->Update();
+    if (reader->GetOutput()->GetNumberOfCells() != step)
+    {
+      std::cerr << "Wrong STL file written at step " << step << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+  return EXIT_SUCCESS;
+}
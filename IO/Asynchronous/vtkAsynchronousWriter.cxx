@@ -0,0 +1,277 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkAsynchronousWriter.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkAsynchronousWriter.h"
+
+#include "vtkDataObject.h"
+#include "vtkDataWriter.h"
+#include "vtkErrorCode.h"
+#include "vtkInformation.h"
+#include "vtkLogger.h"
+#include "vtkObjectFactory.h"
+#include "vtkSmartPointer.h"
+#include "vtkXMLWriterBase.h"
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+
+//****************************************************************************
+namespace
+{
+struct WriteTask
+{
+  vtkSmartPointer<vtkAlgorithm> Writer;
+  vtkSmartPointer<vtkDataObject> Data;
+  bool HasFileName;
+  std::string FileName;
+  std::function<void(vtkAlgorithm*, const char*)> FileNameFunction;
+};
+
+// Returns true if the file name of the writer is set without a function.
+bool HasFileNameSetter(vtkAlgorithm* writer)
+{
+  return vtkXMLWriterBase::SafeDownCast(writer) || vtkDataWriter::SafeDownCast(writer);
+}
+
+// Writes the data of the task with its writer, and returns true on success.
+bool Write(const WriteTask& task)
+{
+  vtkAlgorithm* writer = task.Writer;
+  writer->SetInputDataObject(0, task.Data);
+  if (task.HasFileName)
+  {
+    if (vtkXMLWriterBase* xmlWriter = vtkXMLWriterBase::SafeDownCast(writer))
+    {
+      xmlWriter->SetFileName(task.FileName.c_str());
+    }
+    else if (vtkDataWriter* legacyWriter = vtkDataWriter::SafeDownCast(writer))
+    {
+      legacyWriter->SetFileName(task.FileName.c_str());
+    }
+    else
+    {
+      task.FileNameFunction(writer, task.FileName.c_str());
+    }
+  }
+  // SetWriter() only accepts these two kinds of writers
+  vtkXMLWriterBase* xmlWriter = vtkXMLWriterBase::SafeDownCast(writer);
+  int success = xmlWriter ? xmlWriter->Write() : vtkWriter::SafeDownCast(writer)->Write();
+  success = success && writer->GetErrorCode() == vtkErrorCode::NoError;
+
+  // Do not keep the data alive after it was written
+  writer->SetInputDataObject(0, nullptr);
+  return success != 0;
+}
+}
+
+//****************************************************************************
+class vtkAsynchronousWriter::vtkInternals
+{
+public:
+  ~vtkInternals()
+  {
+    {
+      std::lock_guard<std::mutex> lock(this->Mutex);
+      this->Stop = true;
+    }
+    this->TaskAdded.notify_one();
+    if (this->Thread.joinable())
+    {
+      this->Thread.join();
+    }
+  }
+
+  // Queues a task, after waiting for the number of pending tasks to be below
+  // the given maximum.
+  void Push(WriteTask&& task, int maximumNumberOfPendingTasks)
+  {
+    std::unique_lock<std::mutex> lock(this->Mutex);
+    this->TaskDone.wait(
+      lock, [&]() { return this->NumberOfPendingTasks < maximumNumberOfPendingTasks; });
+    this->Tasks.push_back(std::move(task));
+    ++this->NumberOfPendingTasks;
+    if (!this->Thread.joinable())
+    {
+      this->Thread = std::thread(&vtkInternals::Run, this);
+    }
+    lock.unlock();
+    this->TaskAdded.notify_one();
+  }
+
+  // Waits for all the pending tasks to be done, and returns whether they all
+  // succeeded since the last reset.
+  bool Wait(bool reset)
+  {
+    std::unique_lock<std::mutex> lock(this->Mutex);
+    this->TaskDone.wait(lock, [this]() { return this->NumberOfPendingTasks == 0; });
+    bool succeeded = !this->Failed;
+    if (reset)
+    {
+      this->Failed = false;
+    }
+    return succeeded;
+  }
+
+  std::function<void(vtkAlgorithm*, const char*)> FileNameFunction;
+
+  int GetNumberOfPendingTasks()
+  {
+    std::lock_guard<std::mutex> lock(this->Mutex);
+    return this->NumberOfPendingTasks;
+  }
+
+private:
+  // Executes the tasks in order until the internals are destroyed
+  void Run()
+  {
+    std::unique_lock<std::mutex> lock(this->Mutex);
+    while (true)
+    {
+      this->TaskAdded.wait(lock, [this]() { return this->Stop || !this->Tasks.empty(); });
+      if (this->Tasks.empty())
+      {
+        return;
+      }
+      WriteTask task = std::move(this->Tasks.front());
+      this->Tasks.pop_front();
+      lock.unlock();
+
+      vtkLogF(TRACE, "writing: %s", task.FileName.c_str());
+      bool succeeded = ::Write(task);
+      task.Data = nullptr;
+
+      lock.lock();
+      this->Failed = this->Failed || !succeeded;
+      --this->NumberOfPendingTasks;
+      this->TaskDone.notify_all();
+    }
+  }
+
+  std::mutex Mutex;
+  std::condition_variable TaskAdded;
+  std::condition_variable TaskDone;
+  std::deque<WriteTask> Tasks;
+  int NumberOfPendingTasks = 0;
+  bool Failed = false;
+  bool Stop = false;
+  std::thread Thread;
+};
+
+vtkStandardNewMacro(vtkAsynchronousWriter);
+//------------------------------------------------------------------------------
+vtkAsynchronousWriter::vtkAsynchronousWriter()
+  : Writer(nullptr)
+  , FileName(nullptr)
+  , MaximumNumberOfPendingWrites(2)
+  , Internals(new vtkInternals())
+{
+}
+
+//------------------------------------------------------------------------------
+vtkAsynchronousWriter::~vtkAsynchronousWriter()
+{
+  // Writes the pending data before stopping the thread
+  delete this->Internals;
+  this->Internals = nullptr;
+  this->SetFileName(nullptr);
+  if (this->Writer)
+  {
+    this->Writer->UnRegister(this);
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkAsynchronousWriter::SetWriter(vtkAlgorithm* writer)
+{
+  if (writer && !vtkWriter::SafeDownCast(writer) && !vtkXMLWriterBase::SafeDownCast(writer))
+  {
+    vtkErrorMacro(<< writer->GetClassName() << " is not a vtkWriter or a vtkXMLWriterBase.");
+    return;
+  }
+  if (writer != this->Writer)
+  {
+    this->Internals->Wait(false);
+  }
+  vtkSetObjectBodyMacro(Writer, vtkAlgorithm, writer);
+}
+
+//------------------------------------------------------------------------------
+void vtkAsynchronousWriter::SetFileNameFunction(
+  std::function<void(vtkAlgorithm*, const char*)> function)
+{
+  this->Internals->FileNameFunction = std::move(function);
+  this->Modified();
+}
+
+//------------------------------------------------------------------------------
+int vtkAsynchronousWriter::GetNumberOfPendingWrites()
+{
+  return this->Internals->GetNumberOfPendingTasks();
+}
+
+//------------------------------------------------------------------------------
+int vtkAsynchronousWriter::Flush()
+{
+  return this->Internals->Wait(true) ? 1 : 0;
+}
+
+//------------------------------------------------------------------------------
+int vtkAsynchronousWriter::FillInputPortInformation(int, vtkInformation* info)
+{
+  info->Set(vtkAlgorithm::INPUT_REQUIRED_DATA_TYPE(), "vtkDataObject");
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+void vtkAsynchronousWriter::WriteData()
+{
+  if (!this->Writer)
+  {
+    vtkErrorMacro(<< "No writer provided!");
+    this->SetErrorCode(vtkErrorCode::UnknownError);
+    return;
+  }
+  if (this->FileName && !::HasFileNameSetter(this->Writer) && !this->Internals->FileNameFunction)
+  {
+    vtkErrorMacro(<< "No file name function to give the file name to "
+                  << this->Writer->GetClassName() << ".");
+    this->SetErrorCode(vtkErrorCode::UnknownError);
+    return;
+  }
+
+  // The shallow copy lets the caller replace the arrays of the input, and
+  // update the pipeline, while the data is written.
+  vtkDataObject* input = this->GetInput();
+  WriteTask task;
+  task.Writer = this->Writer;
+  task.Data.TakeReference(input->NewInstance());
+  task.Data->ShallowCopy(input);
+  task.HasFileName = this->FileName != nullptr;
+  task.FileName = this->FileName ? this->FileName : "";
+  task.FileNameFunction = this->Internals->FileNameFunction;
+  this->Internals->Push(std::move(task), this->MaximumNumberOfPendingWrites);
+}
+
+//------------------------------------------------------------------------------
+void vtkAsynchronousWriter::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "Writer: " << this->Writer << endl;
+  os << indent << "FileName: " << (this->FileName ? this->FileName : "(none)") << endl;
+  os << indent << "MaximumNumberOfPendingWrites: " << this->MaximumNumberOfPendingWrites << endl;
+}
@@ -0,0 +1,132 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkAsynchronousWriter.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class    vtkAsynchronousWriter
+ * @brief    writes data with another writer on a background thread
+ *
+ * vtkAsynchronousWriter lets the caller go on while another writer writes its
+ * input. Write() takes a shallow copy of the input and queues it, with the
+ * current file name, for a thread that writes the queued data one after the
+ * other with the writer given to SetWriter(). The writer can be any vtkWriter
+ * or vtkXMLWriterBase, for instance vtkXMLPUnstructuredGridWriter or
+ * vtkXMLMultiBlockDataWriter. VTK writers have no common file name setter:
+ * the file name is given to the subclasses of vtkXMLWriterBase and
+ * vtkDataWriter, and SetFileNameFunction() tells how to give it to other
+ * writers, e.g. vtkSTLWriter.
+ *
+ * Write() only waits when MaximumNumberOfPendingWrites data objects are
+ * already queued, so that a caller writing faster than the disk does not
+ * keep an unbounded number of time steps in memory. Flush() waits until all
+ * the queued data are written.
+ *
+ * The writer must not be used or modified by the caller while writes are
+ * pending. Since the input is only shallow copied, its arrays must not be
+ * modified in place after Write() either: they must be replaced by new arrays,
+ * as the sources and filters of a pipeline do. Parallel writers communicate on
+ * the background thread, which requires an MPI implementation supporting
+ * multiple threads.
+ *
+ * @sa
+ * vtkThreadedImageWriter
+ */
+
+#ifndef vtkAsynchronousWriter_h
+#define vtkAsynchronousWriter_h
+
+#include "vtkIOAsynchronousModule.h" // For export macro
+#include "vtkWriter.h"
+
+#include <functional> // For std::function
+
+class VTKIOASYNCHRONOUS_EXPORT vtkAsynchronousWriter : public vtkWriter
+{
+public:
+  static vtkAsynchronousWriter* New();
+  vtkTypeMacro(vtkAsynchronousWriter, vtkWriter);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  ///@{
+  /**
+   * Set/Get the writer used to write the data on the background thread. It
+   * must be a vtkWriter or a vtkXMLWriterBase, other algorithms are rejected.
+   * Setting the writer waits for the pending writes first.
+   */
+  virtual void SetWriter(vtkAlgorithm* writer);
+  vtkGetObjectMacro(Writer, vtkAlgorithm);
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get the name of the file the next Write() writes. It is given to the
+   * writer before it writes the data, with the file name function for writers
+   * not deriving from vtkXMLWriterBase or vtkDataWriter: Write() fails if
+   * there is none. When it is not set, the writer keeps its own file name.
+   */
+  vtkSetStringMacro(FileName);
+  vtkGetStringMacro(FileName);
+  ///@}
+
+  /**
+   * Set the function giving the file name to the writer, on the background
+   * thread, for writers not deriving from vtkXMLWriterBase or vtkDataWriter:
+   * \code
+   * writer->SetFileNameFunction([](vtkAlgorithm* stlWriter, const char* fileName) {
+   *   vtkSTLWriter::SafeDownCast(stlWriter)->SetFileName(fileName);
+   * });
+   * \endcode
+   */
+  void SetFileNameFunction(std::function<void(vtkAlgorithm*, const char*)> function);
+
+  ///@{
+  /**
+   * Set/Get the maximum number of data objects queued or being written. When
+   * it is reached, Write() waits for the writer to finish the oldest one.
+   * Default is 2.
+   */
+  vtkSetClampMacro(MaximumNumberOfPendingWrites, int, 1, VTK_INT_MAX);
+  vtkGetMacro(MaximumNumberOfPendingWrites, int);
+  ///@}
+
+  /**
+   * Returns the number of data objects queued or being written.
+   */
+  int GetNumberOfPendingWrites();
+
+  /**
+   * Waits until all the queued data objects are written. Returns 1 if all the
+   * writes since the previous call succeeded, 0 otherwise.
+   */
+  int Flush();
+
+protected:
+  vtkAsynchronousWriter();
+  ~vtkAsynchronousWriter() override;
+
+  int FillInputPortInformation(int port, vtkInformation* info) override;
+  void WriteData() override;
+
+  vtkAlgorithm* Writer;
+  char* FileName;
+  int MaximumNumberOfPendingWrites;
+
+private:
+  vtkAsynchronousWriter(const vtkAsynchronousWriter&) = delete;
+  void operator=(const vtkAsynchronousWriter&) = delete;
+
+  class vtkInternals;
+  vtkInternals* Internals;
+};
+
+#endif
@@ -0,0 +1,472 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkShuffleDataCompressor.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkShuffleDataCompressor.h"
+#include "vtkEndian.h"
+#include "vtkLZ4DataCompressor.h"
+#include "vtkLZMADataCompressor.h"
+#include "vtkObjectFactory.h"
+#include "vtkSmartPointer.h"
+#include "vtkZLibDataCompressor.h"
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+vtkStandardNewMacro(vtkShuffleDataCompressor);
+
+namespace
+{
+// Every compressed buffer starts with a header of four bytes: the version of
+// the format, the size of the words, the flags and the code of the
+// compressor of the shuffled data.
+const size_t HeaderSize = 4;
+const unsigned char FormatVersion = 1;
+const unsigned char DeltaFlag = 0x1;
+const unsigned char BigEndianFlag = 0x2;
+
+enum CompressorCode : unsigned char
+{
+  NoCompressor = 0,
+  ZLibCompressor = 1,
+  LZ4Compressor = 2,
+  LZMACompressor = 3,
+  OtherCompressor = 255
+};
+
+unsigned char GetCompressorCode(vtkDataCompressor* compressor)
+{
+  if (!compressor)
+  {
+    return NoCompressor;
+  }
+  const char* name = compressor->GetClassName();
+  if (strcmp(name, "vtkZLibDataCompressor") == 0)
+  {
+    return ZLibCompressor;
+  }
+  if (strcmp(name, "vtkLZ4DataCompressor") == 0)
+  {
+    return LZ4Compressor;
+  }
+  if (strcmp(name, "vtkLZMADataCompressor") == 0)
+  {
+    return LZMACompressor;
+  }
+  return OtherCompressor;
+}
+
+// Gather the i-th bytes of the words together. The size of the words is a
+// compile-time constant for the common sizes so that the loops vectorize.
+template <int WordSize>
+void Shuffle(const unsigned char* in, unsigned char* out, size_t numWords)
+{
+  for (int b = 0; b < WordSize; ++b)
+  {
+    unsigned char* plane = out + b * numWords;
+    for (size_t i = 0; i < numWords; ++i)
+    {
+      plane[i] = in[i * WordSize + b];
+    }
+  }
+}
+
+template <int WordSize>
+void Unshuffle(const unsigned char* in, unsigned char* out, size_t numWords)
+{
+  for (size_t i = 0; i < numWords; ++i)
+  {
+    for (int b = 0; b < WordSize; ++b)
+    {
+      out[i * WordSize + b] = in[b * numWords + i];
+    }
+  }
+}
+
+void Shuffle(const unsigned char* in, unsigned char* out, size_t size, int wordSize)
+{
+  const size_t numWords = size / wordSize;
+  switch (wordSize)
+  {
+    case 2:
+      Shuffle<2>(in, out, numWords);
+      break;
+    case 4:
+      Shuffle<4>(in, out, numWords);
+      break;
+    case 8:
+      Shuffle<8>(in, out, numWords);
+      break;
+    default:
+      for (int b = 0; b < wordSize; ++b)
+      {
+        for (size_t i = 0; i < numWords; ++i)
+        {
+          out[b * numWords + i] = in[i * wordSize + b];
+        }
+      }
+  }
+  // The bytes of an incomplete last word are kept as they are.
+  const size_t shuffledSize = numWords * wordSize;
+  memcpy(out + shuffledSize, in + shuffledSize, size - shuffledSize);
+}
+
+void Unshuffle(const unsigned char* in, unsigned char* out, size_t size, int wordSize)
+{
+  const size_t numWords = size / wordSize;
+  switch (wordSize)
+  {
+    case 2:
+      Unshuffle<2>(in, out, numWords);
+      break;
+    case 4:
+      Unshuffle<4>(in, out, numWords);
+      break;
+    case 8:
+      Unshuffle<8>(in, out, numWords);
+      break;
+    default:
+      for (size_t i = 0; i < numWords; ++i)
+      {
+        for (int b = 0; b < wordSize; ++b)
+        {
+          out[i * wordSize + b] = in[b * numWords + i];
+        }
+      }
+  }
+  const size_t shuffledSize = numWords * wordSize;
+  memcpy(out + shuffledSize, in + shuffledSize, size - shuffledSize);
+}
+
+// Load and store integer words that may not be in the byte order of this
+// machine.
+template <typename T>
+T LoadWord(const unsigned char* p, bool swap)
+{
+  T value;
+  memcpy(&value, p, sizeof(T));
+  if (swap)
+  {
+    T swapped = 0;
+    for (size_t b = 0; b < sizeof(T); ++b)
+    {
+      swapped = static_cast<T>((swapped << 8) | ((value >> (8 * b)) & 0xff));
+    }
+    value = swapped;
+  }
+  return value;
+}
+
+template <typename T>
+void StoreWord(unsigned char* p, T value, bool swap)
+{
+  if (swap)
+  {
+    value = LoadWord<T>(reinterpret_cast<unsigned char*>(&value), true);
+  }
+  memcpy(p, &value, sizeof(T));
+}
+
+// Replace the words by the differences between consecutive words, modulo
+// the range of the words.
+template <typename T>
+void EncodeDelta(const unsigned char* in, unsigned char* out, size_t numWords, bool swap)
+{
+  T previous = 0;
+  for (size_t i = 0; i < numWords; ++i)
+  {
+    const T value = LoadWord<T>(in + i * sizeof(T), swap);
+    StoreWord<T>(out + i * sizeof(T), static_cast<T>(value - previous), swap);
+    previous = value;
+  }
+}
+
+template <typename T>
+void DecodeDelta(unsigned char* data, size_t numWords, bool swap)
+{
+  T previous = 0;
+  for (size_t i = 0; i < numWords; ++i)
+  {
+    previous = static_cast<T>(previous + LoadWord<T>(data + i * sizeof(T), swap));
+    StoreWord<T>(data + i * sizeof(T), previous, swap);
+  }
+}
+
+bool CanEncodeDelta(int wordSize)
+{
+  return wordSize == 1 || wordSize == 2 || wordSize == 4 || wordSize == 8;
+}
+
+void EncodeDelta(const unsigned char* in, unsigned char* out, size_t size, int wordSize, bool swap)
+{
+  const size_t numWords = size / wordSize;
+  switch (wordSize)
+  {
+    case 1:
+      EncodeDelta<uint8_t>(in, out, numWords, swap);
+      break;
+    case 2:
+      EncodeDelta<uint16_t>(in, out, numWords, swap);
+      break;
+    case 4:
+      EncodeDelta<uint32_t>(in, out, numWords, swap);
+      break;
+    case 8:
+      EncodeDelta<uint64_t>(in, out, numWords, swap);
+      break;
+  }
+  const size_t encodedSize = numWords * wordSize;
+  memcpy(out + encodedSize, in + encodedSize, size - encodedSize);
+}
+
+void DecodeDelta(unsigned char* data, size_t size, int wordSize, bool swap)
+{
+  const size_t numWords = size / wordSize;
+  switch (wordSize)
+  {
+    case 1:
+      DecodeDelta<uint8_t>(data, numWords, swap);
+      break;
+    case 2:
+      DecodeDelta<uint16_t>(data, numWords, swap);
+      break;
+    case 4:
+      DecodeDelta<uint32_t>(data, numWords, swap);
+      break;
+    case 8:
+      DecodeDelta<uint64_t>(data, numWords, swap);
+      break;
+  }
+}
+
+bool IsBigEndianMachine()
+{
+#ifdef VTK_WORDS_BIGENDIAN
+  return true;
+#else
+  return false;
+#endif
+}
+} // anonymous namespace
+
+//------------------------------------------------------------------------------
+vtkShuffleDataCompressor::vtkShuffleDataCompressor()
+{
+  this->Compressor = vtkLZ4DataCompressor::New();
+  this->WordSize = 1;
+  this->IntegerWords = false;
+  this->BigEndianWords = IsBigEndianMachine();
+  this->Delta = false;
+}
+
+//------------------------------------------------------------------------------
+vtkShuffleDataCompressor::~vtkShuffleDataCompressor()
+{
+  this->SetCompressor(nullptr);
+}
+
+//------------------------------------------------------------------------------
+void vtkShuffleDataCompressor::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+
+  os << indent << "Compressor: ";
+  if (this->Compressor)
+  {
+    os << endl;
+    this->Compressor->PrintSelf(os, indent.GetNextIndent());
+  }
+  else
+  {
+    os << "(none)" << endl;
+  }
+  os << indent << "WordSize: " << this->WordSize << endl;
+  os << indent << "IntegerWords: " << this->IntegerWords << endl;
+  os << indent << "BigEndianWords: " << this->BigEndianWords << endl;
+  os << indent << "Delta: " << this->Delta << endl;
+}
+
+//------------------------------------------------------------------------------
+vtkCxxSetObjectMacro(vtkShuffleDataCompressor, Compressor, vtkDataCompressor);
+
+//------------------------------------------------------------------------------
+void vtkShuffleDataCompressor::SetWordFormat(int wordSize, bool isInteger, bool isBigEndian)
+{
+  if (wordSize < 1 || wordSize > 255)
+  {
+    vtkErrorMacro("Invalid word size " << wordSize << ", words will not be shuffled.");
+    wordSize = 1;
+  }
+  this->WordSize = wordSize;
+  this->IntegerWords = isInteger;
+  this->BigEndianWords = isBigEndian;
+}
+
+//------------------------------------------------------------------------------
+size_t vtkShuffleDataCompressor::CompressBuffer(unsigned char const* uncompressedData,
+  size_t uncompressedSize, unsigned char* compressedData, size_t compressionSpace)
+{
+  if (compressionSpace < HeaderSize)
+  {
+    vtkErrorMacro("Not enough space to compress the data.");
+    return 0;
+  }
+  const int wordSize = this->WordSize;
+  const bool delta = this->Delta && this->IntegerWords && CanEncodeDelta(wordSize);
+  const bool swap = this->BigEndianWords != IsBigEndianMachine();
+
+  compressedData[0] = FormatVersion;
+  compressedData[1] = static_cast<unsigned char>(wordSize);
+  compressedData[2] = static_cast<unsigned char>(
+    (delta ? DeltaFlag : 0) | (this->BigEndianWords ? BigEndianFlag : 0));
+  compressedData[3] = GetCompressorCode(this->Compressor);
+
+  const unsigned char* data = uncompressedData;
+  std::vector<unsigned char> deltas;
+  if (delta)
+  {
+    deltas.resize(uncompressedSize);
+    EncodeDelta(data, deltas.data(), uncompressedSize, wordSize, swap);
+    data = deltas.data();
+  }
+  std::vector<unsigned char> shuffled;
+  if (wordSize > 1)
+  {
+    shuffled.resize(uncompressedSize);
+    Shuffle(data, shuffled.data(), uncompressedSize, wordSize);
+    data = shuffled.data();
+  }
+
+  if (!this->Compressor)
+  {
+    if (compressionSpace < HeaderSize + uncompressedSize)
+    {
+      vtkErrorMacro("Not enough space to compress the data.");
+      return 0;
+    }
+    memcpy(compressedData + HeaderSize, data, uncompressedSize);
+    return HeaderSize + uncompressedSize;
+  }
+  const size_t size = this->Compressor->Compress(
+    data, uncompressedSize, compressedData + HeaderSize, compressionSpace - HeaderSize);
+  return size ? HeaderSize + size : 0;
+}
+
+//------------------------------------------------------------------------------
+size_t vtkShuffleDataCompressor::UncompressBuffer(unsigned char const* compressedData,
+  size_t compressedSize, unsigned char* uncompressedData, size_t uncompressedSize)
+{
+  if (compressedSize < HeaderSize || compressedData[0] != FormatVersion || compressedData[1] < 1)
+  {
+    vtkErrorMacro("Invalid shuffled data header.");
+    return 0;
+  }
+  const int wordSize = compressedData[1];
+  const unsigned char flags = compressedData[2];
+  const unsigned char code = compressedData[3];
+  const bool bigEndian = (flags & BigEndianFlag) != 0;
+  const bool swap = bigEndian != IsBigEndianMachine();
+
+  // The data of this buffer may have been compressed by another compressor
+  // than ours: the one given by the header is used then.
+  vtkSmartPointer<vtkDataCompressor> compressor = this->Compressor;
+  if (code != OtherCompressor && code != GetCompressorCode(this->Compressor))
+  {
+    switch (code)
+    {
+      case NoCompressor:
+        compressor = nullptr;
+        break;
+      case ZLibCompressor:
+        compressor = vtkSmartPointer<vtkZLibDataCompressor>::New();
+        break;
+      case LZ4Compressor:
+        compressor = vtkSmartPointer<vtkLZ4DataCompressor>::New();
+        break;
+      case LZMACompressor:
+        compressor = vtkSmartPointer<vtkLZMADataCompressor>::New();
+        break;
+      default:
+        vtkErrorMacro("Unknown compressor of the shuffled data " << static_cast<int>(code));
+        return 0;
+    }
+  }
+  else if (code == OtherCompressor && !compressor)
+  {
+    vtkErrorMacro("No compressor is set to uncompress the shuffled data.");
+    return 0;
+  }
+
+  std::vector<unsigned char> shuffled;
+  unsigned char* data = uncompressedData;
+  if (wordSize > 1)
+  {
+    shuffled.resize(uncompressedSize);
+    data = shuffled.data();
+  }
+  if (compressor)
+  {
+    if (compressor->Uncompress(compressedData + HeaderSize, compressedSize - HeaderSize, data,
+          uncompressedSize) != uncompressedSize)
+    {
+      return 0;
+    }
+  }
+  else
+  {
+    if (compressedSize - HeaderSize != uncompressedSize)
+    {
+      vtkErrorMacro("Wrong size of uncompressed shuffled data.");
+      return 0;
+    }
+    memcpy(data, compressedData + HeaderSize, uncompressedSize);
+  }
+
+  if (wordSize > 1)
+  {
+    Unshuffle(data, uncompressedData, uncompressedSize, wordSize);
+  }
+  if ((flags & DeltaFlag) != 0)
+  {
+    if (!CanEncodeDelta(wordSize))
+    {
+      vtkErrorMacro("Invalid word size " << wordSize << " of delta encoded data.");
+      return 0;
+    }
+    DecodeDelta(uncompressedData, uncompressedSize, wordSize, swap);
+  }
+  return uncompressedSize;
+}
+
+//------------------------------------------------------------------------------
+size_t vtkShuffleDataCompressor::GetMaximumCompressionSpace(size_t size)
+{
+  return HeaderSize +
+    (this->Compressor ? this->Compressor->GetMaximumCompressionSpace(size) : size);
+}
+
+//------------------------------------------------------------------------------
+int vtkShuffleDataCompressor::GetCompressionLevel()
+{
+  return this->Compressor ? this->Compressor->GetCompressionLevel() : 0;
+}
+
+//------------------------------------------------------------------------------
+void vtkShuffleDataCompressor::SetCompressionLevel(int compressionLevel)
+{
+  if (this->Compressor)
+  {
+    this->Compressor->SetCompressionLevel(compressionLevel);
+  }
+}
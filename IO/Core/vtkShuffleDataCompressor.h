@@ -0,0 +1,126 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkShuffleDataCompressor.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkShuffleDataCompressor
+ * @brief   Byte-shuffle preconditioning before another compressor.
+ *
+ * vtkShuffleDataCompressor rearranges the data given to it so that the
+ * first bytes of all the words come first, then their second bytes, and so
+ * on, before compressing the result with another vtkDataCompressor (LZ4 by
+ * default). The bytes of the same significance of neighboring values are
+ * often similar, e.g. the signs and exponents of floating point values, so
+ * the shuffled data compress better and faster than the interleaved ones.
+ * Integer words, such as the offsets and connectivity of the cells, can
+ * also be replaced by the differences between consecutive values before
+ * being shuffled, see SetDelta().
+ *
+ * The size of the words is given with SetWordFormat() before compressing
+ * the data of an array, as vtkXMLWriter does. Every compressed buffer starts
+ * with a small header describing the word format, the delta encoding and
+ * the compressor used, so that uncompressing needs no other setting.
+ *
+ * @sa
+ * vtkDataCompressor vtkLZ4DataCompressor vtkXMLWriter
+ */
+
+#ifndef vtkShuffleDataCompressor_h
+#define vtkShuffleDataCompressor_h
+
+#include "vtkDataCompressor.h"
+#include "vtkIOCoreModule.h" // For export macro
+
+class VTKIOCORE_EXPORT vtkShuffleDataCompressor : public vtkDataCompressor
+{
+public:
+  vtkTypeMacro(vtkShuffleDataCompressor, vtkDataCompressor);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+  static vtkShuffleDataCompressor* New();
+
+  ///@{
+  /**
+   * Get/Set the compressor of the shuffled data. If nullptr, the shuffled
+   * data are stored uncompressed. Defaults to a vtkLZ4DataCompressor.
+   */
+  virtual void SetCompressor(vtkDataCompressor*);
+  vtkGetObjectMacro(Compressor, vtkDataCompressor);
+  ///@}
+
+  /**
+   * Set the format of the words of the data compressed next: their size in
+   * bytes, whether they are integers, and whether they are stored in big
+   * endian order. Words of one byte are not shuffled. Must not be changed
+   * while data are being compressed by other threads.
+   */
+  void SetWordFormat(int wordSize, bool isInteger, bool isBigEndian);
+
+  ///@{
+  /**
+   * Get the format of the words set with SetWordFormat().
+   */
+  vtkGetMacro(WordSize, int);
+  vtkGetMacro(IntegerWords, bool);
+  vtkGetMacro(BigEndianWords, bool);
+  ///@}
+
+  ///@{
+  /**
+   * When on, integer words are replaced by the differences between
+   * consecutive values before being shuffled. This is efficient for slowly
+   * increasing values such as offsets. Off by default.
+   */
+  vtkSetMacro(Delta, bool);
+  vtkGetMacro(Delta, bool);
+  vtkBooleanMacro(Delta, bool);
+  ///@}
+
+  /**
+   *  Get the maximum space that may be needed to store data of the
+   *  given uncompressed size after compression.  This is the minimum
+   *  size of the output buffer that can be passed to the four-argument
+   *  Compress method.
+   */
+  size_t GetMaximumCompressionSpace(size_t size) override;
+
+  ///@{
+  /**
+   * Get/Set the compression level of the compressor of the shuffled data.
+   */
+  int GetCompressionLevel() override;
+  void SetCompressionLevel(int compressionLevel) override;
+  ///@}
+
+protected:
+  vtkShuffleDataCompressor();
+  ~vtkShuffleDataCompressor() override;
+
+  vtkDataCompressor* Compressor;
+  int WordSize;
+  bool IntegerWords;
+  bool BigEndianWords;
+  bool Delta;
+
+  // Compression method required by vtkDataCompressor.
+  size_t CompressBuffer(unsigned char const* uncompressedData, size_t uncompressedSize,
+    unsigned char* compressedData, size_t compressionSpace) override;
+  // Decompression method required by vtkDataCompressor.
+  size_t UncompressBuffer(unsigned char const* compressedData, size_t compressedSize,
+    unsigned char* uncompressedData, size_t uncompressedSize) override;
+
+private:
+  vtkShuffleDataCompressor(const vtkShuffleDataCompressor&) = delete;
+  void operator=(const vtkShuffleDataCompressor&) = delete;
+};
+
+#endif
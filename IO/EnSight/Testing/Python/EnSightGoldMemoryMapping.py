@@ -0,0 +1,67 @@
+#!/usr/bin/env python
+
+"""
+EnSight Gold Binary test of the memory mapped reading
+
+The binary files are read with and without memory mapping, and the outputs,
+whose coordinates, connectivity and variables are decoded in parallel when
+the file is mapped, must be identical.
+"""
+
+import math
+import vtk
+from vtk.util.misc import vtkGetDataRoot
+VTK_DATA_ROOT = vtkGetDataRoot()
+
+def read(fileName, useMemoryMapping):
+    reader = vtk.vtkEnSightGoldBinaryReader()
+    reader.SetUseMemoryMapping(useMemoryMapping)
+    reader.SetCaseFileName(str(VTK_DATA_ROOT) + "/Data/EnSight/" + fileName)
+    reader.ReadAllVariablesOn()
+    reader.Update()
+    return reader.GetOutput()
+
+def sameArrays(array0, array1):
+    if array0.GetNumberOfTuples() != array1.GetNumberOfTuples() or \
+            array0.GetNumberOfComponents() != array1.GetNumberOfComponents():
+        return False
+    for i in range(array0.GetNumberOfValues()):
+        value0 = array0.GetVariantValue(i).ToDouble()
+        value1 = array1.GetVariantValue(i).ToDouble()
+        if value0 != value1 and not (math.isnan(value0) and math.isnan(value1)):
+            return False
+    return True
+
+def sameFieldData(data0, data1):
+    assert data0.GetNumberOfArrays() == data1.GetNumberOfArrays()
+    for i in range(data0.GetNumberOfArrays()):
+        array0 = data0.GetAbstractArray(i)
+        array1 = data1.GetAbstractArray(array0.GetName())
+        assert array1 is not None and sameArrays(array0, array1)
+
+def sameBlocks(block0, block1):
+    assert block0.GetClassName() == block1.GetClassName()
+    if block0.IsA("vtkUnstructuredGrid"):
+        assert sameArrays(block0.GetPoints().GetData(), block1.GetPoints().GetData())
+        assert sameArrays(block0.GetCellTypesArray(), block1.GetCellTypesArray())
+        assert sameArrays(block0.GetCells().GetConnectivityArray(),
+                          block1.GetCells().GetConnectivityArray())
+        assert sameArrays(block0.GetCells().GetOffsetsArray(),
+                          block1.GetCells().GetOffsetsArray())
+    sameFieldData(block0.GetPointData(), block1.GetPointData())
+    sameFieldData(block0.GetCellData(), block1.GetCellData())
+
+for fileName in ["elements-bin.case", "UndefAndPartial/grid_bin.case",
+                 "emptyParts_bin.case", "TEST_bin.case"]:
+    mapped = read(fileName, True)
+    streamed = read(fileName, False)
+    assert mapped.GetNumberOfBlocks() > 0
+    assert mapped.GetNumberOfBlocks() == streamed.GetNumberOfBlocks()
+    for i in range(mapped.GetNumberOfBlocks()):
+        block0 = mapped.GetBlock(i)
+        block1 = streamed.GetBlock(i)
+        assert (block0 is None) == (block1 is None)
+        if block0 is not None:
+            sameBlocks(block0, block1)
+
+# --- end of script --
@@ -25,6 +25,7 @@
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
 #include "vtkRectilinearGrid.h"
+#include "vtkSMPTools.h"
 #include "vtkStructuredGrid.h"
 #include "vtkUnstructuredGrid.h"
 #include "vtksys/Encoding.hxx"
@@ -32,14 +33,26 @@
 #include "vtksys/RegularExpression.hxx"
 #include "vtksys/SystemTools.hxx"
 
+#include <algorithm>
 #include <array>
 #include <cctype>
+#include <cstring>
+#include <limits>
 #include <map>
 #include <numeric>
+#include <streambuf>
 #include <string>
 #include <sys/stat.h>
 #include <vector>
 
+#if defined(_WIN32)
+#include "vtkWindows.h"
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 #if defined(_WIN32)
 #define VTK_STAT_STRUCT struct _stat64
 #define VTK_STAT_FUNC _stat64
@@ -55,6 +68,347 @@
 #define VTK_STAT_FUNC stat64
 #endif
 
+namespace
+{
+// Whether the arrays of a file written with the byte order are swapped when
+// they are read, as ReadIntArray() and ReadFloatArray() do.
+bool NeedsSwap(int byteOrder)
+{
+#ifdef VTK_WORDS_BIGENDIAN
+  return byteOrder == vtkEnSightReader::FILE_LITTLE_ENDIAN;
+#else
+  return byteOrder != vtkEnSightReader::FILE_LITTLE_ENDIAN;
+#endif
+}
+}
+
+class vtkEnSightGoldBinaryReader::FileOffsetMapInternal
+{
+  typedef std::string MapKey;
+  typedef std::map<int, vtkTypeInt64> MapValue;
+
+public:
+  typedef std::map<MapKey, MapValue>::const_iterator const_iterator;
+  typedef std::map<MapKey, MapValue>::value_type value_type;
+
+  // Forgets what is known about the file if it changed since it was indexed
+  void Validate(const MapKey& fileName, vtkTypeUInt64 size, vtkTypeInt64 modifiedTime)
+  {
+    std::pair<vtkTypeUInt64, vtkTypeInt64> stamp(size, modifiedTime);
+    auto stampIterator = this->Stamps.find(fileName);
+    if (stampIterator == this->Stamps.end() || stampIterator->second != stamp)
+    {
+      this->Map.erase(fileName);
+      this->NumberOfTimeSteps.erase(fileName);
+      this->Stamps[fileName] = stamp;
+    }
+  }
+
+  std::map<MapKey, MapValue> Map;
+  std::map<MapKey, int> NumberOfTimeSteps;
+  std::map<MapKey, std::pair<vtkTypeUInt64, vtkTypeInt64>> Stamps;
+};
+
+//------------------------------------------------------------------------------
+// Read-only memory mapping of a whole file, which is the buffer of the stream
+// the file is read through, so that the arrays of the file can be decoded from
+// the mapped memory.
+class vtkEnSightGoldBinaryReader::FileMappingInternal : public std::streambuf
+{
+public:
+  FileMappingInternal() = default;
+  ~FileMappingInternal() override { this->Unmap(); }
+
+  // Returns false if the file could not be mapped.
+  bool Map(const char* fileName, vtkTypeUInt64 size)
+  {
+    this->Unmap();
+    if (size == 0 || size > static_cast<vtkTypeUInt64>(std::numeric_limits<size_t>::max()))
+    {
+      return false;
+    }
+#if defined(_WIN32)
+    HANDLE file = CreateFileW(vtksys::Encoding::ToWide(fileName).c_str(), GENERIC_READ,
+      FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+      return false;
+    }
+    this->Mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (!this->Mapping)
+    {
+      return false;
+    }
+    void* data = MapViewOfFile(this->Mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!data)
+    {
+      CloseHandle(this->Mapping);
+      this->Mapping = nullptr;
+      return false;
+    }
+#else
+    int file = open(fileName, O_RDONLY);
+    if (file < 0)
+    {
+      return false;
+    }
+    void* data = mmap(nullptr, static_cast<size_t>(size), PROT_READ, MAP_PRIVATE, file, 0);
+    close(file);
+    if (data == MAP_FAILED)
+    {
+      return false;
+    }
+#endif
+    this->Data = static_cast<char*>(data);
+    this->Size = size;
+    this->setg(this->Data, this->Data, this->Data + size);
+    return true;
+  }
+
+  void Unmap()
+  {
+    if (!this->Data)
+    {
+      return;
+    }
+#if defined(_WIN32)
+    UnmapViewOfFile(this->Data);
+    CloseHandle(this->Mapping);
+    this->Mapping = nullptr;
+#else
+    munmap(this->Data, static_cast<size_t>(this->Size));
+#endif
+    this->Data = nullptr;
+    this->Size = 0;
+    this->setg(nullptr, nullptr, nullptr);
+  }
+
+  bool IsMapped() const { return this->Data != nullptr; }
+  const char* GetData() const { return this->Data; }
+  vtkTypeUInt64 GetSize() const { return this->Size; }
+
+protected:
+  pos_type seekoff(off_type offset, std::ios_base::seekdir direction,
+    std::ios_base::openmode vtkNotUsed(mode)) override
+  {
+    off_type position = offset;
+    if (direction == std::ios_base::cur)
+    {
+      position += this->gptr() - this->eback();
+    }
+    else if (direction == std::ios_base::end)
+    {
+      position += this->egptr() - this->eback();
+    }
+    if (!this->Data || position < 0 || position > this->egptr() - this->eback())
+    {
+      return pos_type(off_type(-1));
+    }
+    this->setg(this->eback(), this->eback() + position, this->egptr());
+    return pos_type(position);
+  }
+
+  pos_type seekpos(pos_type position, std::ios_base::openmode mode) override
+  {
+    return this->seekoff(off_type(position), std::ios_base::beg, mode);
+  }
+
+private:
+  char* Data = nullptr;
+  vtkTypeUInt64 Size = 0;
+#if defined(_WIN32)
+  HANDLE Mapping = nullptr;
+#endif
+};
+
+//------------------------------------------------------------------------------
+// The arrays of a memory mapped file, located while the file is read, and
+// decoded in parallel once all its parts were read.
+class vtkEnSightGoldBinaryReader::DecodeQueueInternal
+{
+public:
+  // Values of a component of a float array, written at Output with a stride
+  // of NumberOfComponents. The tuples are the consecutive ones from Start, or
+  // the TupleIds from Start when they are given.
+  struct Values
+  {
+    const char* Data;
+    vtkIdType Start;
+    vtkIdType Count;
+    float* Output;
+    int NumberOfComponents;
+    vtkIdList* TupleIds;
+    bool HasUndef;
+    float Undef;
+  };
+
+  // Cells of the same type, inserted in the order they were read.
+  struct Cells
+  {
+    const char* Data;
+    vtkIdType NumberOfCells;
+    int CellType;
+    int NumberOfNodes;
+    const unsigned char* NodeMap;
+    vtkIdList* CellIds;
+  };
+
+  struct Part
+  {
+    vtkUnstructuredGrid* Grid;
+    std::vector<Cells> Sections;
+  };
+
+  // The values are split in blocks so that large arrays are decoded in parallel too
+  void AddValues(const char* data, vtkIdType count, vtkFloatArray* array, int component,
+    vtkIdList* tupleIds = nullptr, bool hasUndef = false, float undef = 0)
+  {
+    // The pointer is taken before the blocks are decoded at the same time
+    float* output = array->GetPointer(0) + component;
+    const vtkIdType blockSize = 65536;
+    for (vtkIdType start = 0; start < count; start += blockSize)
+    {
+      Values values = { data + sizeof(float) * start, start, std::min(blockSize, count - start),
+        output, array->GetNumberOfComponents(), tupleIds, hasUndef, undef };
+      this->ValuesQueue.push_back(values);
+    }
+  }
+
+  void AddCells(vtkUnstructuredGrid* grid, const Cells& cells)
+  {
+    if (this->PartQueue.empty() || this->PartQueue.back().Grid != grid)
+    {
+      this->PartQueue.push_back(Part{ grid, std::vector<Cells>() });
+    }
+    this->PartQueue.back().Sections.push_back(cells);
+  }
+
+  // Inserts the queued cells of the grid, before other cells are inserted
+  void DecodeCells(vtkUnstructuredGrid* grid, bool swap)
+  {
+    if (!this->PartQueue.empty() && this->PartQueue.back().Grid == grid)
+    {
+      DecodeQueueInternal::Decode(this->PartQueue.back(), swap);
+      this->PartQueue.pop_back();
+    }
+  }
+
+  void Decode(bool swap)
+  {
+    vtkSMPTools::For(0, static_cast<vtkIdType>(this->ValuesQueue.size()), 1,
+      [this, swap](vtkIdType begin, vtkIdType end) {
+        for (vtkIdType i = begin; i < end; ++i)
+        {
+          DecodeQueueInternal::Decode(this->ValuesQueue[i], swap);
+        }
+      });
+    vtkSMPTools::For(0, static_cast<vtkIdType>(this->PartQueue.size()), 1,
+      [this, swap](vtkIdType begin, vtkIdType end) {
+        for (vtkIdType i = begin; i < end; ++i)
+        {
+          DecodeQueueInternal::Decode(this->PartQueue[i], swap);
+        }
+      });
+    this->Clear();
+  }
+
+  void Clear()
+  {
+    this->ValuesQueue.clear();
+    this->PartQueue.clear();
+  }
+
+private:
+  // Straight loops on the raw values, that compilers vectorize
+  template <bool Swap>
+  static void Decode(const char* data, vtkIdType count, vtkTypeUInt32* values)
+  {
+    std::memcpy(values, data, sizeof(vtkTypeUInt32) * count);
+    if (Swap)
+    {
+      for (vtkIdType i = 0; i < count; ++i)
+      {
+        const vtkTypeUInt32 value = values[i];
+        values[i] = (value >> 24) | ((value >> 8) & 0xff00) | ((value << 8) & 0xff0000) |
+          (value << 24);
+      }
+    }
+  }
+
+  static void Decode(const char* data, vtkIdType count, vtkTypeUInt32* values, bool swap)
+  {
+    if (swap)
+    {
+      DecodeQueueInternal::Decode<true>(data, count, values);
+    }
+    else
+    {
+      DecodeQueueInternal::Decode<false>(data, count, values);
+    }
+  }
+
+  static void Decode(const Values& values, bool swap)
+  {
+    std::vector<float> buffer(values.Count);
+    std::vector<vtkTypeUInt32> rawBuffer(values.Count);
+    DecodeQueueInternal::Decode(values.Data, values.Count, rawBuffer.data(), swap);
+    std::memcpy(buffer.data(), rawBuffer.data(), sizeof(float) * values.Count);
+    if (values.HasUndef)
+    {
+      // replace undefined values with "internal undef" which in ParaView is NaN
+      std::replace(buffer.begin(), buffer.end(), values.Undef, std::nanf("1"));
+    }
+
+    const int numComponents = values.NumberOfComponents;
+    float* output = values.Output;
+    if (values.TupleIds)
+    {
+      const vtkIdType* tupleIds = values.TupleIds->GetPointer(values.Start);
+      for (vtkIdType i = 0; i < values.Count; ++i)
+      {
+        output[tupleIds[i] * numComponents] = buffer[i];
+      }
+    }
+    else if (numComponents == 1)
+    {
+      std::copy(buffer.begin(), buffer.end(), output + values.Start);
+    }
+    else
+    {
+      output += values.Start * numComponents;
+      for (vtkIdType i = 0; i < values.Count; ++i)
+      {
+        output[i * numComponents] = buffer[i];
+      }
+    }
+  }
+
+  static void Decode(const Part& part, bool swap)
+  {
+    std::vector<vtkTypeUInt32> buffer;
+    vtkIdType nodeIds[20];
+    for (const Cells& cells : part.Sections)
+    {
+      const int numNodes = cells.NumberOfNodes;
+      buffer.resize(cells.NumberOfCells * numNodes);
+      DecodeQueueInternal::Decode(cells.Data, cells.NumberOfCells * numNodes, buffer.data(), swap);
+      const int* nodeIdList = reinterpret_cast<const int*>(buffer.data());
+      for (vtkIdType i = 0; i < cells.NumberOfCells; ++i, nodeIdList += numNodes)
+      {
+        for (int j = 0; j < numNodes; ++j)
+        {
+          nodeIds[cells.NodeMap ? cells.NodeMap[j] : j] = nodeIdList[j] - 1;
+        }
+        cells.CellIds->InsertNextId(part.Grid->InsertNextCell(cells.CellType, numNodes, nodeIds));
+      }
+    }
+  }
+
+  std::vector<Values> ValuesQueue;
+  std::vector<Part> PartQueue;
+};
+
 class vtkEnSightGoldBinaryReader::vtkUtilities
 {
   static int GetDestinationComponent(int srcComponent, int numComponents)
@@ -186,21 +540,79 @@ public:
 
     return nullptr;
   }
-};
 
-vtkStandardNewMacro(vtkEnSightGoldBinaryReader);
-class vtkEnSightGoldBinaryReader::FileOffsetMapInternal
-{
-  typedef std::string MapKey;
-  typedef std::map<int, vtkTypeInt64> MapValue;
+  // Returns whether the second word of the section header is the qualifier,
+  // like the regular expression of ReadVariableFloats() finds, without
+  // compiling it for each section.
+  static bool HasQualifier(const char* sectionHeader, const char* qualifier)
+  {
+    const char* space = strchr(sectionHeader, ' ');
+    if (!space || space == sectionHeader)
+    {
+      return false;
+    }
+    const size_t length = strlen(qualifier);
+    return strncmp(space + 1, qualifier, length) == 0 &&
+      (space[length + 1] == '\0' || space[length + 1] == ' ');
+  }
 
-public:
-  typedef std::map<MapKey, MapValue>::const_iterator const_iterator;
-  typedef std::map<MapKey, MapValue>::value_type value_type;
+  // Returns the array the values of the variable are read in, like
+  // ReadVariableFloats() does.
+  static vtkSmartPointer<vtkFloatArray> GetVariableArray(const char* description,
+    vtkDataSetAttributes* dsa, vtkIdType numElements, int numComponents, int component = -1)
+  {
+    if (numComponents > 1 && component > 0)
+    {
+      vtkSmartPointer<vtkFloatArray> array =
+        vtkFloatArray::SafeDownCast(dsa->GetArray(description));
+      assert(array && array->GetNumberOfComponents() == numComponents);
+      return array;
+    }
+    auto array = vtk::TakeSmartPointer(vtkFloatArray::New());
+    array->SetNumberOfComponents(numComponents);
+    array->SetNumberOfTuples(numElements);
+    return array;
+  }
 
-  std::map<MapKey, MapValue> Map;
+  // Queues the values of a section of a memory mapped file, which has no
+  // partial values, to be decoded in array. They are the values of the tuples
+  // given by tupleIds if not null. Returns false if there was an error.
+  static bool QueueVariableFloats(const char* sectionHeader, vtkEnSightGoldBinaryReader* self,
+    vtkFloatArray* array, vtkIdList* tupleIds, vtkIdType numElements, int numComponents,
+    int component = -1)
+  {
+    const bool hasUndef = vtkUtilities::HasQualifier(sectionHeader, "undef");
+
+    float undefValue{ 0 };
+    if (hasUndef && !self->ReadFloat(&undefValue))
+    {
+      return false;
+    }
+
+    const int numComponentsRead = (numComponents > 1 && component == -1) ? numComponents : 1;
+    for (int comp = 0; comp < numComponentsRead; ++comp)
+    {
+      int destComponent = 0;
+      if (numComponents > 1)
+      {
+        destComponent = component != -1
+          ? component
+          : vtkUtilities::GetDestinationComponent(comp, numComponents);
+      }
+      const char* data = self->SkipMappedArray(numElements);
+      if (!data)
+      {
+        return false;
+      }
+      self->DecodeQueue->AddValues(
+        data, numElements, array, destComponent, tupleIds, hasUndef, undefValue);
+    }
+    return true;
+  }
 };
 
+vtkStandardNewMacro(vtkEnSightGoldBinaryReader);
+
 // This is half the precision of an int.
 #define MAXIMUM_PART_ID 65536
 
@@ -208,9 +620,13 @@ public:
 vtkEnSightGoldBinaryReader::vtkEnSightGoldBinaryReader()
 {
   this->FileOffsets = new vtkEnSightGoldBinaryReader::FileOffsetMapInternal;
+  this->UseMemoryMapping = true;
+  this->FileMapping = new vtkEnSightGoldBinaryReader::FileMappingInternal;
+  this->DecodeQueue = new vtkEnSightGoldBinaryReader::DecodeQueueInternal;
 
   this->GoldIFile = nullptr;
   this->FileSize = 0;
+  this->FileModifiedTime = 0;
   this->SizeOfInt = sizeof(int);
   this->Fortran = 0;
   this->FortranSkipBytes = 0;
@@ -224,6 +640,8 @@ vtkEnSightGoldBinaryReader::~vtkEnSightGoldBinaryReader()
   delete this->FileOffsets;
   delete this->GoldIFile;
   this->GoldIFile = nullptr;
+  delete this->DecodeQueue;
+  delete this->FileMapping;
 }
 
 //------------------------------------------------------------------------------
@@ -238,6 +656,10 @@ int vtkEnSightGoldBinaryReader::OpenFile(const char* filename)
   delete this->GoldIFile;
   this->GoldIFile = nullptr;
 
+  // The arrays not decoded yet are lost with the mapping of the previous file
+  this->DecodeQueue->Clear();
+  this->FileMapping->Unmap();
+
   // Open the new file
   vtkDebugMacro(<< "Opening file " << filename);
   VTK_STAT_STRUCT fs;
@@ -245,12 +667,20 @@ int vtkEnSightGoldBinaryReader::OpenFile(const char* filename)
   {
     // Find out how big the file is.
     this->FileSize = static_cast<vtkTypeUInt64>(fs.st_size);
+    this->FileModifiedTime = static_cast<vtkTypeInt64>(fs.st_mtime);
 
-    std::ios_base::openmode mode = ios::in;
+    if (this->UseMemoryMapping && this->FileMapping->Map(filename, this->FileSize))
+    {
+      this->GoldIFile = new std::istream(this->FileMapping);
+    }
+    else
+    {
+      std::ios_base::openmode mode = ios::in;
 #ifdef _WIN32
-    mode |= ios::binary;
+      mode |= ios::binary;
 #endif
-    this->GoldIFile = new vtksys::ifstream(filename, mode);
+      this->GoldIFile = new vtksys::ifstream(filename, mode);
+    }
   }
   else
   {
@@ -399,16 +829,23 @@ int vtkEnSightGoldBinaryReader::ReadGeometryFile(
     return 0;
   }
 
-  // this will close the file, so we need to reinitialize it
-  int numberOfTimeStepsInFile = this->CountTimeSteps();
-
-  if (!this->InitializeFile(fileName))
-  {
-    return 0;
-  }
-
   if (this->UseFileSets)
   {
+    // The time steps are counted once, and kept with the index of the file
+    // while the geometry does not change.
+    this->FileOffsets->Validate(fileName, this->FileSize, this->FileModifiedTime);
+    auto numberOfTimeStepsIterator = this->FileOffsets->NumberOfTimeSteps.find(fileName);
+    if (numberOfTimeStepsIterator == this->FileOffsets->NumberOfTimeSteps.end())
+    {
+      // this will close the file, so we need to reinitialize it
+      this->FileOffsets->NumberOfTimeSteps[fileName] = this->CountTimeSteps();
+      if (!this->InitializeFile(fileName))
+      {
+        return 0;
+      }
+    }
+    int numberOfTimeStepsInFile = this->FileOffsets->NumberOfTimeSteps[fileName];
+
     if (numberOfTimeStepsInFile > 1)
     {
       this->AddFileIndexToCache(fileName);
@@ -538,16 +975,15 @@ int vtkEnSightGoldBinaryReader::ReadGeometryFile(
       if (lineRead < 0)
       {
         free(name);
-        delete this->GoldIFile;
-        this->GoldIFile = nullptr;
+        this->CloseFile();
         return 0;
       }
     }
     free(name);
   }
 
-  delete this->GoldIFile;
-  this->GoldIFile = nullptr;
+  this->DecodeQueuedArrays();
+  this->CloseFile();
 
   if (lineRead < 0)
   {
@@ -676,8 +1112,7 @@ int vtkEnSightGoldBinaryReader::SkipTimeStep()
 
   if (lineRead < 0)
   {
-    delete this->GoldIFile;
-    this->GoldIFile = nullptr;
+    this->CloseFile();
     return 0;
   }
 
@@ -1376,8 +1811,7 @@ int vtkEnSightGoldBinaryReader::ReadMeasuredGeometryFile(
   delete[] yCoords;
   delete[] zCoords;
 
-  delete this->GoldIFile;
-  this->GoldIFile = nullptr;
+  this->CloseFile();
 
   return 1;
 }
@@ -1428,6 +1862,7 @@ bool vtkEnSightGoldBinaryReader::SkipToTimeStep(const char* fileName, int timeSt
 
   char line[80];
 
+  this->FileOffsets->Validate(fileName, this->FileSize, this->FileModifiedTime);
   this->AddFileIndexToCache(fileName);
 
   int i = this->SeekToCachedTimeStep(fileName, timeStep - 1);
@@ -1499,8 +1934,7 @@ bool vtkEnSightGoldBinaryReader::SkipToTimeStep(const char* fileName, int timeSt
             if (elementType == -1)
             {
               vtkErrorMacro("Unknown element type \"" << line << "\"");
-              delete this->GoldIFile;
-              this->GoldIFile = nullptr;
+              this->CloseFile();
               return false;
             }
             const auto idx = this->UnstructuredPartIds->IsId(realId);
@@ -1616,9 +2050,23 @@ bool vtkEnSightGoldBinaryReader::ReadVariableArray(const char* description,
     // type]" in which case the data is read in chunks rather than a whole.
     if (attributeType != vtkDataObject::CELL || strncmp(line, "block", 5) == 0)
     {
-      // read full data.
-      array = vtkUtilities::ReadVariableFloats(
-        line, this, description, dsa, numElements, numComponents, component);
+      if (this->FileMapping->IsMapped() && !vtkUtilities::HasQualifier(line, "partial"))
+      {
+        // the values are decoded with the other arrays of the file.
+        array = vtkUtilities::GetVariableArray(
+          description, dsa, numElements, numComponents, component);
+        if (!vtkUtilities::QueueVariableFloats(
+              line, this, array, nullptr, numElements, numComponents, component))
+        {
+          return false;
+        }
+      }
+      else
+      {
+        // read full data.
+        array = vtkUtilities::ReadVariableFloats(
+          line, this, description, dsa, numElements, numComponents, component);
+      }
 
       lineRead = advance();
     }
@@ -1653,12 +2101,25 @@ bool vtkEnSightGoldBinaryReader::ReadVariableArray(const char* description,
         auto idx = this->UnstructuredPartIds->IsId(realId);
         auto dstIds = this->GetCellIds(idx, elementType);
         const auto numCellsPerElementType = dstIds->GetNumberOfIds();
-        auto subarray = vtkUtilities::ReadVariableFloats(
-          line, this, description, dsa, numCellsPerElementType, numComponents, component);
+        if (this->FileMapping->IsMapped() && !vtkUtilities::HasQualifier(line, "partial") &&
+          (numComponents == 1 || component == -1))
+        {
+          // the values are decoded with the other arrays of the file.
+          if (!vtkUtilities::QueueVariableFloats(
+                line, this, array, dstIds, numCellsPerElementType, numComponents, component))
+          {
+            return false;
+          }
+        }
+        else
+        {
+          auto subarray = vtkUtilities::ReadVariableFloats(
+            line, this, description, dsa, numCellsPerElementType, numComponents, component);
 
-        srcIds->SetNumberOfIds(numCellsPerElementType);
-        std::iota(srcIds->begin(), srcIds->end(), 0);
-        array->InsertTuples(dstIds, srcIds, subarray);
+          srcIds->SetNumberOfIds(numCellsPerElementType);
+          std::iota(srcIds->begin(), srcIds->end(), 0);
+          array->InsertTuples(dstIds, srcIds, subarray);
+        }
 
         lineRead = advance();
       }
@@ -1679,6 +2140,7 @@ bool vtkEnSightGoldBinaryReader::ReadVariableArray(const char* description,
     }
   }
 
+  this->DecodeQueuedArrays();
   return true;
 }
 
@@ -1699,16 +2161,14 @@ int vtkEnSightGoldBinaryReader::ReadScalarsPerNode(const char* fileName, const c
   if (measured)
   {
     this->ReadMeasureVariableArray(description, compositeOutput, 1);
-    delete this->GoldIFile;
-    this->GoldIFile = nullptr;
+    this->CloseFile();
     return 1;
   }
 
   this->ReadVariableArray(
     description, compositeOutput, vtkDataObject::POINT, numberOfComponents, component);
 
-  delete this->GoldIFile;
-  this->GoldIFile = nullptr;
+  this->CloseFile();
   return 1;
 }
 
@@ -1728,8 +2188,7 @@ int vtkEnSightGoldBinaryReader::ReadAsymmetricTensorsPerNode(const char* fileNam
 
   this->ReadVariableArray(description, compositeOutput, vtkDataObject::POINT, /*numComponents=*/9);
 
-  delete this->GoldIFile;
-  this->GoldIFile = nullptr;
+  this->CloseFile();
 
   return 1;
 }
@@ -1751,15 +2210,13 @@ int vtkEnSightGoldBinaryReader::ReadVectorsPerNode(const char* fileName, const c
   if (measured)
   {
     this->ReadMeasureVariableArray(description, compositeOutput, 3);
-    delete this->GoldIFile;
-    this->GoldIFile = nullptr;
+    this->CloseFile();
     return 1;
   }
 
   this->ReadVariableArray(description, compositeOutput, vtkDataObject::POINT, 3);
 
-  delete this->GoldIFile;
-  this->GoldIFile = nullptr;
+  this->CloseFile();
 
   return 1;
 }
@@ -1780,8 +2237,7 @@ int vtkEnSightGoldBinaryReader::ReadTensorsPerNode(const char* fileName, const c
 
   this->ReadVariableArray(description, compositeOutput, vtkDataObject::POINT, 6);
 
-  delete this->GoldIFile;
-  this->GoldIFile = nullptr;
+  this->CloseFile();
 
   return 1;
 }
@@ -1802,8 +2258,7 @@ int vtkEnSightGoldBinaryReader::ReadScalarsPerElement(const char* fileName, cons
   this->ReadVariableArray(
     description, compositeOutput, vtkDataObject::CELL, numberOfComponents, component);
 
-  delete this->GoldIFile;
-  this->GoldIFile = nullptr;
+  this->CloseFile();
   return 1;
 }
 
@@ -1822,8 +2277,7 @@ int vtkEnSightGoldBinaryReader::ReadVectorsPerElement(const char* fileName, cons
 
   this->ReadVariableArray(description, compositeOutput, vtkDataObject::CELL, 3);
 
-  delete this->GoldIFile;
-  this->GoldIFile = nullptr;
+  this->CloseFile();
   return 1;
 }
 
@@ -1842,8 +2296,7 @@ int vtkEnSightGoldBinaryReader::ReadAsymmetricTensorsPerElement(const char* file
 
   this->ReadVariableArray(description, compositeOutput, vtkDataObject::CELL, 9);
 
-  delete this->GoldIFile;
-  this->GoldIFile = nullptr;
+  this->CloseFile();
 
   return 1;
 }
@@ -1863,8 +2316,7 @@ int vtkEnSightGoldBinaryReader::ReadTensorsPerElement(const char* fileName, cons
 
   this->ReadVariableArray(description, compositeOutput, vtkDataObject::CELL, 6);
 
-  delete this->GoldIFile;
-  this->GoldIFile = nullptr;
+  this->CloseFile();
 
   return 1;
 }
@@ -1924,30 +2376,50 @@ int vtkEnSightGoldBinaryReader::CreateUnstructuredGridOutput(
       vtkPoints* points = vtkPoints::New();
       vtkDebugMacro("num. points: " << numPts);
 
-      points->Allocate(numPts);
-
       if (this->NodeIdsListed)
       {
         this->GoldIFile->seekg(sizeof(int) * numPts + this->FortranSkipBytes, ios::cur);
       }
 
-      xCoords = new float[numPts];
-      yCoords = new float[numPts];
-      zCoords = new float[numPts];
-      this->ReadFloatArray(xCoords, numPts);
-      this->ReadFloatArray(yCoords, numPts);
-      this->ReadFloatArray(zCoords, numPts);
-
-      for (i = 0; i < numPts; i++)
+      if (this->FileMapping->IsMapped())
+      {
+        // The coordinates are decoded with the other arrays of the file
+        points->SetNumberOfPoints(numPts);
+        vtkFloatArray* coordinates = vtkArrayDownCast<vtkFloatArray>(points->GetData());
+        for (i = 0; i < 3; i++)
+        {
+          const char* data = this->SkipMappedArray(numPts);
+          if (!data)
+          {
+            points->Delete();
+            return -1;
+          }
+          this->DecodeQueue->AddValues(data, numPts, coordinates, i);
+        }
+      }
+      else
       {
-        points->InsertNextPoint(xCoords[i], yCoords[i], zCoords[i]);
+        points->Allocate(numPts);
+
+        xCoords = new float[numPts];
+        yCoords = new float[numPts];
+        zCoords = new float[numPts];
+        this->ReadFloatArray(xCoords, numPts);
+        this->ReadFloatArray(yCoords, numPts);
+        this->ReadFloatArray(zCoords, numPts);
+
+        for (i = 0; i < numPts; i++)
+        {
+          points->InsertNextPoint(xCoords[i], yCoords[i], zCoords[i]);
+        }
+
+        delete[] xCoords;
+        delete[] yCoords;
+        delete[] zCoords;
       }
 
       output->SetPoints(points);
       points->Delete();
-      delete[] xCoords;
-      delete[] yCoords;
-      delete[] zCoords;
     }
     else if (strncmp(line, "point", 5) == 0)
     {
@@ -1966,18 +2438,11 @@ int vtkEnSightGoldBinaryReader::CreateUnstructuredGridOutput(
         this->GoldIFile->seekg(sizeof(int) * numElements + this->FortranSkipBytes, ios::cur);
       }
 
-      nodeIdList = new int[numElements];
-      this->ReadIntArray(nodeIdList, numElements);
-
-      vtkIdType nodeIds;
-      for (i = 0; i < numElements; i++)
+      if (!this->ReadCells(
+            output, this->GetCellIds(idx, vtkEnSightReader::POINT), numElements, VTK_VERTEX, 1))
       {
-        nodeIds = nodeIdList[i] - 1;
-        cellId = output->InsertNextCell(VTK_VERTEX, 1, &nodeIds);
-        this->GetCellIds(idx, vtkEnSightReader::POINT)->InsertNextId(cellId);
+        return -1;
       }
-
-      delete[] nodeIdList;
     }
     else if (strncmp(line, "g_point", 7) == 0)
     {
@@ -2015,21 +2480,11 @@ int vtkEnSightGoldBinaryReader::CreateUnstructuredGridOutput(
         this->GoldIFile->seekg(sizeof(int) * numElements + this->FortranSkipBytes, ios::cur);
       }
 
-      nodeIdList = new int[numElements * 2];
-      this->ReadIntArray(nodeIdList, numElements * 2);
-
-      vtkIdType nodeIds[2];
-      for (i = 0; i < numElements; i++)
+      if (!this->ReadCells(
+            output, this->GetCellIds(idx, vtkEnSightReader::BAR2), numElements, VTK_LINE, 2))
       {
-        for (j = 0; j < 2; j++)
-        {
-          nodeIds[j] = nodeIdList[2 * i + j] - 1;
-        }
-        cellId = output->InsertNextCell(VTK_LINE, 2, nodeIds);
-        this->GetCellIds(idx, vtkEnSightReader::BAR2)->InsertNextId(cellId);
+        return -1;
       }
-
-      delete[] nodeIdList;
     }
     else if (strncmp(line, "g_bar2", 6) == 0)
     {
@@ -2068,21 +2523,12 @@ int vtkEnSightGoldBinaryReader::CreateUnstructuredGridOutput(
         this->GoldIFile->seekg(sizeof(int) * numElements + this->FortranSkipBytes, ios::cur);
       }
 
-      nodeIdList = new int[numElements * 3];
-      this->ReadIntArray(nodeIdList, numElements * 3);
-
-      vtkIdType nodeIds[3];
-      for (i = 0; i < numElements; i++)
+      static const unsigned char bar3Map[3] = { 0, 2, 1 };
+      if (!this->ReadCells(output, this->GetCellIds(idx, vtkEnSightReader::BAR3), numElements,
+            VTK_QUADRATIC_EDGE, 3, bar3Map))
       {
-        nodeIds[0] = nodeIdList[3 * i] - 1;
-        nodeIds[1] = nodeIdList[3 * i + 2] - 1;
-        nodeIds[2] = nodeIdList[3 * i + 1] - 1;
-
-        cellId = output->InsertNextCell(VTK_QUADRATIC_EDGE, 3, nodeIds);
-        this->GetCellIds(idx, vtkEnSightReader::BAR3)->InsertNextId(cellId);
+        return -1;
       }
-
-      delete[] nodeIdList;
     }
     else if (strncmp(line, "g_bar3", 6) == 0)
     {
@@ -2112,6 +2558,9 @@ int vtkEnSightGoldBinaryReader::CreateUnstructuredGridOutput(
       int numNodes = 0;
       int nodeCount = 0;
 
+      // The cells read before are inserted first
+      this->DecodeQueue->DecodeCells(output, ::NeedsSwap(this->ByteOrder));
+
       cellType = vtkEnSightReader::NSIDED;
       this->ReadInt(&numElements);
       if (numElements < 0 ||
@@ -2209,40 +2658,12 @@ int vtkEnSightGoldBinaryReader::CreateUnstructuredGridOutput(
         this->GoldIFile->seekg(sizeof(int) * numElements + this->FortranSkipBytes, ios::cur);
       }
 
-      if (cellType == vtkEnSightReader::TRIA6)
-      {
-        nodeIdList = new int[numElements * 6];
-        this->ReadIntArray(nodeIdList, numElements * 6);
-      }
-      else
-      {
-        nodeIdList = new int[numElements * 3];
-        this->ReadIntArray(nodeIdList, numElements * 3);
-      }
-
-      vtkIdType nodeIds[6];
-      for (i = 0; i < numElements; i++)
+      const bool quadratic = cellType == vtkEnSightReader::TRIA6;
+      if (!this->ReadCells(output, this->GetCellIds(idx, cellType), numElements,
+            quadratic ? VTK_QUADRATIC_TRIANGLE : VTK_TRIANGLE, quadratic ? 6 : 3))
       {
-        if (cellType == vtkEnSightReader::TRIA6)
-        {
-          for (j = 0; j < 6; j++)
-          {
-            nodeIds[j] = nodeIdList[6 * i + j] - 1;
-          }
-          cellId = output->InsertNextCell(VTK_QUADRATIC_TRIANGLE, 6, nodeIds);
-        }
-        else
-        {
-          for (j = 0; j < 3; j++)
-          {
-            nodeIds[j] = nodeIdList[3 * i + j] - 1;
-          }
-          cellId = output->InsertNextCell(VTK_TRIANGLE, 3, nodeIds);
-        }
-        this->GetCellIds(idx, cellType)->InsertNextId(cellId);
+        return -1;
       }
-
-      delete[] nodeIdList;
     }
     else if (strncmp(line, "g_tria3", 7) == 0 || strncmp(line, "g_tria6", 7) == 0)
     {
@@ -2307,40 +2728,12 @@ int vtkEnSightGoldBinaryReader::CreateUnstructuredGridOutput(
         this->GoldIFile->seekg(sizeof(int) * numElements + this->FortranSkipBytes, ios::cur);
       }
 
-      if (cellType == vtkEnSightReader::QUAD8)
-      {
-        nodeIdList = new int[numElements * 8];
-        this->ReadIntArray(nodeIdList, numElements * 8);
-      }
-      else
-      {
-        nodeIdList = new int[numElements * 4];
-        this->ReadIntArray(nodeIdList, numElements * 4);
-      }
-
-      vtkIdType nodeIds[8];
-      for (i = 0; i < numElements; i++)
+      const bool quadratic = cellType == vtkEnSightReader::QUAD8;
+      if (!this->ReadCells(output, this->GetCellIds(idx, cellType), numElements,
+            quadratic ? VTK_QUADRATIC_QUAD : VTK_QUAD, quadratic ? 8 : 4))
       {
-        if (cellType == vtkEnSightReader::QUAD8)
-        {
-          for (j = 0; j < 8; j++)
-          {
-            nodeIds[j] = nodeIdList[8 * i + j] - 1;
-          }
-          cellId = output->InsertNextCell(VTK_QUADRATIC_QUAD, 8, nodeIds);
-        }
-        else
-        {
-          for (j = 0; j < 4; j++)
-          {
-            nodeIds[j] = nodeIdList[4 * i + j] - 1;
-          }
-          cellId = output->InsertNextCell(VTK_QUAD, 4, nodeIds);
-        }
-        this->GetCellIds(idx, cellType)->InsertNextId(cellId);
+        return -1;
       }
-
-      delete[] nodeIdList;
     }
     else if (strncmp(line, "g_quad4", 7) == 0 || strncmp(line, "g_quad8", 7) == 0)
     {
@@ -2394,6 +2787,9 @@ int vtkEnSightGoldBinaryReader::CreateUnstructuredGridOutput(
       int nodeCount = 0;
       int elementNodeCount = 0;
 
+      // The cells read before are inserted first
+      this->DecodeQueue->DecodeCells(output, ::NeedsSwap(this->ByteOrder));
+
       cellType = vtkEnSightReader::NFACED;
       this->ReadInt(&numElements);
       if (numElements < 0 ||
@@ -2552,40 +2948,12 @@ int vtkEnSightGoldBinaryReader::CreateUnstructuredGridOutput(
         this->GoldIFile->seekg(sizeof(int) * numElements + this->FortranSkipBytes, ios::cur);
       }
 
-      if (cellType == vtkEnSightReader::TETRA10)
-      {
-        nodeIdList = new int[numElements * 10];
-        this->ReadIntArray(nodeIdList, numElements * 10);
-      }
-      else
-      {
-        nodeIdList = new int[numElements * 4];
-        this->ReadIntArray(nodeIdList, numElements * 4);
-      }
-
-      vtkIdType nodeIds[10];
-      for (i = 0; i < numElements; i++)
+      const bool quadratic = cellType == vtkEnSightReader::TETRA10;
+      if (!this->ReadCells(output, this->GetCellIds(idx, cellType), numElements,
+            quadratic ? VTK_QUADRATIC_TETRA : VTK_TETRA, quadratic ? 10 : 4))
       {
-        if (cellType == vtkEnSightReader::TETRA10)
-        {
-          for (j = 0; j < 10; j++)
-          {
-            nodeIds[j] = nodeIdList[10 * i + j] - 1;
-          }
-          cellId = output->InsertNextCell(VTK_QUADRATIC_TETRA, 10, nodeIds);
-        }
-        else
-        {
-          for (j = 0; j < 4; j++)
-          {
-            nodeIds[j] = nodeIdList[4 * i + j] - 1;
-          }
-          cellId = output->InsertNextCell(VTK_TETRA, 4, nodeIds);
-        }
-        this->GetCellIds(idx, cellType)->InsertNextId(cellId);
+        return -1;
       }
-
-      delete[] nodeIdList;
     }
     else if (strncmp(line, "g_tetra4", 8) == 0 || strncmp(line, "g_tetra10", 9) == 0)
     {
@@ -2651,40 +3019,12 @@ int vtkEnSightGoldBinaryReader::CreateUnstructuredGridOutput(
         this->GoldIFile->seekg(sizeof(int) * numElements + this->FortranSkipBytes, ios::cur);
       }
 
-      if (cellType == vtkEnSightReader::PYRAMID13)
-      {
-        nodeIdList = new int[numElements * 13];
-        this->ReadIntArray(nodeIdList, numElements * 13);
-      }
-      else
-      {
-        nodeIdList = new int[numElements * 5];
-        this->ReadIntArray(nodeIdList, numElements * 5);
-      }
-
-      vtkIdType nodeIds[13];
-      for (i = 0; i < numElements; i++)
+      const bool quadratic = cellType == vtkEnSightReader::PYRAMID13;
+      if (!this->ReadCells(output, this->GetCellIds(idx, cellType), numElements,
+            quadratic ? VTK_QUADRATIC_PYRAMID : VTK_PYRAMID, quadratic ? 13 : 5))
       {
-        if (cellType == vtkEnSightReader::PYRAMID13)
-        {
-          for (j = 0; j < 13; j++)
-          {
-            nodeIds[j] = nodeIdList[13 * i + j] - 1;
-          }
-          cellId = output->InsertNextCell(VTK_QUADRATIC_PYRAMID, 13, nodeIds);
-        }
-        else
-        {
-          for (j = 0; j < 5; j++)
-          {
-            nodeIds[j] = nodeIdList[5 * i + j] - 1;
-          }
-          cellId = output->InsertNextCell(VTK_PYRAMID, 5, nodeIds);
-        }
-        this->GetCellIds(idx, cellType)->InsertNextId(cellId);
+        return -1;
       }
-
-      delete[] nodeIdList;
     }
     else if (strncmp(line, "g_pyramid5", 10) == 0 || strncmp(line, "g_pyramid13", 11) == 0)
     {
@@ -2749,40 +3089,12 @@ int vtkEnSightGoldBinaryReader::CreateUnstructuredGridOutput(
         this->GoldIFile->seekg(sizeof(int) * numElements + this->FortranSkipBytes, ios::cur);
       }
 
-      if (cellType == vtkEnSightReader::HEXA20)
-      {
-        nodeIdList = new int[numElements * 20];
-        this->ReadIntArray(nodeIdList, numElements * 20);
-      }
-      else
-      {
-        nodeIdList = new int[numElements * 8];
-        this->ReadIntArray(nodeIdList, numElements * 8);
-      }
-
-      vtkIdType nodeIds[20];
-      for (i = 0; i < numElements; i++)
+      const bool quadratic = cellType == vtkEnSightReader::HEXA20;
+      if (!this->ReadCells(output, this->GetCellIds(idx, cellType), numElements,
+            quadratic ? VTK_QUADRATIC_HEXAHEDRON : VTK_HEXAHEDRON, quadratic ? 20 : 8))
       {
-        if (cellType == vtkEnSightReader::HEXA20)
-        {
-          for (j = 0; j < 20; j++)
-          {
-            nodeIds[j] = nodeIdList[20 * i + j] - 1;
-          }
-          cellId = output->InsertNextCell(VTK_QUADRATIC_HEXAHEDRON, 20, nodeIds);
-        }
-        else
-        {
-          for (j = 0; j < 8; j++)
-          {
-            nodeIds[j] = nodeIdList[8 * i + j] - 1;
-          }
-          cellId = output->InsertNextCell(VTK_HEXAHEDRON, 8, nodeIds);
-        }
-        this->GetCellIds(idx, cellType)->InsertNextId(cellId);
+        return -1;
       }
-
-      delete[] nodeIdList;
     }
     else if (strncmp(line, "g_hexa8", 7) == 0 || strncmp(line, "g_hexa20", 8) == 0)
     {
@@ -2847,43 +3159,17 @@ int vtkEnSightGoldBinaryReader::CreateUnstructuredGridOutput(
         this->GoldIFile->seekg(sizeof(int) * numElements + this->FortranSkipBytes, ios::cur);
       }
 
-      if (cellType == vtkEnSightReader::PENTA15)
-      {
-        nodeIdList = new int[numElements * 15];
-        this->ReadIntArray(nodeIdList, numElements * 15);
-      }
-      else
-      {
-        nodeIdList = new int[numElements * 6];
-        this->ReadIntArray(nodeIdList, numElements * 6);
-      }
-
-      const unsigned char penta6Map[6] = { 0, 2, 1, 3, 5, 4 };
-      const unsigned char penta15Map[15] = { 0, 2, 1, 3, 5, 4, 8, 7, 6, 11, 10, 9, 12, 14, 13 };
+      static const unsigned char penta6Map[6] = { 0, 2, 1, 3, 5, 4 };
+      static const unsigned char penta15Map[15] = { 0, 2, 1, 3, 5, 4, 8, 7, 6, 11, 10, 9, 12, 14,
+        13 };
 
-      vtkIdType nodeIds[15];
-      for (i = 0; i < numElements; i++)
+      const bool quadratic = cellType == vtkEnSightReader::PENTA15;
+      if (!this->ReadCells(output, this->GetCellIds(idx, cellType), numElements,
+            quadratic ? VTK_QUADRATIC_WEDGE : VTK_WEDGE, quadratic ? 15 : 6,
+            quadratic ? penta15Map : penta6Map))
       {
-        if (cellType == vtkEnSightReader::PENTA15)
-        {
-          for (j = 0; j < 15; j++)
-          {
-            nodeIds[penta15Map[j]] = nodeIdList[15 * i + j] - 1;
-          }
-          cellId = output->InsertNextCell(VTK_QUADRATIC_WEDGE, 15, nodeIds);
-        }
-        else
-        {
-          for (j = 0; j < 6; j++)
-          {
-            nodeIds[penta6Map[j]] = nodeIdList[6 * i + j] - 1;
-          }
-          cellId = output->InsertNextCell(VTK_WEDGE, 6, nodeIds);
-        }
-        this->GetCellIds(idx, cellType)->InsertNextId(cellId);
+        return -1;
       }
-
-      delete[] nodeIdList;
     }
     else if (strncmp(line, "g_penta6", 8) == 0 || strncmp(line, "g_penta15", 9) == 0)
     {
@@ -3529,10 +3815,87 @@ int vtkEnSightGoldBinaryReader::ReadFloatArray(float* result, int numFloats)
   return 1;
 }
 
+// Internal function to read cells of the same type.
+// Returns zero if there was an error.
+int vtkEnSightGoldBinaryReader::ReadCells(vtkUnstructuredGrid* output, vtkIdList* cellIds,
+  int numElements, int cellType, int numNodes, const unsigned char* nodeMap)
+{
+  if (this->FileMapping->IsMapped())
+  {
+    const char* data = this->SkipMappedArray(static_cast<vtkIdType>(numElements) * numNodes);
+    if (!data)
+    {
+      return 0;
+    }
+    this->DecodeQueue->AddCells(
+      output, { data, numElements, cellType, numNodes, nodeMap, cellIds });
+    return 1;
+  }
+
+  std::vector<int> nodeIdList(static_cast<size_t>(numElements) * numNodes);
+  if (!this->ReadIntArray(nodeIdList.data(), numElements * numNodes))
+  {
+    return 0;
+  }
+
+  vtkIdType nodeIds[20];
+  for (int i = 0; i < numElements; i++)
+  {
+    for (int j = 0; j < numNodes; j++)
+    {
+      nodeIds[nodeMap ? nodeMap[j] : j] = nodeIdList[numNodes * i + j] - 1;
+    }
+    cellIds->InsertNextId(output->InsertNextCell(cellType, numNodes, nodeIds));
+  }
+  return 1;
+}
+
+// Internal function to skip an array of the memory mapped file.
+// Returns nullptr if there was an error.
+const char* vtkEnSightGoldBinaryReader::SkipMappedArray(vtkIdType numValues)
+{
+  const std::streamoff position = this->GoldIFile->tellg();
+  if (numValues <= 0 && position >= 0)
+  {
+    // Like ReadFloatArray(), there is nothing to read
+    return this->FileMapping->GetData() + position;
+  }
+
+  const vtkTypeUInt64 start = position + this->FortranSkipBytes / 2;
+  const vtkTypeUInt64 end = start + sizeof(float) * numValues + this->FortranSkipBytes / 2;
+  if (position < 0 || end > this->FileMapping->GetSize())
+  {
+    vtkErrorMacro("Read failed");
+    this->GoldIFile->setstate(ios::failbit);
+    return nullptr;
+  }
+  this->GoldIFile->seekg(end, ios::beg);
+  return this->FileMapping->GetData() + start;
+}
+
+//------------------------------------------------------------------------------
+void vtkEnSightGoldBinaryReader::CloseFile()
+{
+  delete this->GoldIFile;
+  this->GoldIFile = nullptr;
+
+  // The mapping is released as soon as the file is read, so that it does
+  // not keep the file locked. The arrays not decoded yet are lost with it.
+  this->DecodeQueue->Clear();
+  this->FileMapping->Unmap();
+}
+
+//------------------------------------------------------------------------------
+void vtkEnSightGoldBinaryReader::DecodeQueuedArrays()
+{
+  this->DecodeQueue->Decode(::NeedsSwap(this->ByteOrder));
+}
+
 //------------------------------------------------------------------------------
 void vtkEnSightGoldBinaryReader::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "UseMemoryMapping: " << this->UseMemoryMapping << endl;
 }
 
 // Seeks the IFile to the cached timestep nearest the target timestep.
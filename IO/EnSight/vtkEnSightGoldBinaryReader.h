@@ -33,6 +33,11 @@
  * what types they will be.
  * This reader can only handle static EnSight datasets (both static geometry
  * and variables).
+ * @par Performance:
+ * Files are memory mapped when possible. The coordinates and connectivity of
+ * the unstructured parts and the values of the variables are then located
+ * while the file is read, and decoded in parallel once all its parts were
+ * read.
  * @par Thanks:
  * Thanks to Yvan Fournier for providing the code to support nfaced elements.
  */
@@ -44,6 +49,7 @@
 #include "vtkIOEnSightModule.h" // For export macro
 
 class vtkMultiBlockDataSet;
+class vtkUnstructuredGrid;
 
 class VTKIOENSIGHT_EXPORT vtkEnSightGoldBinaryReader : public vtkEnSightReader
 {
@@ -52,6 +58,19 @@ public:
   vtkTypeMacro(vtkEnSightGoldBinaryReader, vtkEnSightReader);
   void PrintSelf(ostream& os, vtkIndent indent) override;
 
+  ///@{
+  /**
+   * Set/Get whether the files are memory mapped, so that the arrays of their
+   * parts are decoded in parallel. Files that cannot be mapped are read as
+   * streams. Turning it off may be needed for files that can be truncated
+   * while they are read, for instance on some network file systems.
+   * Default is on.
+   */
+  vtkSetMacro(UseMemoryMapping, bool);
+  vtkGetMacro(UseMemoryMapping, bool);
+  vtkBooleanMacro(UseMemoryMapping, bool);
+  ///@}
+
 protected:
   vtkEnSightGoldBinaryReader();
   ~vtkEnSightGoldBinaryReader() override;
@@ -59,6 +78,9 @@ protected:
   // Returns 1 if successful.  Sets file size as a side action.
   int OpenFile(const char* filename);
 
+  // Closes the file opened by OpenFile() and releases its memory mapping.
+  void CloseFile();
+
   // Returns 1 if successful.  Handles constructing the filename, opening the file and checking
   // if it's binary
   int InitializeFile(const char* filename);
@@ -202,6 +224,27 @@ protected:
    */
   int ReadFloatArray(float* result, int numFloats);
 
+  /**
+   * Internal function to read in numElements cells of numNodes nodes, with
+   * nodeMap giving the VTK index of each EnSight node when not null. The
+   * cells of a memory mapped file are inserted by DecodeQueuedArrays().
+   * Returns zero if there was an error.
+   */
+  int ReadCells(vtkUnstructuredGrid* output, vtkIdList* cellIds, int numElements, int cellType,
+    int numNodes, const unsigned char* nodeMap = nullptr);
+
+  /**
+   * Skips the next array of numValues 4 bytes values of the memory mapped
+   * file, and returns its address. Returns nullptr if there was an error.
+   */
+  const char* SkipMappedArray(vtkIdType numValues);
+
+  /**
+   * Decodes in parallel the arrays found in the memory mapped file since it
+   * was opened.
+   */
+  void DecodeQueuedArrays();
+
   /**
    * Counts the number of timesteps in the geometry file
    * This function assumes the file is already open and returns the
@@ -244,10 +287,20 @@ protected:
   istream* GoldIFile;
   // The size of the file could be used to choose byte order.
   vtkTypeUInt64 FileSize;
+  // The modification time of the file tells when its time steps must be indexed again.
+  vtkTypeInt64 FileModifiedTime;
 
   class FileOffsetMapInternal;
   FileOffsetMapInternal* FileOffsets;
 
+  bool UseMemoryMapping;
+
+  class FileMappingInternal;
+  FileMappingInternal* FileMapping;
+
+  class DecodeQueueInternal;
+  DecodeQueueInternal* DecodeQueue;
+
 private:
   int SizeOfInt;
   vtkEnSightGoldBinaryReader(const vtkEnSightGoldBinaryReader&) = delete;
@@ -0,0 +1,268 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestExodusSharedCache.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check the result variables read concurrently by vtkExodusIIReader, and that
+// readers of the same file using the shared cache read them once.
+
+#include "vtkCellData.h"
+#include "vtkDataArray.h"
+#include "vtkDoubleArray.h"
+#include "vtkExodusIIReader.h"
+#include "vtkExodusIIWriter.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkTestUtilities.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+namespace
+{
+const int Resolution = 20;
+
+//----------------------------------------------------------------------------
+double CellValue(const double center[3])
+{
+  return center[0] + 10 * center[1] + 100 * center[2];
+}
+
+//----------------------------------------------------------------------------
+// A grid of hexahedra with scalar and vector, point and cell arrays. A
+// nonzero offset is added to the scalars and adds a point array.
+void WriteGrid(const std::string& fileName, double offset = 0)
+{
+  const int n = Resolution + 1;
+  vtkNew<vtkPoints> points;
+  vtkNew<vtkDoubleArray> pressure;
+  pressure->SetName("Pressure");
+  vtkNew<vtkDoubleArray> velocity;
+  velocity->SetName("Velocity");
+  velocity->SetNumberOfComponents(3);
+  for (int k = 0; k < n; ++k)
+  {
+    for (int j = 0; j < n; ++j)
+    {
+      for (int i = 0; i < n; ++i)
+      {
+        double point[3] = { static_cast<double>(i), static_cast<double>(j),
+          static_cast<double>(k) };
+        points->InsertNextPoint(point);
+        pressure->InsertNextValue(point[0] + point[1] + point[2] + offset);
+        velocity->InsertNextTuple(point);
+      }
+    }
+  }
+
+  vtkNew<vtkUnstructuredGrid> grid;
+  grid->SetPoints(points);
+  vtkNew<vtkDoubleArray> density;
+  density->SetName("Density");
+  vtkNew<vtkDoubleArray> flux;
+  flux->SetName("Flux");
+  flux->SetNumberOfComponents(3);
+  for (int k = 0; k < Resolution; ++k)
+  {
+    for (int j = 0; j < Resolution; ++j)
+    {
+      for (int i = 0; i < Resolution; ++i)
+      {
+        vtkIdType first = i + n * (j + n * k);
+        vtkIdType hexahedron[8] = { first, first + 1, first + n + 1, first + n, first + n * n,
+          first + n * n + 1, first + n * n + n + 1, first + n * n + n };
+        grid->InsertNextCell(VTK_HEXAHEDRON, 8, hexahedron);
+        double center[3] = { i + 0.5, j + 0.5, k + 0.5 };
+        double value = CellValue(center);
+        density->InsertNextValue(value + offset);
+        flux->InsertNextTuple3(value, 2 * value, 3 * value);
+      }
+    }
+  }
+  grid->GetPointData()->AddArray(pressure);
+  grid->GetPointData()->AddArray(velocity);
+  grid->GetCellData()->AddArray(density);
+  grid->GetCellData()->AddArray(flux);
+  if (offset != 0)
+  {
+    vtkNew<vtkDoubleArray> temperature;
+    temperature->DeepCopy(pressure);
+    temperature->SetName("Temperature");
+    grid->GetPointData()->AddArray(temperature);
+  }
+
+  vtkNew<vtkExodusIIWriter> writer;
+  writer->SetInputData(grid);
+  writer->SetFileName(fileName.c_str());
+  writer->Write();
+}
+
+//----------------------------------------------------------------------------
+vtkUnstructuredGrid* Read(vtkExodusIIReader* reader, const std::string& fileName)
+{
+  reader->SetFileName(fileName.c_str());
+  reader->UpdateInformation();
+  reader->SetAllArrayStatus(vtkExodusIIReader::NODAL, 1);
+  reader->SetAllArrayStatus(vtkExodusIIReader::ELEM_BLOCK, 1);
+  reader->Update();
+  vtkMultiBlockDataSet* blocks =
+    vtkMultiBlockDataSet::SafeDownCast(reader->GetOutput()->GetBlock(0));
+  return blocks ? vtkUnstructuredGrid::SafeDownCast(blocks->GetBlock(0)) : nullptr;
+}
+
+//----------------------------------------------------------------------------
+bool CheckGrid(vtkUnstructuredGrid* grid, double offset = 0)
+{
+  if (!grid || grid->GetNumberOfCells() != Resolution * Resolution * Resolution)
+  {
+    std::cerr << "Wrong grid read" << std::endl;
+    return false;
+  }
+  vtkDataArray* pressure = grid->GetPointData()->GetArray("Pressure");
+  vtkDataArray* velocity = grid->GetPointData()->GetArray("Velocity");
+  vtkDataArray* density = grid->GetCellData()->GetArray("Density");
+  vtkDataArray* flux = grid->GetCellData()->GetArray("Flux");
+  if (!pressure || !velocity || velocity->GetNumberOfComponents() != 3 || !density || !flux ||
+    flux->GetNumberOfComponents() != 3)
+  {
+    std::cerr << "Missing arrays" << std::endl;
+    return false;
+  }
+  for (vtkIdType i = 0; i < grid->GetNumberOfPoints(); ++i)
+  {
+    double point[3];
+    grid->GetPoint(i, point);
+    double* vector = velocity->GetTuple3(i);
+    if (pressure->GetComponent(i, 0) != point[0] + point[1] + point[2] + offset ||
+      vector[0] != point[0] ||
+      vector[1] != point[1] || vector[2] != point[2])
+    {
+      std::cerr << "Wrong point values at point " << i << std::endl;
+      return false;
+    }
+  }
+  for (vtkIdType i = 0; i < grid->GetNumberOfCells(); ++i)
+  {
+    double bounds[6];
+    grid->GetCellBounds(i, bounds);
+    double center[3] = { (bounds[0] + bounds[1]) / 2, (bounds[2] + bounds[3]) / 2,
+      (bounds[4] + bounds[5]) / 2 };
+    double value = CellValue(center);
+    double* vector = flux->GetTuple3(i);
+    if (std::abs(density->GetComponent(i, 0) - value - offset) > 1e-9 ||
+      vector[0] != vector[1] / 2 || vector[0] != vector[2] / 3 || vector[0] != value)
+    {
+      std::cerr << "Wrong cell values at cell " << i << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+//----------------------------------------------------------------------------
+int TestExodusSharedCache(int argc, char* argv[])
+{
+  char* tempDir =
+    vtkTestUtilities::GetArgOrEnvOrDefault("-T", argc, argv, "VTK_TEMP_DIR", "Testing/Temporary");
+  std::string fileName = std::string(tempDir) + "/TestExodusSharedCache.exo";
+  delete[] tempDir;
+  WriteGrid(fileName);
+
+  vtkNew<vtkExodusIIReader> reader;
+  vtkUnstructuredGrid* grid = Read(reader, fileName);
+  if (!CheckGrid(grid))
+  {
+    return EXIT_FAILURE;
+  }
+
+  vtkNew<vtkExodusIIReader> sharingReader1;
+  sharingReader1->SetCacheSize(16);
+  sharingReader1->UseSharedCacheOn();
+  vtkUnstructuredGrid* sharingGrid1 = Read(sharingReader1, fileName);
+  vtkNew<vtkExodusIIReader> sharingReader2;
+  sharingReader2->UseSharedCacheOn();
+  vtkUnstructuredGrid* sharingGrid2 = Read(sharingReader2, fileName);
+  if (!CheckGrid(sharingGrid1) || !CheckGrid(sharingGrid2))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // The second reader uses the arrays read by the first one, but not those of
+  // the reader that does not share its cache
+  vtkDataArray* density = grid->GetCellData()->GetArray("Density");
+  vtkDataArray* sharedDensity1 = sharingGrid1->GetCellData()->GetArray("Density");
+  vtkDataArray* sharedDensity2 = sharingGrid2->GetCellData()->GetArray("Density");
+  if (sharedDensity1 != sharedDensity2 || density == sharedDensity1)
+  {
+    std::cerr << "The cache was not shared" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Changing the settings of a reader does not affect the other one
+  sharingReader2->SetApplyDisplacements(false);
+  sharingReader2->Update();
+  sharingReader1->Modified();
+  sharingReader1->Update();
+  vtkMultiBlockDataSet* blocks =
+    vtkMultiBlockDataSet::SafeDownCast(sharingReader1->GetOutput()->GetBlock(0));
+  if (!CheckGrid(vtkUnstructuredGrid::SafeDownCast(blocks->GetBlock(0))))
+  {
+    return EXIT_FAILURE;
+  }
+
+  sharingReader2->UseSharedCacheOff();
+  sharingReader2->Modified();
+  sharingReader2->Update();
+  blocks = vtkMultiBlockDataSet::SafeDownCast(sharingReader2->GetOutput()->GetBlock(0));
+  sharingGrid2 = vtkUnstructuredGrid::SafeDownCast(blocks->GetBlock(0));
+  if (!CheckGrid(sharingGrid2) ||
+    sharingGrid2->GetCellData()->GetArray("Density") == sharedDensity1)
+  {
+    std::cerr << "The cache is still shared" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // The shared cache is cleared when the file changes, on the next execution
+  // of a reader or ResetCache()
+  WriteGrid(fileName, 1000);
+  sharingReader1->Modified();
+  sharingReader1->Update();
+  blocks = vtkMultiBlockDataSet::SafeDownCast(sharingReader1->GetOutput()->GetBlock(0));
+  if (!CheckGrid(vtkUnstructuredGrid::SafeDownCast(blocks->GetBlock(0)), 1000))
+  {
+    std::cerr << "Values of the previous file read from the shared cache" << std::endl;
+    return EXIT_FAILURE;
+  }
+  vtkNew<vtkExodusIIReader> sharingReader3;
+  sharingReader3->UseSharedCacheOn();
+  if (!CheckGrid(Read(sharingReader3, fileName), 1000))
+  {
+    return EXIT_FAILURE;
+  }
+  WriteGrid(fileName);
+  sharingReader1->ResetCache();
+  sharingReader1->Modified();
+  sharingReader1->Update();
+  blocks = vtkMultiBlockDataSet::SafeDownCast(sharingReader1->GetOutput()->GetBlock(0));
+  if (!CheckGrid(vtkUnstructuredGrid::SafeDownCast(blocks->GetBlock(0))))
+  {
+    std::cerr << "Values of the previous file read after ResetCache()" << std::endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
@@ -3,6 +3,10 @@
 #include "vtkDataArray.h"
 #include "vtkObjectFactory.h"
 
+#include "vtksys/SystemTools.hxx"
+
+#include <string>
+
 // Define VTK_EXO_DBG_CACHE to print cache adds, drops, and replacements.
 //#undef VTK_EXO_DBG_CACHE
 
@@ -65,6 +69,48 @@ void printLRUBack( vtkExodusIICacheRef& cit )
 }
 #endif // 0
 
+// ============================================================================
+namespace
+{
+// A cache shared by the readers of a file
+struct vtkExodusIISharedCache
+{
+  vtkExodusIICache* Cache = nullptr;
+  int NumberOfUsers = 0;
+  long ModifiedTime = 0;
+  unsigned long FileLength = 0;
+
+  // Clear the cache when its file was modified since the last call
+  bool Update(const std::string& path)
+  {
+    const long modifiedTime = vtksys::SystemTools::ModifiedTime(path);
+    const unsigned long fileLength = vtksys::SystemTools::FileLength(path);
+    const bool modified = modifiedTime != this->ModifiedTime || fileLength != this->FileLength;
+    if (modified)
+    {
+      // The arrays of the previous version of the file are obsolete
+      this->Cache->Clear();
+      this->ModifiedTime = modifiedTime;
+      this->FileLength = fileLength;
+    }
+    return modified;
+  }
+};
+
+std::mutex& GetSharedCachesMutex()
+{
+  static std::mutex mutex;
+  return mutex;
+}
+
+// The shared caches, by full path of their file
+std::map<std::string, vtkExodusIISharedCache>& GetSharedCaches()
+{
+  static std::map<std::string, vtkExodusIISharedCache> caches;
+  return caches;
+}
+}
+
 // ============================================================================
 
 vtkStandardNewMacro(vtkExodusIICache);
@@ -82,6 +128,7 @@ vtkExodusIICache::~vtkExodusIICache()
 
 void vtkExodusIICache::PrintSelf(ostream& os, vtkIndent indent)
 {
+  std::lock_guard<std::recursive_mutex> lock(this->Mutex);
   this->Superclass::PrintSelf(os, indent);
   os << indent << "Capacity: " << this->Capacity << " MiB\n";
   os << indent << "Size: " << this->Size << " MiB\n";
@@ -91,12 +138,14 @@ void vtkExodusIICache::PrintSelf(ostream& os, vtkIndent indent)
 
 void vtkExodusIICache::Clear()
 {
+  std::lock_guard<std::recursive_mutex> lock(this->Mutex);
   // printCache( this->Cache, this->LRU );
   this->ReduceToSize(0.);
 }
 
 void vtkExodusIICache::SetCacheCapacity(double sizeInMiB)
 {
+  std::lock_guard<std::recursive_mutex> lock(this->Mutex);
   if (sizeInMiB == this->Capacity)
     return;
 
@@ -108,8 +157,15 @@ void vtkExodusIICache::SetCacheCapacity(double sizeInMiB)
   this->Capacity = sizeInMiB < 0 ? 0 : sizeInMiB;
 }
 
+double vtkExodusIICache::GetCacheCapacity()
+{
+  std::lock_guard<std::recursive_mutex> lock(this->Mutex);
+  return this->Capacity;
+}
+
 int vtkExodusIICache::ReduceToSize(double newSize)
 {
+  std::lock_guard<std::recursive_mutex> lock(this->Mutex);
   int deletedSomething = 0;
   while (this->Size > newSize && !this->LRU.empty())
   {
@@ -153,6 +209,7 @@ int vtkExodusIICache::ReduceToSize(double newSize)
 
 void vtkExodusIICache::Insert(vtkExodusIICacheKey& key, vtkDataArray* value)
 {
+  std::lock_guard<std::recursive_mutex> lock(this->Mutex);
   double vsize = value ? value->GetActualMemorySize() / 1024. : 0.;
 
   vtkExodusIICacheRef it = this->Cache.find(key);
@@ -198,6 +255,7 @@ vtkDataArray*& vtkExodusIICache::Find(const vtkExodusIICacheKey& key)
 {
   static vtkDataArray* dummy = nullptr;
 
+  std::lock_guard<std::recursive_mutex> lock(this->Mutex);
   vtkExodusIICacheRef it = this->Cache.find(key);
   if (it != this->Cache.end())
   {
@@ -210,8 +268,22 @@ vtkDataArray*& vtkExodusIICache::Find(const vtkExodusIICacheKey& key)
   return dummy;
 }
 
+vtkSmartPointer<vtkDataArray> vtkExodusIICache::Lookup(const vtkExodusIICacheKey& key)
+{
+  std::lock_guard<std::recursive_mutex> lock(this->Mutex);
+  vtkExodusIICacheRef it = this->Cache.find(key);
+  if (it != this->Cache.end())
+  {
+    this->LRU.erase(it->second->LRUEntry);
+    it->second->LRUEntry = this->LRU.insert(this->LRU.begin(), it);
+    return it->second->Value;
+  }
+  return nullptr;
+}
+
 int vtkExodusIICache::Invalidate(const vtkExodusIICacheKey& key)
 {
+  std::lock_guard<std::recursive_mutex> lock(this->Mutex);
   vtkExodusIICacheRef it = this->Cache.find(key);
   if (it != this->Cache.end())
   {
@@ -241,6 +313,7 @@ int vtkExodusIICache::Invalidate(const vtkExodusIICacheKey& key)
 
 int vtkExodusIICache::Invalidate(const vtkExodusIICacheKey& key, const vtkExodusIICacheKey& pattern)
 {
+  std::lock_guard<std::recursive_mutex> lock(this->Mutex);
   vtkExodusIICacheRef it;
   int nDropped = 0;
   it = this->Cache.begin();
@@ -279,6 +352,7 @@ int vtkExodusIICache::Invalidate(const vtkExodusIICacheKey& key, const vtkExodus
 
 void vtkExodusIICache::RecomputeSize()
 {
+  std::lock_guard<std::recursive_mutex> lock(this->Mutex);
   this->Size = 0.;
   vtkExodusIICacheRef it;
   for (it = this->Cache.begin(); it != this->Cache.end(); ++it)
@@ -289,3 +363,49 @@ void vtkExodusIICache::RecomputeSize()
     }
   }
 }
+
+vtkExodusIICache* vtkExodusIICache::AcquireSharedCache(const char* fileName)
+{
+  std::string path = vtksys::SystemTools::CollapseFullPath(fileName);
+
+  std::lock_guard<std::mutex> lock(GetSharedCachesMutex());
+  vtkExodusIISharedCache& shared = GetSharedCaches()[path];
+  if (!shared.Cache)
+  {
+    shared.Cache = vtkExodusIICache::New();
+  }
+  shared.Update(path);
+  ++shared.NumberOfUsers;
+  return shared.Cache;
+}
+
+bool vtkExodusIICache::UpdateSharedCache(vtkExodusIICache* cache)
+{
+  std::lock_guard<std::mutex> lock(GetSharedCachesMutex());
+  for (auto& shared : GetSharedCaches())
+  {
+    if (shared.second.Cache == cache)
+    {
+      return shared.second.Update(shared.first);
+    }
+  }
+  return false;
+}
+
+void vtkExodusIICache::ReleaseSharedCache(vtkExodusIICache* cache)
+{
+  std::lock_guard<std::mutex> lock(GetSharedCachesMutex());
+  std::map<std::string, vtkExodusIISharedCache>& caches = GetSharedCaches();
+  for (auto it = caches.begin(); it != caches.end(); ++it)
+  {
+    if (it->second.Cache == cache)
+    {
+      if (--it->second.NumberOfUsers == 0)
+      {
+        it->second.Cache->Delete();
+        caches.erase(it);
+      }
+      return;
+    }
+  }
+}
@@ -22,12 +22,17 @@
 // entries O(1). Each cache entry stores an iterator into
 // the list of references so that it can be located quickly for
 // removal.
+//
+// The methods of the cache are thread safe, so that a cache can be
+// shared by the readers of the same file with AcquireSharedCache().
 
 #include "vtkIOExodusModule.h" // For export macro
 #include "vtkObject.h"
+#include "vtkSmartPointer.h" // for vtkSmartPointer
 
-#include <list> // use for LRU ordering
-#include <map>  // used for cache storage
+#include <list>  // use for LRU ordering
+#include <map>   // used for cache storage
+#include <mutex> // for std::recursive_mutex
 
 class VTKIOEXODUS_EXPORT vtkExodusIICacheKey
 {
@@ -131,6 +136,9 @@ public:
   /// reduced below the current size.
   void SetCacheCapacity(double sizeInMiB);
 
+  /// Get the maximum allowable cache size in MiB.
+  double GetCacheCapacity();
+
   /** See how much cache space is left.
    * This is the difference between the capacity and the size of the cache.
    * The result is in MiB.
@@ -150,6 +158,11 @@ public:
    */
   vtkDataArray*& Find(const vtkExodusIICacheKey&);
 
+  /** Same as Find(), but the returned array is referenced, so that it stays valid when another
+   * thread removes it from the cache. Use it on shared caches.
+   */
+  vtkSmartPointer<vtkDataArray> Lookup(const vtkExodusIICacheKey& key);
+
   /** Invalidate a cache entry (drop it from the cache) if the key exists.
    * This does nothing if the cache entry does not exist.
    * Returns 1 if the cache entry existed prior to this call and 0 otherwise.
@@ -167,6 +180,21 @@ public:
    */
   int Invalidate(const vtkExodusIICacheKey& key, const vtkExodusIICacheKey& pattern);
 
+  /** Return the cache shared by all the readers of the given file in the process, creating it
+   * if needed. The cache is cleared when the file was modified since it was last acquired or
+   * updated. Each call must be matched by a call to ReleaseSharedCache().
+   */
+  static vtkExodusIICache* AcquireSharedCache(const char* fileName);
+
+  /** Clear a cache returned by AcquireSharedCache() when its file was modified, as told by its
+   * modification time and size, since the cache was last acquired or updated.
+   * Returns true if the cache was cleared.
+   */
+  static bool UpdateSharedCache(vtkExodusIICache* cache);
+
+  /// Release a cache returned by AcquireSharedCache(), deleting it when it is no longer used.
+  static void ReleaseSharedCache(vtkExodusIICache* cache);
+
 protected:
   /// Default constructor
   vtkExodusIICache();
@@ -195,6 +223,9 @@ protected:
   /// The actual LRU list (indices into the cache ordered least to most recently used).
   vtkExodusIICacheLRU LRU;
 
+  /// Serializes the accesses to the cache.
+  std::recursive_mutex Mutex;
+
 private:
   vtkExodusIICache(const vtkExodusIICache&) = delete;
   void operator=(const vtkExodusIICache&) = delete;
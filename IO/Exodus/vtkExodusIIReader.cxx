@@ -40,6 +40,7 @@
 #include "vtkPointData.h"
 #include "vtkPoints.h"
 #include "vtkPolyData.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkSortDataArray.h"
 #include "vtkStdString.h"
@@ -55,6 +56,7 @@
 #include <algorithm>
 #include <deque>
 #include <map>
+#include <mutex>
 #include <set>
 #include <string>
 #include <vector>
@@ -147,6 +149,8 @@ vtkExodusIIReaderPrivate::BlockSetInfoType::BlockSetInfoType(
   , PointMap(block.PointMap)
   , ReversePointMap(block.ReversePointMap)
   , CachedConnectivity(nullptr)
+  , CachedPoints(block.CachedPoints)
+  , CachedPointsSource(block.CachedPointsSource)
 {
   // this is needed to properly manage memory.
   // when vectors are resized or reserved the container
@@ -183,6 +187,8 @@ vtkExodusIIReaderPrivate::BlockSetInfoType& vtkExodusIIReaderPrivate::BlockSetIn
     this->PointMap = block.PointMap;
     this->ReversePointMap = block.ReversePointMap;
     this->NextSqueezePoint = block.NextSqueezePoint;
+    this->CachedPoints = block.CachedPoints;
+    this->CachedPointsSource = block.CachedPointsSource;
     if (block.CachedConnectivity)
     {
       this->CachedConnectivity = vtkUnstructuredGrid::New();
@@ -314,6 +320,8 @@ vtkExodusIIReaderPrivate::vtkExodusIIReaderPrivate()
 
   this->Cache = vtkExodusIICache::New();
   this->CacheSize = 0;
+  this->SharedCache = nullptr;
+  this->UseSharedCache = false;
 
   this->HasModeShapes = 0;
   this->ModeShapeTime = -1.;
@@ -346,8 +354,13 @@ vtkExodusIIReaderPrivate::vtkExodusIIReaderPrivate()
 vtkExodusIIReaderPrivate::~vtkExodusIIReaderPrivate()
 {
   this->CloseFile();
+  this->RequestArrays.clear();
   this->Cache->Delete();
   this->CacheSize = 0;
+  if (this->SharedCache)
+  {
+    vtkExodusIICache::ReleaseSharedCache(this->SharedCache);
+  }
   this->ClearConnectivityCaches();
   if (this->Parser)
   {
@@ -471,6 +484,8 @@ int vtkExodusIIReaderPrivate::AssembleOutputConnectivity(vtkIdType timeStep, int
   }
 
   // OK, we needed to remake the cache...
+  bsinfop->CachedPoints = nullptr;
+  bsinfop->CachedPointsSource = nullptr;
   bsinfop->CachedConnectivity = vtkUnstructuredGrid::New();
   bsinfop->CachedConnectivity->Allocate(bsinfop->Size);
   if (this->SqueezePoints)
@@ -518,19 +533,6 @@ int vtkExodusIIReaderPrivate::AssembleOutputConnectivity(vtkIdType timeStep, int
 int vtkExodusIIReaderPrivate::AssembleOutputPoints(
   vtkIdType timeStep, BlockSetInfoType* bsinfop, vtkUnstructuredGrid* output)
 {
-  (void)timeStep;
-  vtkPoints* pts = output->GetPoints();
-  if (!pts)
-  {
-    pts = vtkPoints::New();
-    output->SetPoints(pts);
-    pts->FastDelete();
-  }
-  else
-  {
-    pts->Reset();
-  }
-
   int ts = -1; // If we don't have displacements, only cache the array under one key.
   if (this->ApplyDisplacements && this->FindDisplacementVectors(timeStep))
   { // Otherwise, each time step's array will be different.
@@ -545,6 +547,27 @@ int vtkExodusIIReaderPrivate::AssembleOutputPoints(
     return 0;
   }
 
+  // Reuse the points of a static mesh, so that their MTime does not change.
+  if (ts == -1 && bsinfop->CachedPoints && bsinfop->CachedPointsSource == arr)
+  {
+    output->SetPoints(bsinfop->CachedPoints);
+    return 1;
+  }
+
+  vtkPoints* pts = output->GetPoints();
+  if (!pts)
+  {
+    pts = vtkPoints::New();
+    output->SetPoints(pts);
+    pts->FastDelete();
+  }
+  else
+  {
+    pts->Reset();
+  }
+  bsinfop->CachedPoints = ts == -1 ? pts : nullptr;
+  bsinfop->CachedPointsSource = ts == -1 ? arr : nullptr;
+
   if (this->SqueezePoints)
   {
     pts->SetNumberOfPoints(bsinfop->NextSqueezePoint);
@@ -1577,10 +1600,256 @@ void vtkExodusIIReaderPrivate::InsertSetSides(
   }
 }
 
+//------------------------------------------------------------------------------
+// Return whether the array of the key only depends on the file, and not on the
+// settings of the reader, so that it can be shared with the other readers.
+static bool vtkExodusIIIsFileArray(const vtkExodusIICacheKey& key)
+{
+  switch (key.ObjectType)
+  {
+    case vtkExodusIIReader::GLOBAL:
+    case vtkExodusIIReader::NODAL:
+    case vtkExodusIIReader::EDGE_BLOCK:
+    case vtkExodusIIReader::FACE_BLOCK:
+    case vtkExodusIIReader::ELEM_BLOCK:
+    case vtkExodusIIReader::NODE_SET:
+    case vtkExodusIIReader::EDGE_SET:
+    case vtkExodusIIReader::FACE_SET:
+    case vtkExodusIIReader::SIDE_SET:
+    case vtkExodusIIReader::ELEM_SET:
+    case vtkExodusIIReader::NODE_MAP:
+    case vtkExodusIIReader::EDGE_MAP:
+    case vtkExodusIIReader::FACE_MAP:
+    case vtkExodusIIReader::ELEM_MAP:
+    case vtkExodusIIReader::NODE_ID:
+    case vtkExodusIIReader::EDGE_ID:
+    case vtkExodusIIReader::FACE_ID:
+    case vtkExodusIIReader::ELEMENT_ID:
+    case vtkExodusIIReader::ELEM_BLOCK_ELEM_CONN:
+    case vtkExodusIIReader::ELEM_BLOCK_FACE_CONN:
+    case vtkExodusIIReader::ELEM_BLOCK_EDGE_CONN:
+    case vtkExodusIIReader::FACE_BLOCK_CONN:
+    case vtkExodusIIReader::EDGE_BLOCK_CONN:
+    case vtkExodusIIReader::ENTITY_COUNTS:
+    case vtkExodusIIReader::ELEM_BLOCK_ATTRIB:
+    case vtkExodusIIReader::FACE_BLOCK_ATTRIB:
+    case vtkExodusIIReader::EDGE_BLOCK_ATTRIB:
+      return true;
+    case vtkExodusIIReader::NODAL_COORDS:
+      // The coordinates are only displaced for time steps
+      return key.Time < 0;
+    default:
+      return false;
+  }
+}
+
+//------------------------------------------------------------------------------
+vtkExodusIICache* vtkExodusIIReaderPrivate::GetCache(const vtkExodusIICacheKey& key)
+{
+  return this->SharedCache && vtkExodusIIIsFileArray(key) ? this->SharedCache : this->Cache;
+}
+
+//------------------------------------------------------------------------------
+void vtkExodusIIReaderPrivate::UpdateSharedCache()
+{
+  const char* fileName =
+    this->UseSharedCache && this->Parent ? this->Parent->GetFileName() : nullptr;
+  if (this->SharedCache && (!fileName || this->SharedCacheFileName != fileName))
+  {
+    vtkExodusIICache::ReleaseSharedCache(this->SharedCache);
+    this->SharedCache = nullptr;
+  }
+  if (fileName && !this->SharedCache)
+  {
+    this->SharedCache = vtkExodusIICache::AcquireSharedCache(fileName);
+    this->SharedCacheFileName = fileName;
+    // The shared cache is as large as the largest cache of its readers
+    this->SharedCache->SetCacheCapacity(
+      std::max(this->SharedCache->GetCacheCapacity(), this->CacheSize));
+  }
+  else if (this->SharedCache)
+  {
+    // Another reader may have filled the cache from a previous version of the file
+    vtkExodusIICache::UpdateSharedCache(this->SharedCache);
+  }
+}
+
+//------------------------------------------------------------------------------
+vtkDataArray* vtkExodusIIReaderPrivate::ReadResultArray(const vtkExodusIICacheKey& key,
+  const ArrayInfoType* ainfop, const ObjectInfoType* oinfop, std::mutex* exodusMutex)
+{
+  vtkIdType numTuples = oinfop ? oinfop->Size : this->ModelParameters.num_nodes;
+  vtkDataArray* arr = vtkDataArray::CreateDataArray(ainfop->StorageType);
+  arr->SetName(ainfop->Name.c_str());
+  // Promote 2-component arrays to 3-component arrays when we have 2-D coordinates
+  arr->SetNumberOfComponents(
+    ainfop->Components == 2 && this->ModelParameters.num_dim == 2 ? 3 : ainfop->Components);
+  arr->SetNumberOfTuples(numTuples);
+
+  // Exodus doesn't support reading with a stride, so the components of vectors
+  // are read separately and interleaved.
+  std::vector<std::vector<double>> tmpVal(ainfop->Components > 1 ? ainfop->Components : 0);
+  for (int c = 0; c < ainfop->Components; ++c)
+  {
+    void* values = arr->GetVoidPointer(0);
+    if (ainfop->Components > 1)
+    {
+      tmpVal[c].resize(numTuples + 1); // + 1 to avoid errors when numTuples == 0. BUG #8746.
+      values = tmpVal[c].data();
+    }
+    if (exodusMutex)
+    {
+      exodusMutex->lock();
+    }
+    int status = ex_get_var(this->Exoid, key.Time + 1, static_cast<ex_entity_type>(key.ObjectType),
+      ainfop->OriginalIndices[c], oinfop ? oinfop->Id : 0, numTuples, values);
+    if (exodusMutex)
+    {
+      exodusMutex->unlock();
+    }
+    // When reading concurrently, the errors are reported when the array is read again
+    if (status < 0)
+    {
+      const char* name =
+        ainfop->Components > 1 ? ainfop->OriginalNames[c].c_str() : ainfop->Name.c_str();
+      if (!exodusMutex && oinfop)
+      {
+        vtkErrorMacro("Could not read result variable "
+          << name << " for "
+          << objtype_names[this->GetObjectTypeIndexFromObjectType(key.ObjectType)] << " "
+          << oinfop->Id << ".");
+      }
+      else if (!exodusMutex)
+      {
+        vtkErrorMacro("Could not read nodal result variable " << name << ".");
+      }
+      arr->Delete();
+      return nullptr;
+    }
+  }
+
+  if (ainfop->Components > 1)
+  {
+    // Use arr->GetNumberOfComponents() as we may have promoted 2-D arrays to 3-D.
+    std::vector<double> tmpTuple(arr->GetNumberOfComponents(), 0.);
+    for (vtkIdType t = 0; t < numTuples; ++t)
+    {
+      for (int c = 0; c < ainfop->Components; ++c)
+      {
+        tmpTuple[c] = tmpVal[c][t];
+      }
+      arr->SetTuple(t, tmpTuple.data());
+    }
+  }
+  return arr;
+}
+
+//------------------------------------------------------------------------------
+void vtkExodusIIReaderPrivate::ReadResultArrays(vtkIdType timeStep)
+{
+  // Collect the arrays that AssembleOutputPointArrays() and
+  // AssembleOutputCellArrays() will need and that are not cached yet
+  std::vector<vtkExodusIICacheKey> keys;
+  std::vector<const ArrayInfoType*> arrayInfos;
+  std::vector<const ObjectInfoType*> objectInfos;
+  auto addKey = [&](const vtkExodusIICacheKey& key, const ArrayInfoType* ainfop,
+                  const ObjectInfoType* oinfop) {
+    vtkExodusIICache* cache = this->GetCache(key);
+    if (this->RequestArrays.count(key))
+    {
+      return;
+    }
+    if (cache == this->SharedCache)
+    {
+      if (vtkSmartPointer<vtkDataArray> arr = cache->Lookup(key))
+      {
+        this->RequestArrays[key] = arr;
+        return;
+      }
+    }
+    else if (cache->Find(key))
+    {
+      return;
+    }
+    keys.push_back(key);
+    arrayInfos.push_back(ainfop);
+    objectInfos.push_back(oinfop);
+  };
+
+  bool hasOutput = false;
+  for (int conntypidx = 0; conntypidx < num_conn_types; ++conntypidx)
+  {
+    int otypidx = conn_obj_idx_cvt[conntypidx];
+    int otyp = obj_types[otypidx];
+    auto ami = this->ArrayInfo.find(otyp);
+    int numObj = this->GetNumberOfObjectsOfType(otyp);
+    for (int obj = 0; obj < numObj; ++obj)
+    {
+      ObjectInfoType* oinfop = this->GetObjectInfo(otypidx, obj);
+      if (!oinfop->Status)
+      {
+        continue;
+      }
+      hasOutput = true;
+      if (ami == this->ArrayInfo.end())
+      {
+        continue;
+      }
+      for (size_t aidx = 0; aidx < ami->second.size(); ++aidx)
+      {
+        const ArrayInfoType& ainfo = ami->second[aidx];
+        if (ainfo.Status && ainfo.ObjectTruth[obj])
+        {
+          addKey(vtkExodusIICacheKey(timeStep, otyp, obj, static_cast<int>(aidx)), &ainfo, oinfop);
+        }
+      }
+    }
+  }
+  auto nodal = this->ArrayInfo.find(vtkExodusIIReader::NODAL);
+  if (hasOutput && nodal != this->ArrayInfo.end())
+  {
+    for (size_t aidx = 0; aidx < nodal->second.size(); ++aidx)
+    {
+      if (nodal->second[aidx].Status)
+      {
+        addKey(vtkExodusIICacheKey(timeStep, vtkExodusIIReader::NODAL, 0, static_cast<int>(aidx)),
+          &nodal->second[aidx], nullptr);
+      }
+    }
+  }
+  if (keys.empty())
+  {
+    return;
+  }
+
+  // The Exodus library is not thread safe: the arrays are read one at a time,
+  // while the components of the arrays already read are interleaved.
+  std::vector<vtkSmartPointer<vtkDataArray>> arrays(keys.size());
+  std::mutex exodusMutex;
+  vtkSMPTools::For(0, static_cast<vtkIdType>(keys.size()), 1, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      arrays[i].TakeReference(
+        this->ReadResultArray(keys[i], arrayInfos[i], objectInfos[i], &exodusMutex));
+    }
+  });
+
+  for (size_t i = 0; i < keys.size(); ++i)
+  {
+    // Arrays that failed are read again by GetCacheOrRead(), which reports the error
+    if (arrays[i])
+    {
+      this->RequestArrays[keys[i]] = arrays[i];
+      this->GetCache(keys[i])->Insert(keys[i], arrays[i]);
+    }
+  }
+}
+
 //------------------------------------------------------------------------------
 vtkDataArray* vtkExodusIIReaderPrivate::GetCacheOrRead(vtkExodusIICacheKey key)
 {
   vtkDataArray* arr;
+  vtkExodusIICache* cache = this->GetCache(key);
   // Never cache points deflected for a mode shape animation... doubles don't make good keys.
   if (this->HasModeShapes && key.ObjectType == vtkExodusIIReader::NODAL_COORDS)
   {
@@ -1588,7 +1857,26 @@ vtkDataArray* vtkExodusIIReaderPrivate::GetCacheOrRead(vtkExodusIICacheKey key)
   }
   else
   {
-    arr = this->Cache->Find(key);
+    auto held = this->RequestArrays.find(key);
+    if (held != this->RequestArrays.end())
+    {
+      return held->second;
+    }
+    if (cache == this->SharedCache)
+    {
+      // Hold the array until the end of the request, since the other readers
+      // of the file may drop it from the shared cache at any time.
+      vtkSmartPointer<vtkDataArray> sharedArr = cache->Lookup(key);
+      if (sharedArr)
+      {
+        this->RequestArrays[key] = sharedArr;
+      }
+      arr = sharedArr;
+    }
+    else
+    {
+      arr = this->Cache->Find(key);
+    }
   }
 
   if (arr)
@@ -1628,79 +1916,8 @@ vtkDataArray* vtkExodusIIReaderPrivate::GetCacheOrRead(vtkExodusIICacheKey key)
   else if (key.ObjectType == vtkExodusIIReader::NODAL)
   {
     // read nodal array
-    ArrayInfoType* ainfop = &this->ArrayInfo[vtkExodusIIReader::NODAL][key.ArrayId];
-    int ncomps =
-      (this->ModelParameters.num_dim == 2 && ainfop->Components == 2) ? 3 : ainfop->Components;
-    arr = vtkDataArray::CreateDataArray(ainfop->StorageType);
-    arr->SetName(ainfop->Name.c_str());
-    arr->SetNumberOfComponents(ncomps);
-    arr->SetNumberOfTuples(this->ModelParameters.num_nodes);
-    if (ncomps != ainfop->Components)
-    {
-      arr->FillComponent(2, 0.);
-    }
-    if (ncomps == 1)
-    {
-      if (ex_get_var(exoid, key.Time + 1, static_cast<ex_entity_type>(key.ObjectType),
-            ainfop->OriginalIndices[0], 0, arr->GetNumberOfTuples(), arr->GetVoidPointer(0)) < 0)
-      {
-        vtkErrorMacro("Could not read nodal result variable " << ainfop->Name.c_str() << ".");
-        arr->Delete();
-        arr = nullptr;
-      }
-    }
-    else
-    {
-      // Exodus doesn't support reading with a stride, so we have to manually interleave the arrays.
-      // Bleh.
-      std::vector<std::vector<double>> tmpVal;
-      tmpVal.resize(ainfop->Components);
-      int c;
-      for (c = 0; c < ainfop->Components; ++c)
-      {
-        vtkIdType N = this->ModelParameters.num_nodes;
-        tmpVal[c].resize(N);
-        if (ex_get_var(exoid, key.Time + 1, static_cast<ex_entity_type>(key.ObjectType),
-              ainfop->OriginalIndices[c], 0, arr->GetNumberOfTuples(), &tmpVal[c][0]) < 0)
-        {
-          vtkErrorMacro(
-            "Could not read nodal result variable " << ainfop->OriginalNames[c].c_str() << ".");
-          arr->Delete();
-          arr = nullptr;
-          return nullptr;
-        }
-      }
-      int t;
-      std::vector<double> tmpTuple;
-      tmpTuple.resize(ncomps);
-      tmpTuple[ncomps - 1] = 0.; // In case we're embedding a 2-D vector in 3-D
-
-      //
-      // Lets unroll the most common case - components == 3.
-      //
-      if (ainfop->Components == 3)
-      {
-        int maxTuples = arr->GetNumberOfTuples();
-        for (t = 0; t < maxTuples; ++t)
-        {
-          tmpTuple[0] = tmpVal[0][t];
-          tmpTuple[1] = tmpVal[1][t];
-          tmpTuple[2] = tmpVal[2][t];
-          arr->SetTuple(t, &tmpTuple[0]);
-        }
-      }
-      else
-      {
-        for (t = 0; t < arr->GetNumberOfTuples(); ++t)
-        {
-          for (c = 0; c < ainfop->Components; ++c)
-          {
-            tmpTuple[c] = tmpVal[c][t];
-          }
-          arr->SetTuple(t, &tmpTuple[0]);
-        }
-      }
-    }
+    arr = this->ReadResultArray(
+      key, &this->ArrayInfo[vtkExodusIIReader::NODAL][key.ArrayId], nullptr, nullptr);
   }
   else if (key.ObjectType == vtkExodusIIReader::GLOBAL_TEMPORAL)
   {
@@ -1870,70 +2087,8 @@ vtkDataArray* vtkExodusIIReaderPrivate::GetCacheOrRead(vtkExodusIICacheKey key)
     key.ObjectType == vtkExodusIIReader::SIDE_SET || key.ObjectType == vtkExodusIIReader::ELEM_SET)
   {
     int otypidx = this->GetObjectTypeIndexFromObjectType(key.ObjectType);
-    ArrayInfoType* ainfop = &this->ArrayInfo[key.ObjectType][key.ArrayId];
-    ObjectInfoType* oinfop = this->GetObjectInfo(otypidx, key.ObjectId);
-
-    arr = vtkDataArray::CreateDataArray(ainfop->StorageType);
-    arr->SetName(ainfop->Name.c_str());
-    if (ainfop->Components == 2 && this->ModelParameters.num_dim == 2)
-    {
-      // Promote 2-component arrays to 3-component arrays when we have 2-D coordinates
-      arr->SetNumberOfComponents(3);
-    }
-    else
-    {
-      arr->SetNumberOfComponents(ainfop->Components);
-    }
-    arr->SetNumberOfTuples(oinfop->Size);
-    if (ainfop->Components == 1)
-    {
-      if (ex_get_var(exoid, key.Time + 1, static_cast<ex_entity_type>(key.ObjectType),
-            ainfop->OriginalIndices[0], oinfop->Id, arr->GetNumberOfTuples(),
-            arr->GetVoidPointer(0)) < 0)
-      {
-        vtkErrorMacro("Could not read result variable "
-          << ainfop->Name.c_str() << " for " << objtype_names[otypidx] << " " << oinfop->Id << ".");
-        arr->Delete();
-        arr = nullptr;
-      }
-    }
-    else
-    {
-      // Exodus doesn't support reading with a stride, so we have to manually interleave the arrays.
-      // Bleh.
-      std::vector<std::vector<double>> tmpVal;
-      tmpVal.resize(ainfop->Components);
-      int c;
-      for (c = 0; c < ainfop->Components; ++c)
-      {
-        vtkIdType N = arr->GetNumberOfTuples();
-        tmpVal[c].resize(N + 1); // + 1 to avoid errors when N == 0.
-                                 // BUG #8746.
-        if (ex_get_var(exoid, key.Time + 1, static_cast<ex_entity_type>(key.ObjectType),
-              ainfop->OriginalIndices[c], oinfop->Id, arr->GetNumberOfTuples(), &tmpVal[c][0]) < 0)
-        {
-          vtkErrorMacro("Could not read result variable "
-            << ainfop->OriginalNames[c].c_str() << " for " << objtype_names[otypidx] << " "
-            << oinfop->Id << ".");
-          arr->Delete();
-          arr = nullptr;
-        }
-      }
-      // Carefully use arr->GetNumberOfComponents() when sizing
-      // output as we may have promoted 2-D arrays to 3-D.
-      int t = arr->GetNumberOfComponents();
-      std::vector<double> tmpTuple;
-      tmpTuple.resize(t);
-      tmpTuple[t - 1] = 0.;
-      for (t = 0; t < arr->GetNumberOfTuples(); ++t)
-      {
-        for (c = 0; c < ainfop->Components; ++c)
-        {
-          tmpTuple[c] = tmpVal[c][t];
-        }
-        arr->SetTuple(t, &tmpTuple[0]);
-      }
-    }
+    arr = this->ReadResultArray(key, &this->ArrayInfo[key.ObjectType][key.ArrayId],
+      this->GetObjectInfo(otypidx, key.ObjectId), nullptr);
   }
   else if (key.ObjectType == vtkExodusIIReader::NODE_MAP ||
     key.ObjectType == vtkExodusIIReader::EDGE_MAP ||
@@ -2896,7 +3051,11 @@ vtkDataArray* vtkExodusIIReaderPrivate::GetCacheOrRead(vtkExodusIICacheKey key)
   // GetCacheOrRead(), you better start running!
   if (arr)
   {
-    this->Cache->Insert(key, arr);
+    if (cache == this->SharedCache)
+    {
+      this->RequestArrays[key] = arr;
+    }
+    cache->Insert(key, arr);
     arr->FastDelete();
   }
   return arr;
@@ -3460,6 +3619,8 @@ void vtkExodusIIReaderPrivate::ClearConnectivityCaches()
         blkit->CachedConnectivity->Delete();
         blkit->CachedConnectivity = nullptr;
       }
+      blkit->CachedPoints = nullptr;
+      blkit->CachedPointsSource = nullptr;
     }
   }
   std::map<int, std::vector<SetInfoType>>::iterator setsit;
@@ -3473,6 +3634,8 @@ void vtkExodusIIReaderPrivate::ClearConnectivityCaches()
         setit->CachedConnectivity->Delete();
         setit->CachedConnectivity = nullptr;
       }
+      setit->CachedPoints = nullptr;
+      setit->CachedPointsSource = nullptr;
     }
   }
 }
@@ -3840,6 +4003,7 @@ void vtkExodusIIReaderPrivate::PrintSelf(ostream& os, vtkIndent indent)
 
   os << indent << "Array Cache:\n";
   this->Cache->PrintSelf(os, inden2);
+  os << indent << "UseSharedCache: " << this->UseSharedCache << "\n";
 
   os << indent << "SqueezePoints: " << this->SqueezePoints << "\n";
   os << indent << "ApplyDisplacements: " << this->ApplyDisplacements << "\n";
@@ -4529,6 +4693,10 @@ int vtkExodusIIReaderPrivate::RequestData(vtkIdType timeStep, vtkMultiBlockDataS
     vtkErrorMacro("You must specify an output mesh");
   }
 
+  // Read the result variables of the time step concurrently before assembling them
+  this->UpdateSharedCache();
+  this->ReadResultArrays(timeStep);
+
   // Iterate over all block and set types, creating a
   // multiblock dataset to hold objects of each type.
   int conntypidx;
@@ -4620,6 +4788,7 @@ int vtkExodusIIReaderPrivate::RequestData(vtkIdType timeStep, vtkMultiBlockDataS
     }
   }
 
+  this->RequestArrays.clear();
   this->CloseFile();
 
   return 0;
@@ -4806,9 +4975,14 @@ void vtkExodusIIReaderPrivate::ResetSettings()
 
 void vtkExodusIIReaderPrivate::ResetCache()
 {
+  this->RequestArrays.clear();
   this->Cache->Clear();
   this->Cache->SetCacheCapacity(
     this->CacheSize); // FIXME: Perhaps Cache should have a Reset and a Clear method?
+  if (this->SharedCache)
+  {
+    vtkExodusIICache::UpdateSharedCache(this->SharedCache);
+  }
   this->ClearConnectivityCaches();
 }
 
@@ -4818,10 +4992,23 @@ void vtkExodusIIReaderPrivate::SetCacheSize(double size)
   {
     this->CacheSize = size;
     this->Cache->SetCacheCapacity(this->CacheSize);
+    if (this->SharedCache && this->SharedCache->GetCacheCapacity() < this->CacheSize)
+    {
+      this->SharedCache->SetCacheCapacity(this->CacheSize);
+    }
     this->Modified();
   }
 }
 
+void vtkExodusIIReaderPrivate::SetUseSharedCache(bool use)
+{
+  if (this->UseSharedCache != use)
+  {
+    this->UseSharedCache = use;
+    this->UpdateSharedCache();
+  }
+}
+
 bool vtkExodusIIReaderPrivate::IsXMLMetadataValid()
 {
   // Make sure that each block id referred to in the metadata arrays exist
@@ -6747,6 +6934,16 @@ double vtkExodusIIReader::GetCacheSize()
   return this->Metadata->GetCacheSize();
 }
 
+void vtkExodusIIReader::SetUseSharedCache(bool use)
+{
+  this->Metadata->SetUseSharedCache(use);
+}
+
+bool vtkExodusIIReader::GetUseSharedCache()
+{
+  return this->Metadata->GetUseSharedCache();
+}
+
 void vtkExodusIIReader::SetSqueezePoints(bool sp)
 {
   this->Metadata->SetSqueezePoints(sp ? 1 : 0);
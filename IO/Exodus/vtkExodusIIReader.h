@@ -790,6 +790,23 @@ public:
    */
   double GetCacheSize();
 
+  ///@{
+  /**
+   * Should the arrays read from the file be cached in a cache shared by all
+   * the readers of the same file in the process, instead of the cache of
+   * this reader? Readers showing the same file then only read its arrays
+   * once. Only the arrays that do not depend on the settings of the readers,
+   * such as result variables, maps, connectivity and undisplaced coordinates,
+   * are shared. The capacity of the shared cache is the largest cache size of
+   * its readers, and ResetCache() only clears it when the file was modified
+   * since it was filled, which is also checked on each execution of the
+   * reader. Off by default.
+   */
+  void SetUseSharedCache(bool use);
+  bool GetUseSharedCache();
+  vtkBooleanMacro(UseSharedCache, bool);
+  ///@}
+
   ///@{
   /**
    * Should the reader output only points used by elements in the output mesh,
@@ -10,11 +10,14 @@
 #include "vtkExodusIICache.h"  // for vtkExodusIICacheKey
 #include "vtkExodusIIReader.h" // for vtkExodusIIReader
 #include "vtkObject.h"
+#include "vtkSmartPointer.h"            // for vtkSmartPointer
 #include "vtkStdString.h"               // for vtkStdString
 #include "vtkToolkits.h"                // make sure VTK_USE_PARALLEL is properly set
 #include "vtksys/RegularExpression.hxx" // for vtksys::RegularExpression
 
 #include <map>    // for std::map
+#include <mutex>  // for std::mutex
+#include <string> // for std::string
 #include <vector> // for std::vector
 
 #include "vtkIOExodusModule.h" // For export macro
@@ -24,6 +27,7 @@ class vtkExodusIIReaderParser;
 class vtkIdTypeArray;
 class vtkMultiBlockDataSet;
 class vtkMutableDirectedGraph;
+class vtkPoints;
 class vtkTypeInt64Array;
 class vtkUnstructuredGrid;
 
@@ -89,6 +93,14 @@ public:
   /// Get the size of the cache in MiB.
   vtkGetMacro(CacheSize, double);
 
+  /** Set whether the arrays read from the file are cached in the cache shared
+   * by all the readers of the file in the process.
+   */
+  void SetUseSharedCache(bool use);
+
+  /// Get whether the arrays read from the file are cached in a shared cache.
+  vtkGetMacro(UseSharedCache, bool);
+
   /** Return the number of time steps in the open file.
    * You must have called RequestInformation() before
    * invoking this member function.
@@ -347,6 +359,12 @@ public:
     vtkIdType NextSqueezePoint;
     /// Cached cell connectivity arrays for mesh
     vtkUnstructuredGrid* CachedConnectivity;
+    /** Cached points for mesh, reused while the nodal coordinates they were
+     * assembled from are the same so that the mesh MTime of a static mesh
+     * does not change from one time step to the next.
+     */
+    vtkSmartPointer<vtkPoints> CachedPoints;
+    vtkSmartPointer<vtkDataArray> CachedPointsSource;
 
     BlockSetInfoType() { this->CachedConnectivity = nullptr; }
     BlockSetInfoType(const BlockSetInfoType& block);
@@ -633,6 +651,27 @@ protected:
    */
   vtkDataArray* GetCacheOrRead(vtkExodusIICacheKey);
 
+  /** Read the result variable of a NODAL, block or set key, with the given
+   * array and object (nullptr for NODAL). When \a exodusMutex is given, the
+   * calls to the Exodus library are serialized with it, so that several
+   * arrays can be read and interleaved concurrently, and errors are not
+   * reported.
+   */
+  vtkDataArray* ReadResultArray(const vtkExodusIICacheKey& key, const ArrayInfoType* ainfop,
+    const ObjectInfoType* oinfop, std::mutex* exodusMutex);
+
+  /** Read concurrently the result variables of the time step that will be
+   * assembled into the output and are not cached yet. They are kept in
+   * RequestArrays until the end of RequestData().
+   */
+  void ReadResultArrays(vtkIdType timeStep);
+
+  /// Return the cache of the arrays of the key: the shared cache or this reader's one.
+  vtkExodusIICache* GetCache(const vtkExodusIICacheKey& key);
+
+  /// Acquire or release the shared cache to match UseSharedCache and the file name.
+  void UpdateSharedCache();
+
   /** Return the index of an object type (in a private list of all object types).
    * This returns a 0-based index if the object type was found and -1 if it
    * was not.
@@ -819,6 +858,19 @@ protected:
   /// The size of the cache in MiB.
   double CacheSize;
 
+  /** The cache shared with the other readers of the file, for the arrays that
+   * only depend on the file, or nullptr when UseSharedCache is false.
+   */
+  vtkExodusIICache* SharedCache;
+  std::string SharedCacheFileName;
+  bool UseSharedCache;
+
+  /** The arrays used by the current request that are not owned by this reader's
+   * cache: those read ahead by ReadResultArrays() and those of the shared
+   * cache, which other readers may drop at any time.
+   */
+  std::map<vtkExodusIICacheKey, vtkSmartPointer<vtkDataArray>> RequestArrays;
+
   vtkTypeBool ApplyDisplacements;
   float DisplacementMagnitude;
   vtkTypeBool HasModeShapes;
@@ -0,0 +1,473 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestOpenFOAMReaderSMPBackends.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that vtkOpenFOAMReader creates the same output with the Sequential
+// and the STDThread SMP backends, on a case written by the test with
+// hexahedra, polyhedra, several patches, volume fields and a point field.
+// The cells are only built concurrently when more than one thread is
+// available.
+
+#include "vtkOpenFOAMReader.h"
+
+#include "vtkCellArray.h"
+#include "vtkCellData.h"
+#include "vtkDataArray.h"
+#include "vtkDataObjectTreeIterator.h"
+#include "vtkIdTypeArray.h"
+#include "vtkInformation.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+#include "vtkTestUtilities.h"
+#include "vtkUnsignedCharArray.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <vtksys/FStream.hxx>
+#include <vtksys/SystemTools.hxx>
+
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+// Enough cells for several windows of chunks with two threads
+const int NX = 48;
+const int NY = 40;
+const int NZ = 36;
+
+int PointId(int i, int j, int k)
+{
+  return i + (NX + 1) * (j + (NY + 1) * k);
+}
+
+int CellId(int i, int j, int k)
+{
+  return i + NX * (j + NY * k);
+}
+
+void WriteHeader(std::ostream& os, const char* className, const char* object)
+{
+  os << "FoamFile\n{\n    version 2.0;\n    format ascii;\n    class " << className
+     << ";\n    object " << object << ";\n}\n\n";
+}
+
+// The mesh is a block of hexahedra. The x faces with i % 4 == 0 have an
+// additional point on their first edge, which makes their cells polyhedra.
+struct Mesh
+{
+  std::vector<std::vector<int>> Faces;
+  std::vector<int> Owner;
+  std::vector<int> Neighbour;
+  std::vector<int> PatchSizes;
+  int NumberOfPoints;
+
+  Mesh()
+  {
+    this->NumberOfPoints = (NX + 1) * (NY + 1) * (NZ + 1);
+
+    // Internal faces, in upper triangular order
+    for (int k = 0; k < NZ; ++k)
+    {
+      for (int j = 0; j < NY; ++j)
+      {
+        for (int i = 0; i < NX; ++i)
+        {
+          if (i + 1 < NX)
+          {
+            this->AddXFace(i + 1, j, k, false, CellId(i, j, k), CellId(i + 1, j, k));
+          }
+          if (j + 1 < NY)
+          {
+            this->AddYFace(i, j + 1, k, false, CellId(i, j, k), CellId(i, j + 1, k));
+          }
+          if (k + 1 < NZ)
+          {
+            this->AddZFace(i, j, k + 1, false, CellId(i, j, k), CellId(i, j, k + 1));
+          }
+        }
+      }
+    }
+
+    // Patches inlet (x min), outlet (x max) and walls
+    size_t start = this->Faces.size();
+    for (int k = 0; k < NZ; ++k)
+    {
+      for (int j = 0; j < NY; ++j)
+      {
+        this->AddXFace(0, j, k, true, CellId(0, j, k), -1);
+      }
+    }
+    this->PatchSizes.push_back(static_cast<int>(this->Faces.size() - start));
+    start = this->Faces.size();
+    for (int k = 0; k < NZ; ++k)
+    {
+      for (int j = 0; j < NY; ++j)
+      {
+        this->AddXFace(NX, j, k, false, CellId(NX - 1, j, k), -1);
+      }
+    }
+    this->PatchSizes.push_back(static_cast<int>(this->Faces.size() - start));
+    start = this->Faces.size();
+    for (int k = 0; k < NZ; ++k)
+    {
+      for (int i = 0; i < NX; ++i)
+      {
+        this->AddYFace(i, 0, k, true, CellId(i, 0, k), -1);
+        this->AddYFace(i, NY, k, false, CellId(i, NY - 1, k), -1);
+      }
+    }
+    for (int j = 0; j < NY; ++j)
+    {
+      for (int i = 0; i < NX; ++i)
+      {
+        this->AddZFace(i, j, 0, true, CellId(i, j, 0), -1);
+        this->AddZFace(i, j, NZ, false, CellId(i, j, NZ - 1), -1);
+      }
+    }
+    this->PatchSizes.push_back(static_cast<int>(this->Faces.size() - start));
+  }
+
+  void AddFace(std::vector<int> face, bool reverse, int owner, int neighbour)
+  {
+    if (reverse)
+    {
+      std::reverse(face.begin() + 1, face.end());
+    }
+    this->Faces.push_back(face);
+    this->Owner.push_back(owner);
+    if (neighbour >= 0)
+    {
+      this->Neighbour.push_back(neighbour);
+    }
+  }
+
+  void AddXFace(int i, int j, int k, bool reverse, int owner, int neighbour)
+  {
+    std::vector<int> face = { PointId(i, j, k) };
+    if (i % 4 == 0)
+    {
+      face.push_back(this->NumberOfPoints++);
+    }
+    face.push_back(PointId(i, j + 1, k));
+    face.push_back(PointId(i, j + 1, k + 1));
+    face.push_back(PointId(i, j, k + 1));
+    this->AddFace(face, reverse, owner, neighbour);
+  }
+
+  void AddYFace(int i, int j, int k, bool reverse, int owner, int neighbour)
+  {
+    this->AddFace({ PointId(i, j, k), PointId(i, j, k + 1), PointId(i + 1, j, k + 1),
+                    PointId(i + 1, j, k) },
+      reverse, owner, neighbour);
+  }
+
+  void AddZFace(int i, int j, int k, bool reverse, int owner, int neighbour)
+  {
+    this->AddFace({ PointId(i, j, k), PointId(i + 1, j, k), PointId(i + 1, j + 1, k),
+                    PointId(i, j + 1, k) },
+      reverse, owner, neighbour);
+  }
+};
+
+void WriteLabelList(const std::string& fileName, const char* object, const std::vector<int>& list)
+{
+  vtksys::ofstream os(fileName.c_str());
+  WriteHeader(os, "labelList", object);
+  os << list.size() << "\n(\n";
+  for (int label : list)
+  {
+    os << label << "\n";
+  }
+  os << ")\n";
+}
+
+bool WriteCase(const std::string& caseDir)
+{
+  const std::string meshDir = caseDir + "/constant/polyMesh";
+  const std::string timeDir = caseDir + "/1";
+  if (!vtksys::SystemTools::MakeDirectory(meshDir) ||
+    !vtksys::SystemTools::MakeDirectory(timeDir) ||
+    !vtksys::SystemTools::MakeDirectory(caseDir + "/system"))
+  {
+    std::cerr << "Cannot create the case " << caseDir << "." << std::endl;
+    return false;
+  }
+  vtksys::ofstream(std::string(caseDir + "/case.foam").c_str());
+  {
+    vtksys::ofstream os(std::string(caseDir + "/system/controlDict").c_str());
+    WriteHeader(os, "dictionary", "controlDict");
+    os << "application icoFoam;\nstartTime 0;\nendTime 1;\ndeltaT 1;\n"
+          "writeControl timeStep;\nwriteInterval 1;\n";
+  }
+
+  const Mesh mesh;
+  {
+    vtksys::ofstream os(std::string(meshDir + "/points").c_str());
+    WriteHeader(os, "vectorField", "points");
+    os << mesh.NumberOfPoints << "\n(\n";
+    for (int k = 0; k <= NZ; ++k)
+    {
+      for (int j = 0; j <= NY; ++j)
+      {
+        for (int i = 0; i <= NX; ++i)
+        {
+          os << "(" << 0.1 * i << " " << 0.1 * j + 0.01 * i << " " << 0.1 * k << ")\n";
+        }
+      }
+    }
+    // The additional points, in the order of their faces
+    for (const std::vector<int>& face : mesh.Faces)
+    {
+      if (face.size() == 5)
+      {
+        const int p = face[0];
+        os << "(" << 0.1 * (p % (NX + 1)) << " "
+           << 0.1 * (p / (NX + 1) % (NY + 1)) + 0.01 * (p % (NX + 1)) + 0.05 << " "
+           << 0.1 * (p / ((NX + 1) * (NY + 1))) << ")\n";
+      }
+    }
+    os << ")\n";
+  }
+  {
+    vtksys::ofstream os(std::string(meshDir + "/faces").c_str());
+    WriteHeader(os, "faceList", "faces");
+    os << mesh.Faces.size() << "\n(\n";
+    for (const std::vector<int>& face : mesh.Faces)
+    {
+      os << face.size() << "(";
+      for (size_t i = 0; i < face.size(); ++i)
+      {
+        os << (i ? " " : "") << face[i];
+      }
+      os << ")\n";
+    }
+    os << ")\n";
+  }
+  WriteLabelList(meshDir + "/owner", "owner", mesh.Owner);
+  WriteLabelList(meshDir + "/neighbour", "neighbour", mesh.Neighbour);
+
+  const char* const patchNames[] = { "inlet", "outlet", "walls" };
+  {
+    vtksys::ofstream os(std::string(meshDir + "/boundary").c_str());
+    WriteHeader(os, "polyBoundaryMesh", "boundary");
+    os << "3\n(\n";
+    size_t start = mesh.Neighbour.size();
+    for (int patchi = 0; patchi < 3; ++patchi)
+    {
+      os << patchNames[patchi] << "\n{\n    type " << (patchi == 2 ? "wall" : "patch")
+         << ";\n    nFaces " << mesh.PatchSizes[patchi] << ";\n    startFace " << start
+         << ";\n}\n";
+      start += mesh.PatchSizes[patchi];
+    }
+    os << ")\n";
+  }
+
+  const int nCells = NX * NY * NZ;
+  {
+    vtksys::ofstream os(std::string(timeDir + "/p").c_str());
+    WriteHeader(os, "volScalarField", "p");
+    os << "dimensions [0 2 -2 0 0 0 0];\n\ninternalField nonuniform List<scalar>\n"
+       << nCells << "\n(\n";
+    for (int celli = 0; celli < nCells; ++celli)
+    {
+      os << 0.001 * (celli % 997) << "\n";
+    }
+    os << ")\n;\n\nboundaryField\n{\n"
+          "    inlet\n    {\n        type fixedValue;\n        value uniform 1;\n    }\n"
+          "    outlet\n    {\n        type zeroGradient;\n    }\n"
+          "    walls\n    {\n        type zeroGradient;\n    }\n}\n";
+  }
+  {
+    vtksys::ofstream os(std::string(timeDir + "/U").c_str());
+    WriteHeader(os, "volVectorField", "U");
+    os << "dimensions [0 1 -1 0 0 0 0];\n\ninternalField nonuniform List<vector>\n"
+       << nCells << "\n(\n";
+    for (int celli = 0; celli < nCells; ++celli)
+    {
+      os << "(" << celli % 13 << " " << -(celli % 7) << " " << 0.5 * (celli % 5) << ")\n";
+    }
+    os << ")\n;\n\nboundaryField\n{\n"
+          "    inlet\n    {\n        type fixedValue;\n        value uniform (1 0 0);\n    }\n"
+          "    outlet\n    {\n        type zeroGradient;\n    }\n"
+          "    walls\n    {\n        type noSlip;\n    }\n}\n";
+  }
+  {
+    vtksys::ofstream os(std::string(timeDir + "/pointDisplacement").c_str());
+    WriteHeader(os, "pointScalarField", "pointDisplacement");
+    os << "dimensions [0 1 0 0 0 0 0];\n\ninternalField nonuniform List<scalar>\n"
+       << mesh.NumberOfPoints << "\n(\n";
+    for (int pointi = 0; pointi < mesh.NumberOfPoints; ++pointi)
+    {
+      os << 0.01 * (pointi % 101) << "\n";
+    }
+    os << ")\n;\n\nboundaryField\n{\n"
+          "    inlet\n    {\n        type fixedValue;\n        value uniform 0;\n    }\n"
+          "    outlet\n    {\n        type zeroGradient;\n    }\n"
+          "    walls\n    {\n        type zeroGradient;\n    }\n}\n";
+  }
+  return true;
+}
+
+vtkSmartPointer<vtkMultiBlockDataSet> Read(const std::string& fileName)
+{
+  vtkNew<vtkOpenFOAMReader> reader;
+  reader->SetFileName(fileName.c_str());
+  reader->UpdateInformation();
+  reader->EnableAllCellArrays();
+  reader->EnableAllPointArrays();
+  reader->EnableAllPatchArrays();
+  reader->CreateCellToPointOn();
+  reader->Update();
+  return reader->GetOutput();
+}
+
+bool SameArray(vtkDataArray* a, vtkDataArray* b, const std::string& what)
+{
+  if (!a || !b || a->GetNumberOfTuples() != b->GetNumberOfTuples() ||
+    a->GetNumberOfComponents() != b->GetNumberOfComponents())
+  {
+    std::cerr << "Different size of " << what << "." << std::endl;
+    return false;
+  }
+  for (vtkIdType i = 0; i < a->GetNumberOfTuples(); ++i)
+  {
+    for (int c = 0; c < a->GetNumberOfComponents(); ++c)
+    {
+      if (a->GetComponent(i, c) != b->GetComponent(i, c))
+      {
+        std::cerr << "Different " << what << " at " << i << "." << std::endl;
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool SameFieldData(vtkFieldData* a, vtkFieldData* b, const std::string& what)
+{
+  if (a->GetNumberOfArrays() != b->GetNumberOfArrays())
+  {
+    std::cerr << "Different number of " << what << " arrays." << std::endl;
+    return false;
+  }
+  for (int i = 0; i < a->GetNumberOfArrays(); ++i)
+  {
+    const char* name = a->GetArrayName(i);
+    if (!SameArray(a->GetArray(i), b->GetArray(name), what + " " + name))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool SameCells(vtkCellArray* a, vtkCellArray* b, const std::string& what)
+{
+  return SameArray(a->GetOffsetsArray(), b->GetOffsetsArray(), what + " offsets") &&
+    SameArray(a->GetConnectivityArray(), b->GetConnectivityArray(), what + " connectivity");
+}
+
+bool SameDataSet(vtkDataSet* a, vtkDataSet* b, const std::string& name)
+{
+  if (!a || !b || a->GetDataObjectType() != b->GetDataObjectType())
+  {
+    std::cerr << "Different type of block " << name << "." << std::endl;
+    return false;
+  }
+  vtkPointSet* pa = vtkPointSet::SafeDownCast(a);
+  vtkPointSet* pb = vtkPointSet::SafeDownCast(b);
+  if (pa && !SameArray(pa->GetPoints()->GetData(), pb->GetPoints()->GetData(), name + " points"))
+  {
+    return false;
+  }
+  vtkUnstructuredGrid* ga = vtkUnstructuredGrid::SafeDownCast(a);
+  vtkUnstructuredGrid* gb = vtkUnstructuredGrid::SafeDownCast(b);
+  if (ga)
+  {
+    if (!SameArray(ga->GetCellTypesArray(), gb->GetCellTypesArray(), name + " cell types") ||
+      !SameCells(ga->GetCells(), gb->GetCells(), name + " cells") ||
+      ((ga->GetFaces() || gb->GetFaces()) &&
+        (!SameArray(ga->GetFaces(), gb->GetFaces(), name + " faces") ||
+          !SameArray(ga->GetFaceLocations(), gb->GetFaceLocations(), name + " face locations"))))
+    {
+      return false;
+    }
+  }
+  vtkPolyData* da = vtkPolyData::SafeDownCast(a);
+  vtkPolyData* db = vtkPolyData::SafeDownCast(b);
+  if (da && !SameCells(da->GetPolys(), db->GetPolys(), name + " polygons"))
+  {
+    return false;
+  }
+  return SameFieldData(a->GetPointData(), b->GetPointData(), name + " point data") &&
+    SameFieldData(a->GetCellData(), b->GetCellData(), name + " cell data");
+}
+} // anonymous namespace
+
+int TestOpenFOAMReaderSMPBackends(int argc, char* argv[])
+{
+  char* tempDir =
+    vtkTestUtilities::GetArgOrEnvOrDefault("-T", argc, argv, "VTK_TEMP_DIR", "Testing/Temporary");
+  const std::string caseDir = std::string(tempDir) + "/TestOpenFOAMReaderSMPBackends";
+  delete[] tempDir;
+  if (!WriteCase(caseDir))
+  {
+    return EXIT_FAILURE;
+  }
+  const std::string fileName = caseDir + "/case.foam";
+
+  vtkSMPTools::SetBackend("Sequential");
+  vtkSmartPointer<vtkMultiBlockDataSet> sequential = Read(fileName);
+  if (!vtkSMPTools::SetBackend("STDThread"))
+  {
+    std::cout << "STDThread backend not available, skipping the comparison." << std::endl;
+    return EXIT_SUCCESS;
+  }
+  vtkSMPTools::Initialize(2);
+  vtkSmartPointer<vtkMultiBlockDataSet> threaded = Read(fileName);
+
+  vtkNew<vtkDataObjectTreeIterator> it;
+  it->SetDataSet(sequential);
+  it->VisitOnlyLeavesOn();
+  int nLeaves = 0;
+  bool hasPolyhedra = false;
+  for (it->InitTraversal(); !it->IsDoneWithTraversal(); it->GoToNextItem())
+  {
+    vtkDataSet* a = vtkDataSet::SafeDownCast(it->GetCurrentDataObject());
+    vtkDataSet* b = vtkDataSet::SafeDownCast(threaded->GetDataSet(it));
+    const char* name = it->GetCurrentMetaData()->Get(vtkCompositeDataSet::NAME());
+    if (!SameDataSet(a, b, name ? name : "(unnamed)"))
+    {
+      return EXIT_FAILURE;
+    }
+    vtkUnstructuredGrid* grid = vtkUnstructuredGrid::SafeDownCast(a);
+    hasPolyhedra = hasPolyhedra || (grid && grid->GetFaces());
+    ++nLeaves;
+  }
+
+  // The internal mesh and the three patches
+  if (nLeaves != 4 || !hasPolyhedra)
+  {
+    std::cerr << "Unexpected output: " << nLeaves << " blocks, "
+              << (hasPolyhedra ? "with" : "without") << " polyhedra." << std::endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
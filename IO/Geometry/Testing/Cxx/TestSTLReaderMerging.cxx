@@ -0,0 +1,145 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestSTLReaderMerging.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that the points merged by vtkSTLReader without a locator are the
+// same as those merged with vtkMergePoints.
+
+#include "vtkCellArray.h"
+#include "vtkCellData.h"
+#include "vtkDataArray.h"
+#include "vtkMergePoints.h"
+#include "vtkMinimalStandardRandomSequence.h"
+#include "vtkNew.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSTLReader.h"
+#include "vtkSTLWriter.h"
+#include "vtkTestUtilities.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+namespace
+{
+//----------------------------------------------------------------------------
+// Triangles on a coarse grid, which share many of their points, with
+// degenerate triangles and the two zeros.
+void WriteTriangles(const std::string& fileName, int fileType)
+{
+  vtkNew<vtkMinimalStandardRandomSequence> random;
+  random->SetSeed(42);
+  vtkNew<vtkPoints> points;
+  vtkNew<vtkCellArray> polys;
+  for (vtkIdType i = 0; i < 3 * 20000; ++i)
+  {
+    double x[3];
+    for (int j = 0; j < 3; ++j)
+    {
+      random->Next();
+      x[j] = static_cast<int>(random->GetRangeValue(-10, 10)) * 0.25;
+      x[j] = x[j] == 0 && i % 2 ? -0.0 : x[j];
+    }
+    points->InsertNextPoint(x);
+  }
+  for (vtkIdType i = 0; i < 20000; ++i)
+  {
+    vtkIdType triangle[3] = { 3 * i, 3 * i + 1, i % 100 == 0 ? 3 * i : 3 * i + 2 };
+    polys->InsertNextCell(3, triangle);
+  }
+  vtkNew<vtkPolyData> polyData;
+  polyData->SetPoints(points);
+  polyData->SetPolys(polys);
+
+  vtkNew<vtkSTLWriter> writer;
+  writer->SetInputData(polyData);
+  writer->SetFileName(fileName.c_str());
+  writer->SetFileType(fileType);
+  writer->Write();
+}
+
+//----------------------------------------------------------------------------
+bool HaveSameValues(vtkDataArray* array1, vtkDataArray* array2)
+{
+  if (array1->GetNumberOfValues() != array2->GetNumberOfValues())
+  {
+    return false;
+  }
+  for (vtkIdType i = 0; i < array1->GetNumberOfValues(); ++i)
+  {
+    if (array1->GetVariantValue(i) != array2->GetVariantValue(i))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------------
+bool TestMerging(const std::string& fileName, bool scalarTags)
+{
+  vtkNew<vtkSTLReader> reader;
+  reader->SetFileName(fileName.c_str());
+  reader->SetScalarTags(scalarTags);
+  reader->Update();
+  vtkPolyData* output = reader->GetOutput();
+
+  vtkNew<vtkSTLReader> referenceReader;
+  referenceReader->SetFileName(fileName.c_str());
+  referenceReader->SetScalarTags(scalarTags);
+  vtkNew<vtkMergePoints> locator;
+  referenceReader->SetLocator(locator);
+  referenceReader->Update();
+  vtkPolyData* reference = referenceReader->GetOutput();
+
+  if (output->GetNumberOfPoints() >= 3 * output->GetNumberOfPolys() ||
+    !HaveSameValues(output->GetPoints()->GetData(), reference->GetPoints()->GetData()) ||
+    !HaveSameValues(
+      output->GetPolys()->GetOffsetsArray(), reference->GetPolys()->GetOffsetsArray()) ||
+    !HaveSameValues(output->GetPolys()->GetConnectivityArray(),
+      reference->GetPolys()->GetConnectivityArray()))
+  {
+    std::cerr << "Wrong points or triangles merged for " << fileName << std::endl;
+    return false;
+  }
+  vtkDataArray* scalars = output->GetCellData()->GetScalars();
+  vtkDataArray* referenceScalars = reference->GetCellData()->GetScalars();
+  if ((scalars == nullptr) != (referenceScalars == nullptr) ||
+    (scalars && !HaveSameValues(scalars, referenceScalars)))
+  {
+    std::cerr << "Wrong scalars merged for " << fileName << std::endl;
+    return false;
+  }
+  return true;
+}
+}
+
+//----------------------------------------------------------------------------
+int TestSTLReaderMerging(int argc, char* argv[])
+{
+  char* tempDir =
+    vtkTestUtilities::GetArgOrEnvOrDefault("-T", argc, argv, "VTK_TEMP_DIR", "Testing/Temporary");
+  std::string binaryFileName = std::string(tempDir) + "/TestSTLReaderMerging-binary.stl";
+  std::string asciiFileName = std::string(tempDir) + "/TestSTLReaderMerging-ascii.stl";
+  delete[] tempDir;
+
+  WriteTriangles(binaryFileName, VTK_BINARY);
+  WriteTriangles(asciiFileName, VTK_ASCII);
+  if (!TestMerging(binaryFileName, false) || !TestMerging(asciiFileName, false) ||
+    !TestMerging(asciiFileName, true))
+  {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
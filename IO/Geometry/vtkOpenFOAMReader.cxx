@@ -194,6 +194,7 @@
 #include "vtkPolyhedron.h"
 #include "vtkPyramid.h"
 #include "vtkQuad.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkSortDataArray.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
@@ -364,6 +365,7 @@ void remapFoamTuple<true>(double data[])
 //------------------------------------------------------------------------------
 // Forward Declarations
 
+struct vtkFoamCellBuffer;
 struct vtkFoamDict;
 struct vtkFoamEntry;
 struct vtkFoamEntryValue;
@@ -1240,6 +1242,16 @@ private:
 #endif
   );
 
+  // Insert the cells [begin, end) of the volume mesh
+  void InsertCellRangeToGrid(vtkFoamCellBuffer& cells, vtkIdType begin, vtkIdType end,
+    const vtkFoamLabelListList& meshCells, const vtkFoamLabelListList& meshFaces,
+    vtkIdList* cellLabels
+#if VTK_FOAMFILE_DECOMPOSE_POLYHEDRA
+    ,
+    vtkIdTypeArray* additionalCellIds, vtkFloatArray* pointArray, vtkIdType& nAdditionalPoints
+#endif
+  );
+
   vtkUnstructuredGrid* MakeInternalMesh(std::unique_ptr<vtkFoamLabelListList>& meshCellsPtr,
     const vtkFoamLabelListList& meshFaces, vtkFloatArray* pointArray);
 
@@ -1263,11 +1275,16 @@ private:
 
   // read and create cell/point fields
   bool ReadFieldFile(vtkFoamIOobject& io, vtkFoamDict& dict, const std::string& varName,
-    const vtkDataArraySelection* selection);
+    const vtkDataArraySelection* selection, bool reportErrors = true);
   vtkSmartPointer<vtkFloatArray> FillField(vtkFoamEntry& entry, vtkIdType nElements,
     const vtkFoamIOobject& io, vtkFoamTypes::dataType fieldDataType);
-  void GetVolFieldAtTimeStep(const std::string& varName, bool isInternalField = false);
-  void GetPointFieldAtTimeStep(const std::string& varName);
+  void GetVolFieldAtTimeStep(vtkFoamIOobject& io, vtkFoamDict& dict, const std::string& varName,
+    bool isInternalField = false);
+  void GetPointFieldAtTimeStep(vtkFoamIOobject& io, vtkFoamDict& dict);
+
+  // read the vol, internal and point field files of the time step concurrently,
+  // and add them to the meshes in order
+  void GetFieldsAtTimeStep(vtkIdType& nFieldsRead, vtkIdType nFieldsToRead);
 
 #if VTK_FOAMFILE_FINITE_AREA
   void GetAreaFieldAtTimeStep(const std::string& varName);
@@ -7178,9 +7195,94 @@ bool vtkOpenFOAMReaderPrivate::CheckFaceList(const vtkFoamLabelListList& faces)
   return true;
 }
 
+//------------------------------------------------------------------------------
+// struct vtkFoamCellBuffer
+// The cells of a part of a volume mesh. They are inserted into the mesh
+// directly, or kept to be inserted later, in order, when the parts of the
+// mesh are created concurrently.
+struct vtkFoamCellBuffer
+{
+  explicit vtkFoamCellBuffer(vtkUnstructuredGrid* grid = nullptr)
+    : Grid(grid)
+  {
+  }
+
+  void InsertNextCell(int type, vtkIdType nPoints, const vtkIdType* points)
+  {
+    if (this->Grid)
+    {
+      this->Grid->InsertNextCell(type, nPoints, points);
+      return;
+    }
+    this->Types.push_back(static_cast<unsigned char>(type));
+    this->Sizes.push_back(nPoints);
+    this->Points.insert(this->Points.end(), points, points + nPoints);
+  }
+
+  // A polyhedron, with its face stream
+  void InsertNextCell(int type, vtkIdType nPoints, const vtkIdType* points, vtkIdType nFaces,
+    const vtkIdType* faces)
+  {
+    if (this->Grid)
+    {
+      this->Grid->InsertNextCell(type, nPoints, points, nFaces, faces);
+      return;
+    }
+    this->Types.push_back(static_cast<unsigned char>(type));
+    this->Sizes.push_back(nPoints);
+    this->Sizes.push_back(nFaces);
+    this->Points.insert(this->Points.end(), points, points + nPoints);
+    this->Points.insert(this->Points.end(), faces, faces + FaceStreamSize(nFaces, faces));
+  }
+
+  // Insert the kept cells into grid and release them
+  void InsertInto(vtkUnstructuredGrid* grid)
+  {
+    const vtkIdType* sizes = this->Sizes.data();
+    const vtkIdType* points = this->Points.data();
+    for (const unsigned char type : this->Types)
+    {
+      const vtkIdType nPoints = *sizes++;
+      if (type == VTK_POLYHEDRON)
+      {
+        const vtkIdType nFaces = *sizes++;
+        const vtkIdType* faces = points + nPoints;
+        grid->InsertNextCell(type, nPoints, points, nFaces, faces);
+        points = faces + FaceStreamSize(nFaces, faces);
+      }
+      else
+      {
+        grid->InsertNextCell(type, nPoints, points);
+        points += nPoints;
+      }
+    }
+    std::vector<unsigned char>().swap(this->Types);
+    std::vector<vtkIdType>().swap(this->Sizes);
+    std::vector<vtkIdType>().swap(this->Points);
+  }
+
+private:
+  static vtkIdType FaceStreamSize(vtkIdType nFaces, const vtkIdType* faces)
+  {
+    vtkIdType size = 0;
+    for (vtkIdType facei = 0; facei < nFaces; ++facei)
+    {
+      size += faces[size] + 1;
+    }
+    return size;
+  }
+
+  vtkUnstructuredGrid* Grid;
+  std::vector<unsigned char> Types;
+  std::vector<vtkIdType> Sizes;
+  std::vector<vtkIdType> Points;
+};
+
 //------------------------------------------------------------------------------
 // determine cell shape and insert the cell into the mesh
-// hexahedron, prism, pyramid, tetrahedron and decompose polyhedron
+// hexahedron, prism, pyramid, tetrahedron and decompose polyhedron.
+// Without decomposition, the shapes of chunks of cells are determined
+// concurrently, and the cells are then inserted in order.
 void vtkOpenFOAMReaderPrivate::InsertCellsToGrid(
   vtkUnstructuredGrid* internalMesh, std::unique_ptr<vtkFoamLabelListList>& meshCellsPtr,
   const vtkFoamLabelListList& meshFaces, vtkIdList* cellLabels
@@ -7190,15 +7292,6 @@ void vtkOpenFOAMReaderPrivate::InsertCellsToGrid(
 #endif
 )
 {
-  // Scratch arrays
-  vtkFoamStackVector<vtkIdType, 256> cellPoints;  // For inserting primitive cell points
-  vtkFoamStackVector<vtkIdType, 1024> polyPoints; // For inserting polyhedral faces and sizes
-  vtkFoamLabelListList::CellType cellFaces;       // For analyzing cell types (shapes)
-  vtkFoamLabelListList::CellType facePoints;      // For processing individual cell faces
-
-  const bool faceOwner64Bit = ::Is64BitArray(this->FaceOwner);
-  const bool cellLabels64Bit = faceOwner64Bit; // reasonable assumption
-
   const vtkIdType nCells = (cellLabels == nullptr ? this->NumCells : cellLabels->GetNumberOfIds());
 
 #if VTK_FOAMFILE_DECOMPOSE_POLYHEDRA
@@ -7221,7 +7314,86 @@ void vtkOpenFOAMReaderPrivate::InsertCellsToGrid(
   }
   const auto& meshCells = *meshCellsPtr;
 
-  for (vtkIdType celli = 0; celli < nCells; ++celli)
+  // Cells are analyzed concurrently in chunks of this many cells
+  const vtkIdType chunkSize = 8192;
+  const vtkIdType nThreads = std::max(1, vtkSMPTools::GetEstimatedNumberOfThreads());
+
+#if VTK_FOAMFILE_DECOMPOSE_POLYHEDRA
+  // The decomposition appends points and cells in the cell order
+  if (additionalCells != nullptr)
+  {
+    vtkFoamCellBuffer cells(internalMesh);
+    this->InsertCellRangeToGrid(cells, 0, nCells, meshCells, meshFaces, cellLabels,
+      additionalCells, pointArray, nAdditionalPoints);
+    return;
+  }
+#endif
+  if (nThreads == 1 || nCells <= chunkSize)
+  {
+    vtkFoamCellBuffer cells(internalMesh);
+    this->InsertCellRangeToGrid(cells, 0, nCells, meshCells, meshFaces, cellLabels
+#if VTK_FOAMFILE_DECOMPOSE_POLYHEDRA
+      ,
+      nullptr, nullptr, nAdditionalPoints
+#endif
+    );
+    return;
+  }
+
+  // Each chunk of a window keeps its cells, which are then inserted in
+  // order. The window bounds the number of cells kept.
+  std::vector<vtkFoamCellBuffer> chunks(4 * nThreads);
+  const vtkIdType windowSize = chunkSize * static_cast<vtkIdType>(chunks.size());
+  for (vtkIdType windowStart = 0; windowStart < nCells; windowStart += windowSize)
+  {
+    const vtkIdType windowEnd = std::min(windowStart + windowSize, nCells);
+    const vtkIdType nChunks = (windowEnd - windowStart + chunkSize - 1) / chunkSize;
+    vtkSMPTools::For(0, nChunks, 1, [&](vtkIdType beginChunk, vtkIdType endChunk) {
+#if VTK_FOAMFILE_DECOMPOSE_POLYHEDRA
+      vtkIdType unusedAdditionalPoints = 0;
+#endif
+      for (vtkIdType chunki = beginChunk; chunki < endChunk; ++chunki)
+      {
+        const vtkIdType begin = windowStart + chunki * chunkSize;
+        this->InsertCellRangeToGrid(chunks[chunki], begin, std::min(begin + chunkSize, windowEnd),
+          meshCells, meshFaces, cellLabels
+#if VTK_FOAMFILE_DECOMPOSE_POLYHEDRA
+          ,
+          nullptr, nullptr, unusedAdditionalPoints
+#endif
+        );
+      }
+    });
+    for (vtkIdType chunki = 0; chunki < nChunks; ++chunki)
+    {
+      chunks[chunki].InsertInto(internalMesh);
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+// determine the shape of the cells [begin, end) and insert them into cells
+void vtkOpenFOAMReaderPrivate::InsertCellRangeToGrid(vtkFoamCellBuffer& cells, vtkIdType begin,
+  vtkIdType end, const vtkFoamLabelListList& meshCells, const vtkFoamLabelListList& meshFaces,
+  vtkIdList* cellLabels
+#if VTK_FOAMFILE_DECOMPOSE_POLYHEDRA
+  ,
+  vtkIdTypeArray* additionalCells, vtkFloatArray* pointArray, vtkIdType& nAdditionalPoints
+#endif
+)
+{
+  // Scratch arrays
+  vtkFoamStackVector<vtkIdType, 256> cellPoints;  // For inserting primitive cell points
+  vtkFoamStackVector<vtkIdType, 1024> polyPoints; // For inserting polyhedral faces and sizes
+  vtkFoamLabelListList::CellType cellFaces;       // For analyzing cell types (shapes)
+  vtkFoamLabelListList::CellType facePoints;      // For processing individual cell faces
+
+  const bool faceOwner64Bit = ::Is64BitArray(this->FaceOwner);
+#if VTK_FOAMFILE_DECOMPOSE_POLYHEDRA
+  const bool cellLabels64Bit = faceOwner64Bit; // reasonable assumption
+#endif
+
+  for (vtkIdType celli = begin; celli < end; ++celli)
   {
     vtkIdType cellId = celli;
     if (cellLabels != nullptr)
@@ -7230,7 +7402,8 @@ void vtkOpenFOAMReaderPrivate::InsertCellsToGrid(
       if (cellId < 0 || cellId >= this->NumCells)
       {
         // sanity check. bad values should have been removed before this
-        vtkWarningMacro(<< "cellLabels id " << cellId << " exceeds the number of cells " << nCells);
+        vtkWarningMacro(<< "cellLabels id " << cellId << " exceeds the number of cells "
+                        << this->NumCells);
         continue;
       }
     }
@@ -7462,7 +7635,7 @@ void vtkOpenFOAMReaderPrivate::InsertCellsToGrid(
       }
 
       // Add HEXAHEDRON (hex) cell to the mesh
-      internalMesh->InsertNextCell(VTK_HEXAHEDRON, 8, cellPoints.data());
+      cells.InsertNextCell(VTK_HEXAHEDRON, 8, cellPoints.data());
     }
 
     // OpenFOAM "prism" | vtkWedge
@@ -7648,7 +7821,7 @@ void vtkOpenFOAMReaderPrivate::InsertCellsToGrid(
         }
 
         // Add WEDGE (prism) cell to the mesh
-        internalMesh->InsertNextCell(VTK_WEDGE, 6, cellPoints.data());
+        cells.InsertNextCell(VTK_WEDGE, 6, cellPoints.data());
       }
     }
 
@@ -7720,7 +7893,7 @@ void vtkOpenFOAMReaderPrivate::InsertCellsToGrid(
       cellPoints[nCellPoints++] = apexMeshPointi;
 
       // Add tetra or pyramid to the mesh
-      internalMesh->InsertNextCell(cellType, nCellPoints, cellPoints.data());
+      cells.InsertNextCell(cellType, nCellPoints, cellPoints.data());
     }
 
     // Polyhedron cell (vtkPolyhedron)
@@ -7743,7 +7916,7 @@ void vtkOpenFOAMReaderPrivate::InsertCellsToGrid(
         if (allEmpty)
         {
           vtkWarningMacro("Warning: No points in cellId " << cellId);
-          internalMesh->InsertNextCell(VTK_EMPTY_CELL, 0, cellPoints.data());
+          cells.InsertNextCell(VTK_EMPTY_CELL, 0, cellPoints.data());
           continue;
         }
       }
@@ -7864,7 +8037,7 @@ void vtkOpenFOAMReaderPrivate::InsertCellsToGrid(
             if (firstCell)
             {
               firstCell = false;
-              internalMesh->InsertNextCell(VTK_PYRAMID, 5, cellPoints.data());
+              cells.InsertNextCell(VTK_PYRAMID, 5, cellPoints.data());
             }
             else
             {
@@ -7893,7 +8066,7 @@ void vtkOpenFOAMReaderPrivate::InsertCellsToGrid(
             if (firstCell)
             {
               firstCell = false;
-              internalMesh->InsertNextCell(VTK_TETRA, 4, cellPoints.data());
+              cells.InsertNextCell(VTK_TETRA, 4, cellPoints.data());
             }
             else
             {
@@ -8006,7 +8179,7 @@ void vtkOpenFOAMReaderPrivate::InsertCellsToGrid(
         }
 
         // Create the poly cell and insert it into the mesh
-        internalMesh->InsertNextCell(VTK_POLYHEDRON, static_cast<vtkIdType>(nCellPoints),
+        cells.InsertNextCell(VTK_POLYHEDRON, static_cast<vtkIdType>(nCellPoints),
           cellPoints.data(), static_cast<vtkIdType>(cellFaces.size()), polyPoints.data());
       }
     }
@@ -8207,6 +8380,10 @@ vtkMultiBlockDataSet* vtkOpenFOAMReaderPrivate::MakeBoundaryMesh(
   std::vector<std::vector<vtkIdType>> procCellList;
   vtkSmartPointer<vtkTypeInt8Array> pointTypes;
 
+  // The active patches, and their meshes
+  std::vector<vtkIdType> activePatches;
+  std::vector<vtkPolyData*> patchMeshes;
+
   if (this->Parent->GetCreateCellToPoint())
   {
     // Create global to AllBoundaries point map
@@ -8280,10 +8457,11 @@ vtkMultiBlockDataSet* vtkOpenFOAMReaderPrivate::MakeBoundaryMesh(
       continue;
     }
 
-    // Create the boundary patch mesh
+    // Create the boundary patch mesh, filled below
     vtkNew<vtkPolyData> bm;
     ::AppendBlock(boundaryMesh, bm, patch.name_);
-    bm->AllocateEstimate(nFaces, 1);
+    activePatches.push_back(patchi);
+    patchMeshes.push_back(bm);
 
     // Local to global point index mapping
     vtkDataArray* bpMap;
@@ -8296,53 +8474,67 @@ vtkMultiBlockDataSet* vtkOpenFOAMReaderPrivate::MakeBoundaryMesh(
       bpMap = vtkTypeInt32Array::New();
     }
     this->BoundaryPointMap->push_back(bpMap);
+  }
 
-    // The point locations for the boundary
-    vtkNew<vtkFloatArray> boundaryPointArray;
-    boundaryPointArray->SetNumberOfComponents(3);
-
-    // In OpenFOAM-1.5 and earlier, meshPoints were in increasing order
-    // but this gave problems in processor point synchronisation.
-    // - now uses the order in which faces are visited
+  // The patch meshes are independent, so they are filled concurrently
+  vtkSMPTools::For(0, static_cast<vtkIdType>(activePatches.size()), 1,
+    [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        const vtkFoamPatch& patch = patches[activePatches[i]];
+        const vtkIdType startFace = patch.startFace();
+        const vtkIdType endFace = patch.endFace();
+        vtkPolyData* bm = patchMeshes[i];
+        vtkDataArray* bpMap = (*this->BoundaryPointMap)[i];
+        bm->AllocateEstimate(patch.size_, 1);
 
-    // Visit order
-    // - normally with unordered_map to create a global to local map.
-    //   However, we later use LookupValue() method on a regular list,
-    //   so unordered_set is sufficient
-    {
-      // A global to local map for marking points
-      std::unordered_set<vtkTypeInt64> markedPoints;
+        // The point locations for the boundary
+        vtkNew<vtkFloatArray> boundaryPointArray;
+        boundaryPointArray->SetNumberOfComponents(3);
 
-      vtkFoamLabelListList::CellType face;
-      for (vtkIdType facei = startFace; facei < endFace; ++facei)
-      {
-        meshFaces.GetCell(facei, face);
+        // In OpenFOAM-1.5 and earlier, meshPoints were in increasing order
+        // but this gave problems in processor point synchronisation.
+        // - now uses the order in which faces are visited
 
-        for (const auto meshPointi : face)
+        // Visit order
+        // - normally with unordered_map to create a global to local map.
+        //   However, we later use LookupValue() method on a regular list,
+        //   so unordered_set is sufficient
         {
-          auto insertion = markedPoints.emplace(meshPointi);
-          if (insertion.second)
+          // A global to local map for marking points
+          std::unordered_set<vtkTypeInt64> markedPoints;
+
+          vtkFoamLabelListList::CellType face;
+          for (vtkIdType facei = startFace; facei < endFace; ++facei)
           {
-            // A previously unvisited point
-            boundaryPointArray->InsertNextTuple(pointArray->GetPointer(3 * meshPointi));
-            AppendLabelValue(bpMap, meshPointi, meshPoints64Bit);
+            meshFaces.GetCell(facei, face);
+
+            for (const auto meshPointi : face)
+            {
+              auto insertion = markedPoints.emplace(meshPointi);
+              if (insertion.second)
+              {
+                // A previously unvisited point
+                boundaryPointArray->InsertNextTuple(pointArray->GetPointer(3 * meshPointi));
+                AppendLabelValue(bpMap, meshPointi, meshPoints64Bit);
+              }
+            }
           }
         }
-      }
-    }
-    bpMap->Squeeze();
-    boundaryPointArray->Squeeze();
+        bpMap->Squeeze();
+        boundaryPointArray->Squeeze();
 
-    vtkNew<vtkPoints> boundaryPoints;
-    boundaryPoints->SetData(boundaryPointArray);
+        vtkNew<vtkPoints> boundaryPoints;
+        boundaryPoints->SetData(boundaryPointArray);
 
-    // Set points for boundary
-    bm->SetPoints(boundaryPoints);
+        // Set points for boundary
+        bm->SetPoints(boundaryPoints);
 
-    // Insert faces to boundary mesh
-    this->InsertFacesToGrid(bm, meshFaces, startFace, endFace, nullptr, bpMap, true);
-    bpMap->ClearLookup();
-  }
+        // Insert faces to boundary mesh
+        this->InsertFacesToGrid(bm, meshFaces, startFace, endFace, nullptr, bpMap, true);
+        bpMap->ClearLookup();
+      }
+    });
 
   if (this->Parent->GetCreateCellToPoint())
   {
@@ -8633,14 +8825,17 @@ void vtkOpenFOAMReaderPrivate::InterpolateCellToPoint(vtkFloatArray* pData, vtkF
 
 //------------------------------------------------------------------------------
 bool vtkOpenFOAMReaderPrivate::ReadFieldFile(vtkFoamIOobject& io, vtkFoamDict& dict,
-  const std::string& varName, const vtkDataArraySelection* selection)
+  const std::string& varName, const vtkDataArraySelection* selection, bool reportErrors)
 {
   const std::string varPath(this->CurrentTimeRegionPath() + "/" + varName);
 
   // Open the file
   if (!io.Open(varPath))
   {
-    vtkErrorMacro(<< "Error opening " << io.GetFileName() << ": " << io.GetError());
+    if (reportErrors)
+    {
+      vtkErrorMacro(<< "Error opening " << io.GetFileName() << ": " << io.GetError());
+    }
     return false;
   }
 
@@ -8654,14 +8849,20 @@ bool vtkOpenFOAMReaderPrivate::ReadFieldFile(vtkFoamIOobject& io, vtkFoamDict& d
   // Read the field file into dictionary
   if (!dict.Read(io))
   {
-    vtkErrorMacro(<< "Error reading line " << io.GetLineNumber() << " of " << io.GetFileName()
-                  << ": " << io.GetError());
+    if (reportErrors)
+    {
+      vtkErrorMacro(<< "Error reading line " << io.GetLineNumber() << " of " << io.GetFileName()
+                    << ": " << io.GetError());
+    }
     return false;
   }
 
   if (dict.GetType() != vtkFoamToken::DICTIONARY)
   {
-    vtkErrorMacro(<< "File " << io.GetFileName() << "is not valid as a field file");
+    if (reportErrors)
+    {
+      vtkErrorMacro(<< "File " << io.GetFileName() << "is not valid as a field file");
+    }
     return false;
   }
   return true;
@@ -8911,7 +9112,7 @@ std::string vtkOpenFOAMReaderPrivate::ConstructDimensions(const vtkFoamDict& dic
 //------------------------------------------------------------------------------
 // Read volume or internal field at a timestep
 void vtkOpenFOAMReaderPrivate::GetVolFieldAtTimeStep(
-  const std::string& varName, bool isInternalField)
+  vtkFoamIOobject& io, vtkFoamDict& dict, const std::string& varName, bool isInternalField)
 {
   // Where to map data
   vtkUnstructuredGrid* internalMesh = this->InternalMesh;
@@ -8921,13 +9122,6 @@ void vtkOpenFOAMReaderPrivate::GetVolFieldAtTimeStep(
   const auto& patches = this->BoundaryDict;
   const bool faceOwner64Bit = ::Is64BitArray(this->FaceOwner);
 
-  vtkFoamIOobject io(this->CasePath, this->Parent);
-  vtkFoamDict dict;
-  if (!this->ReadFieldFile(io, dict, varName, this->Parent->CellDataArraySelection))
-  {
-    return;
-  }
-
   // For internal field (eg, volScalarField::Internal)
   const bool hasColons = (io.GetClassName().find("::Internal") != std::string::npos);
 
@@ -9416,7 +9610,7 @@ void vtkOpenFOAMReaderPrivate::GetVolFieldAtTimeStep(
 
 //------------------------------------------------------------------------------
 // Read point field at a timestep
-void vtkOpenFOAMReaderPrivate::GetPointFieldAtTimeStep(const std::string& varName)
+void vtkOpenFOAMReaderPrivate::GetPointFieldAtTimeStep(vtkFoamIOobject& io, vtkFoamDict& dict)
 {
   // Where to map data
   vtkUnstructuredGrid* internalMesh = this->InternalMesh;
@@ -9425,13 +9619,6 @@ void vtkOpenFOAMReaderPrivate::GetPointFieldAtTimeStep(const std::string& varNam
   // Boundary information
   const auto& patches = this->BoundaryDict;
 
-  vtkFoamIOobject io(this->CasePath, this->Parent);
-  vtkFoamDict dict;
-  if (!this->ReadFieldFile(io, dict, varName, this->Parent->PointDataArraySelection))
-  {
-    return;
-  }
-
   if (io.GetClassName().compare(0, 5, "point") != 0)
   {
     vtkErrorMacro(<< io.GetFileName() << " is not a pointField");
@@ -9633,6 +9820,93 @@ void vtkOpenFOAMReaderPrivate::GetPointFieldAtTimeStep(const std::string& varNam
   // ...
 }
 
+//------------------------------------------------------------------------------
+// Read the vol, internal and point fields at a timestep.
+// The field files are independent, so each batch of them is parsed on several
+// threads, which is most of the work for large meshes. They are then added to
+// the meshes in order. The batches bound the number of parsed files in memory.
+void vtkOpenFOAMReaderPrivate::GetFieldsAtTimeStep(
+  vtkIdType& nFieldsRead, vtkIdType nFieldsToRead)
+{
+  enum fieldType
+  {
+    VOL_FIELD,
+    INTERNAL_FIELD,
+    POINT_FIELD
+  };
+
+  std::vector<std::pair<std::string, fieldType>> fieldFiles;
+  for (vtkIdType i = 0; i < this->VolFieldFiles->GetNumberOfValues(); ++i)
+  {
+    fieldFiles.emplace_back(this->VolFieldFiles->GetValue(i), VOL_FIELD);
+  }
+  for (vtkIdType i = 0; i < this->DimFieldFiles->GetNumberOfValues(); ++i)
+  {
+    fieldFiles.emplace_back(this->DimFieldFiles->GetValue(i), INTERNAL_FIELD);
+  }
+  for (vtkIdType i = 0; i < this->PointFieldFiles->GetNumberOfValues(); ++i)
+  {
+    fieldFiles.emplace_back(this->PointFieldFiles->GetValue(i), POINT_FIELD);
+  }
+
+  auto selection = [this](fieldType type) -> const vtkDataArraySelection* {
+    return (type == POINT_FIELD ? this->Parent->PointDataArraySelection
+                                : this->Parent->CellDataArraySelection);
+  };
+
+  const vtkIdType nFiles = static_cast<vtkIdType>(fieldFiles.size());
+  const vtkIdType batchSize = std::max(1, vtkSMPTools::GetEstimatedNumberOfThreads());
+  std::vector<std::unique_ptr<vtkFoamIOobject>> fieldIOs(batchSize);
+  std::vector<std::unique_ptr<vtkFoamDict>> fieldDicts(batchSize);
+  std::vector<unsigned char> isRead(batchSize);
+
+  for (vtkIdType batchStart = 0; batchStart < nFiles; batchStart += batchSize)
+  {
+    const vtkIdType batchEnd = std::min(batchStart + batchSize, nFiles);
+
+    // The errors are reported below, when reading the file again
+    vtkSMPTools::For(batchStart, batchEnd, 1, [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType filei = begin; filei < end; ++filei)
+      {
+        const vtkIdType batchi = filei - batchStart;
+        fieldIOs[batchi].reset(new vtkFoamIOobject(this->CasePath, this->Parent));
+        fieldDicts[batchi].reset(new vtkFoamDict);
+        isRead[batchi] = this->ReadFieldFile(*fieldIOs[batchi], *fieldDicts[batchi],
+          fieldFiles[filei].first, selection(fieldFiles[filei].second), false);
+      }
+    });
+
+    for (vtkIdType filei = batchStart; filei < batchEnd; ++filei)
+    {
+      const vtkIdType batchi = filei - batchStart;
+      const std::string& varName = fieldFiles[filei].first;
+      const fieldType type = fieldFiles[filei].second;
+      if (!isRead[batchi])
+      {
+        fieldIOs[batchi].reset(new vtkFoamIOobject(this->CasePath, this->Parent));
+        fieldDicts[batchi].reset(new vtkFoamDict);
+        isRead[batchi] =
+          this->ReadFieldFile(*fieldIOs[batchi], *fieldDicts[batchi], varName, selection(type));
+      }
+      if (isRead[batchi])
+      {
+        if (type == POINT_FIELD)
+        {
+          this->GetPointFieldAtTimeStep(*fieldIOs[batchi], *fieldDicts[batchi]);
+        }
+        else
+        {
+          this->GetVolFieldAtTimeStep(
+            *fieldIOs[batchi], *fieldDicts[batchi], varName, type == INTERNAL_FIELD);
+        }
+      }
+      fieldDicts[batchi].reset(nullptr);
+      fieldIOs[batchi].reset(nullptr);
+      this->Parent->UpdateProgress(0.5 + (0.5 * ++nFieldsRead) / nFieldsToRead);
+    }
+  }
+}
+
 //------------------------------------------------------------------------------
 // Read area field at a timestep
 #if VTK_FOAMFILE_FINITE_AREA
@@ -10513,13 +10787,52 @@ int vtkOpenFOAMReaderPrivate::RequestData(vtkMultiBlockDataSet* output)
   std::unique_ptr<vtkFoamLabelListList> meshCells;
   std::unique_ptr<vtkFoamLabelListList> meshFaces;
 
-  if (createEulerians && (recreateInternalMesh || recreateBoundaryMesh))
-  {
-    const std::string facesInstance = this->CurrentTimeRegionPath(this->PolyMeshTimeIndexFaces);
+  const bool readFaces = createEulerians && (recreateInternalMesh || recreateBoundaryMesh);
+  const bool readOwnerNeighbour = createEulerians && recreateInternalMesh;
+  const bool readPoints = createEulerians &&
+    (recreateInternalMesh ||
+      (recreateBoundaryMesh && !recreateInternalMesh && this->InternalMesh == nullptr) ||
+      moveInternalPoints || moveBoundaryPoints);
+
+  // The faces (then owner/neighbour) and the points are read concurrently,
+  // since they are independent files which set different sizes.
+  // The failures are handled afterwards, in order.
+  bool ownerNeighbourRead = false;
+  vtkSMPTools::For(0, 2, 1, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType task = begin; task < end; ++task)
+    {
+      if (task == 0 && readFaces)
+      {
+        const std::string facesInstance =
+          this->CurrentTimeRegionPath(this->PolyMeshTimeIndexFaces);
+
+        vtkFoamDebug(<< "Read faces: " << facesInstance << "\n");
+        // Read polyMesh/faces, create the list of faces, set the number of faces
+        meshFaces = this->ReadFacesFile(facesInstance);
+
+        if (meshFaces && readOwnerNeighbour)
+        {
+          vtkFoamDebug(<< "Read owner/neighbour: " << facesInstance << "\n");
 
-    vtkFoamDebug(<< "Read faces: " << facesInstance << "\n");
-    // Read polyMesh/faces, create the list of faces, set the number of faces
-    meshFaces = this->ReadFacesFile(facesInstance);
+          // Read polyMesh/{owner,neighbour}, create FaceOwner/FaceNeigh
+          ownerNeighbourRead = this->ReadOwnerNeighbourFiles(facesInstance);
+        }
+      }
+      else if (task == 1 && readPoints)
+      {
+        const std::string pointsInstance =
+          this->CurrentTimeRegionPath(this->PolyMeshTimeIndexPoints);
+
+        vtkFoamDebug(<< "Read points: " << pointsInstance << "\n");
+
+        // Read polyMesh/points, set the number of points
+        pointArray = this->ReadPointsFile(pointsInstance);
+      }
+    }
+  });
+
+  if (readFaces)
+  {
     if (!meshFaces)
     {
       return 0;
@@ -10527,31 +10840,17 @@ int vtkOpenFOAMReaderPrivate::RequestData(vtkMultiBlockDataSet* output)
     this->Parent->UpdateProgress(0.2);
   }
 
-  if (createEulerians && recreateInternalMesh)
+  if (readOwnerNeighbour)
   {
-    const std::string facesInstance = this->CurrentTimeRegionPath(this->PolyMeshTimeIndexFaces);
-
-    vtkFoamDebug(<< "Read owner/neighbour: " << facesInstance << "\n");
-
-    // Read polyMesh/{owner,neighbour}, create FaceOwner/FaceNeigh
-    if (!this->ReadOwnerNeighbourFiles(facesInstance))
+    if (!ownerNeighbourRead)
     {
       return 0;
     }
     this->Parent->UpdateProgress(0.3);
   }
 
-  if (createEulerians &&
-    (recreateInternalMesh ||
-      (recreateBoundaryMesh && !recreateInternalMesh && this->InternalMesh == nullptr) ||
-      moveInternalPoints || moveBoundaryPoints))
+  if (readPoints)
   {
-    const std::string pointsInstance = this->CurrentTimeRegionPath(this->PolyMeshTimeIndexPoints);
-
-    vtkFoamDebug(<< "Read points: " << pointsInstance << "\n");
-
-    // Read polyMesh/points, set the number of faces
-    pointArray = this->ReadPointsFile(pointsInstance);
     if ((recreateInternalMesh && pointArray.Get() == nullptr) ||
       (meshFaces && !this->CheckFaceList(*meshFaces)))
     {
@@ -10791,21 +11090,7 @@ int vtkOpenFOAMReaderPrivate::RequestData(vtkMultiBlockDataSet* output)
     nFieldsToRead += this->AreaFieldFiles->GetNumberOfValues();
 #endif
 
-    for (vtkIdType i = 0; i < this->VolFieldFiles->GetNumberOfValues(); ++i)
-    {
-      this->GetVolFieldAtTimeStep(this->VolFieldFiles->GetValue(i));
-      this->Parent->UpdateProgress(0.5 + (0.5 * ++nFieldsRead) / nFieldsToRead);
-    }
-    for (vtkIdType i = 0; i < this->DimFieldFiles->GetNumberOfValues(); ++i)
-    {
-      this->GetVolFieldAtTimeStep(this->DimFieldFiles->GetValue(i), true); // Internal field
-      this->Parent->UpdateProgress(0.5 + (0.5 * ++nFieldsRead) / nFieldsToRead);
-    }
-    for (vtkIdType i = 0; i < this->PointFieldFiles->GetNumberOfValues(); ++i)
-    {
-      this->GetPointFieldAtTimeStep(this->PointFieldFiles->GetValue(i));
-      this->Parent->UpdateProgress(0.5 + (0.5 * ++nFieldsRead) / nFieldsToRead);
-    }
+    this->GetFieldsAtTimeStep(nFieldsRead, nFieldsToRead);
 #if VTK_FOAMFILE_FINITE_AREA
     for (vtkIdType i = 0; i < this->AreaFieldFiles->GetNumberOfValues(); ++i)
     {
@@ -19,6 +19,7 @@
 #include "vtkCellData.h"
 #include "vtkErrorCode.h"
 #include "vtkFloatArray.h"
+#include "vtkIdTypeArray.h"
 #include "vtkIncrementalPointLocator.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
@@ -26,14 +27,19 @@
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPolyData.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkUnsignedCharArray.h"
 
 #include <algorithm>
 #include <cctype>
+#include <cmath>
 #include <cstdlib>
+#include <cstring>
+#include <numeric>
 #include <string>
+#include <vector>
 #include <vtksys/SystemTools.hxx>
 
 vtkStandardNewMacro(vtkSTLReader);
@@ -41,6 +47,180 @@ vtkStandardNewMacro(vtkSTLReader);
 #define VTK_ASCII 0
 #define VTK_BINARY 1
 
+namespace
+{
+// Number of facets read at once, and of items processed per block by the
+// parallel scans.
+const vtkIdType BlockSize = 65536;
+
+//------------------------------------------------------------------------------
+// Calls f(block, begin, end) in parallel for the blocks of [0, n).
+template <typename Functor>
+void ForEachBlock(vtkIdType n, Functor f)
+{
+  vtkSMPTools::For(0, (n + BlockSize - 1) / BlockSize, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType block = begin; block < end; ++block)
+    {
+      f(block, block * BlockSize, std::min(n, (block + 1) * BlockSize));
+    }
+  });
+}
+
+//------------------------------------------------------------------------------
+// Returns the offsets of the blocks of [0, n) in the concatenation of the
+// counts(begin, end) items they produce, followed by the total.
+template <typename Functor>
+std::vector<vtkIdType> ScanBlocks(vtkIdType n, Functor count)
+{
+  std::vector<vtkIdType> offsets((n + BlockSize - 1) / BlockSize + 1, 0);
+  ForEachBlock(n, [&](vtkIdType block, vtkIdType begin, vtkIdType end) {
+    offsets[block + 1] = count(begin, end);
+  });
+  std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+  return offsets;
+}
+
+//------------------------------------------------------------------------------
+// Bits of a coordinate, where 0 and -0 are the same as they compare equal.
+inline vtkTypeUInt32 CoordinateKey(float x)
+{
+  vtkTypeUInt32 key;
+  std::memcpy(&key, &x, sizeof(key));
+  return key == 0x80000000u ? 0u : key;
+}
+
+//------------------------------------------------------------------------------
+// Merges the points of a triangle soup, where the triangle i uses the points
+// 3i, 3i + 1 and 3i + 2, in parallel. The result is the one of vtkMergePoints:
+// points merge when their float coordinates compare equal, they are numbered
+// in the order of their first use, and the triangles which become degenerate
+// are removed.
+void MergeTriangleSoup(vtkPoints* points, vtkFloatArray* scalars, vtkPoints* mergedPoints,
+  vtkCellArray* mergedPolys, vtkFloatArray* mergedScalars)
+{
+  const float* x = static_cast<vtkFloatArray*>(points->GetData())->GetPointer(0);
+  const vtkIdType numberOfPoints = points->GetNumberOfPoints();
+  auto equal = [x](vtkIdType a, vtkIdType b) {
+    const float* xa = x + 3 * a;
+    const float* xb = x + 3 * b;
+    return xa[0] == xb[0] && xa[1] == xb[1] && xa[2] == xb[2];
+  };
+
+  // sort the points by coordinates, and the equal points by id.
+  std::vector<vtkIdType> order(numberOfPoints);
+  vtkSMPTools::For(0, numberOfPoints, [&](vtkIdType begin, vtkIdType end) {
+    std::iota(order.begin() + begin, order.begin() + end, begin);
+  });
+  vtkSMPTools::Sort(order.begin(), order.end(), [x](vtkIdType a, vtkIdType b) {
+    for (int i = 0; i < 3; ++i)
+    {
+      vtkTypeUInt32 keyA = CoordinateKey(x[3 * a + i]);
+      vtkTypeUInt32 keyB = CoordinateKey(x[3 * b + i]);
+      if (keyA != keyB)
+      {
+        return keyA < keyB;
+      }
+    }
+    return a < b;
+  });
+
+  // each point refers to the first point equal to it. Equal points are
+  // adjacent in the order, except NaN coordinates which are never equal.
+  std::vector<vtkIdType> first(numberOfPoints);
+  vtkSMPTools::For(0, numberOfPoints, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      if (i == 0 || !equal(order[i - 1], order[i]))
+      {
+        for (vtkIdType j = i; j < numberOfPoints && (j == i || equal(order[i], order[j])); ++j)
+        {
+          first[order[j]] = order[i];
+        }
+      }
+    }
+  });
+
+  // number the merged points in the order of their first use.
+  std::vector<vtkIdType>& ids = order;
+  std::vector<vtkIdType> pointOffsets =
+    ScanBlocks(numberOfPoints, [&](vtkIdType begin, vtkIdType end) {
+      vtkIdType count = 0;
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        count += first[i] == i;
+      }
+      return count;
+    });
+  mergedPoints->SetDataTypeToFloat();
+  mergedPoints->SetNumberOfPoints(pointOffsets.back());
+  float* mergedX = static_cast<vtkFloatArray*>(mergedPoints->GetData())->GetPointer(0);
+  ForEachBlock(numberOfPoints, [&](vtkIdType block, vtkIdType begin, vtkIdType end) {
+    vtkIdType id = pointOffsets[block];
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      if (first[i] == i)
+      {
+        std::copy(x + 3 * i, x + 3 * i + 3, mergedX + 3 * id);
+        ids[i] = id++;
+      }
+    }
+  });
+  vtkSMPTools::For(0, numberOfPoints, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      ids[i] = ids[first[i]];
+    }
+  });
+
+  // keep the triangles which are not degenerate.
+  const vtkIdType* triangles = ids.data();
+  auto isValid = [triangles](vtkIdType i) {
+    const vtkIdType* t = triangles + 3 * i;
+    return t[0] != t[1] && t[0] != t[2] && t[1] != t[2];
+  };
+  const vtkIdType numberOfTriangles = numberOfPoints / 3;
+  std::vector<vtkIdType> cellOffsets =
+    ScanBlocks(numberOfTriangles, [&](vtkIdType begin, vtkIdType end) {
+      vtkIdType count = 0;
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        count += isValid(i);
+      }
+      return count;
+    });
+  vtkNew<vtkIdTypeArray> offsets;
+  vtkNew<vtkIdTypeArray> connectivity;
+  offsets->SetNumberOfValues(cellOffsets.back() + 1);
+  connectivity->SetNumberOfValues(3 * cellOffsets.back());
+  if (scalars)
+  {
+    mergedScalars->SetNumberOfValues(cellOffsets.back());
+  }
+  ForEachBlock(numberOfTriangles, [&](vtkIdType block, vtkIdType begin, vtkIdType end) {
+    vtkIdType cellId = cellOffsets[block];
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      if (isValid(i))
+      {
+        std::copy(triangles + 3 * i, triangles + 3 * i + 3, connectivity->GetPointer(3 * cellId));
+        if (scalars)
+        {
+          mergedScalars->SetValue(cellId, scalars->GetValue(i));
+        }
+        ++cellId;
+      }
+    }
+  });
+  vtkSMPTools::For(0, cellOffsets.back() + 1, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      offsets->SetValue(i, 3 * i);
+    }
+  });
+  mergedPolys->SetData(offsets, connectivity);
+}
+}
+
 vtkCxxSetObjectMacro(vtkSTLReader, Locator, vtkIncrementalPointLocator);
 vtkCxxSetObjectMacro(vtkSTLReader, BinaryHeader, vtkUnsignedCharArray);
 
@@ -168,35 +348,45 @@ int vtkSTLReader::RequestData(vtkInformation* vtkNotUsed(request),
       mergedScalars->Allocate(newPolys->GetNumberOfCells());
     }
 
-    vtkSmartPointer<vtkIncrementalPointLocator> locator = this->Locator;
-    if (this->Locator == nullptr)
+    if (this->Locator == nullptr && newPts->GetDataType() == VTK_FLOAT &&
+      newPts->GetNumberOfPoints() == 3 * newPolys->GetNumberOfCells())
     {
-      locator.TakeReference(this->NewDefaultLocator());
+      // each triangle has its own points, which are merged in parallel
+      // exactly as vtkMergePoints, the default locator, does.
+      ::MergeTriangleSoup(newPts, newScalars, mergedPts, mergedPolys, mergedScalars);
     }
-    locator->InitPointInsertion(mergedPts, newPts->GetBounds());
-
-    int nextCell = 0;
-    const vtkIdType* pts = nullptr;
-    vtkIdType npts;
-    for (newPolys->InitTraversal(); newPolys->GetNextCell(npts, pts);)
+    else
     {
-      vtkIdType nodes[3];
-      for (int i = 0; i < 3; i++)
+      vtkSmartPointer<vtkIncrementalPointLocator> locator = this->Locator;
+      if (this->Locator == nullptr)
       {
-        double x[3];
-        newPts->GetPoint(pts[i], x);
-        locator->InsertUniquePoint(x, nodes[i]);
+        locator.TakeReference(this->NewDefaultLocator());
       }
+      locator->InitPointInsertion(mergedPts, newPts->GetBounds());
 
-      if (nodes[0] != nodes[1] && nodes[0] != nodes[2] && nodes[1] != nodes[2])
+      int nextCell = 0;
+      const vtkIdType* pts = nullptr;
+      vtkIdType npts;
+      for (newPolys->InitTraversal(); newPolys->GetNextCell(npts, pts);)
       {
-        mergedPolys->InsertNextCell(3, nodes);
-        if (newScalars)
+        vtkIdType nodes[3];
+        for (int i = 0; i < 3; i++)
         {
-          mergedScalars->InsertNextValue(newScalars->GetValue(nextCell));
+          double x[3];
+          newPts->GetPoint(pts[i], x);
+          locator->InsertUniquePoint(x, nodes[i]);
         }
+
+        if (nodes[0] != nodes[1] && nodes[0] != nodes[2] && nodes[1] != nodes[2])
+        {
+          mergedPolys->InsertNextCell(3, nodes);
+          if (newScalars)
+          {
+            mergedScalars->InsertNextValue(newScalars->GetValue(nextCell));
+          }
+        }
+        nextCell++;
       }
-      nextCell++;
     }
 
     vtkDebugMacro(<< "Merged to: " << mergedPts->GetNumberOfPoints() << " points, "
@@ -225,13 +415,6 @@ int vtkSTLReader::RequestData(vtkInformation* vtkNotUsed(request),
 //------------------------------------------------------------------------------
 bool vtkSTLReader::ReadBinarySTL(FILE* fp, vtkPoints* newPts, vtkCellArray* newPolys)
 {
-  struct facet_t_t
-  {
-    float n[3], v1[3], v2[3], v3[3];
-    unsigned short junk;
-  };
-  using facet_t = struct facet_t_t;
-
   vtkDebugMacro(<< "Reading BINARY STL file");
 
   //  File is read to obtain raw information as well as bounding box
@@ -283,42 +466,49 @@ bool vtkSTLReader::ReadBinarySTL(FILE* fp, vtkPoints* newPts, vtkCellArray* newP
     numTris = static_cast<int>(ulFileLength);
   }
 
-  // now we can allocate the memory we need for this STL file
-  newPts->Allocate(numTris * 3);
-  newPolys->AllocateEstimate(numTris, 3);
-
-  facet_t facet;
-  for (int i = 0; fread(&facet, 50, 1, fp) > 0; i++)
+  // the facets are read by blocks, which are decoded in parallel. Each
+  // facet stores its normal, its three vertices and an attribute byte count.
+  const size_t facetSize = 50;
+  std::vector<unsigned char> facets(BlockSize * facetSize);
+  vtkNew<vtkFloatArray> points;
+  points->SetNumberOfComponents(3);
+  points->SetNumberOfTuples(3 * static_cast<vtkIdType>(ulFileLength));
+  vtkIdType numberOfFacets = 0;
+  size_t count;
+  while (numberOfFacets < static_cast<vtkIdType>(ulFileLength) &&
+    (count = fread(facets.data(), facetSize, BlockSize, fp)) > 0)
   {
-    vtkByteSwap::Swap4LE(facet.n);
-    vtkByteSwap::Swap4LE(facet.n + 1);
-    vtkByteSwap::Swap4LE(facet.n + 2);
-
-    vtkByteSwap::Swap4LE(facet.v1);
-    vtkByteSwap::Swap4LE(facet.v1 + 1);
-    vtkByteSwap::Swap4LE(facet.v1 + 2);
-
-    vtkByteSwap::Swap4LE(facet.v2);
-    vtkByteSwap::Swap4LE(facet.v2 + 1);
-    vtkByteSwap::Swap4LE(facet.v2 + 2);
-
-    vtkByteSwap::Swap4LE(facet.v3);
-    vtkByteSwap::Swap4LE(facet.v3 + 1);
-    vtkByteSwap::Swap4LE(facet.v3 + 2);
-
-    vtkIdType pts[3];
-    pts[0] = newPts->InsertNextPoint(facet.v1);
-    pts[1] = newPts->InsertNextPoint(facet.v2);
-    pts[2] = newPts->InsertNextPoint(facet.v3);
-
-    newPolys->InsertNextCell(3, pts);
-
-    if ((i % 100000) == 0 && i != 0)
+    count = std::min(count, static_cast<size_t>(ulFileLength - numberOfFacets));
+    float* x = points->GetPointer(9 * numberOfFacets);
+    const unsigned char* facet = facets.data();
+    vtkSMPTools::For(0, static_cast<vtkIdType>(count), [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        std::memcpy(x + 9 * i, facet + facetSize * i + 3 * sizeof(float), 9 * sizeof(float));
+        vtkByteSwap::Swap4LERange(x + 9 * i, 9);
+      }
+    });
+    numberOfFacets += static_cast<vtkIdType>(count);
+    vtkDebugMacro(<< "triangle# " << numberOfFacets);
+    this->UpdateProgress(static_cast<double>(numberOfFacets) / numTris);
+  }
+  points->SetNumberOfTuples(3 * numberOfFacets);
+  newPts->SetData(points);
+
+  vtkNew<vtkIdTypeArray> offsets;
+  vtkNew<vtkIdTypeArray> connectivity;
+  offsets->SetNumberOfValues(numberOfFacets + 1);
+  connectivity->SetNumberOfValues(3 * numberOfFacets);
+  vtkSMPTools::For(0, numberOfFacets + 1, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType i = begin; i < end; ++i)
     {
-      vtkDebugMacro(<< "triangle# " << i);
-      this->UpdateProgress(static_cast<double>(i) / numTris);
+      offsets->SetValue(i, 3 * i);
     }
-  }
+  });
+  vtkSMPTools::For(0, 3 * numberOfFacets, [&](vtkIdType begin, vtkIdType end) {
+    std::iota(connectivity->GetPointer(begin), connectivity->GetPointer(end), begin);
+  });
+  newPolys->SetData(offsets, connectivity);
 
   return true;
 }
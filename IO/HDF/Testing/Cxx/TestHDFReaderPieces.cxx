@@ -0,0 +1,338 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestHDFReaderPieces.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that vtkHDFReader reads sub-extents of image data, splits the
+// pieces stored in a file when more pieces are requested, and skips the
+// arrays disabled in its array selections.
+
+#include "vtkCellArray.h"
+#include "vtkCellData.h"
+#include "vtkDataArraySelection.h"
+#include "vtkDoubleArray.h"
+#include "vtkFieldData.h"
+#include "vtkHDFReader.h"
+#include "vtkHDFWriter.h"
+#include "vtkIdList.h"
+#include "vtkImageData.h"
+#include "vtkIntArray.h"
+#include "vtkNew.h"
+#include "vtkPartitionedDataSet.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkStringArray.h"
+#include "vtkTestUtilities.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <iostream>
+#include <string>
+
+namespace
+{
+//----------------------------------------------------------------------------
+bool Write(vtkDataObject* data, const std::string& fileName)
+{
+  vtkNew<vtkHDFWriter> writer;
+  writer->SetInputData(data);
+  writer->SetFileName(fileName.c_str());
+  if (!writer->Write())
+  {
+    std::cerr << "Cannot write " << fileName << std::endl;
+    return false;
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------------
+bool TestImageDataExtent(const std::string& fileName)
+{
+  vtkNew<vtkImageData> image;
+  image->SetExtent(-4, 12, 0, 9, 2, 7);
+  vtkNew<vtkDoubleArray> values;
+  values->SetName("Values");
+  vtkNew<vtkIntArray> cellValues;
+  cellValues->SetName("CellValues");
+  for (vtkIdType i = 0; i < image->GetNumberOfPoints(); ++i)
+  {
+    values->InsertNextValue(i);
+  }
+  for (vtkIdType i = 0; i < image->GetNumberOfCells(); ++i)
+  {
+    cellValues->InsertNextValue(static_cast<int>(i));
+  }
+  image->GetPointData()->AddArray(values);
+  image->GetCellData()->AddArray(cellValues);
+  if (!Write(image, fileName))
+  {
+    return false;
+  }
+
+  vtkNew<vtkHDFReader> reader;
+  reader->SetFileName(fileName.c_str());
+  reader->UpdateInformation();
+  reader->GetCellDataArraySelection()->DisableArray("CellValues");
+  int extent[6] = { 0, 5, 3, 3, 4, 7 };
+  reader->UpdateExtent(extent);
+  vtkImageData* data = vtkImageData::SafeDownCast(reader->GetOutputAsDataSet());
+  vtkDataArray* readValues = data ? data->GetPointData()->GetArray("Values") : nullptr;
+  if (!readValues || data->GetCellData()->GetArray("CellValues") ||
+    readValues->GetNumberOfTuples() != data->GetNumberOfPoints())
+  {
+    std::cerr << "Wrong sub-extent read from " << fileName << std::endl;
+    return false;
+  }
+  for (int k = extent[4]; k <= extent[5]; ++k)
+  {
+    for (int j = extent[2]; j <= extent[3]; ++j)
+    {
+      for (int i = extent[0]; i <= extent[1]; ++i)
+      {
+        int ijk[3] = { i, j, k };
+        if (readValues->GetTuple1(data->ComputePointId(ijk)) !=
+          values->GetTuple1(image->ComputePointId(ijk)))
+        {
+          std::cerr << "Wrong value at " << i << " " << j << " " << k << std::endl;
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------------
+// Compares the cells, points and attributes of 'data' with those of
+// 'reference' starting at cell 'cellId', which is advanced.
+bool HaveSameCells(vtkDataSet* data, vtkDataSet* reference, vtkIdType& cellId)
+{
+  vtkDataArray* pointValues = data->GetPointData()->GetArray("PointValues");
+  vtkDataArray* cellValues = data->GetCellData()->GetArray("CellValues");
+  vtkDataArray* referencePointValues = reference->GetPointData()->GetArray("PointValues");
+  vtkDataArray* referenceCellValues = reference->GetCellData()->GetArray("CellValues");
+  if (!pointValues || !cellValues)
+  {
+    std::cerr << "Missing arrays." << std::endl;
+    return false;
+  }
+  vtkNew<vtkIdList> pointIds;
+  vtkNew<vtkIdList> referencePointIds;
+  for (vtkIdType i = 0; i < data->GetNumberOfCells(); ++i, ++cellId)
+  {
+    data->GetCellPoints(i, pointIds);
+    reference->GetCellPoints(cellId, referencePointIds);
+    if (data->GetCellType(i) != reference->GetCellType(cellId) ||
+      pointIds->GetNumberOfIds() != referencePointIds->GetNumberOfIds() ||
+      cellValues->GetTuple1(i) != referenceCellValues->GetTuple1(cellId))
+    {
+      std::cerr << "Wrong cell " << cellId << std::endl;
+      return false;
+    }
+    for (vtkIdType j = 0; j < pointIds->GetNumberOfIds(); ++j)
+    {
+      double point[3];
+      double referencePoint[3];
+      data->GetPoint(pointIds->GetId(j), point);
+      reference->GetPoint(referencePointIds->GetId(j), referencePoint);
+      if (!std::equal(point, point + 3, referencePoint) ||
+        pointValues->GetTuple1(pointIds->GetId(j)) !=
+          referencePointValues->GetTuple1(referencePointIds->GetId(j)))
+      {
+        std::cerr << "Wrong point " << j << " of cell " << cellId << std::endl;
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------------
+vtkSmartPointer<vtkUnstructuredGrid> NewUnstructuredGrid(int seed, vtkIdType numberOfCells)
+{
+  auto grid = vtkSmartPointer<vtkUnstructuredGrid>::New();
+  vtkNew<vtkPoints> points;
+  vtkNew<vtkDoubleArray> pointValues;
+  pointValues->SetName("PointValues");
+  vtkNew<vtkIntArray> cellValues;
+  cellValues->SetName("CellValues");
+  for (vtkIdType i = 0; i < numberOfCells + 2; ++i)
+  {
+    points->InsertNextPoint(i, seed, 0);
+    pointValues->InsertNextValue(seed * 1000 + i);
+  }
+  for (vtkIdType i = 0; i < numberOfCells; ++i)
+  {
+    vtkIdType ids[3] = { i, i + 1, i + 2 };
+    if (i % 3 == 0)
+    {
+      grid->InsertNextCell(VTK_LINE, 2, ids);
+    }
+    else
+    {
+      grid->InsertNextCell(VTK_TRIANGLE, 3, ids);
+    }
+    cellValues->InsertNextValue(static_cast<int>(seed * 1000 + i));
+  }
+  grid->SetPoints(points);
+  grid->GetPointData()->AddArray(pointValues);
+  grid->GetCellData()->AddArray(cellValues);
+  return grid;
+}
+
+//----------------------------------------------------------------------------
+bool TestUnstructuredGridPieces(const std::string& fileName)
+{
+  // two file pieces read as they are and split in sub-pieces.
+  vtkNew<vtkPartitionedDataSet> partitioned;
+  vtkSmartPointer<vtkUnstructuredGrid> partitions[2] = { NewUnstructuredGrid(0, 10),
+    NewUnstructuredGrid(1, 7) };
+  partitioned->SetPartition(0, partitions[0]);
+  partitioned->SetPartition(1, partitions[1]);
+  vtkNew<vtkStringArray> names;
+  names->SetName("Names");
+  names->InsertNextValue("name");
+  partitioned->GetFieldData()->AddArray(names);
+  if (!Write(partitioned, fileName))
+  {
+    return false;
+  }
+
+  vtkNew<vtkHDFReader> reader;
+  reader->SetFileName(fileName.c_str());
+  reader->UpdateInformation();
+  reader->GetFieldDataArraySelection()->DisableArray("Names");
+  for (int numberOfPieces : { 2, 5, 9 })
+  {
+    int partition = 0;
+    vtkIdType cellId = 0;
+    for (int piece = 0; piece < numberOfPieces; ++piece)
+    {
+      reader->UpdatePiece(piece, numberOfPieces, 0);
+      vtkUnstructuredGrid* data = vtkUnstructuredGrid::SafeDownCast(reader->GetOutputAsDataSet());
+      if (!data || data->GetFieldData()->GetAbstractArray("Names"))
+      {
+        std::cerr << "Wrong piece " << piece << " of " << numberOfPieces << std::endl;
+        return false;
+      }
+      if (numberOfPieces == 2)
+      {
+        // whole file pieces
+        partition = piece;
+        cellId = 0;
+      }
+      else if (cellId == partitions[partition]->GetNumberOfCells())
+      {
+        ++partition;
+        cellId = 0;
+      }
+      if (data->GetNumberOfCells() > 0 && !HaveSameCells(data, partitions[partition], cellId))
+      {
+        std::cerr << "Wrong piece " << piece << " of " << numberOfPieces << std::endl;
+        return false;
+      }
+      if (numberOfPieces > 2 && data->GetNumberOfPoints() > data->GetNumberOfCells() + 2)
+      {
+        std::cerr << "Unused points read for piece " << piece << " of " << numberOfPieces
+                  << std::endl;
+        return false;
+      }
+    }
+    if (partition != 1 || cellId != partitions[1]->GetNumberOfCells())
+    {
+      std::cerr << "Missing cells for " << numberOfPieces << " pieces." << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------------
+bool TestPolyDataPieces(const std::string& fileName)
+{
+  vtkNew<vtkPolyData> polyData;
+  vtkNew<vtkPoints> points;
+  vtkNew<vtkDoubleArray> pointValues;
+  pointValues->SetName("PointValues");
+  for (int i = 0; i < 40; ++i)
+  {
+    points->InsertNextPoint(i, i % 2, 0);
+    pointValues->InsertNextValue(i);
+  }
+  vtkNew<vtkCellArray> verts;
+  vtkNew<vtkCellArray> polys;
+  for (vtkIdType i = 0; i < 20; ++i)
+  {
+    verts->InsertNextCell(1, &i);
+    vtkIdType triangle[3] = { 2 * i, 2 * i + 1, (2 * i + 2) % 40 };
+    polys->InsertNextCell(3, triangle);
+  }
+  polyData->SetPoints(points);
+  polyData->SetVerts(verts);
+  polyData->SetPolys(polys);
+  polyData->GetPointData()->AddArray(pointValues);
+  if (!Write(polyData, fileName))
+  {
+    return false;
+  }
+
+  vtkNew<vtkHDFReader> reader;
+  reader->SetFileName(fileName.c_str());
+  const int numberOfPieces = 3;
+  vtkIdType numberOfVerts = 0;
+  vtkIdType numberOfPolys = 0;
+  for (int piece = 0; piece < numberOfPieces; ++piece)
+  {
+    reader->UpdatePiece(piece, numberOfPieces, 0);
+    vtkPolyData* data = vtkPolyData::SafeDownCast(reader->GetOutputAsDataSet());
+    vtkDataArray* values = data ? data->GetPointData()->GetArray("PointValues") : nullptr;
+    if (!values)
+    {
+      std::cerr << "Wrong poly data piece " << piece << std::endl;
+      return false;
+    }
+    // the points of the piece keep their values
+    for (vtkIdType i = 0; i < data->GetNumberOfPoints(); ++i)
+    {
+      if (values->GetTuple1(i) != data->GetPoint(i)[0])
+      {
+        std::cerr << "Wrong point " << i << " of poly data piece " << piece << std::endl;
+        return false;
+      }
+    }
+    numberOfVerts += data->GetNumberOfVerts();
+    numberOfPolys += data->GetNumberOfPolys();
+  }
+  if (numberOfVerts != 20 || numberOfPolys != 20)
+  {
+    std::cerr << "Wrong poly data pieces read from " << fileName << std::endl;
+    return false;
+  }
+  return true;
+}
+}
+
+//----------------------------------------------------------------------------
+int TestHDFReaderPieces(int argc, char* argv[])
+{
+  char* tempDir =
+    vtkTestUtilities::GetArgOrEnvOrDefault("-T", argc, argv, "VTK_TEMP_DIR", "Testing/Temporary");
+  std::string prefix = std::string(tempDir) + "/TestHDFReaderPieces";
+  delete[] tempDir;
+
+  if (!TestImageDataExtent(prefix + "-image.hdf") ||
+    !TestUnstructuredGridPieces(prefix + "-ug.hdf") || !TestPolyDataPieces(prefix + "-pd.hdf"))
+  {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
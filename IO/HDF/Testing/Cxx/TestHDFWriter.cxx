@@ -0,0 +1,515 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestHDFWriter.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that the datasets written by vtkHDFWriter, by pieces, partitions
+// and time steps, are read back unchanged by vtkHDFReader.
+
+#include "vtkAppendDataSets.h"
+#include "vtkAppendPolyData.h"
+#include "vtkCellArray.h"
+#include "vtkCellData.h"
+#include "vtkDoubleArray.h"
+#include "vtkFieldData.h"
+#include "vtkFloatArray.h"
+#include "vtkHDFReader.h"
+#include "vtkHDFWriter.h"
+#include "vtkImageAlgorithm.h"
+#include "vtkImageData.h"
+#include "vtkInformation.h"
+#include "vtkInformationVector.h"
+#include "vtkIntArray.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPartitionedDataSet.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkPolyDataAlgorithm.h"
+#include "vtkStreamingDemandDrivenPipeline.h"
+#include "vtkStringArray.h"
+#include "vtkTestUtilities.h"
+#include "vtkUnsignedCharArray.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <iostream>
+#include <string>
+
+namespace
+{
+const double TimeValues[] = { 0.5, 1.5, 2.5 };
+
+//----------------------------------------------------------------------------
+// Image source whose values depend on the time step, which produces the
+// requested sub-extents.
+class TemporalImageSource : public vtkImageAlgorithm
+{
+public:
+  static TemporalImageSource* New();
+  vtkTypeMacro(TemporalImageSource, vtkImageAlgorithm);
+
+protected:
+  TemporalImageSource() { this->SetNumberOfInputPorts(0); }
+
+  int RequestInformation(vtkInformation*, vtkInformationVector**,
+    vtkInformationVector* outputVector) override
+  {
+    vtkInformation* outInfo = outputVector->GetInformationObject(0);
+    int wholeExtent[6] = { 0, 9, -3, 4, 0, 0 };
+    outInfo->Set(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(), wholeExtent, 6);
+    outInfo->Set(vtkStreamingDemandDrivenPipeline::TIME_STEPS(), TimeValues, 3);
+    double timeRange[2] = { TimeValues[0], TimeValues[2] };
+    outInfo->Set(vtkStreamingDemandDrivenPipeline::TIME_RANGE(), timeRange, 2);
+    outInfo->Set(CAN_PRODUCE_SUB_EXTENT(), 1);
+    return 1;
+  }
+
+  int RequestData(vtkInformation*, vtkInformationVector**,
+    vtkInformationVector* outputVector) override
+  {
+    vtkInformation* outInfo = outputVector->GetInformationObject(0);
+    vtkImageData* output = vtkImageData::GetData(outInfo);
+    double time = outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP());
+    int* extent = outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT());
+    output->SetExtent(extent);
+    vtkNew<vtkDoubleArray> values;
+    values->SetName("Values");
+    for (int j = extent[2]; j <= extent[3]; ++j)
+    {
+      for (int i = extent[0]; i <= extent[1]; ++i)
+      {
+        values->InsertNextValue(100 * time + 10 * j + i);
+      }
+    }
+    output->GetPointData()->AddArray(values);
+    output->GetInformation()->Set(vtkDataObject::DATA_TIME_STEP(), time);
+    return 1;
+  }
+};
+vtkStandardNewMacro(TemporalImageSource);
+
+//----------------------------------------------------------------------------
+// Poly data source with one more point for each time step, which produces
+// the requested pieces.
+class TemporalPolyDataSource : public vtkPolyDataAlgorithm
+{
+public:
+  static TemporalPolyDataSource* New();
+  vtkTypeMacro(TemporalPolyDataSource, vtkPolyDataAlgorithm);
+
+protected:
+  TemporalPolyDataSource() { this->SetNumberOfInputPorts(0); }
+
+  int RequestInformation(vtkInformation*, vtkInformationVector**,
+    vtkInformationVector* outputVector) override
+  {
+    vtkInformation* outInfo = outputVector->GetInformationObject(0);
+    outInfo->Set(vtkStreamingDemandDrivenPipeline::TIME_STEPS(), TimeValues, 3);
+    double timeRange[2] = { TimeValues[0], TimeValues[2] };
+    outInfo->Set(vtkStreamingDemandDrivenPipeline::TIME_RANGE(), timeRange, 2);
+    outInfo->Set(CAN_HANDLE_PIECE_REQUEST(), 1);
+    return 1;
+  }
+
+  int RequestData(vtkInformation*, vtkInformationVector**,
+    vtkInformationVector* outputVector) override
+  {
+    vtkInformation* outInfo = outputVector->GetInformationObject(0);
+    vtkPolyData* output = vtkPolyData::GetData(outInfo);
+    double time = outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP());
+    int piece = outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_PIECE_NUMBER());
+    vtkIdType numberOfPoints = 2 + static_cast<vtkIdType>(time) + piece;
+    vtkNew<vtkPoints> points;
+    vtkNew<vtkCellArray> lines;
+    vtkNew<vtkDoubleArray> values;
+    values->SetName("Values");
+    lines->InsertNextCell(numberOfPoints);
+    for (vtkIdType i = 0; i < numberOfPoints; ++i)
+    {
+      points->InsertNextPoint(i, piece, time);
+      lines->InsertCellPoint(i);
+      values->InsertNextValue(100 * time + 10 * piece + i);
+    }
+    output->SetPoints(points);
+    output->SetLines(lines);
+    output->GetPointData()->AddArray(values);
+    return 1;
+  }
+};
+vtkStandardNewMacro(TemporalPolyDataSource);
+
+//----------------------------------------------------------------------------
+bool HaveSameValues(vtkDataArray* array1, vtkDataArray* array2, const char* name)
+{
+  if (!array1 || !array2 || array1->GetNumberOfValues() != array2->GetNumberOfValues() ||
+    array1->GetNumberOfComponents() != array2->GetNumberOfComponents())
+  {
+    std::cerr << "Wrong array " << name << "." << std::endl;
+    return false;
+  }
+  for (vtkIdType i = 0; i < array1->GetNumberOfValues(); ++i)
+  {
+    if (array1->GetVariantValue(i) != array2->GetVariantValue(i))
+    {
+      std::cerr << "Wrong value " << i << " in array " << name << "." << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------------
+bool HaveSameAttributes(vtkDataSet* data, vtkDataSet* reference)
+{
+  for (int attributeType : { vtkDataObject::POINT, vtkDataObject::CELL })
+  {
+    vtkFieldData* attributes = reference->GetAttributesAsFieldData(attributeType);
+    for (int i = 0; i < attributes->GetNumberOfArrays(); ++i)
+    {
+      vtkDataArray* array = attributes->GetArray(i);
+      if (!HaveSameValues(data->GetAttributesAsFieldData(attributeType)->GetArray(array->GetName()),
+            array, array->GetName()))
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------------
+bool HaveSameCells(vtkCellArray* cells, vtkCellArray* reference, const char* name)
+{
+  return HaveSameValues(cells->GetOffsetsArray(), reference->GetOffsetsArray(), name) &&
+    HaveSameValues(cells->GetConnectivityArray(), reference->GetConnectivityArray(), name);
+}
+
+//----------------------------------------------------------------------------
+vtkSmartPointer<vtkHDFReader> ReadFile(const std::string& fileName)
+{
+  auto reader = vtkSmartPointer<vtkHDFReader>::New();
+  reader->SetFileName(fileName.c_str());
+  reader->Update();
+  return reader;
+}
+
+//----------------------------------------------------------------------------
+vtkSmartPointer<vtkImageData> NewImage(const int* extent)
+{
+  auto image = vtkSmartPointer<vtkImageData>::New();
+  image->SetExtent(const_cast<int*>(extent));
+  image->SetOrigin(1, 2, 3);
+  image->SetSpacing(0.5, 0.25, 2);
+  vtkNew<vtkFloatArray> scalars;
+  scalars->SetName("Scalars");
+  vtkNew<vtkDoubleArray> vectors;
+  vectors->SetName("Vectors");
+  vectors->SetNumberOfComponents(3);
+  for (vtkIdType i = 0; i < image->GetNumberOfPoints(); ++i)
+  {
+    scalars->InsertNextValue(i * 0.5f);
+    vectors->InsertNextTuple3(i, -i, i * i);
+  }
+  vtkNew<vtkIntArray> cellScalars;
+  cellScalars->SetName("CellScalars");
+  for (vtkIdType i = 0; i < image->GetNumberOfCells(); ++i)
+  {
+    cellScalars->InsertNextValue(static_cast<int>(7 * i));
+  }
+  image->GetPointData()->AddArray(scalars);
+  image->GetPointData()->AddArray(vectors);
+  image->GetCellData()->AddArray(cellScalars);
+  return image;
+}
+
+//----------------------------------------------------------------------------
+bool TestImageData(const std::string& fileName, const int* extent, int numberOfPieces)
+{
+  vtkSmartPointer<vtkImageData> image = NewImage(extent);
+  vtkNew<vtkHDFWriter> writer;
+  writer->SetInputData(image);
+  writer->SetFileName(fileName.c_str());
+  writer->SetNumberOfPieces(numberOfPieces);
+  writer->SetChunkSize(10);
+  writer->SetCompressionLevel(4);
+  if (!writer->Write())
+  {
+    std::cerr << "Cannot write " << fileName << std::endl;
+    return false;
+  }
+
+  vtkSmartPointer<vtkHDFReader> reader = ReadFile(fileName);
+  vtkImageData* data = vtkImageData::SafeDownCast(reader->GetOutputAsDataSet());
+  int* dataExtent = data ? data->GetExtent() : nullptr;
+  if (!data || !std::equal(dataExtent, dataExtent + 6, extent) ||
+    data->GetOrigin()[1] != 2 || data->GetSpacing()[2] != 2 || !HaveSameAttributes(data, image))
+  {
+    std::cerr << "Wrong image data read from " << fileName << std::endl;
+    return false;
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------------
+vtkSmartPointer<vtkUnstructuredGrid> NewUnstructuredGrid(int seed)
+{
+  auto grid = vtkSmartPointer<vtkUnstructuredGrid>::New();
+  vtkNew<vtkPoints> points;
+  vtkNew<vtkDoubleArray> pointValues;
+  pointValues->SetName("PointValues");
+  for (int i = 0; i < 5 + seed; ++i)
+  {
+    points->InsertNextPoint(i, seed + i % 2, i * 0.5);
+    pointValues->InsertNextValue(seed * 100 + i);
+  }
+  grid->SetPoints(points);
+  vtkIdType tetra[4] = { 0, 1, 2, 3 };
+  vtkIdType triangle[3] = { 1, 3, 4 };
+  grid->InsertNextCell(VTK_TETRA, 4, tetra);
+  grid->InsertNextCell(VTK_TRIANGLE, 3, triangle);
+  grid->InsertNextCell(VTK_VERTEX, 1, &triangle[2]);
+  vtkNew<vtkIntArray> cellValues;
+  cellValues->SetName("CellValues");
+  cellValues->SetNumberOfComponents(2);
+  for (int i = 0; i < 3; ++i)
+  {
+    cellValues->InsertNextTuple2(seed, i);
+  }
+  grid->GetPointData()->AddArray(pointValues);
+  grid->GetCellData()->AddArray(cellValues);
+  return grid;
+}
+
+//----------------------------------------------------------------------------
+bool TestUnstructuredGrid(const std::string& fileName)
+{
+  vtkNew<vtkPartitionedDataSet> partitioned;
+  vtkNew<vtkAppendDataSets> append;
+  for (int i = 0; i < 3; ++i)
+  {
+    vtkSmartPointer<vtkUnstructuredGrid> grid = NewUnstructuredGrid(i);
+    partitioned->SetPartition(i, grid);
+    append->AddInputData(grid);
+  }
+  append->Update();
+  vtkNew<vtkStringArray> names;
+  names->SetName("Names");
+  names->InsertNextValue("first");
+  names->InsertNextValue("");
+  names->InsertNextValue("third name");
+  vtkNew<vtkDoubleArray> factors;
+  factors->SetName("Factors");
+  factors->InsertNextValue(3.5);
+  partitioned->GetFieldData()->AddArray(names);
+  partitioned->GetFieldData()->AddArray(factors);
+
+  vtkNew<vtkHDFWriter> writer;
+  writer->SetInputData(partitioned);
+  writer->SetFileName(fileName.c_str());
+  if (!writer->Write())
+  {
+    std::cerr << "Cannot write " << fileName << std::endl;
+    return false;
+  }
+
+  vtkSmartPointer<vtkHDFReader> reader = ReadFile(fileName);
+  vtkUnstructuredGrid* data = vtkUnstructuredGrid::SafeDownCast(reader->GetOutputAsDataSet());
+  vtkUnstructuredGrid* reference = vtkUnstructuredGrid::SafeDownCast(append->GetOutput());
+  if (!data || data->GetNumberOfPoints() != reference->GetNumberOfPoints() ||
+    !HaveSameValues(data->GetPoints()->GetData(), reference->GetPoints()->GetData(), "Points") ||
+    !HaveSameCells(data->GetCells(), reference->GetCells(), "Cells") ||
+    !HaveSameValues(data->GetCellTypesArray(), reference->GetCellTypesArray(), "Types") ||
+    !HaveSameAttributes(data, reference))
+  {
+    std::cerr << "Wrong unstructured grid read from " << fileName << std::endl;
+    return false;
+  }
+  vtkStringArray* readNames =
+    vtkStringArray::SafeDownCast(data->GetFieldData()->GetAbstractArray("Names"));
+  if (!readNames || readNames->GetNumberOfValues() != 3 || readNames->GetValue(2) != "third name" ||
+    !HaveSameValues(data->GetFieldData()->GetArray("Factors"), factors, "Factors"))
+  {
+    std::cerr << "Wrong field data read from " << fileName << std::endl;
+    return false;
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------------
+bool TestPolyData(const std::string& fileName)
+{
+  vtkNew<vtkPolyData> polyData;
+  vtkNew<vtkPoints> points;
+  vtkNew<vtkFloatArray> pointValues;
+  pointValues->SetName("PointValues");
+  for (int i = 0; i < 12; ++i)
+  {
+    points->InsertNextPoint(i % 3, i / 3, 0);
+    pointValues->InsertNextValue(i * 1.5f);
+  }
+  polyData->SetPoints(points);
+  vtkNew<vtkCellArray> verts;
+  vtkNew<vtkCellArray> lines;
+  vtkNew<vtkCellArray> polys;
+  vtkNew<vtkCellArray> strips;
+  vtkIdType line[3] = { 0, 1, 2 };
+  vtkIdType quad[4] = { 0, 1, 4, 3 };
+  vtkIdType triangle[3] = { 4, 5, 8 };
+  vtkIdType strip[6] = { 6, 9, 7, 10, 8, 11 };
+  verts->InsertNextCell(1, &line[1]);
+  lines->InsertNextCell(3, line);
+  polys->InsertNextCell(4, quad);
+  polys->InsertNextCell(3, triangle);
+  strips->InsertNextCell(6, strip);
+  polyData->SetVerts(verts);
+  polyData->SetLines(lines);
+  polyData->SetPolys(polys);
+  polyData->SetStrips(strips);
+  vtkNew<vtkUnsignedCharArray> cellValues;
+  cellValues->SetName("CellValues");
+  for (int i = 0; i < 5; ++i)
+  {
+    cellValues->InsertNextValue(10 + i);
+  }
+  polyData->GetPointData()->AddArray(pointValues);
+  polyData->GetCellData()->AddArray(cellValues);
+
+  vtkNew<vtkHDFWriter> writer;
+  writer->SetInputData(polyData);
+  writer->SetFileName(fileName.c_str());
+  writer->SetCompressionLevel(9);
+  if (!writer->Write())
+  {
+    std::cerr << "Cannot write " << fileName << std::endl;
+    return false;
+  }
+
+  vtkSmartPointer<vtkHDFReader> reader = ReadFile(fileName);
+  vtkPolyData* data = vtkPolyData::SafeDownCast(reader->GetOutputAsDataSet());
+  if (!data ||
+    !HaveSameValues(data->GetPoints()->GetData(), polyData->GetPoints()->GetData(), "Points") ||
+    !HaveSameCells(data->GetVerts(), verts, "Vertices") ||
+    !HaveSameCells(data->GetLines(), lines, "Lines") ||
+    !HaveSameCells(data->GetPolys(), polys, "Polygons") ||
+    !HaveSameCells(data->GetStrips(), strips, "Strips") || !HaveSameAttributes(data, polyData))
+  {
+    std::cerr << "Wrong poly data read from " << fileName << std::endl;
+    return false;
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------------
+bool TestTemporalImageData(const std::string& fileName)
+{
+  vtkNew<TemporalImageSource> source;
+  vtkNew<vtkHDFWriter> writer;
+  writer->SetInputConnection(source->GetOutputPort());
+  writer->SetFileName(fileName.c_str());
+  writer->SetNumberOfPieces(3);
+  writer->WriteAllTimeStepsOn();
+  if (!writer->Write())
+  {
+    std::cerr << "Cannot write " << fileName << std::endl;
+    return false;
+  }
+
+  vtkNew<vtkHDFReader> reader;
+  reader->SetFileName(fileName.c_str());
+  reader->UpdateInformation();
+  if (reader->GetOutputInformation(0)->Length(vtkStreamingDemandDrivenPipeline::TIME_STEPS()) !=
+    3)
+  {
+    std::cerr << "Wrong time steps read from " << fileName << std::endl;
+    return false;
+  }
+  for (int step = 2; step >= 0; --step)
+  {
+    vtkNew<TemporalImageSource> reference;
+    reference->UpdateTimeStep(TimeValues[step]);
+    reader->UpdateTimeStep(TimeValues[step]);
+    if (!HaveSameAttributes(reader->GetOutputAsDataSet(), reference->GetOutput()))
+    {
+      std::cerr << "Wrong time step " << step << " read from " << fileName << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------------
+bool TestTemporalPolyData(const std::string& fileName)
+{
+  vtkNew<TemporalPolyDataSource> source;
+  vtkNew<vtkHDFWriter> writer;
+  writer->SetInputConnection(source->GetOutputPort());
+  writer->SetFileName(fileName.c_str());
+  writer->SetNumberOfPieces(2);
+  writer->WriteAllTimeStepsOn();
+  if (!writer->Write())
+  {
+    std::cerr << "Cannot write " << fileName << std::endl;
+    return false;
+  }
+
+  vtkNew<vtkHDFReader> reader;
+  reader->SetFileName(fileName.c_str());
+  for (int step = 0; step < 3; ++step)
+  {
+    vtkNew<vtkAppendPolyData> append;
+    for (int piece = 0; piece < 2; ++piece)
+    {
+      source->UpdatePiece(piece, 2, 0);
+      source->UpdateTimeStep(TimeValues[step], piece, 2);
+      vtkNew<vtkPolyData> pieceData;
+      pieceData->DeepCopy(source->GetOutput());
+      append->AddInputData(pieceData);
+    }
+    append->Update();
+    reader->UpdateTimeStep(TimeValues[step]);
+    vtkPolyData* data = vtkPolyData::SafeDownCast(reader->GetOutputAsDataSet());
+    if (!data ||
+      !HaveSameValues(
+        data->GetPoints()->GetData(), append->GetOutput()->GetPoints()->GetData(), "Points") ||
+      !HaveSameCells(data->GetLines(), append->GetOutput()->GetLines(), "Lines") ||
+      !HaveSameAttributes(data, append->GetOutput()))
+    {
+      std::cerr << "Wrong time step " << step << " read from " << fileName << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+//----------------------------------------------------------------------------
+int TestHDFWriter(int argc, char* argv[])
+{
+  char* tempDir =
+    vtkTestUtilities::GetArgOrEnvOrDefault("-T", argc, argv, "VTK_TEMP_DIR", "Testing/Temporary");
+  std::string prefix = std::string(tempDir) + "/TestHDFWriter";
+  delete[] tempDir;
+
+  const int extent3D[6] = { -2, 5, 0, 6, 1, 4 };
+  const int extent2D[6] = { 0, 20, 3, 9, 0, 0 };
+  if (!TestImageData(prefix + "-image.hdf", extent3D, 1) ||
+    !TestImageData(prefix + "-image-pieces.hdf", extent3D, 4) ||
+    !TestImageData(prefix + "-image-2d.hdf", extent2D, 3) ||
+    !TestUnstructuredGrid(prefix + "-ug.hdf") || !TestPolyData(prefix + "-pd.hdf") ||
+    !TestTemporalImageData(prefix + "-image-steps.hdf") ||
+    !TestTemporalPolyData(prefix + "-pd-steps.hdf"))
+  {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
@@ -15,6 +15,7 @@
 #include "vtkHDFReader.h"
 
 #include "vtkAppendDataSets.h"
+#include "vtkAppendPolyData.h"
 #include "vtkArrayIteratorIncludes.h"
 #include "vtkCallbackCommand.h"
 #include "vtkDataArray.h"
@@ -28,6 +29,7 @@
 #include "vtkInformationVector.h"
 #include "vtkMatrix3x3.h"
 #include "vtkObjectFactory.h"
+#include "vtkPolyData.h"
 #include "vtkQuadratureSchemeDefinition.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkUnstructuredGrid.h"
@@ -50,14 +52,11 @@ vtkStandardNewMacro(vtkHDFReader);
 namespace
 {
 //----------------------------------------------------------------------------
+// Trailing flat axes of the whole extent are not stored in the file.
 int GetNDims(int* extent)
 {
   int ndims = 3;
-  if (extent[5] - extent[4] == 0)
-  {
-    --ndims;
-  }
-  if (extent[3] - extent[2] == 0)
+  while (ndims > 1 && extent[2 * ndims - 1] == extent[2 * ndims - 2])
   {
     --ndims;
   }
@@ -65,18 +64,47 @@ int GetNDims(int* extent)
 }
 
 //----------------------------------------------------------------------------
-std::vector<hsize_t> ReduceDimension(int* updateExtent, int* wholeExtent)
+// Returns the file extent of the points, or of the cells, of 'updateExtent'.
+std::vector<hsize_t> ReduceDimension(int* updateExtent, int* wholeExtent, bool cells)
 {
   int dims = ::GetNDims(wholeExtent);
   std::vector<hsize_t> v(2 * dims);
   for (int i = 0; i < dims; ++i)
   {
     int j = 2 * i;
-    v[j] = updateExtent[j];
-    v[j + 1] = updateExtent[j + 1];
+    // flat axes have one layer of cells.
+    int lastCell = cells && wholeExtent[j] != wholeExtent[j + 1] ? 1 : 0;
+    v[j] = updateExtent[j] - wholeExtent[j];
+    v[j + 1] = updateExtent[j + 1] - lastCell - wholeExtent[j];
   }
   return v;
 }
+
+//----------------------------------------------------------------------------
+const char* PolyDataTopologyNames[] = { "Vertices/", "Lines/", "Polygons/", "Strips/" };
+
+//----------------------------------------------------------------------------
+// Sets 'range' to the items of the sub-piece 'subPiece' out of
+// 'numberOfSubPieces' of a piece with 'numberOfItems' items.
+void GetSubPieceRange(
+  vtkIdType numberOfItems, int subPiece, int numberOfSubPieces, vtkIdType range[2])
+{
+  range[0] = numberOfItems * subPiece / numberOfSubPieces;
+  range[1] = numberOfItems * (subPiece + 1) / numberOfSubPieces;
+}
+
+//----------------------------------------------------------------------------
+void ShiftValues(vtkDataArray* array, vtkIdType shift)
+{
+  if (shift != 0)
+  {
+    for (auto&& value : vtk::DataArrayValueRange<1>(array))
+    {
+      value = value - shift;
+    }
+    array->Modified();
+  }
+}
 }
 
 //----------------------------------------------------------------------------
@@ -99,6 +127,7 @@ vtkHDFReader::vtkHDFReader()
   std::fill(this->WholeExtent, this->WholeExtent + 6, 0);
   std::fill(this->Origin, this->Origin + 3, 0.0);
   std::fill(this->Spacing, this->Spacing + 3, 0.0);
+  this->TimeStep = 0;
   this->Impl = new vtkHDFReader::Implementation(this);
 }
 
@@ -218,7 +247,8 @@ int vtkHDFReader::RequestDataObject(vtkInformation*, vtkInformationVector** vtkN
   vtkInformationVector* outputVector)
 {
   std::map<int, std::string> typeNameMap = { std::make_pair(VTK_IMAGE_DATA, "vtkImageData"),
-    std::make_pair(VTK_UNSTRUCTURED_GRID, "vtkUnstructuredGrid") };
+    std::make_pair(VTK_UNSTRUCTURED_GRID, "vtkUnstructuredGrid"),
+    std::make_pair(VTK_POLY_DATA, "vtkPolyData") };
   vtkInformation* info = outputVector->GetInformationObject(0);
   vtkDataSet* output = vtkDataSet::SafeDownCast(info->Get(vtkDataObject::DATA_OBJECT()));
 
@@ -253,6 +283,10 @@ int vtkHDFReader::RequestDataObject(vtkInformation*, vtkInformationVector** vtkN
     {
       newOutput = vtkUnstructuredGrid::New();
     }
+    else if (dataSetType == VTK_POLY_DATA)
+    {
+      newOutput = vtkPolyData::New();
+    }
     else
     {
       vtkErrorMacro("HDF dataset type unknown: " << dataSetType);
@@ -314,7 +348,7 @@ int vtkHDFReader::RequestInformation(vtkInformation* vtkNotUsed(request),
     outInfo->Set(vtkDataObject::SPACING(), this->Spacing, 3);
     outInfo->Set(CAN_PRODUCE_SUB_EXTENT(), 1);
   }
-  else if (dataSetType == VTK_UNSTRUCTURED_GRID)
+  else if (dataSetType == VTK_UNSTRUCTURED_GRID || dataSetType == VTK_POLY_DATA)
   {
     outInfo->Set(CAN_HANDLE_PIECE_REQUEST(), 1);
   }
@@ -323,6 +357,23 @@ int vtkHDFReader::RequestInformation(vtkInformation* vtkNotUsed(request),
     vtkErrorMacro("Invalid dataset type: " << dataSetType);
     return 0;
   }
+  if (this->Impl->GetNumberOfSteps() > 0)
+  {
+    std::vector<double> values = this->Impl->GetStepValues();
+    if (values.empty())
+    {
+      return 0;
+    }
+    outInfo->Set(vtkStreamingDemandDrivenPipeline::TIME_STEPS(), values.data(),
+      static_cast<int>(values.size()));
+    double timeRange[2] = { values.front(), values.back() };
+    outInfo->Set(vtkStreamingDemandDrivenPipeline::TIME_RANGE(), timeRange, 2);
+  }
+  else
+  {
+    outInfo->Remove(vtkStreamingDemandDrivenPipeline::TIME_STEPS());
+    outInfo->Remove(vtkStreamingDemandDrivenPipeline::TIME_RANGE());
+  }
   return 1;
 }
 
@@ -359,8 +410,8 @@ int vtkHDFReader::Read(vtkInformation* outInfo, vtkImageData* data)
   }
 
   // in the same order as vtkDataObject::AttributeTypes: POINT, CELL, FIELD
-  for (int attributeType = 0; attributeType < vtkHDFReader::GetNumberOfAttributeTypes();
-       ++attributeType)
+  // field arrays are read by AddFieldArrays
+  for (int attributeType = 0; attributeType < vtkDataObject::FIELD; ++attributeType)
   {
     std::vector<std::string> names = this->Impl->GetArrayNames(attributeType);
     for (const std::string& name : names)
@@ -368,8 +419,14 @@ int vtkHDFReader::Read(vtkInformation* outInfo, vtkImageData* data)
       if (this->DataArraySelection[attributeType]->ArrayIsEnabled(name.c_str()))
       {
         vtkSmartPointer<vtkDataArray> array;
-        std::vector<hsize_t> fileExtent = ::ReduceDimension(&updateExtent[0], this->WholeExtent);
-        std::copy(updateExtent.begin(), updateExtent.end(), fileExtent.begin());
+        std::vector<hsize_t> fileExtent = ::ReduceDimension(
+          &updateExtent[0], this->WholeExtent, attributeType == vtkDataObject::CELL);
+        if (this->Impl->GetNumberOfSteps() > 0)
+        {
+          // the time steps are the first dimension of the arrays.
+          fileExtent.push_back(this->TimeStep);
+          fileExtent.push_back(this->TimeStep);
+        }
         if ((array = vtk::TakeSmartPointer(
                this->Impl->NewArray(attributeType, name.c_str(), fileExtent))) == nullptr)
         {
@@ -390,6 +447,10 @@ int vtkHDFReader::AddFieldArrays(vtkDataSet* data)
   std::vector<std::string> names = this->Impl->GetArrayNames(vtkDataObject::FIELD);
   for (const std::string& name : names)
   {
+    if (!this->DataArraySelection[vtkDataObject::FIELD]->ArrayIsEnabled(name.c_str()))
+    {
+      continue;
+    }
     vtkSmartPointer<vtkAbstractArray> array;
     if ((array = vtk::TakeSmartPointer(this->Impl->NewFieldArray(name.c_str()))) == nullptr)
     {
@@ -403,61 +464,89 @@ int vtkHDFReader::AddFieldArrays(vtkDataSet* data)
 }
 
 //------------------------------------------------------------------------------
-int vtkHDFReader::Read(const std::vector<vtkIdType>& numberOfPoints,
+vtkCellArray* vtkHDFReader::NewCellArray(const std::string& prefix,
   const std::vector<vtkIdType>& numberOfCells,
   const std::vector<vtkIdType>& numberOfConnectivityIds, int filePiece,
-  vtkUnstructuredGrid* pieceData)
+  const vtkIdType cellRange[2])
 {
-  // read the piece and add it to data
-  vtkNew<vtkPoints> points;
-  vtkSmartPointer<vtkDataArray> pointArray;
-  vtkIdType pointOffset = std::accumulate(&numberOfPoints[0], &numberOfPoints[filePiece], 0);
-  if ((pointArray = vtk::TakeSmartPointer(this->Impl->NewMetadataArray(
-         "Points", pointOffset, numberOfPoints[filePiece]))) == nullptr)
-  {
-    vtkErrorMacro("Cannot read the Points array");
-    return 0;
-  }
-  points->SetData(pointArray);
-  pieceData->SetPoints(points);
-  vtkNew<vtkCellArray> cellArray;
   vtkSmartPointer<vtkDataArray> offsetsArray;
   vtkSmartPointer<vtkDataArray> connectivityArray;
-  vtkSmartPointer<vtkDataArray> p;
-  vtkUnsignedCharArray* typesArray;
   // the offsets array has (numberOfCells[i] + 1) elements.
-  vtkIdType offset = std::accumulate(&numberOfCells[0], &numberOfCells[filePiece], filePiece);
+  vtkIdType offset = std::accumulate(
+    &numberOfCells[0], &numberOfCells[filePiece], static_cast<vtkIdType>(filePiece));
   if ((offsetsArray = vtk::TakeSmartPointer(
-         this->Impl->NewMetadataArray("Offsets", offset, numberOfCells[filePiece] + 1))) == nullptr)
+         this->Impl->NewMetadataArray((prefix + "Offsets").c_str(), offset + cellRange[0],
+           cellRange[1] - cellRange[0] + 1))) == nullptr)
   {
-    vtkErrorMacro("Cannot read the Offsets array");
-    return 0;
+    vtkErrorMacro("Cannot read the " << prefix << "Offsets array");
+    return nullptr;
+  }
+  // only the connectivity of the cells read
+  vtkIdType firstId = static_cast<vtkIdType>(offsetsArray->GetComponent(0, 0));
+  vtkIdType numberOfIds = static_cast<vtkIdType>(
+                            offsetsArray->GetComponent(offsetsArray->GetNumberOfTuples() - 1, 0)) -
+    firstId;
+  if (firstId < 0 || numberOfIds < 0 || firstId + numberOfIds > numberOfConnectivityIds[filePiece])
+  {
+    vtkErrorMacro("Invalid " << prefix << "Offsets array");
+    return nullptr;
   }
-  offset = std::accumulate(&numberOfConnectivityIds[0], &numberOfConnectivityIds[filePiece], 0);
+  ::ShiftValues(offsetsArray, firstId);
+  offset = std::accumulate(&numberOfConnectivityIds[0], &numberOfConnectivityIds[filePiece],
+    static_cast<vtkIdType>(0));
   if ((connectivityArray = vtk::TakeSmartPointer(this->Impl->NewMetadataArray(
-         "Connectivity", offset, numberOfConnectivityIds[filePiece]))) == nullptr)
+         (prefix + "Connectivity").c_str(), offset + firstId, numberOfIds))) == nullptr)
   {
-    vtkErrorMacro("Cannot read the Connectivity array");
-    return 0;
+    vtkErrorMacro("Cannot read the " << prefix << "Connectivity array");
+    return nullptr;
   }
+  vtkCellArray* cellArray = vtkCellArray::New();
   cellArray->SetData(offsetsArray, connectivityArray);
+  return cellArray;
+}
 
-  vtkIdType cellOffset = std::accumulate(&numberOfCells[0], &numberOfCells[filePiece], 0);
-  if ((p = vtk::TakeSmartPointer(
-         this->Impl->NewMetadataArray("Types", cellOffset, numberOfCells[filePiece]))) == nullptr)
+//------------------------------------------------------------------------------
+void vtkHDFReader::GetPointRange(const std::vector<vtkCellArray*>& cellArrays,
+  vtkIdType filePieceNumberOfPoints, bool wholePiece, vtkIdType pointRange[2])
+{
+  pointRange[0] = 0;
+  pointRange[1] = filePieceNumberOfPoints;
+  if (wholePiece)
   {
-    vtkErrorMacro("Cannot read the Types array");
-    return 0;
+    return;
   }
-  if ((typesArray = vtkUnsignedCharArray::SafeDownCast(p)) == nullptr)
+  pointRange[0] = filePieceNumberOfPoints;
+  pointRange[1] = 0;
+  for (vtkCellArray* cellArray : cellArrays)
   {
-    vtkErrorMacro("Error: The Types array element is not unsigned char.");
-    return 0;
+    vtkDataArray* connectivity = cellArray->GetConnectivityArray();
+    if (connectivity->GetNumberOfTuples() > 0)
+    {
+      double range[2];
+      connectivity->GetRange(range, 0);
+      pointRange[0] = std::min(pointRange[0], static_cast<vtkIdType>(range[0]));
+      pointRange[1] = std::max(pointRange[1], static_cast<vtkIdType>(range[1]) + 1);
+    }
   }
-  pieceData->SetCells(typesArray, cellArray);
+  if (pointRange[0] >= pointRange[1])
+  {
+    // no cells, no points
+    pointRange[0] = pointRange[1] = 0;
+    return;
+  }
+  for (vtkCellArray* cellArray : cellArrays)
+  {
+    ::ShiftValues(cellArray->GetConnectivityArray(), pointRange[0]);
+  }
+}
 
-  std::vector<vtkIdType> offsets = { pointOffset, cellOffset };
-  std::vector<const std::vector<vtkIdType>*> numberOf = { &numberOfPoints, &numberOfCells };
+//------------------------------------------------------------------------------
+int vtkHDFReader::AddAttributeArrays(vtkDataSet* pieceData, vtkIdType pointOffset,
+  vtkIdType numberOfPoints, const std::vector<vtkIdType>& cellOffsets,
+  const std::vector<vtkIdType>& numberOfCells)
+{
+  std::vector<std::vector<vtkIdType>> offsets = { { pointOffset }, cellOffsets };
+  std::vector<std::vector<vtkIdType>> numberOf = { { numberOfPoints }, numberOfCells };
   // in the same order as vtkDataObject::AttributeTypes: POINT, CELL, FIELD
   // field arrays are only read on node 0
   for (int attributeType = 0; attributeType < vtkDataObject::FIELD; ++attributeType)
@@ -468,11 +557,23 @@ int vtkHDFReader::Read(const std::vector<vtkIdType>& numberOfPoints,
       if (this->DataArraySelection[attributeType]->ArrayIsEnabled(name.c_str()))
       {
         vtkSmartPointer<vtkDataArray> array;
-        if ((array = vtk::TakeSmartPointer(this->Impl->NewArray(attributeType, name.c_str(),
-               offsets[attributeType], (*numberOf[attributeType])[filePiece]))) == nullptr)
+        for (size_t i = 0; i < offsets[attributeType].size(); ++i)
         {
-          vtkErrorMacro("Error reading array " << name);
-          return 0;
+          vtkSmartPointer<vtkDataArray> part;
+          if ((part = vtk::TakeSmartPointer(this->Impl->NewArray(attributeType, name.c_str(),
+                 offsets[attributeType][i], numberOf[attributeType][i]))) == nullptr)
+          {
+            vtkErrorMacro("Error reading array " << name);
+            return 0;
+          }
+          if (!array)
+          {
+            array = part;
+          }
+          else
+          {
+            array->InsertTuples(array->GetNumberOfTuples(), part->GetNumberOfTuples(), 0, part);
+          }
         }
         array->SetName(name.c_str());
         pieceData->GetAttributesAsFieldData(attributeType)->AddArray(array);
@@ -482,6 +583,120 @@ int vtkHDFReader::Read(const std::vector<vtkIdType>& numberOfPoints,
   return 1;
 }
 
+//------------------------------------------------------------------------------
+int vtkHDFReader::Read(const std::vector<vtkIdType>& numberOfPoints,
+  const std::vector<vtkIdType>& numberOfCells,
+  const std::vector<vtkIdType>& numberOfConnectivityIds, int filePiece, int subPiece,
+  int numberOfSubPieces, vtkUnstructuredGrid* pieceData)
+{
+  // read the cells of the sub-piece, then the points they use
+  vtkIdType cellRange[2];
+  ::GetSubPieceRange(numberOfCells[filePiece], subPiece, numberOfSubPieces, cellRange);
+  vtkSmartPointer<vtkCellArray> cellArray;
+  vtkSmartPointer<vtkDataArray> p;
+  vtkUnsignedCharArray* typesArray;
+  if ((cellArray = vtk::TakeSmartPointer(this->NewCellArray(
+         "", numberOfCells, numberOfConnectivityIds, filePiece, cellRange))) == nullptr)
+  {
+    return 0;
+  }
+  vtkIdType pointRange[2];
+  this->GetPointRange(
+    { cellArray }, numberOfPoints[filePiece], numberOfSubPieces == 1, pointRange);
+
+  vtkNew<vtkPoints> points;
+  vtkSmartPointer<vtkDataArray> pointArray;
+  vtkIdType pointOffset =
+    std::accumulate(&numberOfPoints[0], &numberOfPoints[filePiece], static_cast<vtkIdType>(0)) +
+    pointRange[0];
+  if ((pointArray = vtk::TakeSmartPointer(this->Impl->NewMetadataArray(
+         "Points", pointOffset, pointRange[1] - pointRange[0]))) == nullptr)
+  {
+    vtkErrorMacro("Cannot read the Points array");
+    return 0;
+  }
+  points->SetData(pointArray);
+  pieceData->SetPoints(points);
+
+  vtkIdType cellOffset =
+    std::accumulate(&numberOfCells[0], &numberOfCells[filePiece], static_cast<vtkIdType>(0)) +
+    cellRange[0];
+  if ((p = vtk::TakeSmartPointer(this->Impl->NewMetadataArray(
+         "Types", cellOffset, cellRange[1] - cellRange[0]))) == nullptr)
+  {
+    vtkErrorMacro("Cannot read the Types array");
+    return 0;
+  }
+  if ((typesArray = vtkUnsignedCharArray::SafeDownCast(p)) == nullptr)
+  {
+    vtkErrorMacro("Error: The Types array element is not unsigned char.");
+    return 0;
+  }
+  pieceData->SetCells(typesArray, cellArray);
+
+  return this->AddAttributeArrays(pieceData, pointOffset, pointRange[1] - pointRange[0],
+    { cellOffset }, { cellRange[1] - cellRange[0] });
+}
+
+//------------------------------------------------------------------------------
+int vtkHDFReader::GetFilePieceRange(int range[2])
+{
+  range[0] = 0;
+  range[1] = this->Impl->GetNumberOfPieces();
+  int numberOfSteps = this->Impl->GetNumberOfSteps();
+  if (numberOfSteps > 0)
+  {
+    std::vector<vtkIdType> partOffsets =
+      this->Impl->GetMetadata("Steps/PartOffsets", numberOfSteps);
+    std::vector<vtkIdType> numberOfParts =
+      this->Impl->GetMetadata("Steps/NumberOfParts", numberOfSteps);
+    if (partOffsets.empty() || numberOfParts.empty())
+    {
+      return 0;
+    }
+    range[0] = static_cast<int>(partOffsets[this->TimeStep]);
+    range[1] = static_cast<int>(partOffsets[this->TimeStep] + numberOfParts[this->TimeStep]);
+    if (range[0] < 0 || range[1] > this->Impl->GetNumberOfPieces())
+    {
+      vtkErrorMacro("Invalid pieces for time step " << this->TimeStep);
+      return 0;
+    }
+  }
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+std::vector<std::array<int, 3>> vtkHDFReader::GetFileParts(
+  vtkInformation* outInfo, int filePieceRange[2])
+{
+  std::vector<std::array<int, 3>> parts;
+  int memoryPieceCount = outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_NUMBER_OF_PIECES());
+  int piece = outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_PIECE_NUMBER());
+  int filePieceCount = filePieceRange[1] - filePieceRange[0];
+  if (memoryPieceCount <= filePieceCount)
+  {
+    for (int filePiece = filePieceRange[0] + piece; filePiece < filePieceRange[1];
+         filePiece += memoryPieceCount)
+    {
+      parts.push_back({ { filePiece, 0, 1 } });
+    }
+  }
+  else if (filePieceCount > 0 && piece >= 0 && piece < memoryPieceCount)
+  {
+    // the pieces [firstPiece(i), firstPiece(i + 1)) split the file piece i
+    auto firstPiece = [=](vtkIdType filePiece) {
+      return static_cast<int>(
+        (filePiece * memoryPieceCount + filePieceCount - 1) / filePieceCount);
+    };
+    int filePiece =
+      static_cast<int>(static_cast<vtkIdType>(piece) * filePieceCount / memoryPieceCount);
+    int first = firstPiece(filePiece);
+    parts.push_back(
+      { { filePieceRange[0] + filePiece, piece - first, firstPiece(filePiece + 1) - first } });
+  }
+  return parts;
+}
+
 //------------------------------------------------------------------------------
 int vtkHDFReader::Read(vtkInformation* outInfo, vtkUnstructuredGrid* data)
 {
@@ -503,19 +718,148 @@ int vtkHDFReader::Read(vtkInformation* outInfo, vtkUnstructuredGrid* data)
   {
     return 0;
   }
-  int memoryPieceCount = outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_NUMBER_OF_PIECES());
-  int piece = outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_PIECE_NUMBER());
-  vtkNew<vtkUnstructuredGrid> pieceData;
+  int filePieceRange[2];
+  if (!this->GetFilePieceRange(filePieceRange))
+  {
+    return 0;
+  }
+  // the parts are read first and appended all at once
   vtkNew<vtkAppendDataSets> append;
-  append->AddInputData(data);
-  append->AddInputData(pieceData);
-  for (int filePiece = piece; filePiece < filePieceCount; filePiece += memoryPieceCount)
+  vtkSmartPointer<vtkUnstructuredGrid> pieceData;
+  for (const auto& part : this->GetFileParts(outInfo, filePieceRange))
+  {
+    pieceData = vtkSmartPointer<vtkUnstructuredGrid>::New();
+    if (!this->Read(numberOfPoints, numberOfCells, numberOfConnectivityIds, part[0], part[1],
+          part[2], pieceData))
+    {
+      return 0;
+    }
+    append->AddInputData(pieceData);
+  }
+  if (append->GetNumberOfInputConnections(0) == 1)
+  {
+    data->ShallowCopy(pieceData);
+  }
+  else if (append->GetNumberOfInputConnections(0) > 1)
+  {
+    append->Update();
+    data->ShallowCopy(append->GetOutput());
+  }
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+int vtkHDFReader::Read(const std::vector<vtkIdType>& numberOfPoints,
+  const std::vector<std::vector<vtkIdType>>& numberOfCells,
+  const std::vector<std::vector<vtkIdType>>& numberOfConnectivityIds, int filePiece,
+  int subPiece, int numberOfSubPieces, vtkPolyData* pieceData)
+{
+  // the cells of a piece are its vertices, then lines, polygons and strips,
+  // each topology is split in sub-pieces.
+  std::vector<vtkSmartPointer<vtkCellArray>> topologies(numberOfCells.size());
+  std::vector<vtkCellArray*> cellArrays;
+  std::vector<vtkIdType> cellOffsets;
+  std::vector<vtkIdType> cellCounts;
+  vtkIdType cellOffset = 0;
+  for (size_t i = 0; i < topologies.size(); ++i)
+  {
+    cellOffset += std::accumulate(
+      &numberOfCells[i][0], &numberOfCells[i][filePiece], static_cast<vtkIdType>(0));
+  }
+  for (size_t i = 0; i < topologies.size(); ++i)
+  {
+    vtkIdType cellRange[2];
+    ::GetSubPieceRange(numberOfCells[i][filePiece], subPiece, numberOfSubPieces, cellRange);
+    if ((topologies[i] = vtk::TakeSmartPointer(this->NewCellArray(::PolyDataTopologyNames[i],
+           numberOfCells[i], numberOfConnectivityIds[i], filePiece, cellRange))) == nullptr)
+    {
+      return 0;
+    }
+    cellArrays.push_back(topologies[i]);
+    // contiguous cell ranges are read at once
+    if (!cellOffsets.empty() && cellOffsets.back() + cellCounts.back() == cellOffset + cellRange[0])
+    {
+      cellCounts.back() += cellRange[1] - cellRange[0];
+    }
+    else
+    {
+      cellOffsets.push_back(cellOffset + cellRange[0]);
+      cellCounts.push_back(cellRange[1] - cellRange[0]);
+    }
+    cellOffset += numberOfCells[i][filePiece];
+  }
+  vtkIdType pointRange[2];
+  this->GetPointRange(cellArrays, numberOfPoints[filePiece], numberOfSubPieces == 1, pointRange);
+  pieceData->SetVerts(topologies[0]);
+  pieceData->SetLines(topologies[1]);
+  pieceData->SetPolys(topologies[2]);
+  pieceData->SetStrips(topologies[3]);
+
+  vtkNew<vtkPoints> points;
+  vtkSmartPointer<vtkDataArray> pointArray;
+  vtkIdType pointOffset =
+    std::accumulate(&numberOfPoints[0], &numberOfPoints[filePiece], static_cast<vtkIdType>(0)) +
+    pointRange[0];
+  if ((pointArray = vtk::TakeSmartPointer(this->Impl->NewMetadataArray(
+         "Points", pointOffset, pointRange[1] - pointRange[0]))) == nullptr)
+  {
+    vtkErrorMacro("Cannot read the Points array");
+    return 0;
+  }
+  points->SetData(pointArray);
+  pieceData->SetPoints(points);
+
+  return this->AddAttributeArrays(
+    pieceData, pointOffset, pointRange[1] - pointRange[0], cellOffsets, cellCounts);
+}
+
+//------------------------------------------------------------------------------
+int vtkHDFReader::Read(vtkInformation* outInfo, vtkPolyData* data)
+{
+  int filePieceCount = this->Impl->GetNumberOfPieces();
+  std::vector<vtkIdType> numberOfPoints = this->Impl->GetMetadata("NumberOfPoints", filePieceCount);
+  if (numberOfPoints.empty())
   {
-    pieceData->Initialize();
-    if (!this->Read(numberOfPoints, numberOfCells, numberOfConnectivityIds, filePiece, pieceData))
+    return 0;
+  }
+  std::vector<std::vector<vtkIdType>> numberOfCells;
+  std::vector<std::vector<vtkIdType>> numberOfConnectivityIds;
+  for (const char* topologyName : ::PolyDataTopologyNames)
+  {
+    std::string prefix = topologyName;
+    numberOfCells.push_back(
+      this->Impl->GetMetadata((prefix + "NumberOfCells").c_str(), filePieceCount));
+    numberOfConnectivityIds.push_back(
+      this->Impl->GetMetadata((prefix + "NumberOfConnectivityIds").c_str(), filePieceCount));
+    if (numberOfCells.back().empty() || numberOfConnectivityIds.back().empty())
     {
       return 0;
     }
+  }
+  int filePieceRange[2];
+  if (!this->GetFilePieceRange(filePieceRange))
+  {
+    return 0;
+  }
+  // the parts are read first and appended all at once
+  vtkNew<vtkAppendPolyData> append;
+  vtkSmartPointer<vtkPolyData> pieceData;
+  for (const auto& part : this->GetFileParts(outInfo, filePieceRange))
+  {
+    pieceData = vtkSmartPointer<vtkPolyData>::New();
+    if (!this->Read(numberOfPoints, numberOfCells, numberOfConnectivityIds, part[0], part[1],
+          part[2], pieceData))
+    {
+      return 0;
+    }
+    append->AddInputData(pieceData);
+  }
+  if (append->GetNumberOfInputConnections(0) == 1)
+  {
+    data->ShallowCopy(pieceData);
+  }
+  else if (append->GetNumberOfInputConnections(0) > 1)
+  {
     append->Update();
     data->ShallowCopy(append->GetOutput());
   }
@@ -537,6 +881,23 @@ int vtkHDFReader::RequestData(vtkInformation* vtkNotUsed(request),
   {
     return 0;
   }
+  this->TimeStep = 0;
+  if (this->Impl->GetNumberOfSteps() > 0)
+  {
+    std::vector<double> values = this->Impl->GetStepValues();
+    if (values.empty())
+    {
+      return 0;
+    }
+    if (outInfo->Has(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP()))
+    {
+      // the last time step at or before the requested time
+      double time = outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP());
+      auto it = std::upper_bound(values.begin(), values.end(), time);
+      this->TimeStep = it == values.begin() ? 0 : static_cast<int>(it - values.begin()) - 1;
+    }
+    output->GetInformation()->Set(vtkDataObject::DATA_TIME_STEP(), values[this->TimeStep]);
+  }
   int dataSetType = this->Impl->GetDataSetType();
   if (dataSetType == VTK_IMAGE_DATA)
   {
@@ -548,6 +909,11 @@ int vtkHDFReader::RequestData(vtkInformation* vtkNotUsed(request),
     vtkUnstructuredGrid* data = vtkUnstructuredGrid::SafeDownCast(output);
     ok = this->Read(outInfo, data);
   }
+  else if (dataSetType == VTK_POLY_DATA)
+  {
+    vtkPolyData* data = vtkPolyData::SafeDownCast(output);
+    ok = this->Read(outInfo, data);
+  }
   else
   {
     vtkErrorMacro("HDF dataset type unknown: " << dataSetType);
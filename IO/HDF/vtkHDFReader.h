@@ -23,10 +23,13 @@
 
 #include "vtkDataSetAlgorithm.h"
 #include "vtkIOHDFModule.h" // For export macro
+#include <array>            // For std::array
+#include <string>           // For std::string
 #include <vector>           // For storing list of values
 
 class vtkAbstractArray;
 class vtkCallbackCommand;
+class vtkCellArray;
 class vtkDataArraySelection;
 class vtkDataSet;
 class vtkDataSetAttributes;
@@ -36,9 +39,17 @@ class vtkCommand;
 
 /**
  * Reads data saved using the VTKHDF format which supports all
- * vtkDataSet types (image data and unstructured grid are currently
- * implemented) and both serial and parallel processing.  The standard
+ * vtkDataSet types (image data, unstructured grid and poly data are
+ * currently implemented) and both serial and parallel processing. Files
+ * with a Steps group provide the time steps they store. The standard
  * extension for this format is .hdf.
+ *
+ * Only the requested data is read from the file: image data reads the
+ * hyperslab of its update extent, and unstructured grids and poly data
+ * read the pieces assigned to the requested piece. When more pieces are
+ * requested than the file stores, each stored piece is split further
+ * into contiguous ranges of cells, which read the range of points they
+ * use. Arrays disabled in the array selections are not read.
  */
 class VTKIOHDF_EXPORT vtkHDFReader : public vtkDataSetAlgorithm
 {
@@ -121,18 +132,68 @@ protected:
    */
   int Read(vtkInformation* outInfo, vtkImageData* data);
   int Read(vtkInformation* outInfo, vtkUnstructuredGrid* data);
+  int Read(vtkInformation* outInfo, vtkPolyData* data);
   //@}
   /**
-   * Read 'pieceData' specified by 'filePiece' where
-   * number of points, cells and connectivity ids
+   * Read 'pieceData', the sub-piece 'subPiece' out of 'numberOfSubPieces'
+   * of 'filePiece', where number of points, cells and connectivity ids
    * store those numbers for all pieces.
    */
   int Read(const std::vector<vtkIdType>& numberOfPoints,
     const std::vector<vtkIdType>& numberOfCells,
+    const std::vector<vtkIdType>& numberOfConnectivityIds, int filePiece, int subPiece,
+    int numberOfSubPieces, vtkUnstructuredGrid* pieceData);
+  /**
+   * Read the poly data 'pieceData', the sub-piece 'subPiece' out of
+   * 'numberOfSubPieces' of 'filePiece', where number of cells and
+   * connectivity ids store those numbers for the vertices, lines, polygons
+   * and strips of all pieces.
+   */
+  int Read(const std::vector<vtkIdType>& numberOfPoints,
+    const std::vector<std::vector<vtkIdType>>& numberOfCells,
+    const std::vector<std::vector<vtkIdType>>& numberOfConnectivityIds, int filePiece,
+    int subPiece, int numberOfSubPieces, vtkPolyData* pieceData);
+  /**
+   * Read the cells [cellRange[0], cellRange[1]) of 'filePiece' from the
+   * Offsets and Connectivity datasets whose names start with 'prefix'.
+   * The point ids are those of the file piece. Returns nullptr for an
+   * error. The cell array has to be deleted by the user.
+   */
+  vtkCellArray* NewCellArray(const std::string& prefix, const std::vector<vtkIdType>& numberOfCells,
     const std::vector<vtkIdType>& numberOfConnectivityIds, int filePiece,
-    vtkUnstructuredGrid* pieceData);
+    const vtkIdType cellRange[2]);
+  /**
+   * Sets 'pointRange' to the points of 'filePiece' used by 'cellArrays', or
+   * to all of its points for a whole piece, and renumbers the point ids of
+   * 'cellArrays' from the first point of the range.
+   */
+  void GetPointRange(const std::vector<vtkCellArray*>& cellArrays,
+    vtkIdType filePieceNumberOfPoints, bool wholePiece, vtkIdType pointRange[2]);
   /**
-   * Read the field arrays from the file and add them to the dataset.
+   * Read the point arrays of the points [pointOffset, pointOffset +
+   * numberOfPoints) and the cell arrays of the concatenated cell ranges
+   * [cellOffsets[i], cellOffsets[i] + numberOfCells[i]), and add them to
+   * 'pieceData'.
+   */
+  int AddAttributeArrays(vtkDataSet* pieceData, vtkIdType pointOffset,
+    vtkIdType numberOfPoints, const std::vector<vtkIdType>& cellOffsets,
+    const std::vector<vtkIdType>& numberOfCells);
+  /**
+   * Sets 'range' to the first file piece of the current time step and the
+   * one after its last. Returns 1 if successfull, 0 otherwise.
+   */
+  int GetFilePieceRange(int range[2]);
+  /**
+   * Returns the parts of the file pieces in 'filePieceRange' read for the
+   * piece requested in 'outInfo', as triplets of file piece, sub-piece and
+   * number of sub-pieces. Pieces are dealt round-robin when the file has at
+   * least as many pieces as requested, otherwise each file piece is split
+   * evenly in sub-pieces.
+   */
+  std::vector<std::array<int, 3>> GetFileParts(vtkInformation* outInfo, int filePieceRange[2]);
+  /**
+   * Read the field arrays enabled in the field data array selection and
+   * add them to the dataset.
    */
   int AddFieldArrays(vtkDataSet* data);
 
@@ -189,6 +250,10 @@ protected:
   double Origin[3];
   double Spacing[3];
   //@}
+  /**
+   * Index of the time step read, 0 if the file has no time steps.
+   */
+  int TimeStep;
   class Implementation;
   Implementation* Impl;
 };
@@ -14,6 +14,7 @@
 =========================================================================*/
 
 #include "vtkHDFReaderImplementation.h"
+#include <algorithm>
 #include <iostream>
 #include <iterator>
 #include <sstream>
@@ -75,6 +76,7 @@ vtkHDFReader::Implementation::Implementation(vtkHDFReader* reader)
   , VTKGroup(-1)
   , DataSetType(-1)
   , NumberOfPieces(-1)
+  , NumberOfSteps(0)
   , Reader(reader)
 {
   std::fill(this->AttributeDataGroup.begin(), this->AttributeDataGroup.end(), -1);
@@ -176,14 +178,30 @@ bool vtkHDFReader::Implementation::Open(const char* fileName)
     {
       return false;
     }
-    hid_t attr = -1;
     try
     {
-      H5Eset_auto(H5E_DEFAULT, nullptr, nullptr); // errors off
-      if ((attr = H5Aopen_name(this->VTKGroup, "WholeExtent")) < 0)
+      std::string typeName;
+      if (H5Aexists(this->VTKGroup, "Type") > 0)
       {
-        H5Eset_auto(H5E_DEFAULT, f, client_data); // errors on
-        this->DataSetType = VTK_UNSTRUCTURED_GRID;
+        if (!this->GetStringAttribute("Type", typeName))
+        {
+          throw std::runtime_error("Cannot read the Type attribute");
+        }
+      }
+      else
+      {
+        // files written without a Type attribute
+        typeName =
+          H5Aexists(this->VTKGroup, "WholeExtent") > 0 ? "ImageData" : "UnstructuredGrid";
+      }
+      if (typeName == "ImageData")
+      {
+        this->DataSetType = VTK_IMAGE_DATA;
+        this->NumberOfPieces = 1;
+      }
+      else if (typeName == "UnstructuredGrid" || typeName == "PolyData")
+      {
+        this->DataSetType = typeName == "PolyData" ? VTK_POLY_DATA : VTK_UNSTRUCTURED_GRID;
         const char* datasetName = "/VTKHDF/NumberOfPoints";
         std::vector<hsize_t> dims = this->GetDimensions(datasetName);
         if (dims.size() != 1)
@@ -194,9 +212,17 @@ bool vtkHDFReader::Implementation::Open(const char* fileName)
       }
       else
       {
-        H5Eset_auto(H5E_DEFAULT, f, client_data); // errors on
-        this->DataSetType = VTK_IMAGE_DATA;
-        this->NumberOfPieces = 1;
+        throw std::runtime_error("Unknown dataset type: " + typeName);
+      }
+      if (H5Lexists(this->VTKGroup, "Steps", H5P_DEFAULT) > 0)
+      {
+        const char* datasetName = "/VTKHDF/Steps/Values";
+        std::vector<hsize_t> dims = this->GetDimensions(datasetName);
+        if (dims.size() != 1)
+        {
+          throw std::runtime_error(std::string(datasetName) + " dataset should have 1 dimension");
+        }
+        this->NumberOfSteps = dims[0];
       }
     }
     catch (const std::exception& e)
@@ -204,10 +230,6 @@ bool vtkHDFReader::Implementation::Open(const char* fileName)
       vtkErrorWithObjectMacro(this->Reader, << e.what());
       error = true;
     }
-    if (attr >= 0)
-    {
-      error = H5Aclose(attr) < 0 || error;
-    }
   }
   this->BuildTypeReaderMap();
   return !error;
@@ -218,6 +240,7 @@ void vtkHDFReader::Implementation::Close()
 {
   this->DataSetType = -1;
   this->NumberOfPieces = 0;
+  this->NumberOfSteps = 0;
   std::fill(this->Version.begin(), this->Version.end(), 0);
   for (size_t i = 0; i < this->AttributeDataGroup.size(); ++i)
   {
@@ -520,6 +543,88 @@ bool vtkHDFReader::Implementation::GetAttribute(
   return !error;
 }
 
+//------------------------------------------------------------------------------
+bool vtkHDFReader::Implementation::GetStringAttribute(
+  const char* attributeName, std::string& value)
+{
+  hid_t attr = -1;
+  hid_t type = -1;
+  hid_t memType = -1;
+  bool error = false;
+  try
+  {
+    if ((attr = H5Aopen_name(this->VTKGroup, attributeName)) < 0)
+    {
+      throw std::runtime_error(std::string(attributeName) + " attribute not found");
+    }
+    if ((type = H5Aget_type(attr)) < 0 || H5Tget_class(type) != H5T_STRING)
+    {
+      throw std::runtime_error(std::string(attributeName) + " attribute should be a string");
+    }
+    if ((memType = H5Tcopy(H5T_C_S1)) < 0)
+    {
+      throw std::runtime_error("Error H5Tcopy");
+    }
+    if (H5Tis_variable_str(type) > 0)
+    {
+      char* str = nullptr;
+      if (H5Tset_size(memType, H5T_VARIABLE) < 0 || H5Aread(attr, memType, &str) < 0)
+      {
+        throw std::runtime_error(std::string("Error reading ") + attributeName + " attribute");
+      }
+      value = str ? str : "";
+      H5free_memory(str);
+    }
+    else
+    {
+      std::vector<char> str(H5Tget_size(type) + 1, 0);
+      if (H5Tset_size(memType, str.size()) < 0 || H5Aread(attr, memType, str.data()) < 0)
+      {
+        throw std::runtime_error(std::string("Error reading ") + attributeName + " attribute");
+      }
+      value = str.data();
+    }
+  }
+  catch (const std::exception& e)
+  {
+    vtkErrorWithObjectMacro(this->Reader, << e.what());
+    error = true;
+  }
+  if (memType >= 0)
+  {
+    error = H5Tclose(memType) < 0 || error;
+  }
+  if (type >= 0)
+  {
+    error = H5Tclose(type) < 0 || error;
+  }
+  if (attr >= 0)
+  {
+    error = H5Aclose(attr) < 0 || error;
+  }
+  return !error;
+}
+
+//------------------------------------------------------------------------------
+std::vector<double> vtkHDFReader::Implementation::GetStepValues()
+{
+  std::vector<double> values;
+  if (this->NumberOfSteps <= 0)
+  {
+    return values;
+  }
+  std::vector<hsize_t> fileExtent = { 0, static_cast<hsize_t>(this->NumberOfSteps - 1) };
+  auto a = vtk::TakeSmartPointer(NewArray(this->VTKGroup, "Steps/Values", fileExtent));
+  if (!a)
+  {
+    return values;
+  }
+  values.resize(a->GetNumberOfTuples());
+  auto range = vtk::DataArrayValueRange<1>(a);
+  std::copy(range.begin(), range.end(), values.begin());
+  return values;
+}
+
 //------------------------------------------------------------------------------
 std::vector<std::string> vtkHDFReader::Implementation::GetArrayNames(int attributeType)
 {
@@ -786,7 +891,7 @@ template <typename T>
 vtkDataArray* vtkHDFReader::Implementation::NewArray(
   hid_t dataset, const std::vector<hsize_t>& fileExtent, hsize_t numberOfComponents)
 {
-  int numberOfTuples = 1;
+  vtkIdType numberOfTuples = 1;
   size_t ndims = fileExtent.size() >> 1;
   for (size_t i = 0; i < ndims; ++i)
   {
@@ -829,6 +934,11 @@ bool vtkHDFReader::Implementation::NewArray(
       count.push_back(numberOfComponents);
       start.push_back(0);
     }
+    if (std::find(count.begin(), count.end(), 0) != count.end())
+    {
+      // nothing to read, such as the cells of a piece without cells.
+      return true;
+    }
     if ((memspace = H5Screate_simple(static_cast<int>(count.size()), &count[0], nullptr)) < 0)
     {
       throw std::runtime_error("Error H5Screate_simple for memory space");
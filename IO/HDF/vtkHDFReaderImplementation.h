@@ -67,6 +67,15 @@ public:
    * Returns the number of partitions for this dataset.
    */
   int GetNumberOfPieces() { return this->NumberOfPieces; }
+  /**
+   * Returns the number of time steps stored in the Steps group, 0 if the
+   * file has none.
+   */
+  int GetNumberOfSteps() { return this->NumberOfSteps; }
+  /**
+   * Returns the values of the time steps, or an empty vector for an error.
+   */
+  std::vector<double> GetStepValues();
   /**
    * For an ImageData, sets the extent for 'partitionIndex'. Returns
    * true for success and false otherwise.
@@ -180,6 +189,10 @@ protected:
    * key in a map.
    */
   TypeDescription GetTypeDescription(hid_t type);
+  /**
+   * Reads the string attribute 'attributeName' from the /VTKHDF group.
+   */
+  bool GetStringAttribute(const char* attributeName, std::string& value);
 
 private:
   std::string FileName;
@@ -189,6 +202,7 @@ private:
   std::array<hid_t, 3> AttributeDataGroup;
   int DataSetType;
   int NumberOfPieces;
+  int NumberOfSteps;
   std::array<int, 2> Version;
   vtkHDFReader* Reader;
   using ArrayReader = vtkDataArray* (vtkHDFReader::Implementation::*)(hid_t dataset,
@@ -0,0 +1,526 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkHDFWriter.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkHDFWriter.h"
+
+#include "vtkCellArray.h"
+#include "vtkCellData.h"
+#include "vtkCommand.h"
+#include "vtkDoubleArray.h"
+#include "vtkErrorCode.h"
+#include "vtkExtentTranslator.h"
+#include "vtkFloatArray.h"
+#include "vtkHDFWriterImplementation.h"
+#include "vtkImageData.h"
+#include "vtkInformation.h"
+#include "vtkInformationVector.h"
+#include "vtkMatrix3x3.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPartitionedDataSet.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkStreamingDemandDrivenPipeline.h"
+#include "vtkTypeInt64Array.h"
+#include "vtkUnsignedCharArray.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+vtkStandardNewMacro(vtkHDFWriter);
+
+namespace
+{
+//----------------------------------------------------------------------------
+// Cell extent of the points of 'extent' in an image of 'wholeExtent'. Flat
+// axes of the whole extent have one layer of cells.
+void GetCellExtent(const int* extent, const int* wholeExtent, int* cellExtent)
+{
+  for (int i = 0; i < 3; ++i)
+  {
+    cellExtent[2 * i] = extent[2 * i];
+    cellExtent[2 * i + 1] =
+      extent[2 * i + 1] - (wholeExtent[2 * i] == wholeExtent[2 * i + 1] ? 0 : 1);
+  }
+}
+
+//----------------------------------------------------------------------------
+bool IsEmptyExtent(const int* extent)
+{
+  return extent[0] > extent[1] || extent[2] > extent[3] || extent[4] > extent[5];
+}
+}
+
+//----------------------------------------------------------------------------
+vtkHDFWriter::vtkHDFWriter()
+{
+  this->FileName = nullptr;
+  this->ChunkSize = 25000;
+  this->CompressionLevel = 0;
+  this->NumberOfPieces = 1;
+  this->WriteAllTimeSteps = false;
+  this->NumberOfTimeSteps = 0;
+  this->CurrentTimeIndex = 0;
+  this->CurrentPiece = 0;
+  this->DataSetType = -1;
+  std::fill(this->WholeExtent, this->WholeExtent + 6, 0);
+  this->Impl = new vtkHDFWriter::Implementation(this);
+}
+
+//----------------------------------------------------------------------------
+vtkHDFWriter::~vtkHDFWriter()
+{
+  delete this->Impl;
+  this->SetFileName(nullptr);
+}
+
+//----------------------------------------------------------------------------
+void vtkHDFWriter::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "FileName: " << (this->FileName ? this->FileName : "(none)") << "\n";
+  os << indent << "ChunkSize: " << this->ChunkSize << "\n";
+  os << indent << "CompressionLevel: " << this->CompressionLevel << "\n";
+  os << indent << "NumberOfPieces: " << this->NumberOfPieces << "\n";
+  os << indent << "WriteAllTimeSteps: " << this->WriteAllTimeSteps << "\n";
+}
+
+//----------------------------------------------------------------------------
+int vtkHDFWriter::FillInputPortInformation(int vtkNotUsed(port), vtkInformation* info)
+{
+  info->Remove(vtkAlgorithm::INPUT_REQUIRED_DATA_TYPE());
+  info->Append(vtkAlgorithm::INPUT_REQUIRED_DATA_TYPE(), "vtkImageData");
+  info->Append(vtkAlgorithm::INPUT_REQUIRED_DATA_TYPE(), "vtkUnstructuredGrid");
+  info->Append(vtkAlgorithm::INPUT_REQUIRED_DATA_TYPE(), "vtkPolyData");
+  info->Append(vtkAlgorithm::INPUT_REQUIRED_DATA_TYPE(), "vtkPartitionedDataSet");
+  return 1;
+}
+
+//----------------------------------------------------------------------------
+vtkTypeBool vtkHDFWriter::ProcessRequest(
+  vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  if (request->Has(vtkDemandDrivenPipeline::REQUEST_INFORMATION()))
+  {
+    return this->RequestInformation(request, inputVector, outputVector);
+  }
+  else if (request->Has(vtkStreamingDemandDrivenPipeline::REQUEST_UPDATE_EXTENT()))
+  {
+    return this->RequestUpdateExtent(request, inputVector, outputVector);
+  }
+  return this->Superclass::ProcessRequest(request, inputVector, outputVector);
+}
+
+//----------------------------------------------------------------------------
+int vtkHDFWriter::RequestInformation(vtkInformation* vtkNotUsed(request),
+  vtkInformationVector** inputVector, vtkInformationVector* vtkNotUsed(outputVector))
+{
+  vtkInformation* inInfo = inputVector[0]->GetInformationObject(0);
+  if (inInfo->Has(vtkStreamingDemandDrivenPipeline::TIME_STEPS()))
+  {
+    this->NumberOfTimeSteps = inInfo->Length(vtkStreamingDemandDrivenPipeline::TIME_STEPS());
+  }
+  else
+  {
+    this->NumberOfTimeSteps = 0;
+  }
+  return 1;
+}
+
+//----------------------------------------------------------------------------
+int vtkHDFWriter::RequestUpdateExtent(vtkInformation* vtkNotUsed(request),
+  vtkInformationVector** inputVector, vtkInformationVector* vtkNotUsed(outputVector))
+{
+  vtkInformation* inInfo = inputVector[0]->GetInformationObject(0);
+  if (this->WriteAllTimeSteps && inInfo->Has(vtkStreamingDemandDrivenPipeline::TIME_STEPS()))
+  {
+    double* timeSteps = inInfo->Get(vtkStreamingDemandDrivenPipeline::TIME_STEPS());
+    inInfo->Set(
+      vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP(), timeSteps[this->CurrentTimeIndex]);
+  }
+  inInfo->Set(vtkStreamingDemandDrivenPipeline::UPDATE_PIECE_NUMBER(), this->CurrentPiece);
+  inInfo->Set(vtkStreamingDemandDrivenPipeline::UPDATE_NUMBER_OF_PIECES(), this->NumberOfPieces);
+  inInfo->Set(vtkStreamingDemandDrivenPipeline::UPDATE_NUMBER_OF_GHOST_LEVELS(), 0);
+  if (inInfo->Has(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT()))
+  {
+    // producers of sub-extents split the whole extent by piece themselves
+    inInfo->Set(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT(),
+      inInfo->Get(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT()), 6);
+  }
+  return 1;
+}
+
+//----------------------------------------------------------------------------
+int vtkHDFWriter::RequestData(vtkInformation* request, vtkInformationVector** inputVector,
+  vtkInformationVector* vtkNotUsed(outputVector))
+{
+  if (!this->FileName)
+  {
+    vtkErrorMacro("No file name specified");
+    this->SetErrorCode(vtkErrorCode::NoFileNameError);
+    return 0;
+  }
+  vtkInformation* inInfo = inputVector[0]->GetInformationObject(0);
+  if (!inInfo->Get(vtkDataObject::DATA_OBJECT()))
+  {
+    vtkErrorMacro(<< "No input!");
+    return 0;
+  }
+
+  bool temporal = this->WriteAllTimeSteps && this->NumberOfTimeSteps > 0;
+  // is this the first request
+  if (this->CurrentTimeIndex == 0 && this->CurrentPiece == 0)
+  {
+    this->SetErrorCode(vtkErrorCode::NoError);
+    this->DataSetType = -1;
+    this->TimeValues.clear();
+    this->NumberOfParts.clear();
+    if (!this->Impl->Create(this->FileName))
+    {
+      this->SetErrorCode(vtkErrorCode::CannotOpenFileError);
+      return 0;
+    }
+  }
+  if (this->CurrentPiece == 0)
+  {
+    this->TimeValues.push_back(temporal
+        ? inInfo->Get(vtkStreamingDemandDrivenPipeline::TIME_STEPS())[this->CurrentTimeIndex]
+        : 0.0);
+    this->NumberOfParts.push_back(0);
+  }
+
+  this->InvokeEvent(vtkCommand::StartEvent, nullptr);
+  this->WriteData();
+  this->InvokeEvent(vtkCommand::EndEvent, nullptr);
+
+  if (++this->CurrentPiece == this->NumberOfPieces)
+  {
+    this->CurrentPiece = 0;
+    ++this->CurrentTimeIndex;
+  }
+  bool failed = this->GetErrorCode() != vtkErrorCode::NoError;
+  if (!failed &&
+    (this->CurrentPiece != 0 || (temporal && this->CurrentTimeIndex < this->NumberOfTimeSteps)))
+  {
+    // Tell the pipeline to loop over the pieces and time steps.
+    request->Set(vtkStreamingDemandDrivenPipeline::CONTINUE_EXECUTING(), 1);
+    return 1;
+  }
+
+  if (!failed && !this->WriteMetadata())
+  {
+    this->SetErrorCode(vtkErrorCode::UnknownError);
+    failed = true;
+  }
+  if (!this->Impl->Close() && !failed)
+  {
+    vtkErrorMacro("Error closing " << this->FileName);
+    this->SetErrorCode(vtkErrorCode::UnknownError);
+    failed = true;
+  }
+  this->CurrentPiece = 0;
+  this->CurrentTimeIndex = 0;
+  // Tell the pipeline to stop looping.
+  request->Set(vtkStreamingDemandDrivenPipeline::CONTINUE_EXECUTING(), 0);
+  this->WriteTime.Modified();
+  return failed ? 0 : 1;
+}
+
+//----------------------------------------------------------------------------
+void vtkHDFWriter::WriteData()
+{
+  vtkDataObject* input = this->GetInput();
+  std::vector<vtkDataSet*> dataSets;
+  if (vtkPartitionedDataSet* partitioned = vtkPartitionedDataSet::SafeDownCast(input))
+  {
+    for (unsigned int i = 0; i < partitioned->GetNumberOfPartitions(); ++i)
+    {
+      if (vtkDataSet* partition = partitioned->GetPartition(i))
+      {
+        dataSets.push_back(partition);
+      }
+    }
+  }
+  else if (vtkDataSet* dataSet = vtkDataSet::SafeDownCast(input))
+  {
+    dataSets.push_back(dataSet);
+  }
+
+  if (this->DataSetType < 0 && !dataSets.empty())
+  {
+    this->DataSetType = dataSets[0]->GetDataObjectType();
+    if (this->DataSetType == VTK_IMAGE_DATA)
+    {
+      // the datasets of the image arrays cover the whole extent of the input,
+      // or of the partitions written first when it has none.
+      vtkImageData* image = vtkImageData::SafeDownCast(dataSets[0]);
+      vtkInformation* inInfo = this->GetInputInformation();
+      if (input == image && inInfo->Has(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT()))
+      {
+        inInfo->Get(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(), this->WholeExtent);
+      }
+      else
+      {
+        image->GetExtent(this->WholeExtent);
+        for (vtkDataSet* dataSet : dataSets)
+        {
+          if (vtkImageData* partition = vtkImageData::SafeDownCast(dataSet))
+          {
+            const int* extent = partition->GetExtent();
+            for (int i = 0; i < 3; ++i)
+            {
+              this->WholeExtent[2 * i] = std::min(this->WholeExtent[2 * i], extent[2 * i]);
+              this->WholeExtent[2 * i + 1] =
+                std::max(this->WholeExtent[2 * i + 1], extent[2 * i + 1]);
+            }
+          }
+        }
+      }
+      if (!this->Impl->SetAttribute("WholeExtent", 6, this->WholeExtent) ||
+        !this->Impl->SetAttribute("Origin", 3, image->GetOrigin()) ||
+        !this->Impl->SetAttribute("Spacing", 3, image->GetSpacing()) ||
+        !this->Impl->SetAttribute("Direction", 9, image->GetDirectionMatrix()->GetData()))
+      {
+        this->SetErrorCode(vtkErrorCode::UnknownError);
+        return;
+      }
+    }
+  }
+
+  // field arrays are written once, with the first piece.
+  if (this->CurrentTimeIndex == 0 && this->CurrentPiece == 0)
+  {
+    vtkFieldData* fieldData = input->GetFieldData();
+    if ((!fieldData || fieldData->GetNumberOfArrays() == 0) && !dataSets.empty())
+    {
+      fieldData = dataSets[0]->GetFieldData();
+    }
+    if (fieldData && !this->Impl->WriteFieldData(fieldData))
+    {
+      this->SetErrorCode(vtkErrorCode::UnknownError);
+      return;
+    }
+  }
+
+  for (vtkDataSet* dataSet : dataSets)
+  {
+    int ok = 0;
+    if (dataSet->GetDataObjectType() != this->DataSetType)
+    {
+      vtkErrorMacro("Cannot write a " << dataSet->GetClassName()
+                                      << " with datasets of another type");
+    }
+    else if (this->DataSetType == VTK_IMAGE_DATA)
+    {
+      ok = this->WritePiece(vtkImageData::SafeDownCast(dataSet));
+    }
+    else if (this->DataSetType == VTK_UNSTRUCTURED_GRID)
+    {
+      ok = this->WritePiece(vtkUnstructuredGrid::SafeDownCast(dataSet));
+    }
+    else if (this->DataSetType == VTK_POLY_DATA)
+    {
+      ok = this->WritePiece(vtkPolyData::SafeDownCast(dataSet));
+    }
+    else
+    {
+      vtkErrorMacro("Dataset type not supported: " << dataSet->GetClassName());
+    }
+    if (!ok)
+    {
+      this->SetErrorCode(vtkErrorCode::UnknownError);
+      return;
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+int vtkHDFWriter::WritePiece(vtkImageData* data)
+{
+  // only the extent of the current piece is written, the input may provide
+  // more, for instance the whole extent for each piece.
+  const int* dataExtent = data->GetExtent();
+  int pieceExtent[6];
+  std::copy(this->WholeExtent, this->WholeExtent + 6, pieceExtent);
+  if (this->GetInput() == data && this->NumberOfPieces > 1)
+  {
+    vtkNew<vtkExtentTranslator> translator;
+    translator->PieceToExtentThreadSafe(this->CurrentPiece, this->NumberOfPieces, 0,
+      this->WholeExtent, pieceExtent, vtkExtentTranslator::BLOCK_MODE, 0);
+  }
+  int extent[6];
+  for (int i = 0; i < 3; ++i)
+  {
+    extent[2 * i] = std::max(dataExtent[2 * i], pieceExtent[2 * i]);
+    extent[2 * i + 1] = std::min(dataExtent[2 * i + 1], pieceExtent[2 * i + 1]);
+  }
+  if (::IsEmptyExtent(extent))
+  {
+    return 1;
+  }
+  int step = this->WriteAllTimeSteps && this->NumberOfTimeSteps > 0 ? this->CurrentTimeIndex : -1;
+
+  vtkPointData* pointData = data->GetPointData();
+  for (int i = 0; i < pointData->GetNumberOfArrays(); ++i)
+  {
+    vtkDataArray* array = pointData->GetArray(i);
+    if (array && array->GetName() &&
+      !this->Impl->WriteImageArray("/VTKHDF/PointData", array->GetName(), array, dataExtent,
+        extent, this->WholeExtent, step))
+    {
+      return 0;
+    }
+  }
+
+  int dataCellExtent[6];
+  int cellExtent[6];
+  int wholeCellExtent[6];
+  ::GetCellExtent(dataExtent, this->WholeExtent, dataCellExtent);
+  ::GetCellExtent(extent, this->WholeExtent, cellExtent);
+  ::GetCellExtent(this->WholeExtent, this->WholeExtent, wholeCellExtent);
+  vtkCellData* cellData = data->GetCellData();
+  for (int i = 0; !::IsEmptyExtent(cellExtent) && i < cellData->GetNumberOfArrays(); ++i)
+  {
+    vtkDataArray* array = cellData->GetArray(i);
+    if (array && array->GetName() &&
+      !this->Impl->WriteImageArray("/VTKHDF/CellData", array->GetName(), array, dataCellExtent,
+        cellExtent, wholeCellExtent, step))
+    {
+      return 0;
+    }
+  }
+  ++this->NumberOfParts.back();
+  return 1;
+}
+
+//----------------------------------------------------------------------------
+int vtkHDFWriter::WritePiece(vtkUnstructuredGrid* data)
+{
+  vtkNew<vtkFloatArray> noPoints;
+  noPoints->SetNumberOfComponents(3);
+  vtkNew<vtkCellArray> noCells;
+  vtkNew<vtkUnsignedCharArray> noTypes;
+  vtkDataArray* points = data->GetPoints() ? data->GetPoints()->GetData() : noPoints.Get();
+  vtkCellArray* cells = data->GetCells() ? data->GetCells() : noCells.Get();
+  vtkDataArray* types = data->GetCellTypesArray() ? data->GetCellTypesArray() : noTypes.Get();
+
+  hid_t group = this->Impl->GetGroup("/VTKHDF");
+  if (group < 0 || !this->Impl->AppendValue(group, "NumberOfPoints", points->GetNumberOfTuples()) ||
+    !this->Impl->AppendArray(group, "Points", points) || !this->Impl->AppendCells(group, cells) ||
+    !this->Impl->AppendArray(group, "Types", types) ||
+    !this->Impl->AppendAttributes("/VTKHDF/PointData", data->GetPointData()) ||
+    !this->Impl->AppendAttributes("/VTKHDF/CellData", data->GetCellData()))
+  {
+    return 0;
+  }
+  ++this->NumberOfParts.back();
+  return 1;
+}
+
+//----------------------------------------------------------------------------
+int vtkHDFWriter::WritePiece(vtkPolyData* data)
+{
+  vtkNew<vtkFloatArray> noPoints;
+  noPoints->SetNumberOfComponents(3);
+  vtkDataArray* points = data->GetPoints() ? data->GetPoints()->GetData() : noPoints.Get();
+
+  hid_t group = this->Impl->GetGroup("/VTKHDF");
+  if (group < 0 || !this->Impl->AppendValue(group, "NumberOfPoints", points->GetNumberOfTuples()) ||
+    !this->Impl->AppendArray(group, "Points", points))
+  {
+    return 0;
+  }
+  // in the order of the cell ids of vtkPolyData
+  const char* topologyNames[] = { "Vertices", "Lines", "Polygons", "Strips" };
+  vtkCellArray* topologies[] = { data->GetVerts(), data->GetLines(), data->GetPolys(),
+    data->GetStrips() };
+  for (int i = 0; i < 4; ++i)
+  {
+    hid_t topologyGroup = this->Impl->GetGroup(std::string("/VTKHDF/") + topologyNames[i]);
+    if (topologyGroup < 0 || !this->Impl->AppendCells(topologyGroup, topologies[i]))
+    {
+      return 0;
+    }
+  }
+  if (!this->Impl->AppendAttributes("/VTKHDF/PointData", data->GetPointData()) ||
+    !this->Impl->AppendAttributes("/VTKHDF/CellData", data->GetCellData()))
+  {
+    return 0;
+  }
+  ++this->NumberOfParts.back();
+  return 1;
+}
+
+//----------------------------------------------------------------------------
+int vtkHDFWriter::WriteMetadata()
+{
+  const char* typeName = nullptr;
+  switch (this->DataSetType)
+  {
+    case VTK_IMAGE_DATA:
+      typeName = "ImageData";
+      break;
+    case VTK_UNSTRUCTURED_GRID:
+      typeName = "UnstructuredGrid";
+      break;
+    case VTK_POLY_DATA:
+      typeName = "PolyData";
+      break;
+    default:
+      vtkErrorMacro("No dataset was written in " << this->FileName);
+      return 0;
+  }
+  // files readable by the readers of version 1 keep this version.
+  bool temporal = this->WriteAllTimeSteps && this->NumberOfTimeSteps > 0;
+  int version[2] = { this->DataSetType == VTK_POLY_DATA || temporal ? 2 : 1, 0 };
+  if (!this->Impl->SetAttribute("Version", 2, version) ||
+    !this->Impl->SetStringAttribute("Type", typeName))
+  {
+    return 0;
+  }
+  if (!temporal)
+  {
+    return 1;
+  }
+
+  hid_t steps = this->Impl->GetGroup("/VTKHDF/Steps");
+  int numberOfSteps = static_cast<int>(this->TimeValues.size());
+  vtkNew<vtkDoubleArray> values;
+  vtkNew<vtkTypeInt64Array> partOffsets;
+  vtkNew<vtkTypeInt64Array> numberOfParts;
+  vtkIdType partOffset = 0;
+  for (int i = 0; i < numberOfSteps; ++i)
+  {
+    values->InsertNextValue(this->TimeValues[i]);
+    partOffsets->InsertNextValue(partOffset);
+    numberOfParts->InsertNextValue(this->NumberOfParts[i]);
+    partOffset += this->NumberOfParts[i];
+  }
+  if (steps < 0 || !this->Impl->SetAttribute(steps, "NSteps", 1, &numberOfSteps) ||
+    !this->Impl->AppendArray(steps, "Values", values))
+  {
+    return 0;
+  }
+  // the pieces of image data are all in the same arrays.
+  if (this->DataSetType != VTK_IMAGE_DATA &&
+    (!this->Impl->AppendArray(steps, "PartOffsets", partOffsets) ||
+      !this->Impl->AppendArray(steps, "NumberOfParts", numberOfParts)))
+  {
+    return 0;
+  }
+  return 1;
+}
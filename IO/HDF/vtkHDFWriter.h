@@ -0,0 +1,172 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkHDFWriter.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkHDFWriter
+ * @brief   VTKHDF format writer.
+ *
+ * vtkHDFWriter writes vtkImageData, vtkUnstructuredGrid and vtkPolyData, or
+ * vtkPartitionedDataSet made of them, in the VTKHDF format read by
+ * vtkHDFReader.
+ *
+ * The datasets of the file are chunked, and compressed when
+ * CompressionLevel is not 0. The input can be streamed in NumberOfPieces
+ * pieces: each piece of an unstructured grid or polydata, and each
+ * partition of a vtkPartitionedDataSet, is appended to the file as a piece
+ * that vtkHDFReader reads independently of the others. The pieces of image
+ * data are written in the hyperslab of their extent in the arrays of the
+ * whole extent, which vtkHDFReader reads by sub-extents.
+ *
+ * When WriteAllTimeSteps is on, all the time steps of the input are
+ * appended to the same file, and vtkHDFReader provides them as time steps.
+ *
+ * @sa
+ * vtkHDFReader
+ */
+
+#ifndef vtkHDFWriter_h
+#define vtkHDFWriter_h
+
+#include "vtkIOHDFModule.h" // For export macro
+#include "vtkWriter.h"
+#include <vector> // For storing list of values
+
+class vtkImageData;
+class vtkPolyData;
+class vtkUnstructuredGrid;
+
+class VTKIOHDF_EXPORT vtkHDFWriter : public vtkWriter
+{
+public:
+  static vtkHDFWriter* New();
+  vtkTypeMacro(vtkHDFWriter, vtkWriter);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  //@{
+  /**
+   * Get/Set the name of the output file.
+   */
+  vtkSetStringMacro(FileName);
+  vtkGetStringMacro(FileName);
+  //@}
+
+  //@{
+  /**
+   * Get/Set the number of tuples in the chunks of the datasets of the file.
+   * The chunks of image data arrays hold whole rows of the image and about
+   * this number of tuples. Defaults to 25000.
+   */
+  vtkSetClampMacro(ChunkSize, int, 1, VTK_INT_MAX);
+  vtkGetMacro(ChunkSize, int);
+  //@}
+
+  //@{
+  /**
+   * Get/Set the level of the deflate compression of the datasets, from 0
+   * (no compression) to 9 (best compression). Defaults to 0.
+   */
+  vtkSetClampMacro(CompressionLevel, int, 0, 9);
+  vtkGetMacro(CompressionLevel, int);
+  //@}
+
+  //@{
+  /**
+   * Get/Set the number of pieces in which the input is requested and
+   * written. The input is expected to provide the requested pieces.
+   * Defaults to 1.
+   */
+  vtkSetClampMacro(NumberOfPieces, int, 1, VTK_INT_MAX);
+  vtkGetMacro(NumberOfPieces, int);
+  //@}
+
+  //@{
+  /**
+   * When on, all the time steps of the input are written in the file.
+   * Otherwise, only the current one is. Off by default.
+   */
+  vtkSetMacro(WriteAllTimeSteps, bool);
+  vtkGetMacro(WriteAllTimeSteps, bool);
+  vtkBooleanMacro(WriteAllTimeSteps, bool);
+  //@}
+
+protected:
+  vtkHDFWriter();
+  ~vtkHDFWriter() override;
+
+  int FillInputPortInformation(int port, vtkInformation* info) override;
+  vtkTypeBool ProcessRequest(vtkInformation* request, vtkInformationVector** inputVector,
+    vtkInformationVector* outputVector) override;
+  int RequestInformation(
+    vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector*);
+  int RequestUpdateExtent(
+    vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector*);
+  int RequestData(vtkInformation* request, vtkInformationVector** inputVector,
+    vtkInformationVector* outputVector) override;
+
+  /**
+   * Write the current piece of the input.
+   */
+  void WriteData() override;
+
+  //@{
+  /**
+   * Write a piece of the input, or a partition of it. Returns 1 if
+   * successful, 0 otherwise.
+   */
+  int WritePiece(vtkImageData* data);
+  int WritePiece(vtkUnstructuredGrid* data);
+  int WritePiece(vtkPolyData* data);
+  //@}
+
+  /**
+   * Write the Version and Type attributes and the time steps, once all the
+   * pieces are written. Returns 1 if successful, 0 otherwise.
+   */
+  int WriteMetadata();
+
+  char* FileName;
+  int ChunkSize;
+  int CompressionLevel;
+  int NumberOfPieces;
+  bool WriteAllTimeSteps;
+
+  int NumberOfTimeSteps;
+  int CurrentTimeIndex;
+  int CurrentPiece;
+
+  /**
+   * Type of the datasets written, -1 before the first one.
+   */
+  int DataSetType;
+  /**
+   * Whole extent of the image data written.
+   */
+  int WholeExtent[6];
+  //@{
+  /**
+   * Value and number of pieces written of each time step.
+   */
+  std::vector<double> TimeValues;
+  std::vector<vtkIdType> NumberOfParts;
+  //@}
+
+private:
+  vtkHDFWriter(const vtkHDFWriter&) = delete;
+  void operator=(const vtkHDFWriter&) = delete;
+
+  class Implementation;
+  Implementation* Impl;
+};
+
+#endif
@@ -0,0 +1,701 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkHDFWriterImplementation.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+
+#include "vtkHDFWriterImplementation.h"
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+
+#include "vtkCellArray.h"
+#include "vtkDataArray.h"
+#include "vtkDataSetAttributes.h"
+#include "vtkFieldData.h"
+#include "vtkNew.h"
+#include "vtkSmartPointer.h"
+#include "vtkStringArray.h"
+#include "vtkTypeInt64Array.h"
+#include "vtkTypeTraits.h"
+
+//------------------------------------------------------------------------------
+namespace
+{
+//------------------------------------------------------------------------------
+// Number of dimensions of the arrays of an image with the given whole
+// extent, as vtkHDFReader expects them: trailing flat axes are dropped.
+int GetNDims(const int* extent)
+{
+  int ndims = 3;
+  while (ndims > 1 && extent[2 * ndims - 1] == extent[2 * ndims - 2])
+  {
+    --ndims;
+  }
+  return ndims;
+}
+
+//------------------------------------------------------------------------------
+// Returns 'array' if its values are contiguous in memory, a copy of it
+// otherwise.
+vtkSmartPointer<vtkDataArray> GetContiguousArray(vtkDataArray* array)
+{
+  if (array->HasStandardMemoryLayout())
+  {
+    return array;
+  }
+  auto copy = vtk::TakeSmartPointer(vtkDataArray::CreateDataArray(array->GetDataType()));
+  copy->DeepCopy(array);
+  return copy;
+}
+}
+
+//------------------------------------------------------------------------------
+vtkHDFWriter::Implementation::Implementation(vtkHDFWriter* writer)
+  : File(-1)
+  , Writer(writer)
+{
+}
+
+//------------------------------------------------------------------------------
+vtkHDFWriter::Implementation::~Implementation()
+{
+  this->Close();
+}
+
+//------------------------------------------------------------------------------
+hid_t vtkHDFWriter::Implementation::GetNativeType(int dataType)
+{
+  switch (dataType)
+  {
+    case VTK_CHAR:
+      return H5T_NATIVE_CHAR;
+    case VTK_SIGNED_CHAR:
+      return H5T_NATIVE_SCHAR;
+    case VTK_UNSIGNED_CHAR:
+      return H5T_NATIVE_UCHAR;
+    case VTK_SHORT:
+      return H5T_NATIVE_SHORT;
+    case VTK_UNSIGNED_SHORT:
+      return H5T_NATIVE_USHORT;
+    case VTK_INT:
+      return H5T_NATIVE_INT;
+    case VTK_UNSIGNED_INT:
+      return H5T_NATIVE_UINT;
+    case VTK_LONG:
+      return H5T_NATIVE_LONG;
+    case VTK_UNSIGNED_LONG:
+      return H5T_NATIVE_ULONG;
+    case VTK_LONG_LONG:
+      return H5T_NATIVE_LLONG;
+    case VTK_UNSIGNED_LONG_LONG:
+      return H5T_NATIVE_ULLONG;
+    case VTK_ID_TYPE:
+#ifdef VTK_USE_64BIT_IDS
+      return H5T_NATIVE_LLONG;
+#else
+      return H5T_NATIVE_INT;
+#endif
+    case VTK_FLOAT:
+      return H5T_NATIVE_FLOAT;
+    case VTK_DOUBLE:
+      return H5T_NATIVE_DOUBLE;
+    default:
+      return -1;
+  }
+}
+
+//------------------------------------------------------------------------------
+bool vtkHDFWriter::Implementation::Create(const char* fileName)
+{
+  this->Close();
+  if ((this->File = H5Fcreate(fileName, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+  {
+    vtkErrorWithObjectMacro(this->Writer, "Cannot create file: " << fileName);
+    return false;
+  }
+  return this->GetGroup("/VTKHDF") >= 0;
+}
+
+//------------------------------------------------------------------------------
+bool vtkHDFWriter::Implementation::Close()
+{
+  bool error = false;
+  for (auto& group : this->Groups)
+  {
+    error = H5Gclose(group.second) < 0 || error;
+  }
+  this->Groups.clear();
+  if (this->File >= 0)
+  {
+    error = H5Fclose(this->File) < 0 || error;
+    this->File = -1;
+  }
+  return !error;
+}
+
+//------------------------------------------------------------------------------
+hid_t vtkHDFWriter::Implementation::GetGroup(const std::string& path)
+{
+  auto it = this->Groups.find(path);
+  if (it != this->Groups.end())
+  {
+    return it->second;
+  }
+  hid_t group = H5Gcreate(this->File, path.c_str(), H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+  if (group < 0)
+  {
+    vtkErrorWithObjectMacro(this->Writer, "Cannot create group " << path);
+    return -1;
+  }
+  this->Groups[path] = group;
+  return group;
+}
+
+//------------------------------------------------------------------------------
+template <typename T>
+bool vtkHDFWriter::Implementation::SetAttribute(
+  const char* attributeName, size_t numberOfElements, const T* value)
+{
+  return this->SetAttribute(this->GetGroup("/VTKHDF"), attributeName, numberOfElements, value);
+}
+
+//------------------------------------------------------------------------------
+template <typename T>
+bool vtkHDFWriter::Implementation::SetAttribute(
+  hid_t group, const char* attributeName, size_t numberOfElements, const T* value)
+{
+  hid_t space = -1;
+  hid_t attr = -1;
+  bool error = false;
+  try
+  {
+    hsize_t dims = numberOfElements;
+    if ((space = H5Screate_simple(1, &dims, nullptr)) < 0)
+    {
+      throw std::runtime_error(std::string(attributeName) + " attribute: create_simple error");
+    }
+    hid_t hdfType = this->GetNativeType(vtkTypeTraits<T>::VTK_TYPE_ID);
+    if ((attr = H5Acreate(group, attributeName, hdfType, space, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+    {
+      throw std::runtime_error(std::string("Cannot create ") + attributeName + " attribute");
+    }
+    if (H5Awrite(attr, hdfType, value) < 0)
+    {
+      throw std::runtime_error(std::string("Error writing ") + attributeName + " attribute");
+    }
+  }
+  catch (const std::exception& e)
+  {
+    vtkErrorWithObjectMacro(this->Writer, << e.what());
+    error = true;
+  }
+  if (attr >= 0)
+  {
+    error = H5Aclose(attr) < 0 || error;
+  }
+  if (space >= 0)
+  {
+    error = H5Sclose(space) < 0 || error;
+  }
+  return !error;
+}
+
+//------------------------------------------------------------------------------
+bool vtkHDFWriter::Implementation::SetStringAttribute(const char* attributeName, const char* value)
+{
+  hid_t space = -1;
+  hid_t type = -1;
+  hid_t attr = -1;
+  bool error = false;
+  try
+  {
+    if ((space = H5Screate(H5S_SCALAR)) < 0)
+    {
+      throw std::runtime_error(std::string(attributeName) + " attribute: create error");
+    }
+    if ((type = H5Tcopy(H5T_C_S1)) < 0 || H5Tset_size(type, strlen(value)) < 0)
+    {
+      throw std::runtime_error(std::string(attributeName) + " attribute: string type error");
+    }
+    if ((attr = H5Acreate(
+           this->GetGroup("/VTKHDF"), attributeName, type, space, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+    {
+      throw std::runtime_error(std::string("Cannot create ") + attributeName + " attribute");
+    }
+    if (H5Awrite(attr, type, value) < 0)
+    {
+      throw std::runtime_error(std::string("Error writing ") + attributeName + " attribute");
+    }
+  }
+  catch (const std::exception& e)
+  {
+    vtkErrorWithObjectMacro(this->Writer, << e.what());
+    error = true;
+  }
+  if (attr >= 0)
+  {
+    error = H5Aclose(attr) < 0 || error;
+  }
+  if (type >= 0)
+  {
+    error = H5Tclose(type) < 0 || error;
+  }
+  if (space >= 0)
+  {
+    error = H5Sclose(space) < 0 || error;
+  }
+  return !error;
+}
+
+//------------------------------------------------------------------------------
+hid_t vtkHDFWriter::Implementation::CreateDatasetProperties(const std::vector<hsize_t>& chunkDims)
+{
+  hid_t plist = H5Pcreate(H5P_DATASET_CREATE);
+  if (plist < 0)
+  {
+    return -1;
+  }
+  int level = this->Writer->GetCompressionLevel();
+  if (H5Pset_chunk(plist, static_cast<int>(chunkDims.size()), chunkDims.data()) < 0 ||
+    (level > 0 && (H5Pset_shuffle(plist) < 0 || H5Pset_deflate(plist, level) < 0)))
+  {
+    H5Pclose(plist);
+    return -1;
+  }
+  return plist;
+}
+
+//------------------------------------------------------------------------------
+bool vtkHDFWriter::Implementation::WriteHyperslab(hid_t dataset, const std::vector<hsize_t>& dims,
+  const std::vector<hsize_t>& start, const std::vector<hsize_t>& count, hid_t memspace,
+  hid_t memType, const void* data)
+{
+  hid_t filespace = -1;
+  bool error = false;
+  try
+  {
+    if ((filespace = H5Dget_space(dataset)) < 0)
+    {
+      throw std::runtime_error("Error H5Dget_space");
+    }
+    std::vector<hsize_t> currentDims(dims.size());
+    if (H5Sget_simple_extent_ndims(filespace) != static_cast<int>(dims.size()) ||
+      H5Sget_simple_extent_dims(filespace, currentDims.data(), nullptr) < 0)
+    {
+      throw std::runtime_error("Existing dataset does not have the dimensions of the array");
+    }
+    if (!std::equal(currentDims.begin(), currentDims.end(), dims.begin(),
+          [](hsize_t current, hsize_t needed) { return current >= needed; }))
+    {
+      for (size_t i = 0; i < dims.size(); ++i)
+      {
+        currentDims[i] = std::max(currentDims[i], dims[i]);
+      }
+      H5Sclose(filespace);
+      if (H5Dset_extent(dataset, currentDims.data()) < 0 ||
+        (filespace = H5Dget_space(dataset)) < 0)
+      {
+        throw std::runtime_error("Error extending dataset");
+      }
+    }
+    if (std::find(count.begin(), count.end(), 0) == count.end())
+    {
+      if (H5Sselect_hyperslab(
+            filespace, H5S_SELECT_SET, start.data(), nullptr, count.data(), nullptr) < 0)
+      {
+        throw std::runtime_error("Error selecting hyperslab");
+      }
+      if (H5Dwrite(dataset, memType, memspace, filespace, H5P_DEFAULT, data) < 0)
+      {
+        throw std::runtime_error("Error H5Dwrite");
+      }
+    }
+  }
+  catch (const std::exception& e)
+  {
+    vtkErrorWithObjectMacro(this->Writer, << e.what());
+    error = true;
+  }
+  if (filespace >= 0)
+  {
+    error = H5Sclose(filespace) < 0 || error;
+  }
+  return !error;
+}
+
+//------------------------------------------------------------------------------
+bool vtkHDFWriter::Implementation::AppendArray(
+  hid_t group, const char* name, vtkDataArray* array, hid_t fileType)
+{
+  vtkSmartPointer<vtkDataArray> values = ::GetContiguousArray(array);
+  hid_t memType = this->GetNativeType(values->GetDataType());
+  if (memType < 0)
+  {
+    vtkErrorWithObjectMacro(this->Writer,
+      "Cannot write array " << name << " of type " << values->GetDataTypeAsString());
+    return false;
+  }
+  hsize_t numberOfComponents = values->GetNumberOfComponents();
+  hsize_t numberOfTuples = values->GetNumberOfTuples();
+  const int rank = numberOfComponents > 1 ? 2 : 1;
+
+  hid_t dataset = -1;
+  hid_t space = -1;
+  hid_t plist = -1;
+  hid_t memspace = -1;
+  bool error = false;
+  try
+  {
+    if (H5Lexists(group, name, H5P_DEFAULT) > 0)
+    {
+      dataset = H5Dopen(group, name, H5P_DEFAULT);
+    }
+    else
+    {
+      hsize_t dims[2] = { 0, numberOfComponents };
+      hsize_t maxDims[2] = { H5S_UNLIMITED, numberOfComponents };
+      std::vector<hsize_t> chunkDims = { static_cast<hsize_t>(this->Writer->GetChunkSize()) };
+      if (rank == 2)
+      {
+        chunkDims.push_back(numberOfComponents);
+      }
+      if ((space = H5Screate_simple(rank, dims, maxDims)) < 0 ||
+        (plist = this->CreateDatasetProperties(chunkDims)) < 0)
+      {
+        throw std::runtime_error(std::string("Cannot create the space of ") + name);
+      }
+      dataset = H5Dcreate(group, name, fileType >= 0 ? fileType : memType, space, H5P_DEFAULT,
+        plist, H5P_DEFAULT);
+    }
+    if (dataset < 0)
+    {
+      throw std::runtime_error(std::string("Cannot open or create ") + name);
+    }
+    if (numberOfTuples > 0)
+    {
+      hsize_t offset = 0;
+      hid_t filespace = H5Dget_space(dataset);
+      if (filespace < 0 || H5Sget_simple_extent_dims(filespace, &offset, nullptr) < 0)
+      {
+        throw std::runtime_error(std::string("Cannot find dimension for ") + name);
+      }
+      H5Sclose(filespace);
+      std::vector<hsize_t> dims = { offset + numberOfTuples, numberOfComponents };
+      std::vector<hsize_t> start = { offset, 0 };
+      std::vector<hsize_t> count = { numberOfTuples, numberOfComponents };
+      dims.resize(rank);
+      start.resize(rank);
+      count.resize(rank);
+      if ((memspace = H5Screate_simple(rank, count.data(), nullptr)) < 0)
+      {
+        throw std::runtime_error("Error H5Screate_simple for memory space");
+      }
+      if (!this->WriteHyperslab(
+            dataset, dims, start, count, memspace, memType, values->GetVoidPointer(0)))
+      {
+        throw std::runtime_error(std::string("Cannot append to ") + name);
+      }
+    }
+  }
+  catch (const std::exception& e)
+  {
+    vtkErrorWithObjectMacro(this->Writer, << e.what());
+    error = true;
+  }
+  if (memspace >= 0)
+  {
+    error = H5Sclose(memspace) < 0 || error;
+  }
+  if (plist >= 0)
+  {
+    error = H5Pclose(plist) < 0 || error;
+  }
+  if (space >= 0)
+  {
+    error = H5Sclose(space) < 0 || error;
+  }
+  if (dataset >= 0)
+  {
+    error = H5Dclose(dataset) < 0 || error;
+  }
+  return !error;
+}
+
+//------------------------------------------------------------------------------
+bool vtkHDFWriter::Implementation::AppendValue(hid_t group, const char* name, vtkIdType value)
+{
+  vtkNew<vtkTypeInt64Array> array;
+  array->InsertNextValue(value);
+  return this->AppendArray(group, name, array);
+}
+
+//------------------------------------------------------------------------------
+bool vtkHDFWriter::Implementation::AppendCells(hid_t group, vtkCellArray* cells)
+{
+  return this->AppendValue(group, "NumberOfCells", cells->GetNumberOfCells()) &&
+    this->AppendValue(group, "NumberOfConnectivityIds", cells->GetNumberOfConnectivityIds()) &&
+    this->AppendArray(group, "Offsets", cells->GetOffsetsArray(), H5T_NATIVE_LLONG) &&
+    this->AppendArray(group, "Connectivity", cells->GetConnectivityArray(), H5T_NATIVE_LLONG);
+}
+
+//------------------------------------------------------------------------------
+bool vtkHDFWriter::Implementation::AppendAttributes(
+  const std::string& groupPath, vtkDataSetAttributes* attributes)
+{
+  for (int i = 0; i < attributes->GetNumberOfArrays(); ++i)
+  {
+    vtkDataArray* array = attributes->GetArray(i);
+    if (!array || !array->GetName())
+    {
+      continue;
+    }
+    hid_t group = this->GetGroup(groupPath);
+    if (group < 0 || !this->AppendArray(group, array->GetName(), array))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool vtkHDFWriter::Implementation::WriteImageArray(const std::string& groupPath, const char* name,
+  vtkDataArray* array, const int arrayExtent[6], const int extent[6], const int wholeExtent[6],
+  int step)
+{
+  vtkSmartPointer<vtkDataArray> values = ::GetContiguousArray(array);
+  hid_t memType = this->GetNativeType(values->GetDataType());
+  if (memType < 0)
+  {
+    vtkErrorWithObjectMacro(this->Writer,
+      "Cannot write array " << name << " of type " << values->GetDataTypeAsString());
+    return false;
+  }
+  vtkIdType numberOfTuples = 1;
+  for (int i = 0; i < 3; ++i)
+  {
+    numberOfTuples *= arrayExtent[2 * i + 1] - arrayExtent[2 * i] + 1;
+  }
+  if (values->GetNumberOfTuples() != numberOfTuples)
+  {
+    vtkErrorWithObjectMacro(this->Writer, "Array " << name << " has "
+                                                   << values->GetNumberOfTuples()
+                                                   << " tuples instead of " << numberOfTuples);
+    return false;
+  }
+
+  // file dimensions: [step], z, y, x, [components] as vtkHDFReader expects.
+  int ndims = ::GetNDims(wholeExtent);
+  hsize_t numberOfComponents = values->GetNumberOfComponents();
+  std::vector<hsize_t> dims, maxDims, chunkDims, fileStart, memDims, memStart, count;
+  if (step >= 0)
+  {
+    dims.push_back(step + 1);
+    maxDims.push_back(H5S_UNLIMITED);
+    chunkDims.push_back(1);
+    fileStart.push_back(step);
+    count.push_back(1);
+    memDims.push_back(1);
+    memStart.push_back(0);
+  }
+  hsize_t chunkSize = this->Writer->GetChunkSize();
+  hsize_t rowSize = 1;
+  std::vector<hsize_t> axisChunks(ndims);
+  for (int i = 0; i < ndims; ++i)
+  {
+    // chunks hold whole rows, and as many of them as fit ChunkSize.
+    hsize_t size = wholeExtent[2 * i + 1] - wholeExtent[2 * i] + 1;
+    axisChunks[i] = i == 0 ? size : std::max<hsize_t>(1, std::min(size, chunkSize / rowSize));
+    rowSize *= axisChunks[i];
+  }
+  for (int i = ndims - 1; i >= 0; --i)
+  {
+    hsize_t size = wholeExtent[2 * i + 1] - wholeExtent[2 * i] + 1;
+    dims.push_back(size);
+    maxDims.push_back(size);
+    chunkDims.push_back(axisChunks[i]);
+    fileStart.push_back(extent[2 * i] - wholeExtent[2 * i]);
+    count.push_back(extent[2 * i + 1] - extent[2 * i] + 1);
+    memDims.push_back(arrayExtent[2 * i + 1] - arrayExtent[2 * i] + 1);
+    memStart.push_back(extent[2 * i] - arrayExtent[2 * i]);
+  }
+  if (numberOfComponents > 1)
+  {
+    dims.push_back(numberOfComponents);
+    maxDims.push_back(numberOfComponents);
+    chunkDims.push_back(numberOfComponents);
+    fileStart.push_back(0);
+    count.push_back(numberOfComponents);
+    memDims.push_back(numberOfComponents);
+    memStart.push_back(0);
+  }
+  const int rank = static_cast<int>(dims.size());
+
+  hid_t group = this->GetGroup(groupPath);
+  hid_t dataset = -1;
+  hid_t space = -1;
+  hid_t plist = -1;
+  hid_t memspace = -1;
+  bool error = false;
+  try
+  {
+    if (group < 0)
+    {
+      throw std::runtime_error("Cannot create group " + groupPath);
+    }
+    if (H5Lexists(group, name, H5P_DEFAULT) > 0)
+    {
+      dataset = H5Dopen(group, name, H5P_DEFAULT);
+    }
+    else
+    {
+      if ((space = H5Screate_simple(rank, dims.data(), maxDims.data())) < 0 ||
+        (plist = this->CreateDatasetProperties(chunkDims)) < 0)
+      {
+        throw std::runtime_error(std::string("Cannot create the space of ") + name);
+      }
+      dataset = H5Dcreate(group, name, memType, space, H5P_DEFAULT, plist, H5P_DEFAULT);
+    }
+    if (dataset < 0)
+    {
+      throw std::runtime_error(std::string("Cannot open or create ") + name);
+    }
+    // select the tuples of 'extent' in the tuples of 'arrayExtent'.
+    if ((memspace = H5Screate_simple(rank, memDims.data(), nullptr)) < 0 ||
+      H5Sselect_hyperslab(
+        memspace, H5S_SELECT_SET, memStart.data(), nullptr, count.data(), nullptr) < 0)
+    {
+      throw std::runtime_error("Error selecting the memory space");
+    }
+    if (!this->WriteHyperslab(
+          dataset, dims, fileStart, count, memspace, memType, values->GetVoidPointer(0)))
+    {
+      throw std::runtime_error(std::string("Cannot write ") + name);
+    }
+  }
+  catch (const std::exception& e)
+  {
+    vtkErrorWithObjectMacro(this->Writer, << e.what());
+    error = true;
+  }
+  if (memspace >= 0)
+  {
+    error = H5Sclose(memspace) < 0 || error;
+  }
+  if (plist >= 0)
+  {
+    error = H5Pclose(plist) < 0 || error;
+  }
+  if (space >= 0)
+  {
+    error = H5Sclose(space) < 0 || error;
+  }
+  if (dataset >= 0)
+  {
+    error = H5Dclose(dataset) < 0 || error;
+  }
+  return !error;
+}
+
+//------------------------------------------------------------------------------
+bool vtkHDFWriter::Implementation::WriteStringArray(
+  hid_t group, const char* name, vtkStringArray* array)
+{
+  std::vector<const char*> values(array->GetNumberOfValues());
+  for (vtkIdType i = 0; i < array->GetNumberOfValues(); ++i)
+  {
+    values[i] = array->GetValue(i).c_str();
+  }
+  hid_t type = -1;
+  hid_t space = -1;
+  hid_t dataset = -1;
+  bool error = false;
+  try
+  {
+    hsize_t dims = values.size();
+    if ((type = H5Tcopy(H5T_C_S1)) < 0 || H5Tset_size(type, H5T_VARIABLE) < 0)
+    {
+      throw std::runtime_error("Error H5Tset_size");
+    }
+    if ((space = H5Screate_simple(1, &dims, nullptr)) < 0)
+    {
+      throw std::runtime_error(std::string("Cannot create the space of ") + name);
+    }
+    if ((dataset = H5Dcreate(group, name, type, space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+    {
+      throw std::runtime_error(std::string("Cannot create ") + name);
+    }
+    if (!values.empty() &&
+      H5Dwrite(dataset, type, H5S_ALL, H5S_ALL, H5P_DEFAULT, values.data()) < 0)
+    {
+      throw std::runtime_error(std::string("Cannot write ") + name);
+    }
+  }
+  catch (const std::exception& e)
+  {
+    vtkErrorWithObjectMacro(this->Writer, << e.what());
+    error = true;
+  }
+  if (dataset >= 0)
+  {
+    error = H5Dclose(dataset) < 0 || error;
+  }
+  if (space >= 0)
+  {
+    error = H5Sclose(space) < 0 || error;
+  }
+  if (type >= 0)
+  {
+    error = H5Tclose(type) < 0 || error;
+  }
+  return !error;
+}
+
+//------------------------------------------------------------------------------
+bool vtkHDFWriter::Implementation::WriteFieldData(vtkFieldData* fieldData)
+{
+  for (int i = 0; i < fieldData->GetNumberOfArrays(); ++i)
+  {
+    vtkAbstractArray* array = fieldData->GetAbstractArray(i);
+    if (!array || !array->GetName())
+    {
+      continue;
+    }
+    vtkDataArray* dataArray = vtkDataArray::SafeDownCast(array);
+    vtkStringArray* stringArray = vtkStringArray::SafeDownCast(array);
+    if (!dataArray && !stringArray)
+    {
+      continue;
+    }
+    hid_t group = this->GetGroup("/VTKHDF/FieldData");
+    if (group < 0 ||
+      !(dataArray ? this->AppendArray(group, array->GetName(), dataArray)
+                  : this->WriteStringArray(group, array->GetName(), stringArray)))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+// explicit template instantiation
+template bool vtkHDFWriter::Implementation::SetAttribute<int>(
+  const char* attributeName, size_t numberOfElements, const int* value);
+template bool vtkHDFWriter::Implementation::SetAttribute<double>(
+  const char* attributeName, size_t numberOfElements, const double* value);
+template bool vtkHDFWriter::Implementation::SetAttribute<int>(
+  hid_t group, const char* attributeName, size_t numberOfElements, const int* value);
+template bool vtkHDFWriter::Implementation::SetAttribute<double>(
+  hid_t group, const char* attributeName, size_t numberOfElements, const double* value);
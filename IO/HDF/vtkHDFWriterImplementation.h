@@ -0,0 +1,158 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkHDFWriterImplementation.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkHDFWriterImplementation
+ * @brief   Implementation class for vtkHDFWriter
+ *
+ */
+
+#ifndef vtkHDFWriterImplementation_h
+#define vtkHDFWriterImplementation_h
+
+#include "vtkHDFWriter.h"
+#include "vtk_hdf5.h"
+#include <map>
+#include <string>
+#include <vector>
+
+class vtkCellArray;
+class vtkDataArray;
+class vtkDataSetAttributes;
+class vtkFieldData;
+class vtkStringArray;
+
+/**
+ * Implementation for the vtkHDFWriter. Creates, closes and
+ * writes the groups, attributes and datasets of a VTK HDF file.
+ */
+class vtkHDFWriter::Implementation
+{
+public:
+  Implementation(vtkHDFWriter* writer);
+  virtual ~Implementation();
+  /**
+   * Creates the VTK HDF file, overwriting any existing file, and its
+   * /VTKHDF group.
+   */
+  bool Create(const char* fileName);
+  /**
+   * Closes the VTK HDF file and releases any allocated resources.
+   */
+  bool Close();
+  /**
+   * Returns true if a file is created and not closed yet.
+   */
+  bool IsOpen() { return this->File >= 0; }
+  /**
+   * Returns the group with the given path, created if it does not exist
+   * yet. The group is closed with the file.
+   */
+  hid_t GetGroup(const std::string& path);
+
+  //@{
+  /**
+   * Writes an attribute of the /VTKHDF group, or of the given group.
+   */
+  template <typename T>
+  bool SetAttribute(const char* attributeName, size_t numberOfElements, const T* value);
+  template <typename T>
+  bool SetAttribute(
+    hid_t group, const char* attributeName, size_t numberOfElements, const T* value);
+  bool SetStringAttribute(const char* attributeName, const char* value);
+  //@}
+
+  /**
+   * Appends the tuples of 'array' to the dataset 'name' of 'group', which
+   * is created the first time with an unlimited first dimension, and as
+   * many columns as the array has components when more than one. The values
+   * are converted to 'fileType' if given, otherwise the dataset has the
+   * type of the array.
+   */
+  bool AppendArray(hid_t group, const char* name, vtkDataArray* array, hid_t fileType = -1);
+  /**
+   * Appends a value to the 1D dataset 'name' of 'group', see AppendArray.
+   */
+  bool AppendValue(hid_t group, const char* name, vtkIdType value);
+  /**
+   * Appends the offsets and connectivity of 'cells', and their sizes, to
+   * 'group' where they are stored as 64 bit integers.
+   */
+  bool AppendCells(hid_t group, vtkCellArray* cells);
+  /**
+   * Appends the arrays of 'attributes' to the datasets of the same name in
+   * the group 'groupPath'. Unnamed arrays and arrays which are not
+   * vtkDataArray are skipped.
+   */
+  bool AppendAttributes(const std::string& groupPath, vtkDataSetAttributes* attributes);
+
+  /**
+   * Writes the tuples of 'array', which covers 'arrayExtent', that are in
+   * 'extent' into the hyperslab of the same extent of the dataset 'name'
+   * of the group 'groupPath', which covers 'wholeExtent'. The extents are
+   * point extents for point arrays and cell extents for cell arrays. If
+   * 'step' is not negative, the dataset has a first unlimited dimension for
+   * the time steps and the tuples are written at index 'step'. The dataset
+   * is created by the first write.
+   */
+  bool WriteImageArray(const std::string& groupPath, const char* name, vtkDataArray* array,
+    const int arrayExtent[6], const int extent[6], const int wholeExtent[6], int step);
+
+  /**
+   * Writes the arrays of 'fieldData' in the FieldData group. String arrays
+   * are written as variable length strings.
+   */
+  bool WriteFieldData(vtkFieldData* fieldData);
+
+  /**
+   * Returns the HDF native type of the values of VTK type 'dataType', or
+   * -1 if there is none.
+   */
+  static hid_t GetNativeType(int dataType);
+
+protected:
+  /**
+   * Creates the property list of a chunked dataset with the given chunk
+   * dimensions, compressed as the writer requests.
+   */
+  hid_t CreateDatasetProperties(const std::vector<hsize_t>& chunkDims);
+  /**
+   * Writes 'data' in the hyperslab 'start', 'count' of 'dataset', after
+   * extending the dataset to 'dims' if it is smaller. 'memspace' selects
+   * the values written from 'data'.
+   */
+  bool WriteHyperslab(hid_t dataset, const std::vector<hsize_t>& dims,
+    const std::vector<hsize_t>& start, const std::vector<hsize_t>& count, hid_t memspace,
+    hid_t memType, const void* data);
+  bool WriteStringArray(hid_t group, const char* name, vtkStringArray* array);
+
+private:
+  hid_t File;
+  std::map<std::string, hid_t> Groups;
+  vtkHDFWriter* Writer;
+};
+
+//------------------------------------------------------------------------------
+// explicit template instantiation declaration
+extern template bool vtkHDFWriter::Implementation::SetAttribute<int>(
+  const char* attributeName, size_t numberOfElements, const int* value);
+extern template bool vtkHDFWriter::Implementation::SetAttribute<double>(
+  const char* attributeName, size_t numberOfElements, const double* value);
+extern template bool vtkHDFWriter::Implementation::SetAttribute<int>(
+  hid_t group, const char* attributeName, size_t numberOfElements, const int* value);
+extern template bool vtkHDFWriter::Implementation::SetAttribute<double>(
+  hid_t group, const char* attributeName, size_t numberOfElements, const double* value);
+
+#endif
+// VTK-HeaderTest-Exclude: vtkHDFWriterImplementation.h
@@ -0,0 +1,191 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestDelimitedTextReaderChunks.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+
+// Checks that text parsed in chunks by vtkDelimitedTextReader gives the same
+// table as the text decoded with the UTF-8 character set, and that text that
+// is not UTF-8 is still decoded by the text codecs.
+
+#include <vtkDelimitedTextReader.h>
+#include <vtkDoubleArray.h>
+#include <vtkIntArray.h>
+#include <vtkNew.h>
+#include <vtkStringArray.h>
+#include <vtkStringToNumeric.h>
+#include <vtkTable.h>
+#include <vtkTestUtilities.h>
+#include <vtkVariant.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+namespace
+{
+// Several windows of text, with strings, escape sequences, non ASCII characters
+// and rows with fewer or more values than the headers
+std::string MakeText()
+{
+  std::ostringstream text;
+  text << "index,value,\"name, quoted\",integer,mixed\n";
+  for (int i = 0; i < 60000; ++i)
+  {
+    text << i << ',' << i * 0.25;
+    if (i % 97 == 0)
+    {
+      text << "\n";
+      continue;
+    }
+    text << ",\"caf\xc3\xa9 " << i << ", here\"," << -i;
+    text << ',' << (i % 1000 == 999 ? "n/a" : " 12 ");
+    if (i % 501 == 0)
+    {
+      text << ",extra\\tvalue,\\";
+    }
+    text << (i % 3 ? "\n" : "\r\n");
+  }
+  text << "60000,2.5e4";
+  return text.str();
+}
+
+bool HaveSameValues(vtkAbstractArray* array1, vtkAbstractArray* array2)
+{
+  vtkDataArray* dataArray1 = vtkDataArray::SafeDownCast(array1);
+  vtkDataArray* dataArray2 = vtkDataArray::SafeDownCast(array2);
+  if ((dataArray1 == nullptr) != (dataArray2 == nullptr) ||
+    (dataArray1 && strcmp(dataArray1->GetClassName(), dataArray2->GetClassName()) != 0) ||
+    strcmp(array1->GetName(), array2->GetName()) != 0 ||
+    array1->GetNumberOfValues() != array2->GetNumberOfValues())
+  {
+    return false;
+  }
+  for (vtkIdType i = 0; i < array1->GetNumberOfValues(); ++i)
+  {
+    if (dataArray1 ? dataArray1->GetComponent(i, 0) != dataArray2->GetComponent(i, 0)
+                   : array1->GetVariantValue(i).ToString() != array2->GetVariantValue(i).ToString())
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool TestText(const std::string& text, bool haveHeaders, bool detectNumericColumns)
+{
+  vtkNew<vtkDelimitedTextReader> reader;
+  reader->SetReadFromInputString(true);
+  reader->SetInputString(text);
+  reader->SetHaveHeaders(haveHeaders);
+  reader->SetDetectNumericColumns(detectNumericColumns);
+  reader->SetTrimWhitespacePriorToNumericConversion(true);
+  reader->Update();
+  vtkTable* table = reader->GetOutput();
+
+  vtkNew<vtkDelimitedTextReader> unicodeReader;
+  unicodeReader->SetReadFromInputString(true);
+  unicodeReader->SetInputString(text);
+  unicodeReader->SetHaveHeaders(haveHeaders);
+  unicodeReader->SetUnicodeCharacterSet("UTF-8");
+  unicodeReader->SetUTF8FieldDelimiters(",");
+  unicodeReader->SetUTF8StringDelimiters("\"");
+  vtkNew<vtkStringToNumeric> numeric;
+  numeric->SetInputConnection(unicodeReader->GetOutputPort());
+  numeric->SetTrimWhitespacePriorToNumericConversion(true);
+  numeric->Update();
+  vtkTable* expectedTable = detectNumericColumns ? vtkTable::SafeDownCast(numeric->GetOutput())
+                                                 : unicodeReader->GetOutput();
+
+  if (table->GetNumberOfColumns() != expectedTable->GetNumberOfColumns() ||
+    table->GetNumberOfRows() != expectedTable->GetNumberOfRows())
+  {
+    cerr << "ERROR: Wrong number of columns or rows: " << table->GetNumberOfColumns() << " x "
+         << table->GetNumberOfRows() << endl;
+    return false;
+  }
+  for (vtkIdType i = 0; i < table->GetNumberOfColumns(); ++i)
+  {
+    if (!HaveSameValues(table->GetColumn(i), expectedTable->GetColumn(i)))
+    {
+      cerr << "ERROR: Wrong values in column " << i << endl;
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+int TestDelimitedTextReaderChunks(int argc, char* argv[])
+{
+  const std::string text = MakeText();
+  if (!TestText(text, true, true) || !TestText(text, true, false) ||
+    !TestText(text, false, true))
+  {
+    return EXIT_FAILURE;
+  }
+
+  vtkNew<vtkDelimitedTextReader> reader;
+  reader->SetReadFromInputString(true);
+  reader->SetInputString(text);
+  reader->SetHaveHeaders(true);
+  reader->SetDetectNumericColumns(true);
+  reader->Update();
+  vtkTable* table = reader->GetOutput();
+  if (table->GetNumberOfRows() != 60001 || !vtkArrayDownCast<vtkIntArray>(table->GetColumn(0)) ||
+    !vtkArrayDownCast<vtkDoubleArray>(table->GetColumn(1)) ||
+    !vtkArrayDownCast<vtkStringArray>(table->GetColumn(4)) ||
+    table->GetValue(3, 2).ToString() != "caf\xc3\xa9 3, here" ||
+    table->GetValue(97, 3).ToInt() != 0)
+  {
+    cerr << "ERROR: Wrong columns" << endl;
+    return EXIT_FAILURE;
+  }
+
+  // Invalid UTF-8 text gives an empty table, like when it is decoded
+  reader->SetInputString(text + "\xff\n");
+  reader->Update();
+  if (reader->GetOutput()->GetNumberOfColumns() != 0)
+  {
+    cerr << "ERROR: Invalid text was read" << endl;
+    return EXIT_FAILURE;
+  }
+
+  // UTF-16 text with a byte order mark
+  char* tempDir =
+    vtkTestUtilities::GetArgOrEnvOrDefault("-T", argc, argv, "VTK_TEMP_DIR", "Testing/Temporary");
+  const std::string fileName = std::string(tempDir) + "/TestDelimitedTextReaderChunks.csv";
+  delete[] tempDir;
+  {
+    std::ofstream file(fileName.c_str(), ios::binary);
+    file << "\xff\xfe";
+    for (char c : std::string("index,name\n1,caf\xe9\n2,b\n"))
+    {
+      file.put(c);
+      file.put('\0');
+    }
+  }
+  reader->SetReadFromInputString(false);
+  reader->SetFileName(fileName.c_str());
+  reader->Update();
+  table = reader->GetOutput();
+  if (table->GetNumberOfColumns() != 2 || table->GetNumberOfRows() != 2 ||
+    table->GetValue(1, 0).ToInt() != 2 || table->GetValue(0, 1).ToString() != "caf\xc3\xa9")
+  {
+    cerr << "ERROR: Wrong UTF-16 table: " << table->GetNumberOfColumns() << " x "
+         << table->GetNumberOfRows() << endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
@@ -21,22 +21,29 @@
 #include "vtkDelimitedTextReader.h"
 #include "vtkCommand.h"
 #include "vtkDataSetAttributes.h"
+#include "vtkDoubleArray.h"
 #include "vtkIdTypeArray.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
+#include "vtkIntArray.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkStringArray.h"
 #include "vtkStringToNumeric.h"
 #include "vtkTable.h"
 #include "vtkUnicodeStringArray.h"
+#include "vtkVariant.h"
 
 #include "vtkTextCodec.h"
 #include "vtkTextCodecFactory.h"
+#include "vtk_utf8.h"
 #include "vtksys/FStream.hxx"
 
 #include <algorithm>
+#include <atomic>
 #include <iostream>
 #include <iterator>
 #include <set>
@@ -46,6 +53,10 @@
 #include <vector>
 
 #include <cctype>
+#include <cerrno>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
 
 ////////////////////////////////////////////////////////////////////////////////
 // DelimitedTextIterator
@@ -93,13 +104,14 @@ public:
 
   ~DelimitedTextIterator() override
   {
-    // Ensure that all table columns have the same length ...
+    // Ensure that all table columns have the same length, the values missing at the end of
+    // the shorter ones being empty (Resize() would only allocate them) ...
     for (vtkIdType i = 0; i != this->OutputTable->GetNumberOfColumns(); ++i)
     {
       if (this->OutputTable->GetColumn(i)->GetNumberOfTuples() !=
         this->OutputTable->GetColumn(0)->GetNumberOfTuples())
       {
-        this->OutputTable->GetColumn(i)->Resize(
+        this->OutputTable->GetColumn(i)->SetNumberOfTuples(
           this->OutputTable->GetColumn(0)->GetNumberOfTuples());
       }
     }
@@ -341,6 +353,690 @@ private:
 
 } // End anonymous namespace
 
+////////////////////////////////////////////////////////////////////////////////
+// DelimitedTextParser
+
+/// Parses ASCII or UTF-8 text whose delimiters are ASCII characters directly from its
+/// bytes into the columns of a vtkTable, producing the same table as DelimitedTextIterator
+/// followed, when numeric columns are detected, by vtkStringToNumeric.
+///
+/// The text is read in windows that are split in chunks ending after a record delimiter,
+/// and the chunks are tokenized concurrently. Since a record delimiter ends a record even
+/// within a string, the only state a chunk inherits from the previous one is a pending
+/// escape character; the rare chunks that follow one are tokenized again. The fields of a
+/// chunk are stored together in a single string, from which numeric columns are converted
+/// without creating a vtkStringArray.
+
+namespace
+{
+
+// Sizes of the windows of text read at once, and of the chunks tokenized concurrently
+const size_t MinimumWindowSize = 1 << 20;
+const size_t MaximumWindowSize = 1 << 26;
+const size_t ChunkSize = 1 << 20;
+
+class DelimitedTextParser
+{
+public:
+  enum CharacterClass
+  {
+    RecordDelimiter = 1,
+    FieldDelimiter = 2,
+    StringDelimiter = 4,
+    Whitespace = 8,
+    EscapeCharacter = 16
+  };
+
+  DelimitedTextParser(vtkAlgorithm* reader, vtkIdType max_records, bool have_headers,
+    bool merge_cons_delimiters, bool detect_numeric_columns, bool force_double,
+    int default_integer_value, double default_double_value, bool trim_whitespace)
+    : Reader(reader)
+    , MaxRecords(max_records)
+    , HaveHeaders(have_headers)
+    , MergeConsDelims(merge_cons_delimiters)
+    , DetectNumericColumns(detect_numeric_columns)
+    , ForceDouble(force_double)
+    , DefaultIntegerValue(default_integer_value)
+    , DefaultDoubleValue(default_double_value)
+    , TrimWhitespace(trim_whitespace)
+  {
+    std::fill(this->Classes, this->Classes + 256, 0);
+  }
+
+  // Adds the UTF-8 'characters' to 'character_class'. Returns false if one of them is not
+  // an ASCII character, which this parser does not handle.
+  bool AddCharacters(const char* characters, unsigned char character_class)
+  {
+    for (const char* c = characters; *c; ++c)
+    {
+      const unsigned char byte = static_cast<unsigned char>(*c);
+      if (byte > 0x7f)
+      {
+        return false;
+      }
+      this->Classes[byte] |= character_class;
+    }
+    return true;
+  }
+
+  // Reads the text of 'input_stream' into 'output_table'. Returns false, leaving
+  // 'output_table' untouched, if the text is not valid UTF-8.
+  bool Parse(istream& input_stream, vtkTable* const output_table)
+  {
+    input_stream.seekg(0, ios::end);
+    const double total_bytes = static_cast<double>(input_stream.tellg());
+    input_stream.seekg(0, ios::beg);
+
+    // The records of the headers count, like in DelimitedTextIterator
+    const vtkIdType max_records =
+      this->MaxRecords && this->HaveHeaders ? this->MaxRecords + 1 : this->MaxRecords;
+    std::vector<char> text;
+    size_t window_size = MinimumWindowSize;
+    double read_bytes = 0;
+    bool escape = false;
+    bool end_of_input = false;
+    vtkIdType record_count = 0;
+    while (!end_of_input && !(max_records && record_count >= max_records))
+    {
+      // Append the next window of text to the partial record of the previous one
+      const size_t carried_bytes = text.size();
+      text.resize(carried_bytes + window_size);
+      input_stream.read(text.data() + carried_bytes, window_size);
+      const size_t window_bytes = static_cast<size_t>(input_stream.gcount());
+      text.resize(carried_bytes + window_bytes);
+      end_of_input = window_bytes < window_size;
+      read_bytes += window_bytes;
+      window_size = std::min(2 * window_size, MaximumWindowSize);
+
+      size_t split = text.size();
+      if (!end_of_input)
+      {
+        while (split != 0 && !(this->Classes[static_cast<unsigned char>(text[split - 1])] &
+                               RecordDelimiter))
+        {
+          --split;
+        }
+        if (split == 0)
+        {
+          // Keep reading until the window holds a complete record
+          continue;
+        }
+      }
+
+      std::vector<Chunk> chunks;
+      const char* const window_end = text.data() + split;
+      for (const char* begin = text.data(); begin != window_end;)
+      {
+        const char* end =
+          begin + std::min(ChunkSize, static_cast<size_t>(window_end - begin));
+        while (end != window_end &&
+          !(this->Classes[static_cast<unsigned char>(end[-1])] & RecordDelimiter))
+        {
+          ++end;
+        }
+        chunks.emplace_back();
+        chunks.back().Begin = begin;
+        chunks.back().End = end;
+        begin = end;
+      }
+      const vtkIdType chunk_count = static_cast<vtkIdType>(chunks.size());
+      vtkSMPTools::For(0, chunk_count, [&](vtkIdType begin, vtkIdType end) {
+        for (vtkIdType i = begin; i < end; ++i)
+        {
+          this->Tokenize(chunks[i], false, end_of_input && i == chunk_count - 1);
+        }
+      });
+      for (vtkIdType i = 0; i < chunk_count; ++i)
+      {
+        if (escape)
+        {
+          this->Tokenize(chunks[i], true, end_of_input && i == chunk_count - 1);
+        }
+        if (!chunks[i].Valid)
+        {
+          return false;
+        }
+        escape = chunks[i].EscapeAtEnd;
+        record_count += static_cast<vtkIdType>(chunks[i].Records.size() - 1);
+        this->Chunks.push_back(std::move(chunks[i]));
+      }
+      text.erase(text.begin(), text.begin() + split);
+
+      if (total_bytes > 0)
+      {
+        this->Reader->UpdateProgress(0.5 * std::min(read_bytes / total_bytes, 1.0));
+      }
+    }
+
+    if (!end_of_input && !ValidateRemainder(input_stream, text, window_size))
+    {
+      return false;
+    }
+
+    // Like DelimitedTextIterator, ignore the records past the maximum number
+    this->FirstRecords.assign(1, 0);
+    for (size_t i = 0; i < this->Chunks.size(); ++i)
+    {
+      std::vector<size_t>& records = this->Chunks[i].Records;
+      const vtkIdType first_record = this->FirstRecords.back();
+      if (max_records && first_record + static_cast<vtkIdType>(records.size() - 1) > max_records)
+      {
+        records.resize(max_records - first_record + 1);
+        this->Chunks.resize(i + 1);
+      }
+      this->FirstRecords.push_back(first_record + static_cast<vtkIdType>(records.size() - 1));
+    }
+
+    this->InsertColumns(output_table);
+    this->Reader->UpdateProgress(1.0);
+    return true;
+  }
+
+private:
+  struct Chunk
+  {
+    // Text of the chunk, only valid while its window is tokenized
+    const char* Begin = nullptr;
+    const char* End = nullptr;
+    bool Valid = true;
+    bool EscapeAtEnd = false;
+    // Values of the fields, each one followed by a null character
+    std::string Values;
+    // Start of each field in Values, followed by the end of the last one
+    std::vector<size_t> Fields;
+    // First field of each record, followed by the number of fields
+    std::vector<size_t> Records;
+  };
+
+  // Checks that the text is valid UTF-8. Like vtkUTF8TextCodec, a sequence truncated by the
+  // end of the input is ignored.
+  static bool Validate(const char* begin, const char*& end, bool end_of_input)
+  {
+    const char* invalid = utf8::find_invalid(begin, end);
+    if (invalid == end)
+    {
+      return true;
+    }
+    const auto length = utf8::internal::sequence_length(invalid);
+    if (end_of_input && length > 0 && end - invalid < length)
+    {
+      end = invalid;
+      return true;
+    }
+    return false;
+  }
+
+  // Checks that the text past the maximum number of records is valid UTF-8 too, as
+  // vtkTextCodecFactory reads all the text to find a codec for it.
+  static bool ValidateRemainder(istream& input_stream, std::vector<char>& text, size_t window_size)
+  {
+    for (bool end_of_input = false; !end_of_input;)
+    {
+      const size_t carried_bytes = text.size();
+      text.resize(carried_bytes + window_size);
+      input_stream.read(text.data() + carried_bytes, window_size);
+      const size_t window_bytes = static_cast<size_t>(input_stream.gcount());
+      text.resize(carried_bytes + window_bytes);
+      end_of_input = window_bytes < window_size;
+
+      // Keep a sequence truncated by the end of the window for the next one
+      const char* end = text.data() + text.size();
+      if (!Validate(text.data(), end, true))
+      {
+        return false;
+      }
+      text.erase(text.begin(), text.begin() + (end - text.data()));
+    }
+    return true;
+  }
+
+  // Same state machine as DelimitedTextIterator, for bytes instead of code points.
+  void Tokenize(Chunk& chunk, bool escape, bool end_of_input) const
+  {
+    const char* end = chunk.End;
+    chunk.Valid = Validate(chunk.Begin, end, end_of_input);
+    if (!chunk.Valid)
+    {
+      return;
+    }
+
+    std::string& values = chunk.Values;
+    values.clear();
+    values.reserve(end - chunk.Begin);
+    chunk.Fields.assign(1, 0);
+    chunk.Records.assign(1, 0);
+    size_t field_start = 0;
+    auto insert_field = [&]() {
+      values.push_back('\0');
+      field_start = values.size();
+      chunk.Fields.push_back(field_start);
+    };
+
+    bool record_adjacent = true;
+    char within_string = 0;
+    for (const char* c = chunk.Begin; c != end; ++c)
+    {
+      const unsigned char character_class = this->Classes[static_cast<unsigned char>(*c)];
+      // Strip adjacent record delimiters and whitespace...
+      if (record_adjacent && (character_class & (RecordDelimiter | Whitespace)))
+      {
+        continue;
+      }
+      record_adjacent = false;
+
+      if (character_class & RecordDelimiter)
+      {
+        insert_field();
+        chunk.Records.push_back(chunk.Fields.size() - 1);
+        record_adjacent = true;
+        within_string = 0;
+      }
+      else if (!within_string && (character_class & FieldDelimiter))
+      {
+        if (!(values.size() == field_start && this->MergeConsDelims))
+        {
+          insert_field();
+        }
+      }
+      else if (!escape && (character_class & EscapeCharacter))
+      {
+        escape = true;
+      }
+      else if (escape)
+      {
+        switch (*c)
+        {
+          case '0':
+            break;
+          case 'a':
+            values.push_back('\a');
+            break;
+          case 'b':
+            values.push_back('\b');
+            break;
+          case 't':
+            values.push_back('\t');
+            break;
+          case 'n':
+            values.push_back('\n');
+            break;
+          case 'v':
+            values.push_back('\v');
+            break;
+          case 'f':
+            values.push_back('\f');
+            break;
+          case 'r':
+            values.push_back('\r');
+            break;
+          default:
+            values.push_back(*c);
+        }
+        escape = false;
+      }
+      else if (!within_string && (character_class & StringDelimiter))
+      {
+        within_string = *c;
+        values.resize(field_start);
+      }
+      else if (within_string && within_string == *c)
+      {
+        within_string = 0;
+      }
+      else
+      {
+        values.push_back(*c);
+      }
+    }
+
+    if (end_of_input)
+    {
+      // Like DelimitedTextIterator::ReachedEndOfInput
+      if (values.size() != field_start &&
+        !(this->Classes[static_cast<unsigned char>(values.back())] &
+          (RecordDelimiter | Whitespace)))
+      {
+        insert_field();
+      }
+      if (chunk.Fields.size() - 1 != chunk.Records.back())
+      {
+        chunk.Records.push_back(chunk.Fields.size() - 1);
+      }
+    }
+    values.resize(field_start);
+    chunk.EscapeAtEnd = escape;
+  }
+
+  // Calls functor(row, begin, end) with the value of 'field' in the rows lower than
+  // 'value_count', concurrently for the chunks and until it returns false for a chunk. The
+  // value is empty for the rows that have fewer fields.
+  template <typename Functor>
+  void ForEachValue(size_t field, vtkIdType value_count, Functor functor) const
+  {
+    static const char empty_value[] = "";
+    const vtkIdType header_count = this->HaveHeaders ? 1 : 0;
+    vtkSMPTools::For(0, static_cast<vtkIdType>(this->Chunks.size()),
+      [&](vtkIdType begin, vtkIdType end) {
+        for (vtkIdType i = begin; i < end; ++i)
+        {
+          const Chunk& chunk = this->Chunks[i];
+          const vtkIdType first_row = this->FirstRecords[i] - header_count;
+          for (size_t record = 0; record + 1 < chunk.Records.size(); ++record)
+          {
+            const vtkIdType row = first_row + static_cast<vtkIdType>(record);
+            if (row < 0)
+            {
+              continue;
+            }
+            if (row >= value_count)
+            {
+              return;
+            }
+            const size_t field_index = chunk.Records[record] + field;
+            bool next_value;
+            if (field_index < chunk.Records[record + 1])
+            {
+              const char* const values = chunk.Values.data();
+              next_value = functor(row, values + chunk.Fields[field_index],
+                values + chunk.Fields[field_index + 1] - 1);
+            }
+            else
+            {
+              next_value = functor(row, empty_value, empty_value);
+            }
+            if (!next_value)
+            {
+              break;
+            }
+          }
+        }
+      });
+  }
+
+  // Locates the first record, from which the columns are created.
+  bool GetFirstRecord(const Chunk*& chunk) const
+  {
+    for (const Chunk& c : this->Chunks)
+    {
+      if (c.Records.size() > 1)
+      {
+        chunk = &c;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void InsertColumns(vtkTable* const output_table) const
+  {
+    const Chunk* first_chunk = nullptr;
+    if (!this->GetFirstRecord(first_chunk))
+    {
+      return;
+    }
+
+    // Create the columns like DelimitedTextIterator::InsertField, so that headers with the
+    // same name replace each other
+    const size_t first_field_count = first_chunk->Records[1];
+    for (size_t field = 0; field < first_field_count; ++field)
+    {
+      if (static_cast<vtkIdType>(field) >= output_table->GetNumberOfColumns())
+      {
+        vtkNew<vtkStringArray> array;
+        if (this->HaveHeaders)
+        {
+          array->SetName(first_chunk->Values.data() + first_chunk->Fields[field]);
+        }
+        else
+        {
+          std::stringstream buffer;
+          buffer << "Field " << field;
+          array->SetName(buffer.str().c_str());
+        }
+        output_table->AddColumn(array);
+      }
+    }
+
+    // Each record after the headers is a row, its missing values being empty
+    const vtkIdType row_count = this->FirstRecords.back() - (this->HaveHeaders ? 1 : 0);
+    const size_t column_count = static_cast<size_t>(output_table->GetNumberOfColumns());
+    for (size_t field = 0; field < column_count; ++field)
+    {
+      vtkSmartPointer<vtkAbstractArray> column;
+      if (this->DetectNumericColumns)
+      {
+        column = this->NewNumericColumn(field, row_count);
+      }
+      if (!column)
+      {
+        column = this->NewStringColumn(field, row_count);
+      }
+      // Replaces the column with the same name, whatever the number of rows of the others
+      column->SetName(output_table->GetColumnName(static_cast<vtkIdType>(field)));
+      output_table->GetRowData()->AddArray(column);
+    }
+  }
+
+  vtkSmartPointer<vtkAbstractArray> NewStringColumn(size_t field, vtkIdType value_count) const
+  {
+    vtkNew<vtkStringArray> strings;
+    strings->SetNumberOfValues(value_count);
+    vtkStdString* const values = strings->GetPointer(0);
+    this->ForEachValue(field, value_count, [&](vtkIdType row, const char* begin, const char* end) {
+      values[row].assign(begin, end);
+      return true;
+    });
+    return strings.GetPointer();
+  }
+
+  // Converts the values of 'field' like vtkStringToNumeric, to integers when all of them
+  // are, otherwise to doubles. Returns nullptr when the column is not numeric.
+  vtkSmartPointer<vtkAbstractArray> NewNumericColumn(size_t field, vtkIdType value_count) const
+  {
+    vtkNew<vtkIntArray> integers;
+    integers->SetNumberOfValues(value_count);
+    int* const integer_values = integers->GetPointer(0);
+    std::atomic<vtkIdType> first_non_integer(value_count);
+    this->ForEachValue(
+      field, value_count, [&](vtkIdType row, const char* begin, const char* end) {
+        vtkIdType first = first_non_integer.load();
+        if (row >= first)
+        {
+          return false;
+        }
+        this->Trim(begin, end);
+        integer_values[row] = this->DefaultIntegerValue;
+        if (begin != end && !ToInt(begin, end, integer_values[row]))
+        {
+          while (row < first && !first_non_integer.compare_exchange_weak(first, row))
+          {
+          }
+          return false;
+        }
+        return true;
+      });
+    // Like vtkStringToNumeric, an empty column is converted to doubles
+    if (first_non_integer == value_count && value_count && !this->ForceDouble)
+    {
+      return integers.GetPointer();
+    }
+
+    // The values before the first one that is not an integer are converted from integers
+    vtkNew<vtkDoubleArray> doubles;
+    doubles->SetNumberOfValues(value_count);
+    double* const double_values = doubles->GetPointer(0);
+    const vtkIdType integer_count = first_non_integer;
+    std::atomic<bool> numeric(true);
+    this->ForEachValue(
+      field, value_count, [&](vtkIdType row, const char* begin, const char* end) {
+        if (!numeric.load(std::memory_order_relaxed))
+        {
+          return false;
+        }
+        this->Trim(begin, end);
+        double_values[row] = this->DefaultDoubleValue;
+        if (begin == end)
+        {
+          return true;
+        }
+        if (row < integer_count)
+        {
+          double_values[row] = integer_values[row];
+          return true;
+        }
+        if (!ToDouble(begin, end, double_values[row]))
+        {
+          numeric = false;
+          return false;
+        }
+        return true;
+      });
+    if (!numeric)
+    {
+      return nullptr;
+    }
+    return doubles.GetPointer();
+  }
+
+  void Trim(const char*& begin, const char*& end) const
+  {
+    // Same characters as vtkStringToNumeric
+    if (this->TrimWhitespace)
+    {
+      static const char whitespace[] = " \n\t\r";
+      while (begin != end && std::strchr(whitespace, *begin))
+      {
+        ++begin;
+      }
+      while (end != begin && std::strchr(whitespace, end[-1]))
+      {
+        --end;
+      }
+    }
+  }
+
+  // Characters skipped by the stream of vtkVariant
+  static bool IsSpace(char c)
+  {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\v' || c == '\f' || c == '\r';
+  }
+
+  static bool IsDigit(char c) { return c >= '0' && c <= '9'; }
+
+  // Converts a value like vtkVariant::ToInt, parsing directly a sequence of at most nine
+  // digits with an optional sign and surrounding spaces.
+  static bool ToInt(const char* begin, const char* end, int& value)
+  {
+    const char* first = begin;
+    const char* last = end;
+    while (first != last && IsSpace(*first))
+    {
+      ++first;
+    }
+    while (last != first && IsSpace(last[-1]))
+    {
+      --last;
+    }
+    const bool negative = first != last && *first == '-';
+    const char* digits = first != last && (*first == '-' || *first == '+') ? first + 1 : first;
+    if (digits != last && last - digits <= 9 && std::all_of(digits, last, IsDigit))
+    {
+      int integer = 0;
+      for (const char* c = digits; c != last; ++c)
+      {
+        integer = 10 * integer + (*c - '0');
+      }
+      value = negative ? -integer : integer;
+      return true;
+    }
+    bool valid;
+    value = vtkVariant(vtkStdString(begin, end - begin)).ToInt(&valid);
+    return valid;
+  }
+
+  // Converts a value like vtkVariant::ToDouble, parsing directly a decimal number with an
+  // optional exponent and surrounding spaces. The value must be followed by a null
+  // character.
+  static bool ToDouble(const char* begin, const char* end, double& value)
+  {
+    const char* first = begin;
+    const char* last = end;
+    while (first != last && IsSpace(*first))
+    {
+      ++first;
+    }
+    while (last != first && IsSpace(last[-1]))
+    {
+      --last;
+    }
+    const char* c = first;
+    if (c != last && (*c == '-' || *c == '+'))
+    {
+      ++c;
+    }
+    const char* const mantissa = c;
+    while (c != last && IsDigit(*c))
+    {
+      ++c;
+    }
+    bool decimal = c != mantissa;
+    if (c != last && *c == '.')
+    {
+      ++c;
+      const char* const fraction = c;
+      while (c != last && IsDigit(*c))
+      {
+        ++c;
+      }
+      decimal = decimal || c != fraction;
+    }
+    if (decimal && c != last && (*c == 'e' || *c == 'E'))
+    {
+      ++c;
+      if (c != last && (*c == '-' || *c == '+'))
+      {
+        ++c;
+      }
+      const char* const exponent = c;
+      while (c != last && IsDigit(*c))
+      {
+        ++c;
+      }
+      decimal = c != exponent;
+    }
+    if (decimal && c == last)
+    {
+      // Out of range values are left to vtkVariant
+      char* parsed;
+      errno = 0;
+      value = std::strtod(first, &parsed);
+      if (parsed == last && errno == 0 && std::isfinite(value))
+      {
+        return true;
+      }
+    }
+    bool valid;
+    value = vtkVariant(vtkStdString(begin, end - begin)).ToDouble(&valid);
+    return valid;
+  }
+
+  vtkAlgorithm* Reader;
+  vtkIdType MaxRecords;
+  bool HaveHeaders;
+  bool MergeConsDelims;
+  bool DetectNumericColumns;
+  bool ForceDouble;
+  int DefaultIntegerValue;
+  double DefaultDoubleValue;
+  bool TrimWhitespace;
+  unsigned char Classes[256];
+  std::vector<Chunk> Chunks;
+  // Index of the first record of each chunk, followed by the number of records
+  std::vector<vtkIdType> FirstRecords;
+};
+
+} // End anonymous namespace
+
 /////////////////////////////////////////////////////////////////////////////////////////
 // vtkDelimitedTextReader
 
@@ -606,6 +1302,7 @@ int vtkDelimitedTextReader::ReadData(vtkTable* const output_table)
 
     vtkStdString character_set;
     vtkTextCodec* transCodec = nullptr;
+    bool parsed = false;
 
     if (this->UnicodeCharacterSet)
     {
@@ -628,25 +1325,54 @@ int vtkDelimitedTextReader::ReadData(vtkTable* const output_table)
       this->UnicodeFieldDelimiters = vtkUnicodeString::from_utf8(fieldDelimiterCharacters);
       this->UnicodeStringDelimiters = vtkUnicodeString::from_utf8(tstring);
       this->UnicodeOutputArrays = false;
-      transCodec = vtkTextCodecFactory::CodecToHandle(*input_stream_pt);
+
+      // ASCII and UTF-8 text with ASCII delimiters is parsed directly from its bytes
+      DelimitedTextParser parser(this, this->MaxRecords, this->HaveHeaders,
+        this->MergeConsecutiveDelimiters, this->DetectNumericColumns, this->ForceDouble,
+        this->DefaultIntegerValue, this->DefaultDoubleValue,
+        this->TrimWhitespacePriorToNumericConversion);
+      if (parser.AddCharacters(
+            this->UnicodeRecordDelimiters.utf8_str(), DelimitedTextParser::RecordDelimiter) &&
+        parser.AddCharacters(
+          this->UnicodeFieldDelimiters.utf8_str(), DelimitedTextParser::FieldDelimiter) &&
+        (!this->UseStringDelimiter ||
+          parser.AddCharacters(
+            this->UnicodeStringDelimiters.utf8_str(), DelimitedTextParser::StringDelimiter)) &&
+        parser.AddCharacters(this->UnicodeWhitespace.utf8_str(), DelimitedTextParser::Whitespace) &&
+        parser.AddCharacters(
+          this->UnicodeEscapeCharacter.utf8_str(), DelimitedTextParser::EscapeCharacter))
+      {
+        parsed = parser.Parse(*input_stream_pt, output_table);
+      }
+      if (!parsed)
+      {
+        // Other text (e.g. UTF-16 with a byte order mark) is decoded by a codec
+        input_stream_pt->clear();
+        input_stream_pt->seekg(0, ios::beg);
+        output_table->Initialize();
+        transCodec = vtkTextCodecFactory::CodecToHandle(*input_stream_pt);
+      }
     }
 
-    if (nullptr == transCodec)
+    if (!parsed)
     {
-      // should this use the locale instead??
-      return 1;
-    }
+      if (nullptr == transCodec)
+      {
+        // should this use the locale instead??
+        return 1;
+      }
 
-    DelimitedTextIterator iterator(this->MaxRecords, this->UnicodeRecordDelimiters,
-      this->UnicodeFieldDelimiters, this->UnicodeStringDelimiters, this->UnicodeWhitespace,
-      this->UnicodeEscapeCharacter, this->HaveHeaders, this->UnicodeOutputArrays,
-      this->MergeConsecutiveDelimiters, this->UseStringDelimiter, output_table);
+      DelimitedTextIterator iterator(this->MaxRecords, this->UnicodeRecordDelimiters,
+        this->UnicodeFieldDelimiters, this->UnicodeStringDelimiters, this->UnicodeWhitespace,
+        this->UnicodeEscapeCharacter, this->HaveHeaders, this->UnicodeOutputArrays,
+        this->MergeConsecutiveDelimiters, this->UseStringDelimiter, output_table);
 
-    vtkTextCodec::OutputIterator& outIter = iterator;
+      vtkTextCodec::OutputIterator& outIter = iterator;
 
-    transCodec->ToUnicode(*input_stream_pt, outIter);
-    iterator.ReachedEndOfInput();
-    transCodec->Delete();
+      transCodec->ToUnicode(*input_stream_pt, outIter);
+      iterator.ReachedEndOfInput();
+      transCodec->Delete();
+    }
 
     if (this->OutputPedigreeIds)
     {
@@ -677,7 +1403,8 @@ int vtkDelimitedTextReader::ReadData(vtkTable* const output_table)
       }
     }
 
-    if (this->DetectNumericColumns && !this->UnicodeOutputArrays)
+    // The parser already converted the numeric columns
+    if (this->DetectNumericColumns && !this->UnicodeOutputArrays && !parsed)
     {
       vtkStringToNumeric* converter = vtkStringToNumeric::New();
       converter->SetForceDouble(this->ForceDouble);
@@ -16,6 +16,7 @@
 
 #include "vtkDataArray.h"
 #include "vtkDataSetAttributes.h"
+#include "vtkIdList.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkMath.h"
@@ -23,6 +24,9 @@
 #include "vtkSetGet.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkTable.h"
+
+#include <algorithm>
+#include <numeric>
 #include <string>
 #include <vector>
 
@@ -198,10 +202,16 @@ int vtkTemporalDelimitedTextReader::RequestData(vtkInformation* vtkNotUsed(reque
     }
     vtkIdType nbRow = static_cast<vtkIdType>(timeStepDataIt->second.size());
     outAttributes->CopyAllocate(this->ReadTable->GetRowData(), nbRow);
-    for (auto r : timeStepDataIt->second)
-    {
-      outputTable->InsertNextRow(this->ReadTable->GetRow(r));
-    }
+
+    // Copy the rows of this time step column by column
+    vtkNew<vtkIdList> inputRows;
+    vtkNew<vtkIdList> outputRows;
+    inputRows->SetNumberOfIds(nbRow);
+    outputRows->SetNumberOfIds(nbRow);
+    std::copy(
+      timeStepDataIt->second.begin(), timeStepDataIt->second.end(), inputRows->GetPointer(0));
+    std::iota(outputRows->GetPointer(0), outputRows->GetPointer(0) + nbRow, 0);
+    outAttributes->CopyData(this->ReadTable->GetRowData(), inputRows, outputRows);
 
     // Get rid of the time column in the result
     if (this->RemoveTimeStepColumn)
@@ -0,0 +1,162 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestLegacyASCIIParsing.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+
+// Check that the values of ASCII legacy files are bit-identical to those
+// read with the formatted input functions of istream.
+
+#include "vtkDataArray.h"
+#include "vtkFieldData.h"
+#include "vtkNew.h"
+#include "vtkPolyData.h"
+#include "vtkPolyDataReader.h"
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+template <typename T>
+std::string RandomRealToken(std::mt19937_64& generator, int precision)
+{
+  T value;
+  do
+  {
+    const uint64_t bits = generator();
+    memcpy(&value, &bits, sizeof(T));
+  } while (std::isnan(value) || std::isinf(value));
+  char buffer[64];
+  snprintf(buffer, sizeof(buffer), "%.*g", precision, static_cast<double>(value));
+  return buffer;
+}
+
+std::vector<std::string> RealTokens(bool isFloat)
+{
+  std::vector<std::string> tokens = { "0", "-0", "+3.25", "5.", ".5", "-.5e-3", "1E5", "1e+5",
+    "00012.5e-0003", "0.1", "1e-310", "4.9406564584124654e-324", "1.17549435e-38",
+    "3.4028234663852886e+38",
+    "3.14159265358979323846264338327950288419716939937510582097494459230781640628620899" };
+  if (!isFloat)
+  {
+    tokens.push_back("1.7976931348623157e308");
+  }
+  std::mt19937_64 generator(42);
+  for (int i = 0; i < 2000; ++i)
+  {
+    tokens.push_back(isFloat ? RandomRealToken<float>(generator, 6 + i % 14)
+                             : RandomRealToken<double>(generator, 10 + i % 12));
+    std::uniform_real_distribution<double> distribution(-1000.0, 1000.0);
+    char buffer[64];
+    snprintf(buffer, sizeof(buffer), "%.*f", 1 + i % 8, distribution(generator));
+    tokens.push_back(buffer);
+  }
+  return tokens;
+}
+
+std::vector<std::string> IntegerTokens(bool is64Bits)
+{
+  std::vector<std::string> tokens = { "0", "-0", "+7", "007", "-2147483648", "2147483647" };
+  if (is64Bits)
+  {
+    tokens.push_back("-9223372036854775808");
+    tokens.push_back("9223372036854775807");
+  }
+  std::mt19937_64 generator(7);
+  for (int i = 0; i < 1000; ++i)
+  {
+    const int64_t value = static_cast<int64_t>(generator()) >> (is64Bits ? i % 60 : 32 + i % 28);
+    tokens.push_back(std::to_string(value));
+  }
+  return tokens;
+}
+
+void AppendArray(
+  std::ostringstream& file, const char* name, const char* type, std::vector<std::string>& tokens)
+{
+  file << name << " 1 " << tokens.size() << " " << type << "\n";
+  for (size_t i = 0; i < tokens.size(); ++i)
+  {
+    // Mix the separators.
+    file << tokens[i] << (i % 7 == 6 ? "\n" : (i % 3 ? " " : "\t  "));
+  }
+  file << "\n";
+}
+
+template <typename T>
+bool CheckArray(vtkFieldData* fieldData, const char* name, const std::vector<std::string>& tokens)
+{
+  vtkDataArray* array = fieldData->GetArray(name);
+  if (!array || array->GetNumberOfValues() != static_cast<vtkIdType>(tokens.size()))
+  {
+    std::cerr << "Wrong array " << name << "." << std::endl;
+    return false;
+  }
+  const T* values = static_cast<const T*>(array->GetVoidPointer(0));
+  for (size_t i = 0; i < tokens.size(); ++i)
+  {
+    std::istringstream stream(tokens[i]);
+    T expected = 0;
+    stream >> expected;
+    if (memcmp(&expected, values + i, sizeof(T)) != 0)
+    {
+      std::cerr << "Wrong value " << values[i] << " for \"" << tokens[i] << "\" in " << name
+                << ", expected " << expected << "." << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+} // anonymous namespace
+
+int TestLegacyASCIIParsing(int, char*[])
+{
+  std::vector<std::string> floats = RealTokens(true);
+  std::vector<std::string> doubles = RealTokens(false);
+  std::vector<std::string> ints = IntegerTokens(false);
+  std::vector<std::string> int64s = IntegerTokens(true);
+  std::vector<std::string> shorts = { "0", "-32768", "32767", "+12", "-0042" };
+
+  std::ostringstream file;
+  file << "# vtk DataFile Version 5.1\nASCII parsing\nASCII\nDATASET POLYDATA\n";
+  file << "FIELD FieldData 5\n";
+  AppendArray(file, "floats", "float", floats);
+  AppendArray(file, "doubles", "double", doubles);
+  AppendArray(file, "ints", "int", ints);
+  AppendArray(file, "int64s", "vtktypeint64", int64s);
+  AppendArray(file, "shorts", "short", shorts);
+  file << "POINTS 1 float\n0 0 0\n";
+
+  vtkNew<vtkPolyDataReader> reader;
+  reader->ReadFromInputStringOn();
+  reader->SetInputString(file.str());
+  reader->Update();
+  vtkFieldData* fieldData = reader->GetOutput()->GetFieldData();
+  if (!CheckArray<float>(fieldData, "floats", floats) ||
+    !CheckArray<double>(fieldData, "doubles", doubles) ||
+    !CheckArray<int>(fieldData, "ints", ints) ||
+    !CheckArray<long long>(fieldData, "int64s", int64s) ||
+    !CheckArray<short>(fieldData, "shorts", shorts))
+  {
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
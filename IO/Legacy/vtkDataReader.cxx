@@ -58,12 +58,19 @@
 #include "vtkUnsignedShortArray.h"
 #include "vtkVariantArray.h"
 
+#include "vtk_doubleconversion.h"
+#include VTK_DOUBLECONVERSION_HEADER(double-conversion.h)
+
 #include "vtksys/FStream.hxx"
 #include <vtksys/SystemTools.hxx>
 
 #include <algorithm>
 #include <cctype>
+#include <cmath>
+#include <limits>
 #include <sstream>
+#include <string>
+#include <type_traits>
 #include <vector>
 
 // I need a safe way to read a line of arbitrary length.  It exists on
@@ -73,6 +80,222 @@
 // so it would be nice to put this in a common file.
 static int my_getline(istream& in, vtkStdString& output, char delim = '\n');
 
+namespace
+{
+// The ASCII values are read directly from the buffer of the stream instead of
+// with the formatted input functions of istream, whose locale handling makes
+// them slow. The same characters are taken from the stream as in the classic
+// locale, and the same values are obtained: the conversions of
+// double-conversion are correctly rounded as those of strtod.
+
+bool IsSpace(int c)
+{
+  return c == ' ' || c == '\t' || c == '\n' || c == '\v' || c == '\f' || c == '\r';
+}
+
+bool IsDigit(int c)
+{
+  return c >= '0' && c <= '9';
+}
+
+// Skip the whitespace before a value as the sentry of the formatted input
+// functions does. Return the first character of the value, or EOF after
+// setting the state of the stream.
+int SkipSpaces(istream& is)
+{
+  if (!is.good())
+  {
+    is.setstate(ios::failbit);
+    return EOF;
+  }
+  std::streambuf* buffer = is.rdbuf();
+  int c = buffer->sgetc();
+  while (c != EOF && IsSpace(c))
+  {
+    c = buffer->snextc();
+  }
+  if (c == EOF)
+  {
+    is.setstate(ios::eofbit | ios::failbit);
+  }
+  return c;
+}
+
+template <typename T>
+T Negate(unsigned long long value, std::true_type /* isSigned */)
+{
+  return static_cast<T>(-static_cast<T>(value - 1) - 1);
+}
+
+template <typename T>
+T Negate(unsigned long long value, std::false_type /* isSigned */)
+{
+  return static_cast<T>(0 - value);
+}
+
+// Read a decimal integer: an optional sign followed by digits. Values out of
+// the range of T are errors, and negative values wrap around for unsigned
+// types, as with "is >> value".
+template <typename T>
+bool ReadASCIIInteger(istream& is, T& value)
+{
+  int c = SkipSpaces(is);
+  if (c == EOF)
+  {
+    return false;
+  }
+  std::streambuf* buffer = is.rdbuf();
+  bool negative = false;
+  if (c == '-' || c == '+')
+  {
+    negative = c == '-';
+    c = buffer->snextc();
+  }
+  const unsigned long long max = static_cast<unsigned long long>(std::numeric_limits<T>::max()) +
+    (negative && std::is_signed<T>::value ? 1 : 0);
+  unsigned long long result = 0;
+  bool foundDigits = false;
+  bool overflow = false;
+  while (IsDigit(c))
+  {
+    const unsigned int digit = static_cast<unsigned int>(c - '0');
+    if (result > (max - digit) / 10)
+    {
+      overflow = true;
+    }
+    else
+    {
+      result = result * 10 + digit;
+    }
+    foundDigits = true;
+    c = buffer->snextc();
+  }
+  if (c == EOF)
+  {
+    is.setstate(ios::eofbit);
+  }
+  if (!foundDigits || overflow)
+  {
+    is.setstate(ios::failbit);
+    return false;
+  }
+  value = negative ? Negate<T>(result, std::is_signed<T>()) : static_cast<T>(result);
+  return true;
+}
+
+// Characters of a floating point number, kept on the stack unless there are
+// many of them.
+class NumberToken
+{
+public:
+  void Append(char c)
+  {
+    if (this->Size + 1 < sizeof(this->Buffer))
+    {
+      this->Buffer[this->Size] = c;
+    }
+    else
+    {
+      if (this->LongToken.empty())
+      {
+        this->LongToken.assign(this->Buffer, this->Size);
+      }
+      this->LongToken += c;
+    }
+    ++this->Size;
+  }
+  const char* GetData() const
+  {
+    return this->LongToken.empty() ? this->Buffer : this->LongToken.data();
+  }
+  int GetSize() const { return static_cast<int>(this->Size); }
+
+private:
+  char Buffer[64];
+  size_t Size = 0;
+  std::string LongToken;
+};
+
+double ConvertToReal(const double_conversion::StringToDoubleConverter& converter,
+  const NumberToken& token, int& processed, double*)
+{
+  return converter.StringToDouble(token.GetData(), token.GetSize(), &processed);
+}
+
+float ConvertToReal(const double_conversion::StringToDoubleConverter& converter,
+  const NumberToken& token, int& processed, float*)
+{
+  return converter.StringToFloat(token.GetData(), token.GetSize(), &processed);
+}
+
+// Read a floating point number: the longest sequence of characters made of
+// an optional sign, digits with at most one decimal point, and an optional
+// exponent, which must be a valid number. Infinite values are errors.
+template <typename T>
+bool ReadASCIIReal(istream& is, T& value)
+{
+  int c = SkipSpaces(is);
+  if (c == EOF)
+  {
+    return false;
+  }
+  std::streambuf* buffer = is.rdbuf();
+  NumberToken token;
+  if (c == '-' || c == '+')
+  {
+    token.Append(static_cast<char>(c));
+    c = buffer->snextc();
+  }
+  bool foundMantissa = false;
+  bool foundPoint = false;
+  bool foundExponent = false;
+  while (c != EOF)
+  {
+    if (IsDigit(c))
+    {
+      foundMantissa = true;
+    }
+    else if (c == '.' && !foundPoint && !foundExponent)
+    {
+      foundPoint = true;
+    }
+    else if ((c == 'e' || c == 'E') && !foundExponent && foundMantissa)
+    {
+      foundExponent = true;
+      token.Append('e');
+      c = buffer->snextc();
+      if (c != '-' && c != '+')
+      {
+        continue;
+      }
+    }
+    else
+    {
+      break;
+    }
+    token.Append(static_cast<char>(c));
+    c = buffer->snextc();
+  }
+  if (c == EOF)
+  {
+    is.setstate(ios::eofbit);
+  }
+
+  static const double_conversion::StringToDoubleConverter converter(
+    double_conversion::StringToDoubleConverter::NO_FLAGS, 0.0, 0.0, nullptr, nullptr);
+  int processed = 0;
+  const T result = ConvertToReal(converter, token, processed, static_cast<T*>(nullptr));
+  if (token.GetSize() == 0 || processed != token.GetSize() ||
+    std::abs(result) == std::numeric_limits<T>::infinity())
+  {
+    is.setstate(ios::failbit);
+    return false;
+  }
+  value = result;
+  return true;
+}
+} // anonymous namespace
+
 vtkStandardNewMacro(vtkDataReader);
 
 vtkCxxSetObjectMacro(vtkDataReader, InputArray, vtkCharArray);
@@ -308,8 +531,7 @@ int vtkDataReader::ReadString(char result[256])
 int vtkDataReader::Read(char* result)
 {
   int intData;
-  *this->IS >> intData;
-  if (this->IS->fail())
+  if (!ReadASCIIInteger(*this->IS, intData))
   {
     return 0;
   }
@@ -322,8 +544,7 @@ int vtkDataReader::Read(char* result)
 int vtkDataReader::Read(unsigned char* result)
 {
   int intData;
-  *this->IS >> intData;
-  if (this->IS->fail())
+  if (!ReadASCIIInteger(*this->IS, intData))
   {
     return 0;
   }
@@ -335,111 +556,61 @@ int vtkDataReader::Read(unsigned char* result)
 //------------------------------------------------------------------------------
 int vtkDataReader::Read(short* result)
 {
-  *this->IS >> *result;
-  if (this->IS->fail())
-  {
-    return 0;
-  }
-  return 1;
+  return ReadASCIIInteger(*this->IS, *result) ? 1 : 0;
 }
 
 //------------------------------------------------------------------------------
 int vtkDataReader::Read(unsigned short* result)
 {
-  *this->IS >> *result;
-  if (this->IS->fail())
-  {
-    return 0;
-  }
-  return 1;
+  return ReadASCIIInteger(*this->IS, *result) ? 1 : 0;
 }
 
 //------------------------------------------------------------------------------
 int vtkDataReader::Read(int* result)
 {
-  *this->IS >> *result;
-  if (this->IS->fail())
-  {
-    return 0;
-  }
-  return 1;
+  return ReadASCIIInteger(*this->IS, *result) ? 1 : 0;
 }
 
 //------------------------------------------------------------------------------
 int vtkDataReader::Read(unsigned int* result)
 {
-  *this->IS >> *result;
-  if (this->IS->fail())
-  {
-    return 0;
-  }
-  return 1;
+  return ReadASCIIInteger(*this->IS, *result) ? 1 : 0;
 }
 
 //------------------------------------------------------------------------------
 int vtkDataReader::Read(long* result)
 {
-  *this->IS >> *result;
-  if (this->IS->fail())
-  {
-    return 0;
-  }
-  return 1;
+  return ReadASCIIInteger(*this->IS, *result) ? 1 : 0;
 }
 
 //------------------------------------------------------------------------------
 int vtkDataReader::Read(unsigned long* result)
 {
-  *this->IS >> *result;
-  if (this->IS->fail())
-  {
-    return 0;
-  }
-  return 1;
+  return ReadASCIIInteger(*this->IS, *result) ? 1 : 0;
 }
 
 //------------------------------------------------------------------------------
 int vtkDataReader::Read(long long* result)
 {
-  *this->IS >> *result;
-  if (this->IS->fail())
-  {
-    return 0;
-  }
-  return 1;
+  return ReadASCIIInteger(*this->IS, *result) ? 1 : 0;
 }
 
 //------------------------------------------------------------------------------
 int vtkDataReader::Read(unsigned long long* result)
 {
-  *this->IS >> *result;
-  if (this->IS->fail())
-  {
-    return 0;
-  }
-  return 1;
+  return ReadASCIIInteger(*this->IS, *result) ? 1 : 0;
 }
 
 //------------------------------------------------------------------------------
 int vtkDataReader::Read(float* result)
 {
-  *this->IS >> *result;
-  if (this->IS->fail())
-  {
-    return 0;
-  }
-  return 1;
+  return ReadASCIIReal(*this->IS, *result) ? 1 : 0;
 }
 
 //------------------------------------------------------------------------------
 int vtkDataReader::Read(double* result)
 {
-  *this->IS >> *result;
-  if (this->IS->fail())
-  {
-    return 0;
-  }
-  return 1;
+  return ReadASCIIReal(*this->IS, *result) ? 1 : 0;
 }
 
 //------------------------------------------------------------------------------
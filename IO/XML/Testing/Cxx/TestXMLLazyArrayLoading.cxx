@@ -0,0 +1,266 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestXMLLazyArrayLoading.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that the arrays read with LazyArrayLoading are only read from the
+// file on their first access, with the values of an eager read.
+
+#include "vtkDoubleArray.h"
+#include "vtkImageData.h"
+#include "vtkIntArray.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkRTAnalyticSource.h"
+#include "vtkTestUtilities.h"
+#include "vtkXMLImageDataReader.h"
+#include "vtkXMLImageDataWriter.h"
+#include "vtkXMLLazyDataArray.h"
+
+#include <iostream>
+#include <string>
+
+namespace
+{
+const char* const ArrayNames[] = { "RTData", "Gradient", "Index" };
+
+void AddArrays(vtkImageData* image)
+{
+  vtkDataArray* scalars = image->GetPointData()->GetScalars();
+  vtkNew<vtkDoubleArray> gradient;
+  gradient->SetName("Gradient");
+  gradient->SetNumberOfComponents(3);
+  gradient->SetNumberOfTuples(image->GetNumberOfPoints());
+  vtkNew<vtkIntArray> index;
+  index->SetName("Index");
+  index->SetNumberOfTuples(image->GetNumberOfPoints());
+  for (vtkIdType i = 0; i < image->GetNumberOfPoints(); ++i)
+  {
+    double s = scalars->GetTuple1(i);
+    gradient->SetTuple3(i, s, -s, 0.5 * s);
+    index->SetValue(i, static_cast<int>(i));
+  }
+  image->GetPointData()->AddArray(gradient);
+  image->GetPointData()->AddArray(index);
+}
+
+template <class T>
+int GetLoadState(vtkDataArray* array)
+{
+  vtkXMLLazyDataArray<T>* lazyArray = vtkXMLLazyDataArray<T>::SafeDownCast(array);
+  return lazyArray ? (lazyArray->IsLoaded() ? 1 : 0) : -1;
+}
+
+// -1 for an array that is not lazy, 0 when not loaded yet, 1 when loaded.
+int LoadState(vtkImageData* image, const char* name)
+{
+  vtkDataArray* array = image->GetPointData()->GetArray(name);
+  if (!array)
+  {
+    return -1;
+  }
+  switch (array->GetDataType())
+  {
+    vtkTemplateMacro(return GetLoadState<VTK_TT>(array));
+  }
+  return -1;
+}
+
+bool CheckArray(vtkImageData* image, vtkImageData* reference, const char* name)
+{
+  vtkDataArray* array = image->GetPointData()->GetArray(name);
+  vtkDataArray* referenceArray = reference->GetPointData()->GetArray(name);
+  if (!array || !referenceArray || array->GetNumberOfTuples() != image->GetNumberOfPoints() ||
+    array->GetNumberOfComponents() != referenceArray->GetNumberOfComponents())
+  {
+    std::cerr << "Wrong size of array " << name << "." << std::endl;
+    return false;
+  }
+  int extent[6];
+  image->GetExtent(extent);
+  for (int k = extent[4]; k <= extent[5]; ++k)
+  {
+    for (int j = extent[2]; j <= extent[3]; ++j)
+    {
+      for (int i = extent[0]; i <= extent[1]; ++i)
+      {
+        int ijk[3] = { i, j, k };
+        vtkIdType id = image->ComputePointId(ijk);
+        vtkIdType referenceId = reference->ComputePointId(ijk);
+        for (int c = 0; c < array->GetNumberOfComponents(); ++c)
+        {
+          if (array->GetComponent(id, c) != referenceArray->GetComponent(referenceId, c))
+          {
+            std::cerr << "Wrong value of array " << name << " at " << i << " " << j << " " << k
+                      << "." << std::endl;
+            return false;
+          }
+        }
+      }
+    }
+  }
+  return true;
+}
+
+bool Write(vtkImageData* image, const std::string& fileName, int compressorType, bool encode)
+{
+  vtkNew<vtkXMLImageDataWriter> writer;
+  writer->SetInputData(image);
+  writer->SetFileName(fileName.c_str());
+  writer->SetDataModeToAppended();
+  writer->SetEncodeAppendedData(encode);
+  writer->SetCompressorType(compressorType);
+  // Blocks that do not hold a whole number of rows.
+  writer->SetBlockSize(1000);
+  return writer->Write() == 1;
+}
+
+bool TestLazyRead(
+  vtkImageData* reference, const std::string& fileName, int compressorType, bool encode)
+{
+  if (!Write(reference, fileName, compressorType, encode))
+  {
+    std::cerr << "Cannot write " << fileName << "." << std::endl;
+    return false;
+  }
+
+  vtkNew<vtkXMLImageDataReader> reader;
+  reader->SetFileName(fileName.c_str());
+  reader->LazyArrayLoadingOn();
+  reader->Update();
+  vtkImageData* output = reader->GetOutput();
+  for (const char* name : ArrayNames)
+  {
+    if (LoadState(output, name) != 0)
+    {
+      std::cerr << "Array " << name << " is not an unloaded lazy array after the read."
+                << std::endl;
+      return false;
+    }
+  }
+
+  // Only the accessed array is read.
+  if (!CheckArray(output, reference, "Index"))
+  {
+    return false;
+  }
+  if (LoadState(output, "Index") != 1 || LoadState(output, "Gradient") != 0 ||
+    LoadState(output, "RTData") != 0)
+  {
+    std::cerr << "Accessing an array did not load exactly that array." << std::endl;
+    return false;
+  }
+  if (output->GetPointData()->GetScalars() != output->GetPointData()->GetArray("RTData"))
+  {
+    std::cerr << "Wrong active scalars." << std::endl;
+    return false;
+  }
+  for (const char* name : ArrayNames)
+  {
+    if (!CheckArray(output, reference, name))
+    {
+      return false;
+    }
+  }
+
+  // A sub-extent locates one segment per row of the file.
+  vtkNew<vtkXMLImageDataReader> subReader;
+  subReader->SetFileName(fileName.c_str());
+  subReader->LazyArrayLoadingOn();
+  const int subExtent[6] = { -3, 7, -20, 5, 2, 9 };
+  static_cast<vtkAlgorithm*>(subReader)->UpdateExtent(subExtent);
+  vtkImageData* subOutput = subReader->GetOutput();
+  if (LoadState(subOutput, "Gradient") != 0)
+  {
+    std::cerr << "Array Gradient of a sub-extent is not an unloaded lazy array." << std::endl;
+    return false;
+  }
+  for (const char* name : ArrayNames)
+  {
+    if (!CheckArray(subOutput, reference, name))
+    {
+      return false;
+    }
+  }
+
+  // Lazy arrays copy like any other array.
+  vtkNew<vtkImageData> copy;
+  copy->DeepCopy(subOutput);
+  return CheckArray(copy, reference, "Gradient");
+}
+} // anonymous namespace
+
+int TestXMLLazyArrayLoading(int argc, char* argv[])
+{
+  char* tempDir =
+    vtkTestUtilities::GetArgOrEnvOrDefault("-T", argc, argv, "VTK_TEMP_DIR", "Testing/Temporary");
+  const std::string fileName = std::string(tempDir) + "/TestXMLLazyArrayLoading.vti";
+  delete[] tempDir;
+
+  vtkNew<vtkRTAnalyticSource> source;
+  source->SetWholeExtent(-20, 20, -20, 20, -20, 20);
+  source->Update();
+  vtkNew<vtkImageData> reference;
+  reference->ShallowCopy(source->GetOutput());
+  AddArrays(reference);
+
+  const int compressorTypes[] = { vtkXMLWriterBase::NONE, vtkXMLWriterBase::ZLIB,
+    vtkXMLWriterBase::LZ4 };
+  for (int compressorType : compressorTypes)
+  {
+    for (bool encode : { false, true })
+    {
+      if (!TestLazyRead(reference, fileName, compressorType, encode))
+      {
+        std::cerr << "Lazy read failed with compressor " << compressorType << " and encoding "
+                  << encode << "." << std::endl;
+        return EXIT_FAILURE;
+      }
+    }
+  }
+
+  // Without the option, the arrays are read by the reader.
+  vtkNew<vtkXMLImageDataReader> reader;
+  reader->SetFileName(fileName.c_str());
+  reader->Update();
+  if (LoadState(reader->GetOutput(), "Gradient") != -1)
+  {
+    std::cerr << "Lazy array created without LazyArrayLoading." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Arrays are not read from a file that changed since the read.
+  vtkNew<vtkXMLImageDataReader> lazyReader;
+  lazyReader->SetFileName(fileName.c_str());
+  lazyReader->LazyArrayLoadingOn();
+  lazyReader->Update();
+  vtkNew<vtkRTAnalyticSource> otherSource;
+  otherSource->SetWholeExtent(0, 10, 0, 10, 0, 10);
+  otherSource->Update();
+  if (!Write(otherSource->GetOutput(), fileName, vtkXMLWriterBase::ZLIB, false))
+  {
+    std::cerr << "Cannot write " << fileName << "." << std::endl;
+    return EXIT_FAILURE;
+  }
+  vtkObject::GlobalWarningDisplayOff();
+  vtkDataArray* scalars = lazyReader->GetOutput()->GetPointData()->GetArray("RTData");
+  double range[2];
+  scalars->GetRange(range);
+  vtkObject::GlobalWarningDisplayOn();
+  if (range[0] != 0 || range[1] != 0)
+  {
+    std::cerr << "Values read from a changed file." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
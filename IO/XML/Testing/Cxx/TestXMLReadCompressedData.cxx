@@ -0,0 +1,106 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestXMLReadCompressedData.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that compressed data are read correctly, whole or in parts that
+// begin and end inside compression blocks.
+
+#include "vtkDataArray.h"
+#include "vtkImageData.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkRTAnalyticSource.h"
+#include "vtkXMLImageDataReader.h"
+#include "vtkXMLImageDataWriter.h"
+
+#include <iostream>
+#include <string>
+
+namespace
+{
+bool CheckValues(vtkImageData* image, vtkImageData* reference)
+{
+  vtkDataArray* array = image->GetPointData()->GetScalars();
+  vtkDataArray* referenceArray = reference->GetPointData()->GetScalars();
+  if (!array || array->GetNumberOfTuples() != image->GetNumberOfPoints())
+  {
+    return false;
+  }
+  int extent[6];
+  image->GetExtent(extent);
+  for (int k = extent[4]; k <= extent[5]; ++k)
+  {
+    for (int j = extent[2]; j <= extent[3]; ++j)
+    {
+      for (int i = extent[0]; i <= extent[1]; ++i)
+      {
+        int ijk[3] = { i, j, k };
+        if (array->GetTuple1(image->ComputePointId(ijk)) !=
+          referenceArray->GetTuple1(reference->ComputePointId(ijk)))
+        {
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+} // anonymous namespace
+
+int TestXMLReadCompressedData(int, char*[])
+{
+  vtkNew<vtkRTAnalyticSource> source;
+  source->SetWholeExtent(-20, 20, -20, 20, -20, 20);
+  source->Update();
+  vtkImageData* reference = source->GetOutput();
+
+  const int compressorTypes[] = { vtkXMLWriterBase::ZLIB, vtkXMLWriterBase::LZ4,
+    vtkXMLWriterBase::LZMA };
+  for (int compressorType : compressorTypes)
+  {
+    vtkNew<vtkXMLImageDataWriter> writer;
+    writer->SetInputData(reference);
+    writer->SetCompressorType(compressorType);
+    // Blocks that do not hold a whole number of rows.
+    writer->SetBlockSize(1000);
+    writer->WriteToOutputStringOn();
+    writer->Write();
+
+    vtkNew<vtkXMLImageDataReader> reader;
+    reader->ReadFromInputStringOn();
+    reader->SetInputString(writer->GetOutputString());
+    reader->Update();
+    if (!CheckValues(reader->GetOutput(), reference))
+    {
+      std::cerr << "Wrong values read with compressor " << compressorType << "." << std::endl;
+      return EXIT_FAILURE;
+    }
+
+    vtkNew<vtkXMLImageDataReader> subReader;
+    subReader->ReadFromInputStringOn();
+    subReader->SetInputString(writer->GetOutputString());
+    const int subExtent[6] = { -3, 7, -20, 5, 2, 9 };
+    static_cast<vtkAlgorithm*>(subReader)->UpdateExtent(subExtent);
+    int extent[6];
+    subReader->GetOutput()->GetExtent(extent);
+    if (extent[0] != -3 || extent[1] != 7 || extent[5] != 9 ||
+      !CheckValues(subReader->GetOutput(), reference))
+    {
+      std::cerr << "Wrong values of a sub-extent read with compressor " << compressorType << "."
+                << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
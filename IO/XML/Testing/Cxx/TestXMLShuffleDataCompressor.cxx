@@ -0,0 +1,143 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestXMLShuffleDataCompressor.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that the data compressed by vtkShuffleDataCompressor, with any inner
+// compressor, byte order and delta encoding, are read back unchanged.
+
+#include "vtkCellArray.h"
+#include "vtkDataArray.h"
+#include "vtkElevationFilter.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkShuffleDataCompressor.h"
+#include "vtkSphereSource.h"
+#include "vtkXMLPolyDataReader.h"
+#include "vtkXMLPolyDataWriter.h"
+#include "vtkZLibDataCompressor.h"
+
+#include <cstring>
+#include <iostream>
+#include <string>
+
+namespace
+{
+bool HaveSameValues(vtkDataArray* array1, vtkDataArray* array2)
+{
+  if (!array1 || !array2 || array1->GetNumberOfValues() != array2->GetNumberOfValues())
+  {
+    return false;
+  }
+  for (vtkIdType i = 0; i < array1->GetNumberOfValues(); ++i)
+  {
+    if (array1->GetVariantValue(i) != array2->GetVariantValue(i))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool HaveSameData(vtkPolyData* polyData, vtkPolyData* reference)
+{
+  return HaveSameValues(polyData->GetPoints()->GetData(), reference->GetPoints()->GetData()) &&
+    HaveSameValues(polyData->GetPolys()->GetOffsetsArray(),
+      reference->GetPolys()->GetOffsetsArray()) &&
+    HaveSameValues(polyData->GetPolys()->GetConnectivityArray(),
+      reference->GetPolys()->GetConnectivityArray()) &&
+    HaveSameValues(polyData->GetPointData()->GetArray("Elevation"),
+      reference->GetPointData()->GetArray("Elevation")) &&
+    HaveSameValues(polyData->GetPointData()->GetNormals(), reference->GetPointData()->GetNormals());
+}
+} // anonymous namespace
+
+int TestXMLShuffleDataCompressor(int, char*[])
+{
+  vtkNew<vtkSphereSource> sphere;
+  sphere->SetThetaResolution(100);
+  sphere->SetPhiResolution(100);
+  vtkNew<vtkElevationFilter> elevation;
+  elevation->SetInputConnection(sphere->GetOutputPort());
+  elevation->Update();
+  vtkPolyData* reference = vtkPolyData::SafeDownCast(elevation->GetOutput());
+
+  vtkNew<vtkZLibDataCompressor> zlib;
+  vtkDataCompressor* innerCompressors[] = { nullptr, zlib };
+  for (vtkDataCompressor* innerCompressor : innerCompressors)
+  {
+    for (int byteOrder : { vtkXMLWriter::LittleEndian, vtkXMLWriter::BigEndian })
+    {
+      for (bool delta : { false, true })
+      {
+        vtkNew<vtkShuffleDataCompressor> compressor;
+        if (innerCompressor)
+        {
+          compressor->SetCompressor(innerCompressor);
+        }
+        compressor->SetDelta(delta);
+        vtkNew<vtkXMLPolyDataWriter> writer;
+        writer->SetInputData(reference);
+        writer->SetCompressor(compressor);
+        writer->SetByteOrder(byteOrder);
+        writer->SetDataModeToAppended();
+        writer->SetBlockSize(1000);
+        writer->WriteToOutputStringOn();
+        writer->Write();
+        if (writer->GetOutputString().find("compressor=\"vtkShuffleDataCompressor\"") ==
+          std::string::npos)
+        {
+          std::cerr << "The compressor is not recorded in the file." << std::endl;
+          return EXIT_FAILURE;
+        }
+
+        vtkNew<vtkXMLPolyDataReader> reader;
+        reader->ReadFromInputStringOn();
+        reader->SetInputString(writer->GetOutputString());
+        reader->Update();
+        if (!HaveSameData(reader->GetOutput(), reference))
+        {
+          std::cerr << "Wrong data read with inner compressor "
+                    << (innerCompressor ? innerCompressor->GetClassName() : "(default)")
+                    << ", byte order " << byteOrder << " and delta " << delta << "."
+                    << std::endl;
+          return EXIT_FAILURE;
+        }
+      }
+    }
+  }
+
+  // Shuffled data are uncompressed with the compressor recorded for them.
+  vtkNew<vtkShuffleDataCompressor> stored;
+  stored->SetCompressor(nullptr);
+  stored->SetWordFormat(4, true, false);
+  stored->DeltaOn();
+  const unsigned int words[] = { 7, 12, 40, 41, 41, 30, 0xffffffffu, 5, 9 };
+  const size_t size = sizeof(words) - 2; // With an incomplete last word.
+  const unsigned char* data = reinterpret_cast<const unsigned char*>(words);
+  unsigned char compressed[64];
+  const size_t compressedSize =
+    stored->Compress(data, size, compressed, stored->GetMaximumCompressionSpace(size));
+  vtkNew<vtkShuffleDataCompressor> uncompressor;
+  unsigned char uncompressed[sizeof(words)];
+  if (compressedSize != size + 4 ||
+    uncompressor->Uncompress(compressed, compressedSize, uncompressed, size) != size ||
+    memcmp(uncompressed, data, size) != 0)
+  {
+    std::cerr << "Wrong data uncompressed from stored shuffled data." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,91 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestXMLWriterCompressionThreads.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that the files written with blocks compressed concurrently are
+// identical to those written with blocks compressed sequentially.
+
+#include "vtkDataArray.h"
+#include "vtkElevationFilter.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPolyData.h"
+#include "vtkSphereSource.h"
+#include "vtkXMLPolyDataReader.h"
+#include "vtkXMLPolyDataWriter.h"
+
+#include <iostream>
+#include <string>
+
+namespace
+{
+std::string Write(vtkPolyData* polyData, int compressorType, int dataMode, int numThreads)
+{
+  vtkNew<vtkXMLPolyDataWriter> writer;
+  writer->SetInputData(polyData);
+  writer->SetCompressorType(compressorType);
+  writer->SetDataMode(dataMode);
+  writer->SetBlockSize(1024);
+  writer->SetNumberOfCompressionThreads(numThreads);
+  writer->WriteToOutputStringOn();
+  writer->Write();
+  return writer->GetOutputString();
+}
+} // anonymous namespace
+
+int TestXMLWriterCompressionThreads(int, char*[])
+{
+  vtkNew<vtkSphereSource> sphere;
+  sphere->SetThetaResolution(100);
+  sphere->SetPhiResolution(100);
+  vtkNew<vtkElevationFilter> elevation;
+  elevation->SetInputConnection(sphere->GetOutputPort());
+  elevation->Update();
+  vtkPolyData* polyData = vtkPolyData::SafeDownCast(elevation->GetOutput());
+
+  const int compressorTypes[] = { vtkXMLWriterBase::ZLIB, vtkXMLWriterBase::LZ4,
+    vtkXMLWriterBase::LZMA };
+  const int dataModes[] = { vtkXMLWriterBase::Binary, vtkXMLWriterBase::Appended };
+  for (int compressorType : compressorTypes)
+  {
+    for (int dataMode : dataModes)
+    {
+      const std::string sequential = Write(polyData, compressorType, dataMode, 1);
+      for (int numThreads : { 0, 2, 3 })
+      {
+        if (Write(polyData, compressorType, dataMode, numThreads) != sequential)
+        {
+          std::cerr << "The file written with " << numThreads << " threads and compressor "
+                    << compressorType << " differs from the sequential one." << std::endl;
+          return EXIT_FAILURE;
+        }
+      }
+
+      vtkNew<vtkXMLPolyDataReader> reader;
+      reader->ReadFromInputStringOn();
+      reader->SetInputString(sequential);
+      reader->Update();
+      vtkDataArray* expected = polyData->GetPointData()->GetArray("Elevation");
+      vtkDataArray* actual = reader->GetOutput()->GetPointData()->GetArray("Elevation");
+      if (!actual || actual->GetNumberOfTuples() != expected->GetNumberOfTuples() ||
+        actual->GetTuple1(expected->GetNumberOfTuples() - 1) !=
+          expected->GetTuple1(expected->GetNumberOfTuples() - 1))
+      {
+        std::cerr << "Wrong data read with compressor " << compressorType << "." << std::endl;
+        return EXIT_FAILURE;
+      }
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -276,7 +276,7 @@ void vtkXMLDataReader::SetupOutputData()
         this->NumberOfPointArrays++;
         (*this->PointDataTimeStep)[ename] = -1;
         (*this->PointDataOffset)[ename] = -1;
-        vtkAbstractArray* array = this->CreateArray(eNested);
+        vtkAbstractArray* array = this->CreateArray(eNested, this->CanReadArrayLazily(eNested));
         if (array)
         {
           array->SetNumberOfTuples(pointTuples);
@@ -305,7 +305,7 @@ void vtkXMLDataReader::SetupOutputData()
         this->NumberOfCellArrays++;
         (*this->CellDataTimeStep)[ename] = -1;
         (*this->CellDataOffset)[ename] = -1;
-        vtkAbstractArray* array = this->CreateArray(eNested);
+        vtkAbstractArray* array = this->CreateArray(eNested, this->CanReadArrayLazily(eNested));
         if (array)
         {
           array->SetNumberOfTuples(cellTuples);
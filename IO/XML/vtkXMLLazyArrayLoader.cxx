@@ -0,0 +1,160 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkXMLLazyArrayLoader.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkXMLLazyArrayLoader.h"
+
+#include "vtkDataArray.h"
+#include "vtkDataCompressor.h"
+#include "vtkObjectFactory.h"
+#include "vtkXMLDataParser.h"
+
+#include "vtksys/FStream.hxx"
+#include <vtksys/SystemTools.hxx>
+
+#include <locale> // C++ locale
+
+vtkStandardNewMacro(vtkXMLLazyArrayLoader);
+
+//------------------------------------------------------------------------------
+vtkXMLLazyArrayLoader::vtkXMLLazyArrayLoader()
+{
+  this->FileLength = 0;
+  this->FileModifiedTime = 0;
+  this->Compressor = nullptr;
+  this->Parser = nullptr;
+}
+
+//------------------------------------------------------------------------------
+vtkXMLLazyArrayLoader::~vtkXMLLazyArrayLoader()
+{
+  if (this->Compressor)
+  {
+    this->Compressor->Delete();
+  }
+  if (this->Parser)
+  {
+    this->Parser->Delete();
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkXMLLazyArrayLoader::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "FileName: " << this->FileName << "\n";
+  os << indent << "FileLength: " << this->FileLength << "\n";
+  os << indent << "FileModifiedTime: " << this->FileModifiedTime << "\n";
+  os << indent << "Compressor: " << this->Compressor << "\n";
+}
+
+//------------------------------------------------------------------------------
+bool vtkXMLLazyArrayLoader::Initialize(const char* fileName, vtkDataCompressor* compressor)
+{
+  if (!fileName || !vtksys::SystemTools::FileExists(fileName, true))
+  {
+    vtkErrorMacro("Cannot find file " << (fileName ? fileName : "(null)"));
+    return false;
+  }
+  this->FileName = fileName;
+  this->FileLength = vtksys::SystemTools::FileLength(this->FileName);
+  this->FileModifiedTime = vtksys::SystemTools::ModifiedTime(this->FileName);
+
+  if (compressor != this->Compressor)
+  {
+    if (this->Compressor)
+    {
+      this->Compressor->Delete();
+    }
+    this->Compressor = compressor;
+    if (this->Compressor)
+    {
+      this->Compressor->Register(this);
+    }
+  }
+  if (this->Parser)
+  {
+    this->Parser->Delete();
+    this->Parser = nullptr;
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool vtkXMLLazyArrayLoader::FileIsUnchanged()
+{
+  return vtksys::SystemTools::FileLength(this->FileName) == this->FileLength &&
+    vtksys::SystemTools::ModifiedTime(this->FileName) == this->FileModifiedTime;
+}
+
+//------------------------------------------------------------------------------
+bool vtkXMLLazyArrayLoader::Load(vtkDataArray* array, const std::vector<Segment>& segments)
+{
+  std::lock_guard<std::mutex> lock(this->LoadMutex);
+  if (this->FileName.empty())
+  {
+    vtkErrorMacro("Load() called before Initialize().");
+    return false;
+  }
+  if (!this->FileIsUnchanged())
+  {
+    vtkErrorMacro("File " << this->FileName << " changed since it was read, cannot load array "
+                          << (array->GetName() ? array->GetName() : "(unnamed)"));
+    return false;
+  }
+
+  std::ios_base::openmode mode = ios::in;
+#ifdef _WIN32
+  mode |= ios::binary;
+#endif
+  vtksys::ifstream stream(this->FileName.c_str(), mode);
+  if (!stream)
+  {
+    vtkErrorMacro("Error opening file " << this->FileName);
+    return false;
+  }
+  stream.imbue(std::locale::classic());
+
+  // The header of the file tells the parser where the appended data starts
+  // and how its blocks are encoded.
+  if (!this->Parser)
+  {
+    this->Parser = vtkXMLDataParser::New();
+    this->Parser->SetStream(&stream);
+    if (!this->Parser->Parse())
+    {
+      vtkErrorMacro("Error parsing file " << this->FileName);
+      this->Parser->Delete();
+      this->Parser = nullptr;
+      return false;
+    }
+    this->Parser->SetCompressor(this->Compressor);
+  }
+  this->Parser->SetStream(&stream);
+
+  bool result = true;
+  for (const Segment& segment : segments)
+  {
+    if (this->Parser->ReadAppendedData(segment.Offset, array->GetVoidPointer(segment.ArrayIndex),
+          segment.StartWord, segment.NumberOfWords,
+          array->GetDataType()) != segment.NumberOfWords)
+    {
+      vtkErrorMacro("Cannot read the values of array "
+        << (array->GetName() ? array->GetName() : "(unnamed)") << " from " << this->FileName);
+      result = false;
+      break;
+    }
+  }
+  this->Parser->SetStream(nullptr);
+  return result;
+}
@@ -0,0 +1,110 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkXMLLazyArrayLoader.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkXMLLazyArrayLoader
+ * @brief   Reads the appended data of vtkXMLLazyDataArray instances.
+ *
+ * vtkXMLLazyArrayLoader is shared by the lazy arrays created by one
+ * execution of a vtkXMLReader with LazyArrayLoading on. It remembers the
+ * file and the compressor of that execution and reads the appended data
+ * segments of an array, uncompressing them, when the array is first
+ * accessed. The file is opened again for each load, and its header is
+ * parsed once by an internal vtkXMLDataParser.
+ *
+ * The file must not change between the read and the loads: the size and
+ * modification time of the file are checked before each load, and the
+ * load fails with an error when they differ.
+ *
+ * Loads are serialized, so arrays sharing a loader can be accessed from
+ * several threads.
+ *
+ * @sa
+ * vtkXMLLazyDataArray vtkXMLReader
+ */
+
+#ifndef vtkXMLLazyArrayLoader_h
+#define vtkXMLLazyArrayLoader_h
+
+#include "vtkIOXMLModule.h" // For export macro
+#include "vtkObject.h"
+
+#include <mutex>  // For std::mutex
+#include <string> // For std::string
+#include <vector> // For std::vector
+
+class vtkDataArray;
+class vtkDataCompressor;
+class vtkXMLDataParser;
+
+class VTKIOXML_EXPORT vtkXMLLazyArrayLoader : public vtkObject
+{
+public:
+  static vtkXMLLazyArrayLoader* New();
+  vtkTypeMacro(vtkXMLLazyArrayLoader, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * A part of an array stored in the appended data: NumberOfWords values
+   * starting at StartWord in the data at Offset, read at ArrayIndex in the
+   * array.
+   */
+  struct Segment
+  {
+    vtkTypeInt64 Offset;
+    vtkTypeUInt64 StartWord;
+    size_t NumberOfWords;
+    vtkIdType ArrayIndex;
+  };
+
+  /**
+   * Set the file to read from and the compressor of its appended data,
+   * which may be nullptr. The current size and modification time of the
+   * file are recorded. Returns false if the file cannot be found.
+   */
+  bool Initialize(const char* fileName, vtkDataCompressor* compressor);
+
+  /**
+   * Read the given segments into array, which must be allocated. Returns
+   * false, after reporting an error, if the file changed since Initialize()
+   * or a segment cannot be read.
+   */
+  bool Load(vtkDataArray* array, const std::vector<Segment>& segments);
+
+  /**
+   * Get the file given to Initialize().
+   */
+  const char* GetFileName() const { return this->FileName.c_str(); }
+
+protected:
+  vtkXMLLazyArrayLoader();
+  ~vtkXMLLazyArrayLoader() override;
+
+  // Whether the size and modification time of the file are still the
+  // recorded ones.
+  bool FileIsUnchanged();
+
+  std::string FileName;
+  unsigned long FileLength;
+  long FileModifiedTime;
+  vtkDataCompressor* Compressor;
+  vtkXMLDataParser* Parser;
+  std::mutex LoadMutex;
+
+private:
+  vtkXMLLazyArrayLoader(const vtkXMLLazyArrayLoader&) = delete;
+  void operator=(const vtkXMLLazyArrayLoader&) = delete;
+};
+
+#endif
@@ -0,0 +1,185 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkXMLLazyDataArray.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+
+/**
+ * @class   vtkXMLLazyDataArray
+ * @brief   Array of a VTK XML file read on its first access.
+ *
+ * vtkXMLLazyDataArray is created by vtkXMLReader for the appended point
+ * and cell data arrays of a file when LazyArrayLoading is on. The reader
+ * only records where the values of the array are stored in the appended
+ * data. The first access to the values reads and uncompresses them,
+ * through the vtkXMLLazyArrayLoader shared by the arrays of the same
+ * read, into an internal vtkAOSDataArrayTemplate to which all the
+ * methods are then forwarded.
+ *
+ * Getting the number of tuples, components or the name of the array,
+ * Squeeze() and GetActualMemorySize() do not load the values. Loading is
+ * thread safe. If the values cannot be read, an error is reported and the
+ * array is filled with zeros.
+ *
+ * GetVoidPointer() returns the storage of the internal array, so the
+ * array can be used like a regular array once loaded, but it is not a
+ * vtkAOSDataArrayTemplate: code that only handles the latter with
+ * vtkArrayDispatch goes through the slower generic path.
+ *
+ * @sa
+ * vtkXMLLazyArrayLoader vtkXMLReader vtkMappedDataArray
+ */
+
+#ifndef vtkXMLLazyDataArray_h
+#define vtkXMLLazyDataArray_h
+
+#include "vtkMappedDataArray.h"
+
+#include "vtkAOSDataArrayTemplate.h" // For vtkAOSDataArrayTemplate
+#include "vtkObjectFactory.h"        // for vtkStandardNewMacro
+#include "vtkXMLLazyArrayLoader.h"   // For vtkXMLLazyArrayLoader::Segment
+
+#include <atomic> // For std::atomic
+#include <mutex>  // For std::mutex
+#include <vector> // For std::vector
+
+template <class Scalar>
+class vtkXMLLazyDataArray : public vtkMappedDataArray<Scalar>
+{
+public:
+  vtkAbstractTemplateTypeMacro(vtkXMLLazyDataArray<Scalar>, vtkMappedDataArray<Scalar>)
+    vtkMappedDataArrayNewInstanceMacro(vtkXMLLazyDataArray<Scalar>) static vtkXMLLazyDataArray*
+    New();
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  typedef typename Superclass::ValueType ValueType;
+
+  /**
+   * Set the loader reading the values of this array. Only allowed before
+   * the array is loaded.
+   */
+  void SetLoader(vtkXMLLazyArrayLoader* loader);
+
+  /**
+   * Record a segment of the values of this array, read on the first access.
+   * Returns false if the array is already loaded.
+   */
+  bool AddSegment(const vtkXMLLazyArrayLoader::Segment& segment);
+
+  /**
+   * Return whether the values of the array have been read.
+   */
+  bool IsLoaded() const { return this->Loaded; }
+
+  /**
+   * Read the values of the array now, if they have not been read yet.
+   */
+  void Load() const;
+
+  // Reimplemented virtuals -- see superclasses for descriptions:
+  void Initialize() override;
+  void SetNumberOfComponents(int num) override;
+  void SetNumberOfTuples(vtkIdType number) override;
+  bool SetNumberOfValues(vtkIdType number) override;
+  void Squeeze() override;
+  unsigned long GetActualMemorySize() const override;
+  void* GetVoidPointer(vtkIdType id) override;
+  void* WriteVoidPointer(vtkIdType id, vtkIdType number) override;
+  void DataChanged() override {}
+  void GetTuples(vtkIdList* ptIds, vtkAbstractArray* output) override;
+  void GetTuples(vtkIdType p1, vtkIdType p2, vtkAbstractArray* output) override;
+  VTK_NEWINSTANCE vtkArrayIterator* NewIterator() override;
+  vtkIdType LookupValue(vtkVariant value) override;
+  void LookupValue(vtkVariant value, vtkIdList* ids) override;
+  vtkVariant GetVariantValue(vtkIdType idx) override;
+  void ClearLookup() override;
+  double* GetTuple(vtkIdType i) override;
+  void GetTuple(vtkIdType i, double* tuple) override;
+  vtkIdType LookupTypedValue(Scalar value) override;
+  void LookupTypedValue(Scalar value, vtkIdList* ids) override;
+  ValueType GetValue(vtkIdType idx) const override;
+  ValueType& GetValueReference(vtkIdType idx) override;
+  void GetTypedTuple(vtkIdType idx, Scalar* t) const override;
+  ValueType GetTypedComponent(vtkIdType tupleIdx, int comp) const override;
+  void SetTypedComponent(vtkIdType tupleIdx, int comp, ValueType v) override;
+  vtkTypeBool Allocate(vtkIdType sz, vtkIdType ext) override;
+  vtkTypeBool Resize(vtkIdType numTuples) override;
+  void SetTuple(vtkIdType i, vtkIdType j, vtkAbstractArray* source) override;
+  void SetTuple(vtkIdType i, const float* source) override;
+  void SetTuple(vtkIdType i, const double* source) override;
+  void InsertTuple(vtkIdType i, vtkIdType j, vtkAbstractArray* source) override;
+  void InsertTuple(vtkIdType i, const float* source) override;
+  void InsertTuple(vtkIdType i, const double* source) override;
+  void InsertTuples(vtkIdList* dstIds, vtkIdList* srcIds, vtkAbstractArray* source) override;
+  void InsertTuples(
+    vtkIdType dstStart, vtkIdType n, vtkIdType srcStart, vtkAbstractArray* source) override;
+  vtkIdType InsertNextTuple(vtkIdType j, vtkAbstractArray* source) override;
+  vtkIdType InsertNextTuple(const float* source) override;
+  vtkIdType InsertNextTuple(const double* source) override;
+  void DeepCopy(vtkAbstractArray* aa) override;
+  void DeepCopy(vtkDataArray* da) override;
+  void InterpolateTuple(
+    vtkIdType i, vtkIdList* ptIndices, vtkAbstractArray* source, double* weights) override;
+  void InterpolateTuple(vtkIdType i, vtkIdType id1, vtkAbstractArray* source1, vtkIdType id2,
+    vtkAbstractArray* source2, double t) override;
+  void SetVariantValue(vtkIdType idx, vtkVariant value) override;
+  void InsertVariantValue(vtkIdType idx, vtkVariant value) override;
+  void RemoveTuple(vtkIdType id) override;
+  void RemoveFirstTuple() override;
+  void RemoveLastTuple() override;
+  void SetTypedTuple(vtkIdType i, const Scalar* t) override;
+  void InsertTypedTuple(vtkIdType i, const Scalar* t) override;
+  vtkIdType InsertNextTypedTuple(const Scalar* t) override;
+  void SetValue(vtkIdType idx, Scalar value) override;
+  vtkIdType InsertNextValue(Scalar v) override;
+  void InsertValue(vtkIdType idx, Scalar v) override;
+
+protected:
+  vtkXMLLazyDataArray();
+  ~vtkXMLLazyDataArray() override;
+
+  // Load the values and return the internal array.
+  vtkAOSDataArrayTemplate<Scalar>* GetValues() const
+  {
+    if (!this->Loaded)
+    {
+      this->Load();
+    }
+    return this->Values;
+  }
+
+  // Copy the size of the internal array after it was modified.
+  void UpdateSize();
+
+  // Return the internal array instead of this array, to let it copy its own
+  // values with its fast path.
+  vtkAbstractArray* GetSource(vtkAbstractArray* source)
+  {
+    return source == this ? this->GetValues() : source;
+  }
+
+  vtkAOSDataArrayTemplate<Scalar>* Values;
+  vtkXMLLazyArrayLoader* Loader;
+  std::vector<vtkXMLLazyArrayLoader::Segment> Segments;
+  mutable std::atomic<bool> Loaded;
+  mutable std::mutex LoadMutex;
+
+private:
+  vtkXMLLazyDataArray(const vtkXMLLazyDataArray&) = delete;
+  void operator=(const vtkXMLLazyDataArray&) = delete;
+};
+
+#include "vtkXMLLazyDataArray.txx"
+
+#endif // vtkXMLLazyDataArray_h
+
+// VTK-HeaderTest-Exclude: vtkXMLLazyDataArray.h
@@ -0,0 +1,604 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkXMLLazyDataArray.txx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+
+#include "vtkXMLLazyDataArray.h"
+
+#include "vtkIdList.h"
+#include "vtkObjectFactory.h"
+#include "vtkVariant.h"
+
+//------------------------------------------------------------------------------
+// Can't use vtkStandardNewMacro on a templated class.
+template <class Scalar>
+vtkXMLLazyDataArray<Scalar>* vtkXMLLazyDataArray<Scalar>::New()
+{
+  VTK_STANDARD_NEW_BODY(vtkXMLLazyDataArray<Scalar>);
+}
+
+//------------------------------------------------------------------------------
+template <class Scalar>
+vtkXMLLazyDataArray<Scalar>::vtkXMLLazyDataArray()
+  : Values(nullptr)
+  , Loader(nullptr)
+  , Loaded(false)
+{
+}
+
+//------------------------------------------------------------------------------
+template <class Scalar>
+vtkXMLLazyDataArray<Scalar>::~vtkXMLLazyDataArray()
+{
+  if (this->Values)
+  {
+    this->Values->Delete();
+  }
+  if (this->Loader)
+  {
+    this->Loader->Delete();
+  }
+}
+
+//------------------------------------------------------------------------------
+template <class Scalar>
+void vtkXMLLazyDataArray<Scalar>::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->vtkXMLLazyDataArray<Scalar>::Superclass::PrintSelf(os, indent);
+  os << indent << "Loaded: " << this->IsLoaded() << "\n";
+  os << indent << "Number of segments: " << this->Segments.size() << "\n";
+  os << indent << "Loader: " << this->Loader << "\n";
+}
+
+//------------------------------------------------------------------------------
+template <class Scalar>
+void vtkXMLLazyDataArray<Scalar>::SetLoader(vtkXMLLazyArrayLoader* loader)
+{
+  if (this->Loaded)
+  {
+    vtkErrorMacro(<< "SetLoader() called on a loaded array.");
+    return;
+  }
+  if (loader == this->Loader)
+  {
+    return;
+  }
+  if (this->Loader)
+  {
+    this->Loader->Delete();
+  }
+  this->Loader = loader;
+  if (this->Loader)
+  {
+    this->Loader->Register(this);
+  }
+}
+
+//------------------------------------------------------------------------------
+template <class Scalar>
+bool vtkXMLLazyDataArray<Scalar>::AddSegment(const vtkXMLLazyArrayLoader::Segment& segment)
+{
+  if (this->Loaded)
+  {
+    return false;
+  }
+  this->Segments.push_back(segment);
+  return true;
+}
+
+//------------------------------------------------------------------------------
+template <class Scalar>
+void vtkXMLLazyDataArray<Scalar>::Load() const
+{
+  std::lock_guard<std::mutex> lock(this->LoadMutex);
+  if (this->Loaded)
+  {
+    return;
+  }
+  auto self = const_cast<vtkXMLLazyDataArray<Scalar>*>(this);
+
+  vtkAOSDataArrayTemplate<Scalar>* values = vtkAOSDataArrayTemplate<Scalar>::New();
+  values->SetNumberOfComponents(this->NumberOfComponents);
+  values->SetNumberOfValues(this->MaxId + 1);
+  if (!this->Segments.empty())
+  {
+    if (!this->Loader)
+    {
+      vtkErrorWithObjectMacro(self, << "No loader to read the values of the array.");
+      values->FillValue(0);
+    }
+    else if (!this->Loader->Load(values, this->Segments))
+    {
+      values->FillValue(0);
+    }
+  }
+
+  self->Values = values;
+  self->Segments.clear();
+  self->Segments.shrink_to_fit();
+  if (self->Loader)
+  {
+    self->Loader->Delete();
+    self->Loader = nullptr;
+  }
+  this->Loaded = true;
+}
+
+//------------------------------------------------------------------------------
+template <class Scalar>
+void vtkXMLLazyDataArray<Scalar>::UpdateSize()
+{
+  this->Size = this->Values->GetSize();
+  this->MaxId = this->Values->GetMaxId();
+}
+
+//------------------------------------------------------------------------------
+template <class Scalar>
+void vtkXMLLazyDataArray<Scalar>::Initialize()
+{
+  std::lock_guard<std::mutex> lock(this->LoadMutex);
+  if (!this->Values)
+  {
+    this->Values = vtkAOSDataArrayTemplate<Scalar>::New();
+  }
+  this->Values->SetNumberOfComponents(this->NumberOfComponents);
+  this->Values->Initialize();
+  this->Segments.clear();
+  if (this->Loader)
+  {
+    this->Loader->Delete();
+    this->Loader = nullptr;
+  }
+  this->Loaded = true;
+  this->UpdateSize();
+}
+
+//------------------------------------------------------------------------------
+template <class Scalar>
+void vtkXMLLazyDataArray<Scalar>::SetNumberOfComponents(int num)
+{
+  this->Superclass::SetNumberOfComponents(num);
+  if (this->Loaded)
+  {
+    this->Values->SetNumberOfComponents(this->NumberOfComponents);
+  }
+}
+
+//------------------------------------------------------------------------------
+template <class Scalar>
+void vtkXMLLazyDataArray<Scalar>::SetNumberOfTuples(vtkIdType number)
+{
+  this->SetNumberOfValues(number * this->NumberOfComponents);
+}
+
+//------------------------------------------------------------------------------
+template <class Scalar>
+bool vtkXMLLazyDataArray<Scalar>::SetNumberOfValues(vtkIdType number)
+{
+  if (!this->Loaded)
+  {
+    // Only the size is known until the values are read.
+    this->Size = number;
+    this->MaxId = number - 1;
+    return true;
+  }
+  bool result = this->Values->SetNumberOfValues(number);
+  this->UpdateSize();
+  return result;
+}
+
+//------------------------------------------------------------------------------
+template <class Scalar>
+void vtkXMLLazyDataArray<Scalar>::Squeeze()
+{
+  if (this->Loaded)
+  {
+    this->Values->Squeeze();
+    this->UpdateSize();
+  }
+}
+
+//------------------------------------------------------------------------------
+template <class Scalar>
+unsigned long vtkXMLLazyDataArray<Scalar>::GetActualMemorySize() const
+{
+  return this->Loaded ? this->Values->GetActualMemorySize() : 1;
+}
+
+//------------------------------------------------------------------------------
+template <class Scalar>
+void* vtkXMLLazyDataArray<Scalar>::GetVoidPointer(vtkIdType id)
+{
+  return this->GetValues()->GetVoidPointer(id);
+}
+
+//------------------------------------------------------------------------------
+template <class Scalar>
+void* vtkXMLLazyDataArray<Scalar>::WriteVoidPointer(vtkIdType id, vtkIdType number)
+{
+  void* result = this->GetValues()->WriteVoidPointer(id, number);
+  this->UpdateSize();
+  return result;
+}
+
+//------------------------------------------------------------------------------
+template <class Scalar>
+void vtkXMLLazyDataArray<Scalar>::GetTuples(vtkIdList* ptIds, vtkAbstractArray* output)
+{
+  this->GetValues()->GetTuples(ptIds, output);
+}
+
+//------------------------------------------------------------------------------
+template <class Scalar>
+void vtkXMLLazyDataArray<Scalar>::GetTuples(vtkIdType p1, vtkIdType p2, vtkAbstractArray* output)
+{
+  this->GetValues()->GetTuples(p1, p2, output);
+}
+
+//------------------------------------------------------------------------------
+template <class Scalar>
+vtkArrayIterator* vtkXMLLazyDataArray<Scalar>::NewIterator()
+{
+  return this->GetValues()->NewIterator();
+}
+
+//------------------------------------------------------------------------------
+template <class Scalar>
+vtkIdType vtkXMLLazyDataArray<Scalar>::LookupValue(vtkVariant value)
+{
+  return this->GetValues()->LookupValue(value);
+}
+
+//------------------------------------------------------------------------------
+template <class Scalar>
+void vtkXMLLazyDataArray<Scalar>::LookupValue(vtkVariant value, vtkIdList* ids)
+{
+  this->GetValues()->LookupValue(value, ids);
+}
+
+//------------------------------------------------------------------------------
+template <class Scalar>
+vtkVariant vtkXMLLazyDataArray<Scalar>::GetVariantValue(vtkIdType idx)
+{
+  return this->GetValues()->GetVariantValue(idx);
+}
+
+//------------------------------------------------------------------------------
+template <class Scalar>
+void vtkXMLLazyDataArray<Scalar>::ClearLookup()
+{
+  if (this->Loaded)
+  {
+    this->Values->ClearLookup();
+  }
+}
+
+//------------------------------------------------------------------------------
+template <class Scalar>
+double* vtkXMLLazyDataArray<Scalar>::GetTuple(vtkIdType i)
+{
+  return this->GetValues()->GetTuple(i);
+}
+
+//------------------------------------------------------------------------------
+template <class Scalar>
+void vtkXMLLazyDataArray<Scalar>::GetTuple(vtkIdType i, double* tuple)
+{
+  this->GetValues()->GetTuple(i, tuple);
+}
+
+//------------------------------------------------------------------------------
+template <class Scalar>
+vtkIdType vtkXMLLazyDataArray<Scalar>::LookupTypedValue(Scalar value)
+{
+  return this->GetValues()->LookupTypedValue(value);
+}
+
+//------------------------------------------------------------------------------
+template <class Scalar>
+void vtkXMLLazyDataArray<Scalar>::LookupTypedValue(Scalar value, vtkIdList* ids)
+{
+  this->GetValues()->LookupTypedValue(value, ids);
+}
+
+//------------------------------------------------------------------------------
+template <class Scalar>
+typename vtkXMLLazyDataArray<Scalar>::ValueType vtkXMLLazyDataArray<Scalar>::GetValue(
+  vtkIdType idx) const
+{
+  return this->GetValues()->GetValue(idx);
+}
+
+//------------------------------------------------------------------------------
+template <class Scalar>
+typename vtkXMLLazyDataArray<Scalar>::ValueType& vtkXMLLazyDataArray<Scalar>::GetValueReference(
+  vtkIdType idx)
+{
+  return *this->GetValues()->GetPointer(idx);
+}
+
+//------------------------------------------------------------------------------
+template <class Scalar>
+void vtkXMLLazyDataArray<Scalar>::GetTypedTuple(vtkIdType idx, Scalar* t) const
+{
+  this->GetValues()->GetTypedTuple(idx, t);
+}
+
+//------------------------------------------------------------------------------
+template <class Scalar>
+typename vtkXMLLazyDataArray<Scalar>::ValueType vtkXMLLazyDataArray<Scalar>::GetTypedComponent(
+  vtkIdType tupleIdx, int comp) const
+{
+  return this->GetValues()->GetTypedComponent(tupleIdx, comp);
+}
+
+//------------------------------------------------------------------------------
+template <class Scalar>
+void vtkXMLLazyDataArray<Scalar>::SetTypedComponent(vtkIdType tupleIdx, int comp, ValueType v)
+{
+  this->GetValues()->SetTypedComponent(tupleIdx, comp, v);
+}
+
+//------------------------------------------------------------------------------
+template <class Scalar>
+vtkTypeBool vtkXMLLazyDataArray<Scalar>::Allocate(vtkIdType sz, vtkIdType ext)
+{
+  vtkTypeBool result = this->GetValues()->Allocate(sz, ext);
+  this->UpdateSize();
+  return result;
+}
+
+//------------------------------------------------------------------------------
+template <class Scalar>
+vtkTypeBool vtkXMLLazyDataArray<Scalar>::Resize(vtkIdType numTuples)
+{
+  vtkTypeBool result = this->GetValues()->Resize(numTuples);
+  this->UpdateSize();
+  return result;
+}
+
+//------------------------------------------------------------------------------
+template <class Scalar>
+void vtkXMLLazyDataArray<Scalar>::SetTuple(vtkIdType i, vtkIdType j, vtkAbstractArray* source)
+{
+  this->GetValues()->SetTuple(i, j, this->GetSource(source));
+}
+
+//------------------------------------------------------------------------------
+template <class Scalar>
+void vtkXMLLazyDataArray<Scalar>::SetTuple(vtkIdType i, const float* source)
+{
+  this->GetValues()->SetTuple(i, source);
+}
+
+//------------------------------------------------------------------------------
+template <class Scalar>
+void vtkXMLLazyDataArray<Scalar>::SetTuple(vtkIdType i, const double* source)
+{
+  this->GetValues()->SetTuple(i, source);
+}
+
+//------------------------------------------------------------------------------
+template <class Scalar>
+void vtkXMLLazyDataArray<Scalar>::InsertTuple(vtkIdType i, vtkIdType j, vtkAbstractArray* source)
+{
+  this->GetValues()->InsertTuple(i, j, this->GetSource(source));
+  this->UpdateSize();
+}
+
+//------------------------------------------------------------------------------
+template <class Scalar>
+void vtkXMLLazyDataArray<Scalar>::InsertTuple(vtkIdType i, const float* source)
+{
+  this->GetValues()->InsertTuple(i, source);
+  this->UpdateSize();
+}
+
+//------------------------------------------------------------------------------
+template <class Scalar>
+void vtkXMLLazyDataArray<Scalar>::InsertTuple(vtkIdType i, const double* source)
+{
+  this->GetValues()->InsertTuple(i, source);
+  this->UpdateSize();
+}
+
+//------------------------------------------------------------------------------
+template <class Scalar>
+void vtkXMLLazyDataArray<Scalar>::InsertTuples(
+  vtkIdList* dstIds, vtkIdList* srcIds, vtkAbstractArray* source)
+{
+  this->GetValues()->InsertTuples(dstIds, srcIds, this->GetSource(source));
+  this->UpdateSize();
+}
+
+//------------------------------------------------------------------------------
+template <class Scalar>
+void vtkXMLLazyDataArray<Scalar>::InsertTuples(
+  vtkIdType dstStart, vtkIdType n, vtkIdType srcStart, vtkAbstractArray* source)
+{
+  this->GetValues()->InsertTuples(dstStart, n, srcStart, this->GetSource(source));
+  this->UpdateSize();
+}
+
+//------------------------------------------------------------------------------
+template <class Scalar>
+vtkIdType vtkXMLLazyDataArray<Scalar>::InsertNextTuple(vtkIdType j, vtkAbstractArray* source)
+{
+  vtkIdType result = this->GetValues()->InsertNextTuple(j, this->GetSource(source));
+  this->UpdateSize();
+  return result;
+}
+
+//------------------------------------------------------------------------------
+template <class Scalar>
+vtkIdType vtkXMLLazyDataArray<Scalar>::InsertNextTuple(const float* source)
+{
+  vtkIdType result = this->GetValues()->InsertNextTuple(source);
+  this->UpdateSize();
+  return result;
+}
+
+//------------------------------------------------------------------------------
+template <class Scalar>
+vtkIdType vtkXMLLazyDataArray<Scalar>::InsertNextTuple(const double* source)
+{
+  vtkIdType result = this->GetValues()->InsertNextTuple(source);
+  this->UpdateSize();
+  return result;
+}
+
+//------------------------------------------------------------------------------
+template <class Scalar>
+void vtkXMLLazyDataArray<Scalar>::DeepCopy(vtkAbstractArray* aa)
+{
+  if (!aa || aa == this)
+  {
+    return;
+  }
+
+  // Copying a lazy array loads it.
+  vtkAOSDataArrayTemplate<Scalar>* values = vtkAOSDataArrayTemplate<Scalar>::New();
+  values->DeepCopy(aa);
+  {
+    std::lock_guard<std::mutex> lock(this->LoadMutex);
+    if (this->Values)
+    {
+      this->Values->Delete();
+    }
+    this->Values = values;
+    this->Segments.clear();
+    if (this->Loader)
+    {
+      this->Loader->Delete();
+      this->Loader = nullptr;
+    }
+    this->Loaded = true;
+  }
+  this->vtkAbstractArray::DeepCopy(aa);
+  this->Superclass::SetNumberOfComponents(values->GetNumberOfComponents());
+  this->UpdateSize();
+  this->Modified();
+}
+
+//------------------------------------------------------------------------------
+template <class Scalar>
+void vtkXMLLazyDataArray<Scalar>::DeepCopy(vtkDataArray* da)
+{
+  this->DeepCopy(static_cast<vtkAbstractArray*>(da));
+}
+
+//------------------------------------------------------------------------------
+template <class Scalar>
+void vtkXMLLazyDataArray<Scalar>::InterpolateTuple(
+  vtkIdType i, vtkIdList* ptIndices, vtkAbstractArray* source, double* weights)
+{
+  this->GetValues()->InterpolateTuple(i, ptIndices, this->GetSource(source), weights);
+  this->UpdateSize();
+}
+
+//------------------------------------------------------------------------------
+template <class Scalar>
+void vtkXMLLazyDataArray<Scalar>::InterpolateTuple(vtkIdType i, vtkIdType id1,
+  vtkAbstractArray* source1, vtkIdType id2, vtkAbstractArray* source2, double t)
+{
+  this->GetValues()->InterpolateTuple(
+    i, id1, this->GetSource(source1), id2, this->GetSource(source2), t);
+  this->UpdateSize();
+}
+
+//------------------------------------------------------------------------------
+template <class Scalar>
+void vtkXMLLazyDataArray<Scalar>::SetVariantValue(vtkIdType idx, vtkVariant value)
+{
+  this->GetValues()->SetVariantValue(idx, value);
+}
+
+//------------------------------------------------------------------------------
+template <class Scalar>
+void vtkXMLLazyDataArray<Scalar>::InsertVariantValue(vtkIdType idx, vtkVariant value)
+{
+  this->GetValues()->InsertVariantValue(idx, value);
+  this->UpdateSize();
+}
+
+//------------------------------------------------------------------------------
+template <class Scalar>
+void vtkXMLLazyDataArray<Scalar>::RemoveTuple(vtkIdType id)
+{
+  this->GetValues()->RemoveTuple(id);
+  this->UpdateSize();
+}
+
+//------------------------------------------------------------------------------
+template <class Scalar>
+void vtkXMLLazyDataArray<Scalar>::RemoveFirstTuple()
+{
+  this->GetValues()->RemoveFirstTuple();
+  this->UpdateSize();
+}
+
+//------------------------------------------------------------------------------
+template <class Scalar>
+void vtkXMLLazyDataArray<Scalar>::RemoveLastTuple()
+{
+  this->GetValues()->RemoveLastTuple();
+  this->UpdateSize();
+}
+
+//------------------------------------------------------------------------------
+template <class Scalar>
+void vtkXMLLazyDataArray<Scalar>::SetTypedTuple(vtkIdType i, const Scalar* t)
+{
+  this->GetValues()->SetTypedTuple(i, t);
+}
+
+//------------------------------------------------------------------------------
+template <class Scalar>
+void vtkXMLLazyDataArray<Scalar>::InsertTypedTuple(vtkIdType i, const Scalar* t)
+{
+  this->GetValues()->InsertTypedTuple(i, t);
+  this->UpdateSize();
+}
+
+//------------------------------------------------------------------------------
+template <class Scalar>
+vtkIdType vtkXMLLazyDataArray<Scalar>::InsertNextTypedTuple(const Scalar* t)
+{
+  vtkIdType result = this->GetValues()->InsertNextTypedTuple(t);
+  this->UpdateSize();
+  return result;
+}
+
+//------------------------------------------------------------------------------
+template <class Scalar>
+void vtkXMLLazyDataArray<Scalar>::SetValue(vtkIdType idx, Scalar value)
+{
+  this->GetValues()->SetValue(idx, value);
+}
+
+//------------------------------------------------------------------------------
+template <class Scalar>
+vtkIdType vtkXMLLazyDataArray<Scalar>::InsertNextValue(Scalar v)
+{
+  vtkIdType result = this->GetValues()->InsertNextValue(v);
+  this->UpdateSize();
+  return result;
+}
+
+//------------------------------------------------------------------------------
+template <class Scalar>
+void vtkXMLLazyDataArray<Scalar>::InsertValue(vtkIdType idx, Scalar v)
+{
+  this->GetValues()->InsertValue(idx, v);
+  this->UpdateSize();
+}
@@ -22,6 +22,7 @@
 #include "vtkUnsignedCharArray.h"
 #include "vtkXMLDataElement.h"
 
+#include <algorithm>
 #include <cassert>
 
 vtkStandardNewMacro(vtkXMLPolyDataReader);
@@ -477,3 +478,34 @@ int vtkXMLPolyDataReader::FillOutputPortInformation(int, vtkInformation* info)
   info->Set(vtkDataObject::DATA_TYPE_NAME(), "vtkPolyData");
   return 1;
 }
+
+//------------------------------------------------------------------------------
+void vtkXMLPolyDataReader::ReusePreviousMesh(bool reuse)
+{
+  this->Superclass::ReusePreviousMesh(reuse);
+
+  vtkPolyData* output = vtkPolyData::SafeDownCast(this->GetCurrentOutput());
+  if (!reuse || !output)
+  {
+    std::fill(this->PreviousCells, this->PreviousCells + 4, nullptr);
+    return;
+  }
+  vtkCellArray* cells[4] = { output->GetVerts(), output->GetLines(), output->GetStrips(),
+    output->GetPolys() };
+  bool same = true;
+  for (int i = 0; i < 4 && same; ++i)
+  {
+    same = this->PreviousCells[i] && HaveSameValues(this->PreviousCells[i], cells[i]);
+  }
+  if (same)
+  {
+    output->SetVerts(this->PreviousCells[0]);
+    output->SetLines(this->PreviousCells[1]);
+    output->SetStrips(this->PreviousCells[2]);
+    output->SetPolys(this->PreviousCells[3]);
+  }
+  else
+  {
+    std::copy(cells, cells + 4, this->PreviousCells);
+  }
+}
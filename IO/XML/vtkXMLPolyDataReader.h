@@ -83,6 +83,8 @@ protected:
 
   int FillOutputPortInformation(int, vtkInformation*) override;
 
+  void ReusePreviousMesh(bool reuse) override;
+
   // The size of the UpdatePiece.
   int TotalNumberOfVerts;
   int TotalNumberOfLines;
@@ -113,6 +115,10 @@ protected:
   int PolysTimeStep;
   unsigned long PolysOffset;
 
+  // The verts, lines, strips and polys of the previous execution, see
+  // ReuseUnchangedMesh.
+  vtkSmartPointer<vtkCellArray> PreviousCells[4];
+
 private:
   vtkXMLPolyDataReader(const vtkXMLPolyDataReader&) = delete;
   void operator=(const vtkXMLPolyDataReader&) = delete;
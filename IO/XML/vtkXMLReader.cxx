@@ -38,11 +38,14 @@
 #include "vtkLZMADataCompressor.h"
 #include "vtkObjectFactory.h"
 #include "vtkQuadratureSchemeDefinition.h"
+#include "vtkShuffleDataCompressor.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkStringArray.h"
 #include "vtkXMLDataElement.h"
 #include "vtkXMLDataParser.h"
 #include "vtkXMLFileReadTester.h"
+#include "vtkXMLLazyArrayLoader.h"
+#include "vtkXMLLazyDataArray.h"
 #include "vtkXMLReaderVersion.h"
 #include "vtkZLibDataCompressor.h"
 
@@ -140,6 +143,8 @@ vtkXMLReader::vtkXMLReader()
   this->StringStream = nullptr;
   this->ReadFromInputString = 0;
   this->InputString = "";
+  this->LazyArrayLoading = false;
+  this->LazyArrayLoader = nullptr;
   this->XMLParser = nullptr;
   this->ReaderErrorObserver = nullptr;
   this->ParserErrorObserver = nullptr;
@@ -198,6 +203,10 @@ vtkXMLReader::~vtkXMLReader()
     this->DestroyXMLParser();
   }
   this->CloseStream();
+  if (this->LazyArrayLoader)
+  {
+    this->LazyArrayLoader->Delete();
+  }
   this->CellDataArraySelection->RemoveObserver(this->SelectionObserver);
   this->PointDataArraySelection->RemoveObserver(this->SelectionObserver);
   this->ColumnArraySelection->RemoveObserver(this->SelectionObserver);
@@ -235,6 +244,7 @@ void vtkXMLReader::PrintSelf(ostream& os, vtkIndent indent)
   {
     os << indent << "Stream: (none)\n";
   }
+  os << indent << "LazyArrayLoading: " << this->LazyArrayLoading << "\n";
   os << indent << "TimeStep:" << this->TimeStep << "\n";
   os << indent << "ActiveTimeDataArrayName:"
      << (this->ActiveTimeDataArrayName ? this->ActiveTimeDataArrayName : "(null)") << "\n";
@@ -460,6 +470,10 @@ void vtkXMLReader::SetupCompressor(const char* type)
     {
       compressor = vtkLZMADataCompressor::New();
     }
+    else if (strcmp(type, "vtkShuffleDataCompressor") == 0)
+    {
+      compressor = vtkShuffleDataCompressor::New();
+    }
   }
 
   if (!compressor)
@@ -686,6 +700,13 @@ int vtkXMLReader::RequestData(vtkInformation* vtkNotUsed(request),
   float wholeProgressRange[2] = { 0.f, 1.f };
   this->SetProgressRange(wholeProgressRange, 0, 1);
 
+  // The lazy arrays of a previous execution keep their own loader.
+  if (this->LazyArrayLoader)
+  {
+    this->LazyArrayLoader->Delete();
+    this->LazyArrayLoader = nullptr;
+  }
+
   if (!this->InformationError)
   {
     // We are just starting to execute.  No errors have yet occurred.
@@ -902,6 +923,24 @@ int vtkXMLDataReaderReadArrayValues(vtkXMLDataElement* da, vtkXMLDataParser* xml
   return result;
 }
 
+//------------------------------------------------------------------------------
+template <class T>
+bool vtkXMLReaderAddLazySegment(
+  vtkAbstractArray* array, const vtkXMLLazyArrayLoader::Segment& segment)
+{
+  vtkXMLLazyDataArray<T>* lazyArray = vtkXMLLazyDataArray<T>::SafeDownCast(array);
+  return lazyArray && lazyArray->AddSegment(segment);
+}
+
+//------------------------------------------------------------------------------
+template <class T>
+vtkAbstractArray* vtkXMLReaderNewLazyArray(vtkXMLLazyArrayLoader* loader)
+{
+  vtkXMLLazyDataArray<T>* lazyArray = vtkXMLLazyDataArray<T>::New();
+  lazyArray->SetLoader(loader);
+  return lazyArray;
+}
+
 }
 
 //------------------------------------------------------------------------------
@@ -913,15 +952,39 @@ int vtkXMLReader::ReadArrayValues(vtkXMLDataElement* da, vtkIdType arrayIndex,
   {
     return 0;
   }
-  this->InReadData = 1;
-  int result;
-  vtkArrayIterator* iter = array->NewIterator();
   if (arrayIndex + numValues > array->GetNumberOfValues())
   {
     vtkErrorMacro("Array has " << array->GetNumberOfValues() << " allocated elements, but "
                                << arrayIndex + numValues << " were requested to be read");
     return 0;
   }
+
+  // The values of lazy arrays are only located here, and read on their
+  // first access.
+  vtkTypeInt64 offset = 0;
+  if (array->GetArrayType() == vtkAbstractArray::MappedDataArray &&
+    da->GetScalarAttribute("offset", offset))
+  {
+    vtkXMLLazyArrayLoader::Segment segment;
+    segment.Offset = offset;
+    segment.StartWord = static_cast<vtkTypeUInt64>(startIndex);
+    segment.NumberOfWords = static_cast<size_t>(numValues);
+    segment.ArrayIndex = arrayIndex;
+    bool located = false;
+    switch (array->GetDataType())
+    {
+      vtkTemplateMacro(located = vtkXMLReaderAddLazySegment<VTK_TT>(array, segment));
+    }
+    if (located)
+    {
+      array->Modified();
+      return 1;
+    }
+  }
+
+  this->InReadData = 1;
+  int result;
+  vtkArrayIterator* iter = array->NewIterator();
   switch (array->GetDataType())
   {
     vtkArrayIteratorTemplateMacro(result = vtkXMLDataReaderReadArrayValues(da, this->XMLParser,
@@ -1428,7 +1491,35 @@ int vtkXMLReader::GetLocalDataType(vtkXMLDataElement* da, int dataType)
 }
 
 //------------------------------------------------------------------------------
-vtkAbstractArray* vtkXMLReader::CreateArray(vtkXMLDataElement* da)
+bool vtkXMLReader::CanReadArrayLazily(vtkXMLDataElement* da)
+{
+  // The lazy arrays read the appended data of the file again, and are
+  // filled in place: time steps reuse the arrays and the ghost arrays of old
+  // files are converted while they are read.
+  if (!this->LazyArrayLoading || this->ReadFromInputString || !this->FileName ||
+    !this->FileStream || this->NumberOfTimeSteps > 0 || !da->GetAttribute("offset") ||
+    da->GetAttribute("IdType") || da->GetAttribute("TimeStep"))
+  {
+    return false;
+  }
+  const char* name = da->GetAttribute("Name");
+  if (name &&
+    (strcmp(name, vtkDataSetAttributes::GhostArrayName()) == 0 ||
+      (this->GetFileMajorVersion() < 2 && strcmp(name, "vtkGhostLevels") == 0)))
+  {
+    return false;
+  }
+  int dataType = 0;
+  if (!da->GetWordTypeAttribute("type", dataType))
+  {
+    return false;
+  }
+  // Only the numeric arrays are read lazily.
+  return dataType != VTK_BIT && dataType != VTK_STRING;
+}
+
+//------------------------------------------------------------------------------
+vtkAbstractArray* vtkXMLReader::CreateArray(vtkXMLDataElement* da, bool lazy)
 {
   int dataType = 0;
   if (!da->GetWordTypeAttribute("type", dataType))
@@ -1437,7 +1528,27 @@ vtkAbstractArray* vtkXMLReader::CreateArray(vtkXMLDataElement* da)
   }
 
   dataType = this->GetLocalDataType(da, dataType);
-  vtkAbstractArray* array = vtkAbstractArray::CreateArray(dataType);
+  if (lazy && !this->LazyArrayLoader)
+  {
+    this->LazyArrayLoader = vtkXMLLazyArrayLoader::New();
+    if (!this->LazyArrayLoader->Initialize(this->FileName, this->XMLParser->GetCompressor()))
+    {
+      this->LazyArrayLoader->Delete();
+      this->LazyArrayLoader = nullptr;
+    }
+  }
+  vtkAbstractArray* array = nullptr;
+  if (lazy && this->LazyArrayLoader)
+  {
+    switch (dataType)
+    {
+      vtkTemplateMacro(array = vtkXMLReaderNewLazyArray<VTK_TT>(this->LazyArrayLoader));
+    }
+  }
+  if (!array)
+  {
+    array = vtkAbstractArray::CreateArray(dataType);
+  }
 
   array->SetName(da->GetAttribute("Name"));
 
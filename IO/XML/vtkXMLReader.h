@@ -42,6 +42,7 @@ class vtkXMLDataParser;
 class vtkInformationVector;
 class vtkInformation;
 class vtkStringArray;
+class vtkXMLLazyArrayLoader;
 
 class VTKIOXML_EXPORT vtkXMLReader : public vtkAlgorithm
 {
@@ -74,6 +75,22 @@ public:
   void SetInputString(const std::string& s) { this->InputString = s; }
   ///@}
 
+  ///@{
+  /**
+   * When on, the point and cell data arrays stored in the appended data of
+   * a file are not read by RequestData(): they are created as
+   * vtkXMLLazyDataArray instances, which read and uncompress their values
+   * from the file on their first access. The file must not change while
+   * such arrays are in use. Arrays of files with time steps, inline
+   * arrays, bit and string arrays, id arrays and ghost arrays are still
+   * read by RequestData(), as are all arrays when reading from a string.
+   * Off by default.
+   */
+  vtkSetMacro(LazyArrayLoading, bool);
+  vtkGetMacro(LazyArrayLoading, bool);
+  vtkBooleanMacro(LazyArrayLoading, bool);
+  ///@}
+
   /**
    * Test whether the file (type) with the given name can be read by this
    * reader. If the file has a newer version than the reader, we still say
@@ -242,8 +259,10 @@ protected:
   int GetLocalDataType(vtkXMLDataElement* da, int datatype);
 
   // Create a vtkAbstractArray from its cooresponding XML representation.
-  // Does not allocate.
-  vtkAbstractArray* CreateArray(vtkXMLDataElement* da);
+  // Does not allocate. With lazy, which requires CanReadArrayLazily(da),
+  // creates a vtkXMLLazyDataArray whose values ReadArrayValues() will only
+  // locate.
+  vtkAbstractArray* CreateArray(vtkXMLDataElement* da, bool lazy = false);
 
   // Create a vtkInformationKey from its corresponding XML representation.
   // Stores it in the instance of vtkInformationProvided. Does not allocate.
@@ -327,6 +346,12 @@ protected:
    */
   void MarkIdTypeArrays(vtkXMLDataElement* da);
 
+  /**
+   * Return whether the data array of the given element can be created by
+   * CreateArray() as a vtkXMLLazyDataArray, see LazyArrayLoading.
+   */
+  bool CanReadArrayLazily(vtkXMLDataElement* da);
+
   // The vtkXMLDataParser instance used to hide XML reading details.
   vtkXMLDataParser* XMLParser;
 
@@ -343,6 +368,12 @@ protected:
   // Default is 0: read from file.
   vtkTypeBool ReadFromInputString;
 
+  // Whether the appended data arrays are read on their first access.
+  bool LazyArrayLoading;
+
+  // The loader shared by the lazy arrays of the current execution.
+  vtkXMLLazyArrayLoader* LazyArrayLoader;
+
   // The input string.
   std::string InputString;
 
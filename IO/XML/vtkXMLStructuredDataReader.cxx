@@ -453,7 +453,9 @@ int vtkXMLStructuredDataReader::ReadSubExtent(int* inExtent, int* inDimensions,
   }
   else
   {
-    if (!this->WholeSlices)
+    // Lazy arrays only locate their rows: copying the rows of whole slices
+    // into them would read them.
+    if (!this->WholeSlices || array->GetArrayType() == vtkAbstractArray::MappedDataArray)
     {
       // Read a row at a time.  Split progress range by row.
       float progressRange[2] = { 0.f, 0.f };
@@ -29,6 +29,7 @@
 #include "vtkXMLDataElement.h"
 
 #include <cassert>
+#include <cstring>
 #include <tuple>
 #include <utility>
 
@@ -74,6 +75,8 @@ vtkXMLUnstructuredDataReader::vtkXMLUnstructuredDataReader()
 
   this->PointsTimeStep = -1; // invalid state
   this->PointsOffset = static_cast<unsigned long>(-1);
+
+  this->ReuseUnchangedMesh = false;
 }
 
 //------------------------------------------------------------------------------
@@ -89,6 +92,7 @@ vtkXMLUnstructuredDataReader::~vtkXMLUnstructuredDataReader()
 void vtkXMLUnstructuredDataReader::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "ReuseUnchangedMesh: " << (this->ReuseUnchangedMesh ? "On" : "Off") << endl;
 }
 
 //------------------------------------------------------------------------------
@@ -238,6 +242,7 @@ void vtkXMLUnstructuredDataReader::ReadXMLData()
   // If there are no data to read, stop now.
   if (this->StartPiece == this->EndPiece)
   {
+    this->ReusePreviousMesh(false);
     return;
   }
 
@@ -288,6 +293,61 @@ void vtkXMLUnstructuredDataReader::ReadXMLData()
   }
 
   delete[] fractions;
+
+  this->ReusePreviousMesh(this->ReuseUnchangedMesh && !this->AbortExecute && !this->DataError);
+}
+
+//------------------------------------------------------------------------------
+void vtkXMLUnstructuredDataReader::ReusePreviousMesh(bool reuse)
+{
+  vtkPointSet* output = vtkPointSet::SafeDownCast(this->GetCurrentOutput());
+  vtkPoints* points = output ? output->GetPoints() : nullptr;
+  if (!reuse || !points)
+  {
+    this->PreviousPoints = nullptr;
+  }
+  else if (this->PreviousPoints &&
+    vtkXMLUnstructuredDataReader::HaveSameValues(
+      this->PreviousPoints->GetData(), points->GetData()))
+  {
+    output->SetPoints(this->PreviousPoints);
+  }
+  else
+  {
+    this->PreviousPoints = points;
+  }
+}
+
+//------------------------------------------------------------------------------
+bool vtkXMLUnstructuredDataReader::HaveSameValues(vtkDataArray* array1, vtkDataArray* array2)
+{
+  if (!array1 || !array2)
+  {
+    return array1 == array2;
+  }
+  if (array1->GetDataType() != array2->GetDataType() ||
+    array1->GetNumberOfComponents() != array2->GetNumberOfComponents() ||
+    array1->GetNumberOfValues() != array2->GetNumberOfValues() ||
+    !array1->HasStandardMemoryLayout() || !array2->HasStandardMemoryLayout())
+  {
+    return false;
+  }
+  return array1->GetNumberOfValues() == 0 ||
+    memcmp(array1->GetVoidPointer(0), array2->GetVoidPointer(0),
+      array1->GetNumberOfValues() * array1->GetDataTypeSize()) == 0;
+}
+
+//------------------------------------------------------------------------------
+bool vtkXMLUnstructuredDataReader::HaveSameValues(vtkCellArray* cells1, vtkCellArray* cells2)
+{
+  if (!cells1 || !cells2)
+  {
+    return cells1 == cells2;
+  }
+  return vtkXMLUnstructuredDataReader::HaveSameValues(
+           cells1->GetOffsetsArray(), cells2->GetOffsetsArray()) &&
+    vtkXMLUnstructuredDataReader::HaveSameValues(
+      cells1->GetConnectivityArray(), cells2->GetConnectivityArray());
 }
 
 //------------------------------------------------------------------------------
@@ -19,6 +19,11 @@
  * vtkXMLUnstructuredDataReader provides functionality common to all
  * unstructured data format readers.
  *
+ * With ReuseUnchangedMesh on, the points and cells of the output are the
+ * objects of the previous execution whenever their values did not change,
+ * so that the mesh MTime of the output (see vtkDataSet::GetMeshMTime())
+ * tells downstream filters that only the attributes changed.
+ *
  * @sa
  * vtkXMLPolyDataReader vtkXMLUnstructuredGridReader
  */
@@ -26,11 +31,13 @@
 #ifndef vtkXMLUnstructuredDataReader_h
 #define vtkXMLUnstructuredDataReader_h
 
-#include "vtkIOXMLModule.h" // For export macro
+#include "vtkIOXMLModule.h"  // For export macro
+#include "vtkSmartPointer.h" // For PreviousPoints
 #include "vtkXMLDataReader.h"
 
 class vtkCellArray;
 class vtkIdTypeArray;
+class vtkPoints;
 class vtkPointSet;
 class vtkUnsignedCharArray;
 
@@ -55,6 +62,21 @@ public:
    */
   virtual vtkIdType GetNumberOfPieces();
 
+  ///@{
+  /**
+   * When on, the points and cells read are compared with those of the
+   * previous execution, and replaced by the objects of the previous
+   * execution when their values are the same. The mesh MTime of the output
+   * then does not change for a static mesh with time-varying attributes,
+   * and filters such as vtkGeometryFilter with MeshCaching on only remap
+   * the attributes. The mesh of the last execution is kept in memory, even
+   * when the output is released. Off by default.
+   */
+  vtkSetMacro(ReuseUnchangedMesh, bool);
+  vtkGetMacro(ReuseUnchangedMesh, bool);
+  vtkBooleanMacro(ReuseUnchangedMesh, bool);
+  ///@}
+
   /**
    * Setup the reader as if the given update extent were requested by
    * its output.  This can be used after an UpdateInformation to
@@ -132,6 +154,19 @@ protected:
   int CellsNeedToReadTimeStep(
     vtkXMLDataElement* eNested, int& cellstimestep, unsigned long& cellsoffset);
 
+  // Replace the mesh of the output by that of the previous execution when
+  // their values are the same, and keep the mesh of the output for the next
+  // execution. When reuse is false, only forget the previous mesh.
+  virtual void ReusePreviousMesh(bool reuse);
+
+  // Compare the values of arrays with the standard memory layout, or of
+  // cell arrays. Two null arrays are the same.
+  static bool HaveSameValues(vtkDataArray* array1, vtkDataArray* array2);
+  static bool HaveSameValues(vtkCellArray* cells1, vtkCellArray* cells2);
+
+  bool ReuseUnchangedMesh;
+  vtkSmartPointer<vtkPoints> PreviousPoints;
+
 private:
   vtkXMLUnstructuredDataReader(const vtkXMLUnstructuredDataReader&) = delete;
   void operator=(const vtkXMLUnstructuredDataReader&) = delete;
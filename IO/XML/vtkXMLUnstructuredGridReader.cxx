@@ -371,3 +371,33 @@ int vtkXMLUnstructuredGridReader::FillOutputPortInformation(int, vtkInformation*
   info->Set(vtkDataObject::DATA_TYPE_NAME(), "vtkUnstructuredGrid");
   return 1;
 }
+
+//------------------------------------------------------------------------------
+void vtkXMLUnstructuredGridReader::ReusePreviousMesh(bool reuse)
+{
+  this->Superclass::ReusePreviousMesh(reuse);
+
+  vtkUnstructuredGrid* output = vtkUnstructuredGrid::SafeDownCast(this->GetCurrentOutput());
+  if (!reuse || !output || !output->GetCells())
+  {
+    this->PreviousCells = nullptr;
+    this->PreviousCellTypes = nullptr;
+    this->PreviousFaces = nullptr;
+    this->PreviousFaceLocations = nullptr;
+  }
+  else if (this->PreviousCells && HaveSameValues(this->PreviousCells, output->GetCells()) &&
+    HaveSameValues(this->PreviousCellTypes, output->GetCellTypesArray()) &&
+    HaveSameValues(this->PreviousFaces, output->GetFaces()) &&
+    HaveSameValues(this->PreviousFaceLocations, output->GetFaceLocations()))
+  {
+    output->SetCells(this->PreviousCellTypes, this->PreviousCells, this->PreviousFaceLocations,
+      this->PreviousFaces);
+  }
+  else
+  {
+    this->PreviousCells = output->GetCells();
+    this->PreviousCellTypes = output->GetCellTypesArray();
+    this->PreviousFaces = output->GetFaces();
+    this->PreviousFaceLocations = output->GetFaceLocations();
+  }
+}
@@ -34,6 +34,7 @@
 
 class vtkUnstructuredGrid;
 class vtkIdTypeArray;
+class vtkUnsignedCharArray;
 
 class VTKIOXML_EXPORT vtkXMLUnstructuredGridReader : public vtkXMLUnstructuredDataReader
 {
@@ -74,6 +75,8 @@ protected:
 
   int FillOutputPortInformation(int, vtkInformation*) override;
 
+  void ReusePreviousMesh(bool reuse) override;
+
   // The index of the cell in the output where the current piece
   // begins.
   vtkIdType StartCell;
@@ -85,6 +88,12 @@ protected:
   int CellsTimeStep;
   unsigned long CellsOffset;
 
+  // The cells of the previous execution, see ReuseUnchangedMesh.
+  vtkSmartPointer<vtkCellArray> PreviousCells;
+  vtkSmartPointer<vtkUnsignedCharArray> PreviousCellTypes;
+  vtkSmartPointer<vtkIdTypeArray> PreviousFaces;
+  vtkSmartPointer<vtkIdTypeArray> PreviousFaceLocations;
+
 private:
   vtkXMLUnstructuredGridReader(const vtkXMLUnstructuredGridReader&) = delete;
   void operator=(const vtkXMLUnstructuredGridReader&) = delete;
@@ -43,6 +43,9 @@
 #include "vtkOutputStream.h"
 #include "vtkPointData.h"
 #include "vtkPoints.h"
+#include "vtkSMPTools.h"
+#include "vtkShuffleDataCompressor.h"
+#include "vtkSmartPointer.h"
 #include "vtkStdString.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkUnsignedCharArray.h"
@@ -63,9 +66,11 @@
 #include "vtksys/FStream.hxx"
 #include <memory>
 
+#include <algorithm>
 #include <cassert>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #if !defined(_WIN32) || defined(__CYGWIN__)
 #include <unistd.h> /* unlink */
@@ -441,6 +446,17 @@ int vtkXMLWriterWriteBinaryDataBlocks(vtkXMLWriter* writer,
 } // end anon namespace
 //*****************************************************************************
 
+//------------------------------------------------------------------------------
+// Copies of the blocks of an array waiting to be compressed, in the order
+// they are written. The buffers are reused from one window to the next.
+class vtkXMLWriterCompressionBlocks
+{
+public:
+  std::vector<std::vector<unsigned char>> Blocks;
+  vtkIdType NumberOfBlocks = 0;
+  vtkIdType MaximumNumberOfBlocks = 1;
+};
+
 //------------------------------------------------------------------------------
 vtkXMLWriter::vtkXMLWriter()
 {
@@ -453,6 +469,7 @@ vtkXMLWriter::vtkXMLWriter()
   this->CompressionHeader = nullptr;
   this->Int32IdTypeBuffer = nullptr;
   this->ByteSwapBuffer = nullptr;
+  this->PendingCompressionBlocks = new vtkXMLWriterCompressionBlocks;
 
   this->AppendedDataPosition = 0;
   this->ProgressRange[0] = 0;
@@ -482,6 +499,7 @@ vtkXMLWriter::~vtkXMLWriter()
   this->OutStringStream = nullptr;
   delete this->FieldDataOM;
   delete[] this->NumberOfTimeValues;
+  delete this->PendingCompressionBlocks;
 }
 
 //------------------------------------------------------------------------------
@@ -1003,6 +1021,16 @@ int vtkXMLWriter::WriteBinaryData(vtkAbstractArray* a)
 
   if (this->Compressor)
   {
+    // A shuffling compressor needs the format of the words written.
+    vtkShuffleDataCompressor* shuffle = vtkShuffleDataCompressor::SafeDownCast(this->Compressor);
+    if (shuffle)
+    {
+      const int wordSize =
+        wordType == VTK_BIT ? 1 : static_cast<int>(this->GetOutputWordTypeSize(wordType));
+      const bool isInteger = a->IsNumeric() && wordType != VTK_FLOAT && wordType != VTK_DOUBLE;
+      shuffle->SetWordFormat(wordSize, isInteger, this->ByteOrder == vtkXMLWriter::BigEndian);
+    }
+
     // Need to compress the data.  Create compression header.  This
     // reserves enough space in the output.
     if (!this->CreateCompressionHeader(dataSize))
@@ -1018,6 +1046,12 @@ int vtkXMLWriter::WriteBinaryData(vtkAbstractArray* a)
       result = 0;
     }
 
+    // Compress and write the blocks still waiting.
+    if (result && !this->WritePendingCompressionBlocks())
+    {
+      result = 0;
+    }
+
     // Finish writing the data.
     if (result && !this->DataStream->EndWriting())
     {
@@ -1374,14 +1408,97 @@ int vtkXMLWriter::CreateCompressionHeader(size_t size)
   // Initialize counter for block writing.
   this->CompressionBlockNumber = 0;
 
+  // Compress up to a few blocks per thread at once, unless the blocks are
+  // compressed sequentially.
+  int numThreads = this->NumberOfCompressionThreads;
+  if (numThreads == 0)
+  {
+    numThreads = vtkSMPTools::GetEstimatedNumberOfThreads();
+  }
+  const size_t windowSize = numThreads > 1 ? 4 * static_cast<size_t>(numThreads) : 1;
+  this->PendingCompressionBlocks->NumberOfBlocks = 0;
+  this->PendingCompressionBlocks->MaximumNumberOfBlocks =
+    static_cast<vtkIdType>(std::max<size_t>(std::min(numBlocks, windowSize), 1));
+
   return result;
 }
 
 //------------------------------------------------------------------------------
 int vtkXMLWriter::WriteCompressionBlock(unsigned char* data, size_t size)
 {
-  // Compress the data.
-  vtkUnsignedCharArray* outputArray = this->Compressor->Compress(data, size);
+  vtkXMLWriterCompressionBlocks* pending = this->PendingCompressionBlocks;
+  if (pending->MaximumNumberOfBlocks <= 1)
+  {
+    // Compress and write the data now.
+    vtkSmartPointer<vtkUnsignedCharArray> outputArray;
+    outputArray.TakeReference(this->Compressor->Compress(data, size));
+    return this->WriteCompressedBlock(outputArray);
+  }
+
+  // Copy the data, whose buffer is reused for the next block, and compress
+  // the blocks once the window is full.
+  if (static_cast<size_t>(pending->NumberOfBlocks) >= pending->Blocks.size())
+  {
+    pending->Blocks.resize(pending->NumberOfBlocks + 1);
+  }
+  pending->Blocks[pending->NumberOfBlocks++].assign(data, data + size);
+  if (pending->NumberOfBlocks < pending->MaximumNumberOfBlocks)
+  {
+    return 1;
+  }
+  return this->WritePendingCompressionBlocks();
+}
+
+//------------------------------------------------------------------------------
+int vtkXMLWriter::WritePendingCompressionBlocks()
+{
+  vtkXMLWriterCompressionBlocks* pending = this->PendingCompressionBlocks;
+  const vtkIdType numBlocks = pending->NumberOfBlocks;
+  pending->NumberOfBlocks = 0;
+  if (numBlocks == 0)
+  {
+    return 1;
+  }
+
+  // The blocks are independent: compress them concurrently, then write
+  // them in order.
+  std::vector<vtkSmartPointer<vtkUnsignedCharArray>> outputArrays(numBlocks);
+  vtkDataCompressor* compressor = this->Compressor;
+  auto compress = [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      const std::vector<unsigned char>& block = pending->Blocks[i];
+      outputArrays[i].TakeReference(compressor->Compress(block.data(), block.size()));
+    }
+  };
+  if (this->NumberOfCompressionThreads > 0)
+  {
+    vtkSMPTools::ScopeWithMaxThread(
+      this->NumberOfCompressionThreads, [&]() { vtkSMPTools::For(0, numBlocks, 1, compress); });
+  }
+  else
+  {
+    vtkSMPTools::For(0, numBlocks, 1, compress);
+  }
+
+  for (vtkIdType i = 0; i < numBlocks; ++i)
+  {
+    if (!this->WriteCompressedBlock(outputArrays[i]))
+    {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+int vtkXMLWriter::WriteCompressedBlock(vtkUnsignedCharArray* outputArray)
+{
+  if (!outputArray)
+  {
+    vtkErrorMacro("Failed to compress block " << this->CompressionBlockNumber << ".");
+    return 0;
+  }
 
   // Find the compressed size.
   size_t outputSize = outputArray->GetNumberOfTuples();
@@ -1398,8 +1515,6 @@ int vtkXMLWriter::WriteCompressionBlock(unsigned char* data, size_t size)
   // Store the resulting compressed size in the compression header.
   this->CompressionHeader->Set(3 + this->CompressionBlockNumber++, outputSize);
 
-  outputArray->Delete();
-
   return result;
 }
 
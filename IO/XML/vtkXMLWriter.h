@@ -51,7 +51,9 @@ class vtkOutputStream;
 class vtkPointData;
 class vtkPoints;
 class vtkFieldData;
+class vtkUnsignedCharArray;
 class vtkXMLDataHeader;
+class vtkXMLWriterCompressionBlocks;
 
 class vtkStdString;
 class OffsetsManager;      // one per piece/per time
@@ -139,6 +141,9 @@ protected:
   vtkXMLDataHeader* CompressionHeader;
   vtkTypeInt64 CompressionHeaderPosition;
 
+  // Blocks waiting to be compressed concurrently.
+  vtkXMLWriterCompressionBlocks* PendingCompressionBlocks;
+
   // The output stream used to write binary and appended data.  May
   // transparently encode the data.
   vtkOutputStream* DataStream;
@@ -254,6 +259,8 @@ protected:
   void PerformByteSwap(void* data, size_t numWords, size_t wordSize);
   int CreateCompressionHeader(size_t size);
   int WriteCompressionBlock(unsigned char* data, size_t size);
+  int WritePendingCompressionBlocks();
+  int WriteCompressedBlock(vtkUnsignedCharArray* compressed);
   int WriteCompressionHeader();
   size_t GetWordTypeSize(int dataType);
   const char* GetWordTypeName(int dataType);
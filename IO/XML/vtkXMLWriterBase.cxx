@@ -42,6 +42,7 @@ vtkXMLWriterBase::vtkXMLWriterBase()
   , Compressor(vtkZLibDataCompressor::New())
   , BlockSize(32768) // 2^15
   , CompressionLevel(5)
+  , NumberOfCompressionThreads(0)
   , UsePreviousVersion(true)
 {
   this->SetNumberOfInputPorts(1);
@@ -270,4 +271,5 @@ void vtkXMLWriterBase::PrintSelf(ostream& os, vtkIndent indent)
   }
   os << indent << "EncodeAppendedData: " << this->EncodeAppendedData << "\n";
   os << indent << "BlockSize: " << this->BlockSize << "\n";
+  os << indent << "NumberOfCompressionThreads: " << this->NumberOfCompressionThreads << "\n";
 }
@@ -184,6 +184,19 @@ public:
   vtkGetMacro(BlockSize, size_t);
   ///@}
 
+  ///@{
+  /**
+   * Get/Set the number of threads compressing the blocks of binary and
+   * appended data concurrently. The blocks are compressed independently
+   * and written in order, so the file is identical whatever the number of
+   * threads. 0, the default, uses the number of threads of vtkSMPTools, and
+   * 1 compresses the blocks sequentially. The compressor must be thread
+   * safe, as are the compressors provided by VTK.
+   */
+  vtkSetClampMacro(NumberOfCompressionThreads, int, 0, VTK_INT_MAX);
+  vtkGetMacro(NumberOfCompressionThreads, int);
+  ///@}
+
   ///@{
   /**
    * Get/Set the data mode used for the file's data.  The options are
@@ -262,6 +275,9 @@ protected:
   // 1 (worst compression, fastest) ... 9 (best compression, slowest)
   int CompressionLevel;
 
+  // Number of threads compressing blocks, 0 for the vtkSMPTools default.
+  int NumberOfCompressionThreads;
+
   // This variable is used to ease transition to new versions of VTK XML files.
   // If data that needs to be written satisfies certain conditions,
   // the writer can use the previous file version version.
@@ -21,12 +21,14 @@
 #include "vtkEndian.h"
 #include "vtkInputStream.h"
 #include "vtkObjectFactory.h"
+#include "vtkSMPTools.h"
 #include "vtkXMLDataElement.h"
 #define vtkXMLDataHeaderPrivate_DoNotInclude
 #include "vtkXMLDataHeaderPrivate.h"
 #undef vtkXMLDataHeaderPrivate_DoNotInclude
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cctype>
 #include <memory>
@@ -757,6 +759,11 @@ size_t vtkXMLDataParser::ReadCompressedData(
     endOffset = totalSize;
   }
 
+  if (endOffset <= beginOffset)
+  {
+    return 0;
+  }
+
   // Find the range of compression blocks to read.
   vtkTypeUInt64 firstBlock = beginOffset / this->BlockUncompressedSize;
   vtkTypeUInt64 lastBlock = endOffset / this->BlockUncompressedSize;
@@ -767,85 +774,87 @@ size_t vtkXMLDataParser::ReadCompressedData(
   // Find the offset into the last block where the data end.
   size_t endBlockOffset = endOffset - lastBlock * this->BlockUncompressedSize;
 
+  // The last block is read only if the data end inside it.
+  vtkTypeUInt64 endBlock = lastBlock + (endBlockOffset > 0 ? 1 : 0);
+
+  // The compressed blocks are read sequentially, a window of a few blocks
+  // per thread at a time, and the blocks of a window are uncompressed
+  // concurrently. A block is uncompressed directly into the output, unless
+  // only a part of it is requested.
+  const size_t length = endOffset - beginOffset;
+  const vtkTypeUInt64 windowSize =
+    8 * static_cast<vtkTypeUInt64>(std::max(1, vtkSMPTools::GetEstimatedNumberOfThreads()));
+  std::vector<unsigned char> compressedData;
+  std::vector<size_t> compressedOffsets;
   this->UpdateProgress(0);
-  if (firstBlock == lastBlock)
-  {
-    // Everything fits in one block.
-    unsigned char* blockBuffer = this->ReadBlock(firstBlock);
-    if (!blockBuffer)
-    {
-      return 0;
-    }
-    size_t n = endBlockOffset - beginBlockOffset;
-    memcpy(data, blockBuffer + beginBlockOffset, n);
-    delete[] blockBuffer;
-
-    // Byte swap this block.  Note that n will always be an integer
-    // multiple of the word size.
-    this->PerformByteSwap(data, n / wordSize, wordSize);
-  }
-  else
+  for (vtkTypeUInt64 windowBegin = firstBlock; windowBegin < endBlock && !this->Abort;
+       windowBegin += windowSize)
   {
-    // Read all the complete blocks first.
-    size_t length = endOffset - beginOffset;
-    unsigned char* outputPointer = data;
-    size_t blockSize = this->FindBlockSize(firstBlock);
+    const vtkTypeUInt64 windowEnd = std::min(endBlock, windowBegin + windowSize);
 
-    // Read the first block.
-    unsigned char* blockBuffer = this->ReadBlock(firstBlock);
-    if (!blockBuffer)
+    // Read the compressed blocks of the window.
+    compressedOffsets.assign(1, 0);
+    for (vtkTypeUInt64 block = windowBegin; block < windowEnd; ++block)
     {
-      return 0;
+      compressedOffsets.push_back(compressedOffsets.back() + this->BlockCompressedSizes[block]);
     }
-    size_t n = blockSize - beginBlockOffset;
-    memcpy(outputPointer, blockBuffer + beginBlockOffset, n);
-    delete[] blockBuffer;
-
-    // Byte swap the first block.  Note that n will always be an
-    // integer multiple of the word size.
-    this->PerformByteSwap(outputPointer, n / wordSize, wordSize);
-
-    // Advance the pointer to the beginning of the second block.
-    outputPointer += blockSize - beginBlockOffset;
-
-    // Report progress.
-    this->UpdateProgress(float(outputPointer - data) / length);
-
-    unsigned int currentBlock = firstBlock + 1;
-    for (; currentBlock != lastBlock && !this->Abort; ++currentBlock)
+    compressedData.resize(compressedOffsets.back());
+    for (vtkTypeUInt64 block = windowBegin; block < windowEnd; ++block)
     {
-      // Read this block.
-      if (!this->ReadBlock(currentBlock, outputPointer))
+      size_t compressedSize = this->BlockCompressedSizes[block];
+      if (!this->DataStream->Seek(this->BlockStartOffsets[block]) ||
+        this->DataStream->Read(
+          compressedData.data() + compressedOffsets[block - windowBegin], compressedSize) <
+          compressedSize)
       {
         return 0;
       }
-
-      // Byte swap this block.  Note that blockSize will always be an
-      // integer multiple of the word size.
-      this->PerformByteSwap(outputPointer, blockSize / wordSize, wordSize);
-
-      // Advance the pointer to the beginning of the next block.
-      outputPointer += this->FindBlockSize(currentBlock);
-
-      // Report progress.
-      this->UpdateProgress(float(outputPointer - data) / length);
     }
 
-    // Now read the final block, which is incomplete if it exists.
-    if (endBlockOffset > 0 && !this->Abort)
+    // Uncompress and byte swap them.
+    std::atomic<bool> success(true);
+    vtkSMPTools::For(0, static_cast<vtkIdType>(windowEnd - windowBegin), 1,
+      [&](vtkIdType begin, vtkIdType end) {
+        std::vector<unsigned char> blockBuffer;
+        for (vtkIdType i = begin; i < end; ++i)
+        {
+          vtkTypeUInt64 block = windowBegin + i;
+          size_t blockSize = this->FindBlockSize(block);
+          size_t first = block == firstBlock ? beginBlockOffset : 0;
+          size_t last = block == lastBlock ? endBlockOffset : blockSize;
+          unsigned char* outputPointer =
+            data + (block * this->BlockUncompressedSize + first - beginOffset);
+          unsigned char* target = outputPointer;
+          if (first != 0 || last != blockSize)
+          {
+            blockBuffer.resize(blockSize);
+            target = blockBuffer.data();
+          }
+          if (!this->Compressor->Uncompress(compressedData.data() + compressedOffsets[i],
+                this->BlockCompressedSizes[block], target, blockSize))
+          {
+            success = false;
+            continue;
+          }
+          if (target != outputPointer)
+          {
+            memcpy(outputPointer, target + first, last - first);
+          }
+
+          // Note that the size will always be an integer multiple of the
+          // word size.
+          this->PerformByteSwap(outputPointer, (last - first) / wordSize, wordSize);
+        }
+      });
+    if (!success)
     {
-      blockBuffer = this->ReadBlock(lastBlock);
-      if (!blockBuffer)
-      {
-        return 0;
-      }
-      memcpy(outputPointer, blockBuffer, endBlockOffset);
-      delete[] blockBuffer;
-
-      // Byte swap the partial block.  Note that endBlockOffset will
-      // always be an integer multiple of the word size.
-      this->PerformByteSwap(outputPointer, endBlockOffset / wordSize, wordSize);
+      return 0;
     }
+
+    // Report progress.
+    const vtkTypeUInt64 done = std::min<vtkTypeUInt64>(
+      endOffset, windowEnd * this->BlockUncompressedSize);
+    this->UpdateProgress(float(done - beginOffset) / length);
   }
   this->UpdateProgress(1);
 